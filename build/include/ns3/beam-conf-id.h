@@ -0,0 +1 @@
+#include "/root/repo/src/nr/model/beam-conf-id.h"
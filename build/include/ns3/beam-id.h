@@ -0,0 +1 @@
+#include "/root/repo/src/nr/model/beam-id.h"
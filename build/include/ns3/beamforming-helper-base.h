@@ -0,0 +1 @@
+#include "/root/repo/src/nr/helper/beamforming-helper-base.h"
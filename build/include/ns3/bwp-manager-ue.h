@@ -0,0 +1 @@
+#include "/root/repo/src/nr/model/bwp-manager-ue.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/nr/helper/cc-bwp-helper.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/spectrum/model/constant-spectrum-propagation-loss.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/config-store/model/file-config.h"
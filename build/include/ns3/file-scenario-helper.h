@@ -0,0 +1 @@
+#include "/root/repo/src/nr/helper/file-scenario-helper.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/nr/utils/file-transfer-helper.h"
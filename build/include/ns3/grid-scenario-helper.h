@@ -0,0 +1 @@
+#include "/root/repo/src/nr/helper/grid-scenario-helper.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/nr/helper/hexagonal-grid-scenario-helper.h"
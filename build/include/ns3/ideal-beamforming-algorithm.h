@@ -0,0 +1 @@
+#include "/root/repo/src/nr/model/ideal-beamforming-algorithm.h"
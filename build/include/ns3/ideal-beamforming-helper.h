@@ -0,0 +1 @@
+#include "/root/repo/src/nr/helper/ideal-beamforming-helper.h"
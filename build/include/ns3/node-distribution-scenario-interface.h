@@ -0,0 +1 @@
+#include "/root/repo/src/nr/helper/node-distribution-scenario-interface.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/nr/model/nr-eesm-cc-t1.h"
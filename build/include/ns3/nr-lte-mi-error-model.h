@@ -0,0 +1 @@
+#include "/root/repo/src/nr/model/nr-lte-mi-error-model.h"
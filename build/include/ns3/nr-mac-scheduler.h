@@ -0,0 +1 @@
+#include "/root/repo/src/nr/model/nr-mac-scheduler.h"
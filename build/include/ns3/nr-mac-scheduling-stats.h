@@ -0,0 +1 @@
+#include "/root/repo/src/nr/helper/nr-mac-scheduling-stats.h"
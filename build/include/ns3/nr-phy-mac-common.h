@@ -0,0 +1 @@
+#include "/root/repo/src/nr/model/nr-phy-mac-common.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/nr/helper/nr-phy-rx-trace.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/nr/helper/nr-point-to-point-epc-helper.h"
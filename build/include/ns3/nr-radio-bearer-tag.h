@@ -0,0 +1 @@
+#include "/root/repo/src/nr/model/nr-radio-bearer-tag.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/nr/helper/nr-radio-environment-map-helper.h"
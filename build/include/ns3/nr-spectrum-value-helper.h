@@ -0,0 +1 @@
+#include "/root/repo/src/nr/helper/nr-spectrum-value-helper.h"
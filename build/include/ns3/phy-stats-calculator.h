@@ -0,0 +1 @@
+#include "/root/repo/src/lte/helper/phy-stats-calculator.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/nr/model/realistic-beamforming-algorithm.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/nr/helper/realistic-beamforming-helper.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/nr/utils/three-gpp-channel-model-param.h"
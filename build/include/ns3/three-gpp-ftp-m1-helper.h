@@ -0,0 +1 @@
+#include "/root/repo/src/nr/helper/three-gpp-ftp-m1-helper.h"
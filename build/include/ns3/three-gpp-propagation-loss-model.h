@@ -0,0 +1 @@
+#include "/root/repo/src/propagation/model/three-gpp-propagation-loss-model.h"
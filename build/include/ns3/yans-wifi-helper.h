@@ -0,0 +1 @@
+#include "/root/repo/src/wifi/helper/yans-wifi-helper.h"
@@ -35,6 +35,11 @@ PYBIND11_MODULE(ns3ai_apb_py_stru, m)
 
     py::class_<ActStruct>(m, "PyActStruct").def(py::init<>()).def_readwrite("c", &ActStruct::act_c);
 
+    py::enum_<Ns3AiSyncMode>(m, "Ns3AiSyncMode", py::module_local())
+        .value("SYNC_MODE_SPIN", SYNC_MODE_SPIN)
+        .value("SYNC_MODE_ADAPTIVE", SYNC_MODE_ADAPTIVE);
+    m.attr("NS3_AI_DEFAULT_SPIN_COUNT") = NS3_AI_DEFAULT_SPIN_COUNT;
+
     py::class_<ns3::Ns3AiMsgInterfaceImpl<EnvStruct, ActStruct>>(m, "Ns3AiMsgInterfaceImpl")
         .def(py::init<bool,
                       bool,
@@ -44,15 +49,34 @@ PYBIND11_MODULE(ns3ai_apb_py_stru, m)
                       const char*,
                       const char*,
                       const char*>())
+        .def("SetSyncMode",
+             &ns3::Ns3AiMsgInterfaceImpl<EnvStruct, ActStruct>::SetSyncMode,
+             py::arg("mode"),
+             py::arg("spinCount") = NS3_AI_DEFAULT_SPIN_COUNT)
         .def("PyRecvBegin", &ns3::Ns3AiMsgInterfaceImpl<EnvStruct, ActStruct>::PyRecvBegin)
         .def("PyRecvEnd", &ns3::Ns3AiMsgInterfaceImpl<EnvStruct, ActStruct>::PyRecvEnd)
         .def("PySendBegin", &ns3::Ns3AiMsgInterfaceImpl<EnvStruct, ActStruct>::PySendBegin)
         .def("PySendEnd", &ns3::Ns3AiMsgInterfaceImpl<EnvStruct, ActStruct>::PySendEnd)
+        .def("PyTrySendBegin",
+             &ns3::Ns3AiMsgInterfaceImpl<EnvStruct, ActStruct>::PyTrySendBegin)
         .def("PyGetFinished", &ns3::Ns3AiMsgInterfaceImpl<EnvStruct, ActStruct>::PyGetFinished)
         .def("GetCpp2PyStruct",
              &ns3::Ns3AiMsgInterfaceImpl<EnvStruct, ActStruct>::GetCpp2PyStruct,
              py::return_value_policy::reference)
         .def("GetPy2CppStruct",
              &ns3::Ns3AiMsgInterfaceImpl<EnvStruct, ActStruct>::GetPy2CppStruct,
-             py::return_value_policy::reference);
+             py::return_value_policy::reference)
+        .def("CreateCpp2PyRing",
+             &ns3::Ns3AiMsgInterfaceImpl<EnvStruct, ActStruct>::CreateCpp2PyRing)
+        .def("GetCpp2PyRingSize",
+             &ns3::Ns3AiMsgInterfaceImpl<EnvStruct, ActStruct>::GetCpp2PyRingSize)
+        .def("PyRingRecvBegin",
+             &ns3::Ns3AiMsgInterfaceImpl<EnvStruct, ActStruct>::PyRingRecvBegin,
+             py::arg("maxCount") = 0)
+        .def("PyRingRecvEnd", &ns3::Ns3AiMsgInterfaceImpl<EnvStruct, ActStruct>::PyRingRecvEnd)
+        .def("GetCpp2PyRingStruct",
+             &ns3::Ns3AiMsgInterfaceImpl<EnvStruct, ActStruct>::GetCpp2PyRingStruct,
+             py::return_value_policy::reference)
+        .def("GetCpp2PyRingSeq",
+             &ns3::Ns3AiMsgInterfaceImpl<EnvStruct, ActStruct>::GetCpp2PyRingSeq);
 }
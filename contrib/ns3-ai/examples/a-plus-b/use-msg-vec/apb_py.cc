@@ -80,6 +80,11 @@ PYBIND11_MODULE(ns3ai_apb_py_vec, m)
             },
             py::return_value_policy::reference);
 
+    py::enum_<Ns3AiSyncMode>(m, "Ns3AiSyncMode", py::module_local())
+        .value("SYNC_MODE_SPIN", SYNC_MODE_SPIN)
+        .value("SYNC_MODE_ADAPTIVE", SYNC_MODE_ADAPTIVE);
+    m.attr("NS3_AI_DEFAULT_SPIN_COUNT") = NS3_AI_DEFAULT_SPIN_COUNT;
+
     py::class_<ns3::Ns3AiMsgInterfaceImpl<EnvStruct, ActStruct>>(m, "Ns3AiMsgInterfaceImpl")
         .def(py::init<bool,
                       bool,
@@ -89,6 +94,10 @@ PYBIND11_MODULE(ns3ai_apb_py_vec, m)
                       const char*,
                       const char*,
                       const char*>())
+        .def("SetSyncMode",
+             &ns3::Ns3AiMsgInterfaceImpl<EnvStruct, ActStruct>::SetSyncMode,
+             py::arg("mode"),
+             py::arg("spinCount") = NS3_AI_DEFAULT_SPIN_COUNT)
         .def("PyRecvBegin", &ns3::Ns3AiMsgInterfaceImpl<EnvStruct, ActStruct>::PyRecvBegin)
         .def("PyRecvEnd", &ns3::Ns3AiMsgInterfaceImpl<EnvStruct, ActStruct>::PyRecvEnd)
         .def("PySendBegin", &ns3::Ns3AiMsgInterfaceImpl<EnvStruct, ActStruct>::PySendBegin)
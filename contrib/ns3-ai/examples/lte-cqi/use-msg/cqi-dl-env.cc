@@ -38,6 +38,7 @@ CQIDL::CQIDL()
     interface->SetIsMemoryCreator(false);
     interface->SetUseVector(false);
     interface->SetHandleFinish(true);
+    m_useRing = interface->GetInterface<CqiFeature, CqiPredicted>()->GetCpp2PyRingSize() > 0;
 }
 
 CQIDL::~CQIDL()
@@ -62,6 +63,13 @@ CQIDL::SetWbCQI(uint8_t cqi)
 {
     Ns3AiMsgInterfaceImpl<CqiFeature, CqiPredicted>* msgInterface =
         Ns3AiMsgInterface::Get()->GetInterface<CqiFeature, CqiPredicted>();
+    if (m_useRing)
+    {
+        m_lastCqi = cqi;
+        msgInterface->CppRingSendBegin()->wbCqi = cqi;
+        msgInterface->CppRingSendEnd();
+        return;
+    }
     msgInterface->CppSendBegin();
     msgInterface->GetCpp2PyStruct()->wbCqi = cqi;
     msgInterface->CppSendEnd();
@@ -70,6 +78,10 @@ CQIDL::SetWbCQI(uint8_t cqi)
 /**
  * \brief Get the predictive value of wbcqi.
  *
+ * When the reports are streamed through the ring, it does not wait for
+ * python: it returns the latest prediction received, or the last reported
+ * wbcqi if python has not sent any prediction yet.
+ *
  * \returns the predictive value of wbcqi
  */
 uint8_t
@@ -77,6 +89,16 @@ CQIDL::GetWbCQI()
 {
     Ns3AiMsgInterfaceImpl<CqiFeature, CqiPredicted>* msgInterface =
         Ns3AiMsgInterface::Get()->GetInterface<CqiFeature, CqiPredicted>();
+    if (m_useRing)
+    {
+        if (msgInterface->CppTryRecvBegin())
+        {
+            m_prediction = msgInterface->GetPy2CppStruct()->new_wbCqi;
+            m_hasPrediction = true;
+            msgInterface->CppRecvEnd();
+        }
+        return m_hasPrediction ? m_prediction : m_lastCqi;
+    }
     msgInterface->CppRecvBegin();
     uint8_t ret = msgInterface->GetPy2CppStruct()->new_wbCqi;
     msgInterface->CppRecvEnd();
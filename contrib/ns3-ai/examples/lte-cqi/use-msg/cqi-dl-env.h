@@ -62,6 +62,10 @@ struct CqiPredicted
  * It set data through member function 'Set[xxx]()',
  * and put them into the shared memory, using python to calculate,
  * and got prediction through member function 'Get[xxx]()'.
+ *
+ * If python created the C++ to python ring, the CQI reports are streamed
+ * through the ring and the scheduler uses the latest prediction received,
+ * so the simulation does not wait for python at each report.
  */
 class CQIDL : public Object
 {
@@ -72,6 +76,12 @@ class CQIDL : public Object
 
     void SetWbCQI(uint8_t cqi);
     uint8_t GetWbCQI();
+
+  private:
+    bool m_useRing;              ///< whether the reports are streamed through the ring
+    uint8_t m_lastCqi{0};        ///< the last reported wbcqi
+    uint8_t m_prediction{0};     ///< the last prediction received through the ring
+    bool m_hasPrediction{false}; ///< whether a prediction was received through the ring
 };
 
 } // namespace ns3
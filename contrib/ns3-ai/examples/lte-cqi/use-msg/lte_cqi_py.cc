@@ -35,6 +35,11 @@ PYBIND11_MODULE(ns3ai_ltecqi_py, m)
         .def(py::init<>())
         .def_readwrite("new_wbCqi", &ns3::CqiPredicted::new_wbCqi);
 
+    py::enum_<Ns3AiSyncMode>(m, "Ns3AiSyncMode", py::module_local())
+        .value("SYNC_MODE_SPIN", SYNC_MODE_SPIN)
+        .value("SYNC_MODE_ADAPTIVE", SYNC_MODE_ADAPTIVE);
+    m.attr("NS3_AI_DEFAULT_SPIN_COUNT") = NS3_AI_DEFAULT_SPIN_COUNT;
+
     py::class_<ns3::Ns3AiMsgInterfaceImpl<ns3::CqiFeature, ns3::CqiPredicted>>(
         m,
         "Ns3AiMsgInterfaceImpl")
@@ -46,6 +51,10 @@ PYBIND11_MODULE(ns3ai_ltecqi_py, m)
                       const char*,
                       const char*,
                       const char*>())
+        .def("SetSyncMode",
+             &ns3::Ns3AiMsgInterfaceImpl<ns3::CqiFeature, ns3::CqiPredicted>::SetSyncMode,
+             py::arg("mode"),
+             py::arg("spinCount") = NS3_AI_DEFAULT_SPIN_COUNT)
         .def("PyRecvBegin",
              &ns3::Ns3AiMsgInterfaceImpl<ns3::CqiFeature, ns3::CqiPredicted>::PyRecvBegin)
         .def("PyRecvEnd",
@@ -54,6 +63,8 @@ PYBIND11_MODULE(ns3ai_ltecqi_py, m)
              &ns3::Ns3AiMsgInterfaceImpl<ns3::CqiFeature, ns3::CqiPredicted>::PySendBegin)
         .def("PySendEnd",
              &ns3::Ns3AiMsgInterfaceImpl<ns3::CqiFeature, ns3::CqiPredicted>::PySendEnd)
+        .def("PyTrySendBegin",
+             &ns3::Ns3AiMsgInterfaceImpl<ns3::CqiFeature, ns3::CqiPredicted>::PyTrySendBegin)
         .def("PyGetFinished",
              &ns3::Ns3AiMsgInterfaceImpl<ns3::CqiFeature, ns3::CqiPredicted>::PyGetFinished)
         .def("GetCpp2PyStruct",
@@ -61,5 +72,19 @@ PYBIND11_MODULE(ns3ai_ltecqi_py, m)
              py::return_value_policy::reference)
         .def("GetPy2CppStruct",
              &ns3::Ns3AiMsgInterfaceImpl<ns3::CqiFeature, ns3::CqiPredicted>::GetPy2CppStruct,
-             py::return_value_policy::reference);
+             py::return_value_policy::reference)
+        .def("CreateCpp2PyRing",
+             &ns3::Ns3AiMsgInterfaceImpl<ns3::CqiFeature, ns3::CqiPredicted>::CreateCpp2PyRing)
+        .def("GetCpp2PyRingSize",
+             &ns3::Ns3AiMsgInterfaceImpl<ns3::CqiFeature, ns3::CqiPredicted>::GetCpp2PyRingSize)
+        .def("PyRingRecvBegin",
+             &ns3::Ns3AiMsgInterfaceImpl<ns3::CqiFeature, ns3::CqiPredicted>::PyRingRecvBegin,
+             py::arg("maxCount") = 0)
+        .def("PyRingRecvEnd",
+             &ns3::Ns3AiMsgInterfaceImpl<ns3::CqiFeature, ns3::CqiPredicted>::PyRingRecvEnd)
+        .def("GetCpp2PyRingStruct",
+             &ns3::Ns3AiMsgInterfaceImpl<ns3::CqiFeature, ns3::CqiPredicted>::GetCpp2PyRingStruct,
+             py::return_value_policy::reference)
+        .def("GetCpp2PyRingSeq",
+             &ns3::Ns3AiMsgInterfaceImpl<ns3::CqiFeature, ns3::CqiPredicted>::GetCpp2PyRingSeq);
 }
@@ -92,94 +92,122 @@ is_train = True
 CQI = 0
 delay_queue = []
 
-exp = Experiment("ns3ai_ltecqi_msg", "../../../../../", py_binding, handleFinish=True)
+
+def process_cqi(CQI):
+    """Feed one CQI report to the online LSTM and return the CQI sent back to ns-3."""
+    delay_queue.append(CQI)
+    if len(delay_queue) < delta:
+        CQI = delay_queue[-1]
+    else:
+        CQI = delay_queue[-delta]
+    if not_train:
+        return CQI
+    cqi_queue.append(CQI)
+    if len(cqi_queue) >= input_len + delta:
+        target.append(CQI)
+    if len(cqi_queue) >= input_len:
+        one_data = cqi_queue[-input_len:]
+        train_data.append(one_data)
+    else:
+        old_print("set: %d" % CQI)
+        return CQI
+
+    data_to_pred = np.array(one_data).reshape(-1, input_len, 1) / 10
+    _predict_cqi = lstm_model_mse.predict(data_to_pred)
+    old_print(_predict_cqi)
+    del data_to_pred
+    prediction.append(int(_predict_cqi[0, 0] + 0.49995))
+    last.append(one_data[-1])
+    corrected_predict.append(int(_predict_cqi[0, 0] + 0.49995))
+    del one_data
+    if len(train_data) >= pred_len + delta:
+        err_t = weighted_MSE(
+            np.array(last[(-pred_len - delta):-delta]),
+            np.array(target[-pred_len:]))
+        err_p = weighted_MSE(
+            np.array(prediction[(-pred_len - delta):-delta]),
+            np.array(target[-pred_len:]))
+        if err_p <= err_t * alpha:
+            if err_t < 1e-6:
+                corrected_predict[-1] = last[-1]
+            print(" ")
+            print("OK %d %f %f" % ((len(cqi_queue)), err_t, err_p))
+            right.append(1)
+            pass
+        else:
+            corrected_predict[-1] = last[-1]
+            if err_t <= 1e-6:
+                print("set: %d" % CQI)
+                return CQI
+            else:
+                print("train %d" % (len(cqi_queue)))
+                right.append(0)
+
+                lstm_model_mse.fit(x=np.array(
+                    train_data[-delta - batch_size:-delta]).reshape(
+                    batch_size, input_len, 1) / 10,
+                                   y=np.array(target[-batch_size:]),
+                                   batch_size=batch_size,
+                                   epochs=1,
+                                   verbose=0)
+    else:
+        corrected_predict[-1] = last[-1]
+    # sm.Set(corrected_predict[-1])
+    print("set: %d" % corrected_predict[-1])
+    return CQI
+
+
+# with --ring, ns-3 streams the CQI reports through a multi-slot ring and
+# does not wait for each prediction: it uses the latest one it received
+use_ring = len(sys.argv) > 2 and sys.argv[2] == "--ring"
+
+exp = Experiment("ns3ai_ltecqi_msg", "../../../../../", py_binding, handleFinish=True,
+                 shmSize=65536 if use_ring else 4096,
+                 ringSlots=64 if use_ring else None)
 msgInterface = exp.run(show_output=True)
 
 try:
-    while True:
-        msgInterface.PyRecvBegin()
-        if msgInterface.PyGetFinished():
-            break
-        gc.collect()
-        # Get CQI
-        CQI = msgInterface.GetCpp2PyStruct().wbCqi
-        msgInterface.PyRecvEnd()
-
-        if CQI > 15:
-            break
-        old_print("get: %d" % CQI)
-        # CQI = next(get_CQI)
-        delay_queue.append(CQI)
-        if len(delay_queue) < delta:
-            CQI = delay_queue[-1]
-        else:
-            CQI = delay_queue[-delta]
-        if not_train:
+    if use_ring:
+        reply = None
+        stop = False
+        while not stop:
+            # get every report streamed since the last batch
+            n = msgInterface.PyRingRecvBegin()
+            reports = [msgInterface.GetCpp2PyRingStruct(i).wbCqi for i in range(n)]
+            msgInterface.PyRingRecvEnd()
+            if msgInterface.PyGetFinished():
+                break
+            gc.collect()
+            for CQI in reports:
+                if CQI > 15:
+                    stop = True
+                    break
+                old_print("get: %d" % CQI)
+                reply = process_cqi(CQI)
+            # only the latest prediction is useful, and ns-3 may not have
+            # taken the previous one yet: do not wait for it
+            if reply is not None and msgInterface.PyTrySendBegin():
+                msgInterface.GetPy2CppStruct().new_wbCqi = reply
+                msgInterface.PySendEnd()
+                reply = None
+    else:
+        while True:
+            msgInterface.PyRecvBegin()
+            if msgInterface.PyGetFinished():
+                break
+            gc.collect()
+            # Get CQI
+            CQI = msgInterface.GetCpp2PyStruct().wbCqi
+            msgInterface.PyRecvEnd()
+
+            if CQI > 15:
+                break
+            old_print("get: %d" % CQI)
+            # CQI = next(get_CQI)
+            reply = process_cqi(CQI)
             msgInterface.PySendBegin()
-            msgInterface.GetPy2CppStruct().new_wbCqi = CQI
+            msgInterface.GetPy2CppStruct().new_wbCqi = reply
             msgInterface.PySendEnd()
-            continue
-        cqi_queue.append(CQI)
-        if len(cqi_queue) >= input_len + delta:
-            target.append(CQI)
-        if len(cqi_queue) >= input_len:
-            one_data = cqi_queue[-input_len:]
-            train_data.append(one_data)
-        else:
-            msgInterface.PySendBegin()
-            msgInterface.GetPy2CppStruct().new_wbCqi = CQI
-            msgInterface.PySendEnd()
-            old_print("set: %d" % CQI)
-            continue
-
-        data_to_pred = np.array(one_data).reshape(-1, input_len, 1) / 10
-        _predict_cqi = lstm_model_mse.predict(data_to_pred)
-        old_print(_predict_cqi)
-        del data_to_pred
-        prediction.append(int(_predict_cqi[0, 0] + 0.49995))
-        last.append(one_data[-1])
-        corrected_predict.append(int(_predict_cqi[0, 0] + 0.49995))
-        del one_data
-        if len(train_data) >= pred_len + delta:
-            err_t = weighted_MSE(
-                np.array(last[(-pred_len - delta):-delta]),
-                np.array(target[-pred_len:]))
-            err_p = weighted_MSE(
-                np.array(prediction[(-pred_len - delta):-delta]),
-                np.array(target[-pred_len:]))
-            if err_p <= err_t * alpha:
-                if err_t < 1e-6:
-                    corrected_predict[-1] = last[-1]
-                print(" ")
-                print("OK %d %f %f" % ((len(cqi_queue)), err_t, err_p))
-                right.append(1)
-                pass
-            else:
-                corrected_predict[-1] = last[-1]
-                if err_t <= 1e-6:
-                    msgInterface.PySendBegin()
-                    msgInterface.GetPy2CppStruct().new_wbCqi = CQI
-                    msgInterface.PySendEnd()
-                    print("set: %d" % CQI)
-                    continue
-                else:
-                    print("train %d" % (len(cqi_queue)))
-                    right.append(0)
-
-                    lstm_model_mse.fit(x=np.array(
-                        train_data[-delta - batch_size:-delta]).reshape(
-                        batch_size, input_len, 1) / 10,
-                                       y=np.array(target[-batch_size:]),
-                                       batch_size=batch_size,
-                                       epochs=1,
-                                       verbose=0)
-        else:
-            corrected_predict[-1] = last[-1]
-        # sm.Set(corrected_predict[-1])
-        msgInterface.PySendBegin()
-        msgInterface.GetPy2CppStruct().new_wbCqi = CQI
-        msgInterface.PySendEnd()
-        print("set: %d" % corrected_predict[-1])
 
 except Exception as e:
     exc_type, exc_value, exc_traceback = sys.exc_info()
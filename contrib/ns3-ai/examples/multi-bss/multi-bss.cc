@@ -937,11 +937,13 @@ MeasureIntervalThroughputHolDelay()
         CreateObject<TgaxResidentialPropagationLossModel>();
     GetRxPower(propModel);
 
-    msgInterface->CppSendBegin();
+    // stream one message per node through the ring, so that Python side
+    // starts processing the first nodes while the next ones are written
     for (size_t i = 0; i < wifiNodes.GetN(); i++)
     {
         uint32_t txNodeId = wifiNodes.Get(i)->GetId();
-        auto& env_struct = msgInterface->GetCpp2PyVector()->at(txNodeId);
+        auto& env_struct = *msgInterface->CppRingSendBegin();
+        env_struct = Env{}; // the slot holds a message of another node
         env_struct.txNode = txNodeId;
         env_struct.mcs = nodeMcs[txNodeId];
         env_struct.holDelay = std::get<0>(nodeDelays[txNodeId]);
@@ -969,11 +971,11 @@ MeasureIntervalThroughputHolDelay()
                 env_struct.rxPower[rxNodePower.first / N_BSS] = rxNodePower.second;
             }
         }
+        msgInterface->CppRingSendEnd();
     }
-    msgInterface->CppSendEnd();
 
     msgInterface->CppRecvBegin();
-    double nextCca = msgInterface->GetPy2CppVector()->at(0).newCcaSensitivity;
+    double nextCca = msgInterface->GetPy2CppStruct()->newCcaSensitivity;
     msgInterface->CppRecvEnd();
 
     std::cout << "At " << Simulator::Now().GetMilliSeconds() << "ms:" << std::endl;
@@ -1753,7 +1755,7 @@ main(int argc, char* argv[])
 {
     auto interface = Ns3AiMsgInterface::Get();
     interface->SetIsMemoryCreator(false);
-    interface->SetUseVector(true);
+    interface->SetUseVector(false);
     interface->SetHandleFinish(true);
     duration = 100;    ///< duration (in seconds)
     bool pcap = false; ///< Flag to enable/disable PCAP files generation
@@ -23,13 +23,9 @@
 
 #include <iostream>
 #include <pybind11/pybind11.h>
-#include <pybind11/stl_bind.h>
 
 namespace py = pybind11;
 
-PYBIND11_MAKE_OPAQUE(ns3::Ns3AiMsgInterfaceImpl<Env, Act>::Cpp2PyMsgVector);
-PYBIND11_MAKE_OPAQUE(ns3::Ns3AiMsgInterfaceImpl<Env, Act>::Py2CppMsgVector);
-
 PYBIND11_MODULE(ns3ai_multibss_py, m)
 {
     py::class_<std::array<double, 5>>(m, "RxPowerArray")
@@ -58,43 +54,10 @@ PYBIND11_MODULE(ns3ai_multibss_py, m)
         .def(py::init<>())
         .def_readwrite("newCcaSensitivity", &Act::newCcaSensitivity);
 
-    py::class_<ns3::Ns3AiMsgInterfaceImpl<Env, Act>::Cpp2PyMsgVector>(m, "PyEnvVector")
-        .def("resize",
-             static_cast<void (ns3::Ns3AiMsgInterfaceImpl<Env, Act>::Cpp2PyMsgVector::*)(
-                 ns3::Ns3AiMsgInterfaceImpl<Env, Act>::Cpp2PyMsgVector::size_type)>(
-                 &ns3::Ns3AiMsgInterfaceImpl<Env, Act>::Cpp2PyMsgVector::resize))
-        .def("__len__", &ns3::Ns3AiMsgInterfaceImpl<Env, Act>::Cpp2PyMsgVector::size)
-        .def(
-            "__getitem__",
-            [](ns3::Ns3AiMsgInterfaceImpl<Env, Act>::Cpp2PyMsgVector& vec, uint32_t i) -> Env& {
-                if (i >= vec.size())
-                {
-                    std::cerr << "Invalid index " << i << " for vector, whose size is "
-                              << vec.size() << std::endl;
-                    exit(1);
-                }
-                return vec.at(i);
-            },
-            py::return_value_policy::reference);
-
-    py::class_<ns3::Ns3AiMsgInterfaceImpl<Env, Act>::Py2CppMsgVector>(m, "PyActVector")
-        .def("resize",
-             static_cast<void (ns3::Ns3AiMsgInterfaceImpl<Env, Act>::Py2CppMsgVector::*)(
-                 ns3::Ns3AiMsgInterfaceImpl<Env, Act>::Py2CppMsgVector::size_type)>(
-                 &ns3::Ns3AiMsgInterfaceImpl<Env, Act>::Py2CppMsgVector::resize))
-        .def("__len__", &ns3::Ns3AiMsgInterfaceImpl<Env, Act>::Py2CppMsgVector::size)
-        .def(
-            "__getitem__",
-            [](ns3::Ns3AiMsgInterfaceImpl<Env, Act>::Py2CppMsgVector& vec, uint32_t i) -> Act& {
-                if (i >= vec.size())
-                {
-                    std::cerr << "Invalid index " << i << " for vector, whose size is "
-                              << vec.size() << std::endl;
-                    exit(1);
-                }
-                return vec.at(i);
-            },
-            py::return_value_policy::reference);
+    py::enum_<Ns3AiSyncMode>(m, "Ns3AiSyncMode", py::module_local())
+        .value("SYNC_MODE_SPIN", SYNC_MODE_SPIN)
+        .value("SYNC_MODE_ADAPTIVE", SYNC_MODE_ADAPTIVE);
+    m.attr("NS3_AI_DEFAULT_SPIN_COUNT") = NS3_AI_DEFAULT_SPIN_COUNT;
 
     py::class_<ns3::Ns3AiMsgInterfaceImpl<Env, Act>>(m, "Ns3AiMsgInterfaceImpl")
         .def(py::init<bool,
@@ -105,15 +68,29 @@ PYBIND11_MODULE(ns3ai_multibss_py, m)
                       const char*,
                       const char*,
                       const char*>())
+        .def("SetSyncMode",
+             &ns3::Ns3AiMsgInterfaceImpl<Env, Act>::SetSyncMode,
+             py::arg("mode"),
+             py::arg("spinCount") = NS3_AI_DEFAULT_SPIN_COUNT)
         .def("PyRecvBegin", &ns3::Ns3AiMsgInterfaceImpl<Env, Act>::PyRecvBegin)
         .def("PyRecvEnd", &ns3::Ns3AiMsgInterfaceImpl<Env, Act>::PyRecvEnd)
         .def("PySendBegin", &ns3::Ns3AiMsgInterfaceImpl<Env, Act>::PySendBegin)
         .def("PySendEnd", &ns3::Ns3AiMsgInterfaceImpl<Env, Act>::PySendEnd)
         .def("PyGetFinished", &ns3::Ns3AiMsgInterfaceImpl<Env, Act>::PyGetFinished)
-        .def("GetCpp2PyVector",
-             &ns3::Ns3AiMsgInterfaceImpl<Env, Act>::GetCpp2PyVector,
+        .def("GetCpp2PyStruct",
+             &ns3::Ns3AiMsgInterfaceImpl<Env, Act>::GetCpp2PyStruct,
+             py::return_value_policy::reference)
+        .def("GetPy2CppStruct",
+             &ns3::Ns3AiMsgInterfaceImpl<Env, Act>::GetPy2CppStruct,
+             py::return_value_policy::reference)
+        .def("CreateCpp2PyRing", &ns3::Ns3AiMsgInterfaceImpl<Env, Act>::CreateCpp2PyRing)
+        .def("GetCpp2PyRingSize", &ns3::Ns3AiMsgInterfaceImpl<Env, Act>::GetCpp2PyRingSize)
+        .def("PyRingRecvBegin",
+             &ns3::Ns3AiMsgInterfaceImpl<Env, Act>::PyRingRecvBegin,
+             py::arg("maxCount") = 0)
+        .def("PyRingRecvEnd", &ns3::Ns3AiMsgInterfaceImpl<Env, Act>::PyRingRecvEnd)
+        .def("GetCpp2PyRingStruct",
+             &ns3::Ns3AiMsgInterfaceImpl<Env, Act>::GetCpp2PyRingStruct,
              py::return_value_policy::reference)
-        .def("GetPy2CppVector",
-             &ns3::Ns3AiMsgInterfaceImpl<Env, Act>::GetPy2CppVector,
-             py::return_value_policy::reference);
+        .def("GetCpp2PyRingSeq", &ns3::Ns3AiMsgInterfaceImpl<Env, Act>::GetCpp2PyRingSeq);
 }
@@ -205,32 +205,36 @@ vr_constrant = 5
 vrtpt_cons = 14.7
 eta = 1
 
+# C++ side streams one message per node through the ring at each step
 exp = Experiment("ns3ai_multibss", "../../../../", py_binding,
-                 handleFinish=True, useVector=True, vectorSize=n_total)
+                 handleFinish=True, shmSize=65536, ringSlots=n_total)
 msgInterface = exp.run(setting=ns3Settings, show_output=True)
 
 try:
     while True:
-        # Get current state from C++
-        msgInterface.PyRecvBegin()
+        # Get current state from C++, processing the nodes as they arrive
+        throughput = 0
+        received = 0
+        while received < n_total and not msgInterface.PyGetFinished():
+            n = msgInterface.PyRingRecvBegin(n_total - received)
+            for i in range(n):
+                env = msgInterface.GetCpp2PyRingStruct(i)
+                txNode = env.txNode
+                # print("processing i {} txNode {}".format(i, txNode))
+                for j in range(n_sta+1):
+                    state[j, txNode] = env.rxPower[j]
+                if txNode % n_ap == 0:  # record mcs in BSS-0
+                    state[int(txNode/n_ap)][-1] = env.mcs
+                if txNode == n_ap:     # record delay and tpt of the VR node
+                    vrDelay = env.holDelay
+                    vrThroughput = env.throughput
+                # Sum all nodes' throughput
+                throughput += env.throughput
+            msgInterface.PyRingRecvEnd()
+            received += n
         if msgInterface.PyGetFinished():
             print("Finished")
             break
-        throughput = 0
-        for i in range(n_total):
-            txNode = msgInterface.GetCpp2PyVector()[i].txNode
-            # print("processing i {} txNode {}".format(i, txNode))
-            for j in range(n_sta+1):
-                state[j, txNode] = msgInterface.GetCpp2PyVector()[i].rxPower[j]
-            # state[:, txNode] = msgInterface.GetCpp2PyVector()[i].rxPower
-            if txNode % n_ap == 0:  # record mcs in BSS-0
-                state[int(txNode/n_ap)][-1] = msgInterface.GetCpp2PyVector()[i].mcs
-            if txNode == n_ap:     # record delay and tpt of the VR node
-                vrDelay = msgInterface.GetCpp2PyVector()[i].holDelay
-                vrThroughput = msgInterface.GetCpp2PyVector()[i].throughput
-            # Sum all nodes' throughput
-            throughput += msgInterface.GetCpp2PyVector()[i].throughput
-        msgInterface.PyRecvEnd()
 
         print("step = {}, VR avg delay = {} ms, VR UL tpt = {} Mbps, total UL tpt = {} Mbps".format(
             times, vrDelay, vrThroughput, throughput
@@ -257,9 +261,9 @@ try:
 
         # put the action back to C++
         msgInterface.PySendBegin()
-        msgInterface.GetPy2CppVector()[0].newCcaSensitivity = -82 + action
+        msgInterface.GetPy2CppStruct().newCcaSensitivity = -82 + action
         msgInterface.PySendEnd()
-        print("new CCA: {}".format(msgInterface.GetPy2CppVector()[0].newCcaSensitivity))
+        print("new CCA: {}".format(msgInterface.GetPy2CppStruct().newCcaSensitivity))
         times += 1
 
 except Exception as e:
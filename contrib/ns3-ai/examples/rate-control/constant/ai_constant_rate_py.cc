@@ -38,6 +38,11 @@ PYBIND11_MODULE(ns3ai_ratecontrol_constant_py, m)
         .def_readwrite("nss", &ns3::AiConstantRateActStruct::nss)
         .def_readwrite("next_mcs", &ns3::AiConstantRateActStruct::next_mcs);
 
+    py::enum_<Ns3AiSyncMode>(m, "Ns3AiSyncMode", py::module_local())
+        .value("SYNC_MODE_SPIN", SYNC_MODE_SPIN)
+        .value("SYNC_MODE_ADAPTIVE", SYNC_MODE_ADAPTIVE);
+    m.attr("NS3_AI_DEFAULT_SPIN_COUNT") = NS3_AI_DEFAULT_SPIN_COUNT;
+
     py::class_<
         ns3::Ns3AiMsgInterfaceImpl<ns3::AiConstantRateEnvStruct, ns3::AiConstantRateActStruct>>(
         m,
@@ -50,6 +55,11 @@ PYBIND11_MODULE(ns3ai_ratecontrol_constant_py, m)
                       const char*,
                       const char*,
                       const char*>())
+        .def("SetSyncMode",
+             &ns3::Ns3AiMsgInterfaceImpl<ns3::AiConstantRateEnvStruct,
+                                         ns3::AiConstantRateActStruct>::SetSyncMode,
+             py::arg("mode"),
+             py::arg("spinCount") = NS3_AI_DEFAULT_SPIN_COUNT)
         .def("PyRecvBegin",
              &ns3::Ns3AiMsgInterfaceImpl<ns3::AiConstantRateEnvStruct,
                                          ns3::AiConstantRateActStruct>::PyRecvBegin)
@@ -72,5 +82,25 @@ PYBIND11_MODULE(ns3ai_ratecontrol_constant_py, m)
         .def("GetPy2CppStruct",
              &ns3::Ns3AiMsgInterfaceImpl<ns3::AiConstantRateEnvStruct,
                                          ns3::AiConstantRateActStruct>::GetPy2CppStruct,
-             py::return_value_policy::reference);
+             py::return_value_policy::reference)
+        .def("CreateCpp2PyRing",
+             &ns3::Ns3AiMsgInterfaceImpl<ns3::AiConstantRateEnvStruct,
+                                         ns3::AiConstantRateActStruct>::CreateCpp2PyRing)
+        .def("GetCpp2PyRingSize",
+             &ns3::Ns3AiMsgInterfaceImpl<ns3::AiConstantRateEnvStruct,
+                                         ns3::AiConstantRateActStruct>::GetCpp2PyRingSize)
+        .def("PyRingRecvBegin",
+             &ns3::Ns3AiMsgInterfaceImpl<ns3::AiConstantRateEnvStruct,
+                                         ns3::AiConstantRateActStruct>::PyRingRecvBegin,
+             py::arg("maxCount") = 0)
+        .def("PyRingRecvEnd",
+             &ns3::Ns3AiMsgInterfaceImpl<ns3::AiConstantRateEnvStruct,
+                                         ns3::AiConstantRateActStruct>::PyRingRecvEnd)
+        .def("GetCpp2PyRingStruct",
+             &ns3::Ns3AiMsgInterfaceImpl<ns3::AiConstantRateEnvStruct,
+                                         ns3::AiConstantRateActStruct>::GetCpp2PyRingStruct,
+             py::return_value_policy::reference)
+        .def("GetCpp2PyRingSeq",
+             &ns3::Ns3AiMsgInterfaceImpl<ns3::AiConstantRateEnvStruct,
+                                         ns3::AiConstantRateActStruct>::GetCpp2PyRingSeq);
 }
@@ -85,6 +85,11 @@ PYBIND11_MODULE(ns3ai_ratecontrol_ts_py, m)
         .def_readwrite("res", &ns3::AiThompsonSamplingActStruct::res)
         .def_readwrite("stats", &ns3::AiThompsonSamplingActStruct::stats);
 
+    py::enum_<Ns3AiSyncMode>(m, "Ns3AiSyncMode", py::module_local())
+        .value("SYNC_MODE_SPIN", SYNC_MODE_SPIN)
+        .value("SYNC_MODE_ADAPTIVE", SYNC_MODE_ADAPTIVE);
+    m.attr("NS3_AI_DEFAULT_SPIN_COUNT") = NS3_AI_DEFAULT_SPIN_COUNT;
+
     py::class_<ns3::Ns3AiMsgInterfaceImpl<ns3::AiThompsonSamplingEnvStruct,
                                           ns3::AiThompsonSamplingActStruct>>(
         m,
@@ -97,6 +102,11 @@ PYBIND11_MODULE(ns3ai_ratecontrol_ts_py, m)
                       const char*,
                       const char*,
                       const char*>())
+        .def("SetSyncMode",
+             &ns3::Ns3AiMsgInterfaceImpl<ns3::AiThompsonSamplingEnvStruct,
+                                         ns3::AiThompsonSamplingActStruct>::SetSyncMode,
+             py::arg("mode"),
+             py::arg("spinCount") = NS3_AI_DEFAULT_SPIN_COUNT)
         .def("PyRecvBegin",
              &ns3::Ns3AiMsgInterfaceImpl<ns3::AiThompsonSamplingEnvStruct,
                                          ns3::AiThompsonSamplingActStruct>::PyRecvBegin)
@@ -119,5 +129,25 @@ PYBIND11_MODULE(ns3ai_ratecontrol_ts_py, m)
         .def("GetPy2CppStruct",
              &ns3::Ns3AiMsgInterfaceImpl<ns3::AiThompsonSamplingEnvStruct,
                                          ns3::AiThompsonSamplingActStruct>::GetPy2CppStruct,
-             py::return_value_policy::reference);
+             py::return_value_policy::reference)
+        .def("CreateCpp2PyRing",
+             &ns3::Ns3AiMsgInterfaceImpl<ns3::AiThompsonSamplingEnvStruct,
+                                         ns3::AiThompsonSamplingActStruct>::CreateCpp2PyRing)
+        .def("GetCpp2PyRingSize",
+             &ns3::Ns3AiMsgInterfaceImpl<ns3::AiThompsonSamplingEnvStruct,
+                                         ns3::AiThompsonSamplingActStruct>::GetCpp2PyRingSize)
+        .def("PyRingRecvBegin",
+             &ns3::Ns3AiMsgInterfaceImpl<ns3::AiThompsonSamplingEnvStruct,
+                                         ns3::AiThompsonSamplingActStruct>::PyRingRecvBegin,
+             py::arg("maxCount") = 0)
+        .def("PyRingRecvEnd",
+             &ns3::Ns3AiMsgInterfaceImpl<ns3::AiThompsonSamplingEnvStruct,
+                                         ns3::AiThompsonSamplingActStruct>::PyRingRecvEnd)
+        .def("GetCpp2PyRingStruct",
+             &ns3::Ns3AiMsgInterfaceImpl<ns3::AiThompsonSamplingEnvStruct,
+                                         ns3::AiThompsonSamplingActStruct>::GetCpp2PyRingStruct,
+             py::return_value_policy::reference)
+        .def("GetCpp2PyRingSeq",
+             &ns3::Ns3AiMsgInterfaceImpl<ns3::AiThompsonSamplingEnvStruct,
+                                         ns3::AiThompsonSamplingActStruct>::GetCpp2PyRingSeq);
 }
@@ -0,0 +1,421 @@
+/*
+ * Copyright (c) 2018 Technische Universität Berlin
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Piotr Gawlowicz <gawlowicz@tkn.tu-berlin.de>
+ * Modify: Pengyu Liu <eic_lpy@hust.edu.cn>
+ *         Hao Yin <haoyin@uw.edu>
+ *         Muyuan Shen <muyuan_shen@hust.edu.cn>
+ */
+
+#include "tcp-rl-env.h"
+
+#include "ns3/pointer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <numeric>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("tcp-rl-env-engine");
+
+/**
+ * Maps the Q-values of an observation to the new cWnd and ssThresh, the same
+ * way as TcpDeepQAgent in use-msg/agents.py which trained the model.
+ */
+static std::tuple<uint32_t, uint32_t>
+GetAction(const std::vector<float>& obs, const std::vector<float>& qValues)
+{
+    uint32_t action = std::max_element(qValues.begin(), qValues.end()) - qValues.begin();
+    float cWnd = obs[1];
+    float segmentSize = obs[3];
+    float bytesInFlight = obs[4];
+
+    uint32_t new_cWnd = cWnd;
+    uint32_t new_ssThresh;
+    if (action & 1)
+    {
+        new_cWnd = cWnd + segmentSize;
+    }
+    else if (cWnd > 0)
+    {
+        new_cWnd = cWnd + std::floor(std::max((double)1, (double)segmentSize * segmentSize / cWnd));
+    }
+    if (action < 3)
+    {
+        new_ssThresh = 2 * segmentSize;
+    }
+    else
+    {
+        new_ssThresh = std::floor((double)bytesInFlight / 2);
+    }
+    return {new_cWnd, new_ssThresh};
+}
+
+NS_OBJECT_ENSURE_REGISTERED(TcpTimeStepEnv);
+
+TcpTimeStepEnv::TcpTimeStepEnv()
+{
+}
+
+TcpTimeStepEnv::~TcpTimeStepEnv()
+{
+}
+
+TypeId
+TcpTimeStepEnv::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::TcpTimeStepEnv")
+                            .SetParent<Object>()
+                            .SetGroupName("Ns3Ai")
+                            .AddConstructor<TcpTimeStepEnv>()
+                            .AddAttribute("StepTime",
+                                          "Step interval used in TCP env. Default: 100ms",
+                                          TimeValue(MilliSeconds(100)),
+                                          MakeTimeAccessor(&TcpTimeStepEnv::m_timeStep),
+                                          MakeTimeChecker())
+                            .AddAttribute("InferenceEngine",
+                                          "Engine evaluating the trained DQN",
+                                          PointerValue(),
+                                          MakePointerAccessor(&TcpTimeStepEnv::m_engine),
+                                          MakePointerChecker<Ns3AiInferenceEngine>());
+
+    return tid;
+}
+
+void
+TcpTimeStepEnv::SetNodeId(uint32_t id)
+{
+    NS_LOG_FUNCTION(this);
+    m_nodeId = id;
+}
+
+void
+TcpTimeStepEnv::SetSocketUuid(uint32_t id)
+{
+    NS_LOG_FUNCTION(this);
+    m_socketUuid = id;
+}
+
+void
+TcpTimeStepEnv::TxPktTrace(Ptr<const Packet>, const TcpHeader&, Ptr<const TcpSocketBase>)
+{
+    //   NS_LOG_FUNCTION (this);
+    if (m_lastPktTxTime > MicroSeconds(0.0))
+    {
+        Time interTxTime = Simulator::Now() - m_lastPktTxTime;
+        m_interTxTimeSum += interTxTime;
+        m_interTxTimeNum++;
+    }
+
+    m_lastPktTxTime = Simulator::Now();
+}
+
+void
+TcpTimeStepEnv::RxPktTrace(Ptr<const Packet>, const TcpHeader&, Ptr<const TcpSocketBase>)
+{
+    //   NS_LOG_FUNCTION (this);
+    if (m_lastPktRxTime > MicroSeconds(0.0))
+    {
+        Time interRxTime = Simulator::Now() - m_lastPktRxTime;
+        m_interRxTimeSum += interRxTime;
+        m_interRxTimeNum++;
+    }
+
+    m_lastPktRxTime = Simulator::Now();
+}
+
+void
+TcpTimeStepEnv::Start(Ptr<const TcpSocketState> tcb)
+{
+    m_started = true;
+    // keep the current values until the first action
+    m_new_cWnd = tcb->m_cWnd;
+    m_new_ssThresh = tcb->m_ssThresh;
+    // step at multiples of the step time, like the other sockets, so that they share a batch
+    Time delay = m_timeStep - TimeStep(Simulator::Now().GetTimeStep() % m_timeStep.GetTimeStep());
+    Simulator::Schedule(delay, &TcpTimeStepEnv::ScheduleNotify, this);
+}
+
+void
+TcpTimeStepEnv::ScheduleNotify()
+{
+    Simulator::Schedule(m_timeStep, &TcpTimeStepEnv::ScheduleNotify, this);
+
+    uint64_t bytesInFlightSum = std::accumulate(m_bytesInFlight.begin(), m_bytesInFlight.end(), 0);
+    m_bytesInFlight.clear();
+
+    uint64_t segmentsAckedSum = std::accumulate(m_segmentsAcked.begin(), m_segmentsAcked.end(), 0);
+    m_segmentsAcked.clear();
+
+    std::cerr << "At " << (uint64_t)(Simulator::Now().GetMilliSeconds()) << "ms:\n";
+    std::cerr << "\tstate --"
+              << " ssThresh=" << m_tcb->m_ssThresh << " cWnd=" << m_tcb->m_cWnd
+              << " segmentAcked=" << segmentsAckedSum << " segmentSize=" << m_tcb->m_segmentSize
+              << " bytesInFlightSum=" << bytesInFlightSum << std::endl;
+
+    m_obs = {(float)m_tcb->m_ssThresh,
+             (float)m_tcb->m_cWnd,
+             (float)segmentsAckedSum,
+             (float)m_tcb->m_segmentSize,
+             (float)bytesInFlightSum};
+    // evaluated with the observations of the other sockets stepping at this time
+    m_engine->Submit(m_obs, MakeCallback(&TcpTimeStepEnv::ApplyAction, this));
+
+    m_rttSampleNum = 0;
+    m_rttSum = MicroSeconds(0.0);
+
+    m_interTxTimeNum = 0;
+    m_interTxTimeSum = MicroSeconds(0.0);
+
+    m_interRxTimeNum = 0;
+    m_interRxTimeSum = MicroSeconds(0.0);
+}
+
+void
+TcpTimeStepEnv::ApplyAction(const std::vector<float>& qValues)
+{
+    auto actions = GetAction(m_obs, qValues);
+
+    m_new_cWnd = std::get<0>(actions);
+    m_new_ssThresh = std::get<1>(actions);
+
+    std::cerr << "\taction --"
+              << " new_cWnd=" << m_new_cWnd << " new_ssThresh=" << m_new_ssThresh << std::endl;
+}
+
+uint32_t
+TcpTimeStepEnv::GetSsThresh(Ptr<const TcpSocketState> tcb, uint32_t bytesInFlight)
+{
+    NS_LOG_FUNCTION(this);
+    NS_LOG_INFO(Simulator::Now() << " Node: " << m_nodeId
+                                 << " GetSsThresh, BytesInFlight: " << bytesInFlight);
+    m_tcb = tcb;
+    m_bytesInFlight.push_back(bytesInFlight);
+
+    if (!m_started)
+    {
+        Start(tcb);
+    }
+
+    return m_new_ssThresh;
+}
+
+void
+TcpTimeStepEnv::IncreaseWindow(Ptr<TcpSocketState> tcb, uint32_t segmentsAcked)
+{
+    NS_LOG_FUNCTION(this);
+    NS_LOG_INFO(Simulator::Now() << " Node: " << m_nodeId
+                                 << " IncreaseWindow, SegmentsAcked: " << segmentsAcked);
+    m_tcb = tcb;
+    m_segmentsAcked.push_back(segmentsAcked);
+    m_bytesInFlight.push_back(tcb->m_bytesInFlight);
+
+    if (!m_started)
+    {
+        Start(tcb);
+    }
+
+    tcb->m_cWnd = m_new_cWnd;
+}
+
+void
+TcpTimeStepEnv::PktsAcked(Ptr<TcpSocketState> tcb, uint32_t segmentsAcked, const Time& rtt)
+{
+    m_tcb = tcb;
+    m_rttSum += rtt;
+    m_rttSampleNum++;
+}
+
+void
+TcpTimeStepEnv::CongestionStateSet(Ptr<TcpSocketState> tcb,
+                                   const TcpSocketState::TcpCongState_t newState)
+{
+    m_tcb = tcb;
+}
+
+void
+TcpTimeStepEnv::CwndEvent(Ptr<TcpSocketState> tcb, const TcpSocketState::TcpCAEvent_t event)
+{
+    m_tcb = tcb;
+}
+
+NS_OBJECT_ENSURE_REGISTERED(TcpEventBasedEnv);
+
+TcpEventBasedEnv::TcpEventBasedEnv()
+{
+}
+
+TcpEventBasedEnv::~TcpEventBasedEnv()
+{
+}
+
+TypeId
+TcpEventBasedEnv::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::TcpEventBasedEnv")
+                            .SetParent<Object>()
+                            .SetGroupName("Ns3Ai")
+                            .AddConstructor<TcpEventBasedEnv>()
+                            .AddAttribute("InferenceEngine",
+                                          "Engine evaluating the trained DQN",
+                                          PointerValue(),
+                                          MakePointerAccessor(&TcpEventBasedEnv::m_engine),
+                                          MakePointerChecker<Ns3AiInferenceEngine>());
+
+    return tid;
+}
+
+void
+TcpEventBasedEnv::SetNodeId(uint32_t id)
+{
+    NS_LOG_FUNCTION(this);
+    m_nodeId = id;
+}
+
+void
+TcpEventBasedEnv::SetSocketUuid(uint32_t id)
+{
+    NS_LOG_FUNCTION(this);
+    m_socketUuid = id;
+}
+
+void
+TcpEventBasedEnv::TxPktTrace(Ptr<const Packet>, const TcpHeader&, Ptr<const TcpSocketBase>)
+{
+    //   NS_LOG_FUNCTION (this);
+    if (m_lastPktTxTime > MicroSeconds(0.0))
+    {
+        Time interTxTime = Simulator::Now() - m_lastPktTxTime;
+        m_interTxTimeSum += interTxTime;
+        m_interTxTimeNum++;
+    }
+
+    m_lastPktTxTime = Simulator::Now();
+}
+
+void
+TcpEventBasedEnv::RxPktTrace(Ptr<const Packet>, const TcpHeader&, Ptr<const TcpSocketBase>)
+{
+    //   NS_LOG_FUNCTION (this);
+    if (m_lastPktRxTime > MicroSeconds(0.0))
+    {
+        Time interRxTime = Simulator::Now() - m_lastPktRxTime;
+        m_interRxTimeSum += interRxTime;
+        m_interRxTimeNum++;
+    }
+
+    m_lastPktRxTime = Simulator::Now();
+}
+
+void
+TcpEventBasedEnv::Notify()
+{
+    uint64_t bytesInFlightSum = std::accumulate(m_bytesInFlight.begin(), m_bytesInFlight.end(), 0);
+    m_bytesInFlight.clear();
+
+    uint64_t segmentsAckedSum = std::accumulate(m_segmentsAcked.begin(), m_segmentsAcked.end(), 0);
+    m_segmentsAcked.clear();
+
+    std::cerr << "At " << (uint64_t)(Simulator::Now().GetMilliSeconds()) << "ms:\n";
+    std::cerr << "\tstate --"
+              << " ssThresh=" << m_tcb->m_ssThresh << " cWnd=" << m_tcb->m_cWnd
+              << " segmentAcked=" << segmentsAckedSum << " segmentSize=" << m_tcb->m_segmentSize
+              << " bytesInFlightSum=" << bytesInFlightSum << std::endl;
+
+    m_obs = {(float)m_tcb->m_ssThresh,
+             (float)m_tcb->m_cWnd,
+             (float)segmentsAckedSum,
+             (float)m_tcb->m_segmentSize,
+             (float)bytesInFlightSum};
+    // the caller uses the action right away
+    ApplyAction(m_engine->Infer(m_obs));
+
+    m_rttSampleNum = 0;
+    m_rttSum = MicroSeconds(0.0);
+
+    m_interTxTimeNum = 0;
+    m_interTxTimeSum = MicroSeconds(0.0);
+
+    m_interRxTimeNum = 0;
+    m_interRxTimeSum = MicroSeconds(0.0);
+}
+
+void
+TcpEventBasedEnv::ApplyAction(const std::vector<float>& qValues)
+{
+    auto actions = GetAction(m_obs, qValues);
+
+    m_new_cWnd = std::get<0>(actions);
+    m_new_ssThresh = std::get<1>(actions);
+
+    std::cerr << "\taction --"
+              << " new_cWnd=" << m_new_cWnd << " new_ssThresh=" << m_new_ssThresh << std::endl;
+}
+
+uint32_t
+TcpEventBasedEnv::GetSsThresh(Ptr<const TcpSocketState> tcb, uint32_t bytesInFlight)
+{
+    NS_LOG_FUNCTION(this);
+    NS_LOG_INFO(Simulator::Now() << " Node: " << m_nodeId
+                                 << " GetSsThresh, BytesInFlight: " << bytesInFlight);
+    m_tcb = tcb;
+    m_bytesInFlight.push_back(bytesInFlight);
+
+    Notify();
+
+    return m_new_ssThresh;
+}
+
+void
+TcpEventBasedEnv::IncreaseWindow(Ptr<TcpSocketState> tcb, uint32_t segmentsAcked)
+{
+    NS_LOG_FUNCTION(this);
+    NS_LOG_INFO(Simulator::Now() << " Node: " << m_nodeId
+                                 << " IncreaseWindow, SegmentsAcked: " << segmentsAcked);
+    m_tcb = tcb;
+    m_segmentsAcked.push_back(segmentsAcked);
+    m_bytesInFlight.push_back(tcb->m_bytesInFlight);
+
+    Notify();
+
+    tcb->m_cWnd = m_new_cWnd;
+}
+
+void
+TcpEventBasedEnv::PktsAcked(Ptr<TcpSocketState> tcb, uint32_t segmentsAcked, const Time& rtt)
+{
+    m_tcb = tcb;
+    m_rttSum += rtt;
+    m_rttSampleNum++;
+}
+
+void
+TcpEventBasedEnv::CongestionStateSet(Ptr<TcpSocketState> tcb,
+                                     const TcpSocketState::TcpCongState_t newState)
+{
+    m_tcb = tcb;
+}
+
+void
+TcpEventBasedEnv::CwndEvent(Ptr<TcpSocketState> tcb, const TcpSocketState::TcpCAEvent_t event)
+{
+    m_tcb = tcb;
+}
+
+} // namespace ns3
@@ -27,7 +27,7 @@ import numpy as np
 import matplotlib.pyplot as plt
 from agents import TcpNewRenoAgent, TcpDeepQAgent, TcpQAgent
 import ns3ai_rltcp_msg_py as py_binding
-from ns3ai_utils import Experiment
+from ns3ai_utils import Experiment, save_mlp
 
 
 def get_agent(socketUuid, useRl):
@@ -68,6 +68,8 @@ parser.add_argument('--use_rl', action='store_true',
                     help='whether use rl algorithm')
 parser.add_argument('--rl_algo', type=str,
                     default='DeepQ', help='RL Algorithm, Q or DeepQ')
+parser.add_argument('--save_model', type=str,
+                    help='save the trained DQN in the ns3-ai MLP format, for use-engine')
 
 args = parser.parse_args()
 my_seed = 42
@@ -152,6 +154,17 @@ except Exception as e:
     exit(1)
 
 else:
+    if args.save_model:
+        agent = next(iter(get_agent.tcpAgents.values()), None)
+        if isinstance(agent, TcpDeepQAgent):
+            layers = agent.dqn.eval_net.layers
+            save_mlp([(layers[0].weight.tolist(), layers[0].bias.tolist(), 'relu'),
+                      (layers[2].weight.tolist(), layers[2].bias.tolist(), 'relu'),
+                      (layers[4].weight.tolist(), layers[4].bias.tolist(), 'linear')],
+                     args.save_model)
+            print("Saved the DQN to {}".format(args.save_model))
+        else:
+            print("Only a Deep Q-learning agent can be saved")
     if args.result:
         if args.result_dir:
             if not os.path.exists(args.result_dir):
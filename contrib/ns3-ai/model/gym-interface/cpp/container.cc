@@ -21,6 +21,7 @@
 
 #include "container.h"
 
+#include <ns3/abort.h>
 #include <ns3/log.h>
 
 namespace ns3
@@ -166,6 +167,59 @@ OpenGymDataContainer::CreateFromDataContainerPbMsg(ns3_ai_gym::DataContainer& da
     return actDataContainer;
 }
 
+bool
+OpenGymDataContainer::WriteFlat(Ns3AiGymFlatHeader* /* header */, uint8_t* /* data */)
+{
+    return false;
+}
+
+template <typename T>
+static Ptr<OpenGymDataContainer>
+CreateBoxFromFlat(const Ns3AiGymFlatHeader* header, const uint8_t* data)
+{
+    std::vector<uint32_t> shape(header->shape, header->shape + header->ndim);
+    Ptr<OpenGymBoxContainer<T>> box = CreateObject<OpenGymBoxContainer<T>>(shape);
+    const T* begin = reinterpret_cast<const T*>(data);
+    box->SetData(std::vector<T>(begin, begin + header->count));
+    return box;
+}
+
+Ptr<OpenGymDataContainer>
+OpenGymDataContainer::CreateFromFlat(const Ns3AiGymFlatHeader* header, const uint8_t* data)
+{
+    Ptr<OpenGymDataContainer> actDataContainer;
+    if (header->count == 0)
+    {
+        return actDataContainer;
+    }
+    NS_ABORT_MSG_IF(header->count * header->itemSize > header->capacity,
+                    "Flat data exceeds the region capacity");
+
+    // same element types as the protobuf path
+    if (header->dtype == ns3_ai_gym::INT && header->itemSize == sizeof(int32_t))
+    {
+        actDataContainer = CreateBoxFromFlat<int32_t>(header, data);
+    }
+    else if (header->dtype == ns3_ai_gym::UINT && header->itemSize == sizeof(uint32_t))
+    {
+        actDataContainer = CreateBoxFromFlat<uint32_t>(header, data);
+    }
+    else if (header->dtype == ns3_ai_gym::DOUBLE && header->itemSize == sizeof(double))
+    {
+        actDataContainer = CreateBoxFromFlat<double>(header, data);
+    }
+    else if (header->itemSize == sizeof(float))
+    {
+        actDataContainer = CreateBoxFromFlat<float>(header, data);
+    }
+    else
+    {
+        NS_FATAL_ERROR("Unsupported flat dtype " << header->dtype << " with item size "
+                                                 << header->itemSize);
+    }
+    return actDataContainer;
+}
+
 TypeId
 OpenGymDiscreteContainer::GetTypeId()
 {
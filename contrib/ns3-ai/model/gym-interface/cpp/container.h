@@ -22,11 +22,15 @@
 #ifndef OPENGYM_CONTAINER_H
 #define OPENGYM_CONTAINER_H
 
+#include "../ns3-ai-gym-msg.h"
 #include "messages.pb.h"
 
 #include <ns3/object.h>
 #include <ns3/type-name.h>
 
+#include <algorithm>
+#include <cstring>
+
 namespace ns3
 {
 
@@ -42,6 +46,14 @@ class OpenGymDataContainer : public Object
     static Ptr<OpenGymDataContainer> CreateFromDataContainerPbMsg(
         ns3_ai_gym::DataContainer& dataContainer);
 
+    /**
+     * Writes the data into a flat region (header followed by elements).
+     * Only Box containers support this, others return false.
+     */
+    virtual bool WriteFlat(Ns3AiGymFlatHeader* header, uint8_t* data);
+    static Ptr<OpenGymDataContainer> CreateFromFlat(const Ns3AiGymFlatHeader* header,
+                                                    const uint8_t* data);
+
     virtual void Print(std::ostream& where) const = 0;
 
     friend std::ostream& operator<<(std::ostream& os, const Ptr<OpenGymDataContainer> container)
@@ -98,6 +110,7 @@ class OpenGymBoxContainer : public OpenGymDataContainer
     static TypeId GetTypeId();
 
     ns3_ai_gym::DataContainer GetDataContainerPbMsg() override;
+    bool WriteFlat(Ns3AiGymFlatHeader* header, uint8_t* data) override;
 
     void Print(std::ostream& where) const override;
 
@@ -235,6 +248,24 @@ OpenGymBoxContainer<T>::GetDataContainerPbMsg()
     return dataContainerPbMsg;
 }
 
+template <typename T>
+bool
+OpenGymBoxContainer<T>::WriteFlat(Ns3AiGymFlatHeader* header, uint8_t* data)
+{
+    uint64_t bytes = m_data.size() * sizeof(T);
+    if (bytes > header->capacity || m_shape.size() > FLAT_MAX_DIMS)
+    {
+        return false;
+    }
+    header->dtype = m_dtype;
+    header->itemSize = sizeof(T);
+    header->ndim = m_shape.size();
+    std::copy(m_shape.begin(), m_shape.end(), header->shape);
+    header->count = m_data.size();
+    std::memcpy(data, m_data.data(), bytes);
+    return true;
+}
+
 template <typename T>
 bool
 OpenGymBoxContainer<T>::AddValue(T value)
@@ -62,6 +62,17 @@ OpenGymEnv::SetOpenGymInterface(Ptr<OpenGymInterface> openGymInterface)
     openGymInterface->SetGetRewardCb(MakeCallback(&OpenGymEnv::GetReward, this));
     openGymInterface->SetGetExtraInfoCb(MakeCallback(&OpenGymEnv::GetExtraInfo, this));
     openGymInterface->SetExecuteActionsCb(MakeCallback(&OpenGymEnv::ExecuteActions, this));
+    if (openGymInterface->GetNumEnvs() > 1)
+    {
+        openGymInterface->AddEnv(this);
+    }
+}
+
+int64_t
+OpenGymEnv::AssignStreams(int64_t stream)
+{
+    NS_LOG_FUNCTION(this << stream);
+    return 0;
 }
 
 void
@@ -94,6 +105,8 @@ void
 OpenGymEnv::DoDispose()
 {
     NS_LOG_FUNCTION(this);
+    m_openGymInterface = nullptr;
+    Object::DoDispose();
 }
 
 } // namespace ns3
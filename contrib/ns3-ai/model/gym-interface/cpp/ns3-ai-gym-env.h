@@ -78,9 +78,20 @@ class OpenGymEnv : public Object
      */
     virtual bool ExecuteActions(Ptr<OpenGymDataContainer> action) = 0;
 
+    /**
+     * Assign fixed random variable streams to the random variables of the
+     * environment. Called by OpenGymInterface::AssignStreams for each
+     * environment of the batch. By default, no stream is assigned.
+     *
+     * \param stream first stream index to use
+     * \return the number of stream indices assigned
+     */
+    virtual int64_t AssignStreams(int64_t stream);
+
     /**
      * Sets the lower level gym interface (shared memory)
-     * associated to the environment
+     * associated to the environment. In batched mode, the
+     * environment is also added to the batch of the interface.
      */
     void SetOpenGymInterface(Ptr<OpenGymInterface> openGymInterface);
 
@@ -31,10 +31,13 @@
 #include "ns3-ai-gym-env.h"
 #include "spaces.h"
 
+#include <ns3/abort.h>
 #include <ns3/config.h>
 #include <ns3/log.h>
 #include <ns3/simulator.h>
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -51,7 +54,19 @@ OpenGymInterface::Get()
 OpenGymInterface::OpenGymInterface()
     : m_simEnd(false),
       m_stopEnvRequested(false),
-      m_initSimMsgSent(false)
+      m_initSimMsgSent(false),
+      m_flatMode(false),
+      m_flatObsHeader(nullptr),
+      m_flatActHeader(nullptr),
+      m_numEnvs(1),
+      m_batchCount(0),
+      m_batchCpp2PyBuffer(nullptr),
+      m_batchPy2CppBuffer(nullptr),
+      m_batchCpp2PySize(0),
+      m_batchPy2CppSize(0),
+      m_async(false),
+      m_maxStaleness(1),
+      m_stateSeq(0)
 {
     auto interface = Ns3AiMsgInterface::Get();
     interface->SetIsMemoryCreator(false);
@@ -99,6 +114,8 @@ OpenGymInterface::Init()
         spaceDesc = actionSpace->GetSpaceDescription();
         simInitMsg.mutable_actspace()->CopyFrom(spaceDesc);
     }
+    simInitMsg.set_numenvs(m_numEnvs);
+    simInitMsg.set_asyncmode(m_async);
 
     // get the interface
     Ns3AiMsgInterfaceImpl<Ns3AiGymMsg, Ns3AiGymMsg>* msgInterface =
@@ -121,6 +138,28 @@ OpenGymInterface::Init()
 
     bool done = simInitAck.done();
     NS_LOG_DEBUG("Sim Init Ack: " << done);
+    if (simInitAck.flatmode())
+    {
+        // regions are created by Python side according to the spaces
+        m_flatObsHeader =
+            reinterpret_cast<Ns3AiGymFlatHeader*>(msgInterface->FindRegion(FLAT_OBS_REGION_NAME));
+        m_flatActHeader =
+            reinterpret_cast<Ns3AiGymFlatHeader*>(msgInterface->FindRegion(FLAT_ACT_REGION_NAME));
+        NS_ABORT_MSG_IF(!m_flatObsHeader || !m_flatActHeader,
+                        "Flat mode requested but flat regions are missing");
+        m_flatMode = true;
+        NS_LOG_DEBUG("Flat mode enabled");
+    }
+    if (m_numEnvs > 1)
+    {
+        m_batchCpp2PyBuffer =
+            msgInterface->FindRegion(BATCH_CPP2PY_REGION_NAME, &m_batchCpp2PySize);
+        m_batchPy2CppBuffer =
+            msgInterface->FindRegion(BATCH_PY2CPP_REGION_NAME, &m_batchPy2CppSize);
+        NS_ABORT_MSG_IF(!m_batchCpp2PyBuffer || !m_batchPy2CppBuffer,
+                        "Batched mode with " << m_numEnvs
+                                             << " environments requires Ns3VecEnv on Python side");
+    }
     bool stopSim = simInitAck.stopsimreq();
     if (stopSim)
     {
@@ -143,8 +182,168 @@ OpenGymInterface::NotifyCurrentState()
     {
         return;
     }
-    // collect current env state
-    Ptr<OpenGymDataContainer> obsDataContainer = GetObservation();
+    if (m_async)
+    {
+        NotifyCurrentStateAsync();
+        return;
+    }
+
+    SendEnvState(GetObservation(), false);
+
+    // receive act msg from python
+    ns3_ai_gym::EnvActMsg envActMsg;
+    Ptr<OpenGymDataContainer> actDataContainer;
+    RecvEnvAct(true, envActMsg, actDataContainer);
+
+    if (m_simEnd)
+    {
+        // if sim end only rx msg and quit
+        return;
+    }
+
+    bool stopSim = envActMsg.stopsimreq();
+    if (stopSim)
+    {
+        NS_LOG_DEBUG("---Stop requested: " << stopSim);
+        m_stopEnvRequested = true;
+        Simulator::Stop();
+        Simulator::Destroy();
+        std::exit(0);
+    }
+
+    // first step after reset is called without actions, just to get current state
+    ExecuteActions(actDataContainer);
+}
+
+void
+OpenGymInterface::NotifyCurrentStateAsync()
+{
+    NS_LOG_FUNCTION(this);
+    SendEnvState(GetObservation(), true);
+
+    // take the latest action python has sent so far, without waiting
+    ns3_ai_gym::EnvActMsg envActMsg;
+    Ptr<OpenGymDataContainer> actDataContainer;
+    Ptr<OpenGymDataContainer> freshAction;
+    bool received = false;
+    while (RecvEnvAct(false, envActMsg, actDataContainer))
+    {
+        bool stopSim = envActMsg.stopsimreq();
+        if (stopSim)
+        {
+            NS_LOG_DEBUG("---Stop requested: " << stopSim);
+            m_stopEnvRequested = true;
+            Simulator::Stop();
+            Simulator::Destroy();
+            std::exit(0);
+        }
+        // number of states sent after the one the action was computed for
+        uint64_t staleness = m_stateSeq - envActMsg.seq();
+        if (staleness <= m_maxStaleness)
+        {
+            freshAction = actDataContainer;
+            received = true;
+        }
+        else
+        {
+            NS_LOG_DEBUG("Dropping action for state " << envActMsg.seq() << ", " << staleness
+                                                      << " states old");
+        }
+    }
+
+    if (!received && !m_defaultActionCb.IsNull())
+    {
+        NS_LOG_DEBUG("No fresh action, executing the default action");
+        freshAction = m_defaultActionCb();
+        received = true;
+    }
+    if (received)
+    {
+        ExecuteActions(freshAction);
+    }
+}
+
+void
+OpenGymInterface::SendEnvState(Ptr<OpenGymDataContainer> obsDataContainer, bool replace)
+{
+    // collect current env state, the observation is written directly into
+    // shared memory below in flat mode
+    ns3_ai_gym::EnvStateMsg envStateMsg = GetEnvStateMsg(m_flatMode ? nullptr : obsDataContainer);
+    envStateMsg.set_seq(++m_stateSeq);
+
+    // get the interface
+    Ns3AiMsgInterfaceImpl<Ns3AiGymMsg, Ns3AiGymMsg>* msgInterface =
+        Ns3AiMsgInterface::Get()->GetInterface<Ns3AiGymMsg, Ns3AiGymMsg>();
+
+    // send env state msg to python. When replacing, a state python has not
+    // started to read is taken back and overwritten, so that python only
+    // waits for the previous state to be read.
+    if (!replace || !(msgInterface->CppTrySendBegin() || msgInterface->CppTryRetractSend()))
+    {
+        msgInterface->CppSendBegin();
+    }
+    if (m_flatMode)
+    {
+        m_flatObsHeader->count = 0;
+        if (obsDataContainer)
+        {
+            bool written = obsDataContainer->WriteFlat(
+                m_flatObsHeader,
+                reinterpret_cast<uint8_t*>(m_flatObsHeader) + FLAT_DATA_OFFSET);
+            NS_ABORT_MSG_IF(!written, "Observation cannot be written into the flat region");
+        }
+    }
+    msgInterface->GetCpp2PyStruct()->size = envStateMsg.ByteSizeLong();
+    assert(msgInterface->GetCpp2PyStruct()->size <= MSG_BUFFER_SIZE);
+    envStateMsg.SerializeToArray(msgInterface->GetCpp2PyStruct()->buffer,
+                                 msgInterface->GetCpp2PyStruct()->size);
+
+    msgInterface->CppSendEnd();
+}
+
+bool
+OpenGymInterface::RecvEnvAct(bool block,
+                             ns3_ai_gym::EnvActMsg& envActMsg,
+                             Ptr<OpenGymDataContainer>& actDataContainer)
+{
+    // get the interface
+    Ns3AiMsgInterfaceImpl<Ns3AiGymMsg, Ns3AiGymMsg>* msgInterface =
+        Ns3AiMsgInterface::Get()->GetInterface<Ns3AiGymMsg, Ns3AiGymMsg>();
+
+    if (block)
+    {
+        msgInterface->CppRecvBegin();
+    }
+    else if (!msgInterface->CppTryRecvBegin())
+    {
+        return false;
+    }
+    envActMsg.ParseFromArray(msgInterface->GetPy2CppStruct()->buffer,
+                             msgInterface->GetPy2CppStruct()->size);
+    // the action is read before the flat region can be written again
+    actDataContainer = nullptr;
+    if (!m_simEnd && !envActMsg.stopsimreq())
+    {
+        if (m_flatMode)
+        {
+            actDataContainer = OpenGymDataContainer::CreateFromFlat(
+                m_flatActHeader,
+                reinterpret_cast<uint8_t*>(m_flatActHeader) + FLAT_DATA_OFFSET);
+        }
+        else
+        {
+            ns3_ai_gym::DataContainer actDataContainerPbMsg = envActMsg.actdata();
+            actDataContainer =
+                OpenGymDataContainer::CreateFromDataContainerPbMsg(actDataContainerPbMsg);
+        }
+    }
+    msgInterface->CppRecvEnd();
+    return true;
+}
+
+ns3_ai_gym::EnvStateMsg
+OpenGymInterface::GetEnvStateMsg(Ptr<OpenGymDataContainer> obsDataContainer)
+{
     float reward = GetReward();
     bool isGameOver = IsGameOver();
     std::string extraInfo = GetExtraInfo();
@@ -174,26 +373,65 @@ OpenGymInterface::NotifyCurrentState()
     }
     // extra info
     envStateMsg.set_info(extraInfo);
+    return envStateMsg;
+}
+
+void
+OpenGymInterface::NotifyBatchState(Ptr<OpenGymEnv> entity)
+{
+    NS_LOG_FUNCTION(this << entity);
+    if (!m_initSimMsgSent)
+    {
+        Init();
+    }
+    if (m_stopEnvRequested)
+    {
+        return;
+    }
+    auto it = std::find(m_envs.begin(), m_envs.end(), entity);
+    NS_ABORT_MSG_IF(it == m_envs.end(), "Environment is not registered with AddEnv");
+    uint32_t index = it - m_envs.begin();
+    NS_ABORT_MSG_IF(m_batchPending[index],
+                    "Environment " << index << " notified twice in the same batch");
+
+    m_batchStates[index] = GetEnvStateMsg(GetObservation());
+    m_batchPending[index] = true;
+    ++m_batchCount;
+    if (m_batchCount == m_numEnvs)
+    {
+        SendBatchState();
+    }
+}
+
+void
+OpenGymInterface::SendBatchState()
+{
+    NS_LOG_FUNCTION(this);
+    ns3_ai_gym::EnvStateBatchMsg envStateBatchMsg;
+    for (const auto& envStateMsg : m_batchStates)
+    {
+        envStateBatchMsg.add_states()->CopyFrom(envStateMsg);
+    }
+    m_batchCount = 0;
+    std::fill(m_batchPending.begin(), m_batchPending.end(), false);
 
     // get the interface
     Ns3AiMsgInterfaceImpl<Ns3AiGymMsg, Ns3AiGymMsg>* msgInterface =
         Ns3AiMsgInterface::Get()->GetInterface<Ns3AiGymMsg, Ns3AiGymMsg>();
 
-    // send env state msg to python
+    // send env states to python, only the size goes through the message
     msgInterface->CppSendBegin();
-    msgInterface->GetCpp2PyStruct()->size = envStateMsg.ByteSizeLong();
-    assert(msgInterface->GetCpp2PyStruct()->size <= MSG_BUFFER_SIZE);
-    envStateMsg.SerializeToArray(msgInterface->GetCpp2PyStruct()->buffer,
-                                 msgInterface->GetCpp2PyStruct()->size);
-
+    uint64_t size = envStateBatchMsg.ByteSizeLong();
+    NS_ABORT_MSG_IF(size > m_batchCpp2PySize,
+                    "Batched state of " << size << " bytes does not fit, increase batchBufferSize");
+    envStateBatchMsg.SerializeToArray(m_batchCpp2PyBuffer, size);
+    msgInterface->GetCpp2PyStruct()->size = size;
     msgInterface->CppSendEnd();
 
     // receive act msg from python
-    ns3_ai_gym::EnvActMsg envActMsg;
+    ns3_ai_gym::EnvActBatchMsg envActBatchMsg;
     msgInterface->CppRecvBegin();
-
-    envActMsg.ParseFromArray(msgInterface->GetPy2CppStruct()->buffer,
-                             msgInterface->GetPy2CppStruct()->size);
+    envActBatchMsg.ParseFromArray(m_batchPy2CppBuffer, msgInterface->GetPy2CppStruct()->size);
     msgInterface->CppRecvEnd();
 
     if (m_simEnd)
@@ -202,7 +440,7 @@ OpenGymInterface::NotifyCurrentState()
         return;
     }
 
-    bool stopSim = envActMsg.stopsimreq();
+    bool stopSim = envActBatchMsg.stopsimreq();
     if (stopSim)
     {
         NS_LOG_DEBUG("---Stop requested: " << stopSim);
@@ -212,11 +450,15 @@ OpenGymInterface::NotifyCurrentState()
         std::exit(0);
     }
 
-    // first step after reset is called without actions, just to get current state
-    ns3_ai_gym::DataContainer actDataContainerPbMsg = envActMsg.actdata();
-    Ptr<OpenGymDataContainer> actDataContainer =
-        OpenGymDataContainer::CreateFromDataContainerPbMsg(actDataContainerPbMsg);
-    ExecuteActions(actDataContainer);
+    NS_ABORT_MSG_IF(envActBatchMsg.acts_size() != static_cast<int>(m_numEnvs),
+                    "Expected " << m_numEnvs << " actions, got " << envActBatchMsg.acts_size());
+    for (uint32_t i = 0; i < m_numEnvs; ++i)
+    {
+        ns3_ai_gym::DataContainer actDataContainerPbMsg = envActBatchMsg.acts(i).actdata();
+        Ptr<OpenGymDataContainer> actDataContainer =
+            OpenGymDataContainer::CreateFromDataContainerPbMsg(actDataContainerPbMsg);
+        m_envs[i]->ExecuteActions(actDataContainer);
+    }
 }
 
 void
@@ -232,7 +474,28 @@ OpenGymInterface::NotifySimulationEnd()
 {
     NS_LOG_FUNCTION(this);
     m_simEnd = true;
-    if (m_initSimMsgSent)
+    if (m_initSimMsgSent && m_numEnvs > 1)
+    {
+        // report the final state of every environment
+        for (uint32_t i = 0; i < m_numEnvs; ++i)
+        {
+            SetEnvCallbacks(m_envs[i]);
+            m_batchStates[i] = GetEnvStateMsg(GetObservation());
+        }
+        SendBatchState();
+    }
+    else if (m_initSimMsgSent && m_async)
+    {
+        // report the final state, then discard actions until python stops
+        SendEnvState(GetObservation(), true);
+        ns3_ai_gym::EnvActMsg envActMsg;
+        Ptr<OpenGymDataContainer> actDataContainer;
+        do
+        {
+            RecvEnvAct(true, envActMsg, actDataContainer);
+        } while (!envActMsg.stopsimreq());
+    }
+    else if (m_initSimMsgSent)
     {
         WaitForStop();
     }
@@ -374,27 +637,133 @@ void
 OpenGymInterface::DoDispose()
 {
     NS_LOG_FUNCTION(this);
+    // the environments hold the interface, break the cycle
+    m_envs.clear();
+    m_batchStates.clear();
+    m_batchPending.clear();
+    m_batchCount = 0;
+    m_actionSpaceCb = MakeNullCallback<Ptr<OpenGymSpace>>();
+    m_observationSpaceCb = MakeNullCallback<Ptr<OpenGymSpace>>();
+    m_gameOverCb = MakeNullCallback<bool>();
+    m_obsCb = MakeNullCallback<Ptr<OpenGymDataContainer>>();
+    m_rewardCb = MakeNullCallback<float>();
+    m_extraInfoCb = MakeNullCallback<std::string>();
+    m_actionCb = MakeNullCallback<bool, Ptr<OpenGymDataContainer>>();
+    m_defaultActionCb = MakeNullCallback<Ptr<OpenGymDataContainer>>();
+    Object::DoDispose();
 }
 
 void
-OpenGymInterface::Notify(Ptr<OpenGymEnv> entity)
+OpenGymInterface::SetEnvCallbacks(Ptr<OpenGymEnv> entity)
 {
-    NS_LOG_FUNCTION(this);
-
     SetGetGameOverCb(MakeCallback(&OpenGymEnv::GetGameOver, entity));
     SetGetObservationCb(MakeCallback(&OpenGymEnv::GetObservation, entity));
     SetGetRewardCb(MakeCallback(&OpenGymEnv::GetReward, entity));
     SetGetExtraInfoCb(MakeCallback(&OpenGymEnv::GetExtraInfo, entity));
     SetExecuteActionsCb(MakeCallback(&OpenGymEnv::ExecuteActions, entity));
+}
+
+void
+OpenGymInterface::Notify(Ptr<OpenGymEnv> entity)
+{
+    NS_LOG_FUNCTION(this);
 
+    SetEnvCallbacks(entity);
+
+    if (m_numEnvs > 1)
+    {
+        NotifyBatchState(entity);
+        return;
+    }
     NotifyCurrentState();
 }
 
+void
+OpenGymInterface::SetNumEnvs(uint32_t numEnvs)
+{
+    NS_LOG_FUNCTION(this << numEnvs);
+    NS_ABORT_MSG_IF(m_initSimMsgSent, "Number of environments must be set before the first step");
+    NS_ABORT_MSG_IF(numEnvs == 0, "At least one environment is needed");
+    NS_ABORT_MSG_IF(numEnvs > 1 && m_async,
+                    "Asynchronous mode is not available with more than one environment");
+    m_numEnvs = numEnvs;
+    m_batchStates.resize(numEnvs);
+    m_batchPending.assign(numEnvs, false);
+    m_batchCount = 0;
+}
+
+void
+OpenGymInterface::SetAsyncMode(bool async, uint32_t maxStaleness)
+{
+    NS_LOG_FUNCTION(this << async << maxStaleness);
+    NS_ABORT_MSG_IF(m_initSimMsgSent,
+                    "Asynchronous mode must be set before the first step, Python side "
+                    "has been told the mode in the init message");
+    NS_ABORT_MSG_IF(async && m_numEnvs > 1,
+                    "Asynchronous mode is not available with more than one environment");
+    m_async = async;
+    m_maxStaleness = maxStaleness;
+}
+
+bool
+OpenGymInterface::GetAsyncMode() const
+{
+    return m_async;
+}
+
+void
+OpenGymInterface::SetGetDefaultActionCb(Callback<Ptr<OpenGymDataContainer>> cb)
+{
+    m_defaultActionCb = cb;
+}
+
+uint32_t
+OpenGymInterface::GetNumEnvs() const
+{
+    return m_numEnvs;
+}
+
+void
+OpenGymInterface::AddEnv(Ptr<OpenGymEnv> entity)
+{
+    NS_LOG_FUNCTION(this << entity);
+    if (std::find(m_envs.begin(), m_envs.end(), entity) == m_envs.end())
+    {
+        NS_ABORT_MSG_IF(m_envs.size() >= m_numEnvs, "More environments than set with SetNumEnvs");
+        m_envs.push_back(entity);
+    }
+}
+
+int64_t
+OpenGymInterface::AssignStreams(int64_t stream)
+{
+    NS_LOG_FUNCTION(this << stream);
+    int64_t currentStream = stream;
+    for (auto& env : m_envs)
+    {
+        currentStream += env->AssignStreams(currentStream);
+    }
+    return (currentStream - stream);
+}
+
 Ptr<OpenGymInterface>*
 OpenGymInterface::DoGet()
 {
-    static Ptr<OpenGymInterface> ptr = CreateObject<OpenGymInterface>();
+    static Ptr<OpenGymInterface> ptr = nullptr;
+    if (!ptr)
+    {
+        ptr = CreateObject<OpenGymInterface>();
+        Simulator::ScheduleDestroy(&OpenGymInterface::Delete);
+    }
     return &ptr;
 }
 
+void
+OpenGymInterface::Delete()
+{
+    NS_LOG_FUNCTION_NOARGS();
+    (*DoGet())->Dispose();
+    (*DoGet()) = nullptr;
+}
+
 } // namespace ns3
@@ -23,6 +23,7 @@
 #define NS3_NS3_AI_GYM_INTERFACE_H
 
 #include "../ns3-ai-gym-msg.h"
+#include "messages.pb.h"
 
 #include <ns3/ai-module.h>
 #include <ns3/callback.h>
@@ -30,6 +31,8 @@
 #include <ns3/ptr.h>
 #include <ns3/type-id.h>
 
+#include <vector>
+
 namespace ns3
 {
 
@@ -68,6 +71,52 @@ class OpenGymInterface : public Object
 
     void Notify(Ptr<OpenGymEnv> entity);
 
+    /**
+     * Sets the number of environments stepped together (1 by default).
+     * With more than one environment, the state of each environment is
+     * stored when it calls Notify. When all environments have notified,
+     * the states are sent to Python in a single message, and the actions
+     * of the batch are executed. The environments must register with
+     * AddEnv, and should notify at the same decision epochs.
+     */
+    void SetNumEnvs(uint32_t numEnvs);
+    uint32_t GetNumEnvs() const;
+
+    /**
+     * Registers an environment for batched mode. Its index in the batch is
+     * the registration order.
+     */
+    void AddEnv(Ptr<OpenGymEnv> entity);
+
+    /**
+     * Assigns fixed random variable streams to the environments of the batch,
+     * in registration order, so that each environment draws the same numbers
+     * whatever the number of environments created before it.
+     *
+     * \param stream first stream index to use
+     * \return the number of stream indices assigned
+     */
+    int64_t AssignStreams(int64_t stream);
+
+    /**
+     * Enables or disables asynchronous mode (disabled by default). In
+     * asynchronous mode, NotifyCurrentState publishes the state and returns
+     * without waiting for Python side. The action received since the last
+     * notification is executed if it was computed for a state at most
+     * maxStaleness states old, otherwise the default action is executed.
+     * A state not yet read by Python side is replaced by the newer one.
+     * Must be set before the first step. Not available with more than
+     * one environment.
+     */
+    void SetAsyncMode(bool async, uint32_t maxStaleness = 1);
+    bool GetAsyncMode() const;
+
+    /**
+     * Sets the callback providing the action executed in asynchronous mode
+     * when no fresh action is available. If not set, no action is executed.
+     */
+    void SetGetDefaultActionCb(Callback<Ptr<OpenGymDataContainer>> cb);
+
   protected:
     // Inherited
     void DoInitialize() override;
@@ -75,11 +124,38 @@ class OpenGymInterface : public Object
 
   private:
     static Ptr<OpenGymInterface>* DoGet();
-    //    static void Delete();
+    static void Delete();
+
+    void SetEnvCallbacks(Ptr<OpenGymEnv> entity);
+    ns3_ai_gym::EnvStateMsg GetEnvStateMsg(Ptr<OpenGymDataContainer> obsDataContainer);
+    void NotifyBatchState(Ptr<OpenGymEnv> entity);
+    void SendBatchState();
+    void NotifyCurrentStateAsync();
+    void SendEnvState(Ptr<OpenGymDataContainer> obsDataContainer, bool replace);
+    bool RecvEnvAct(bool block,
+                    ns3_ai_gym::EnvActMsg& envActMsg,
+                    Ptr<OpenGymDataContainer>& actDataContainer);
 
     bool m_simEnd;
     bool m_stopEnvRequested;
     bool m_initSimMsgSent;
+    bool m_flatMode;
+    Ns3AiGymFlatHeader* m_flatObsHeader;
+    Ns3AiGymFlatHeader* m_flatActHeader;
+
+    uint32_t m_numEnvs;
+    std::vector<Ptr<OpenGymEnv>> m_envs;
+    std::vector<ns3_ai_gym::EnvStateMsg> m_batchStates;
+    std::vector<bool> m_batchPending;
+    uint32_t m_batchCount;
+    uint8_t* m_batchCpp2PyBuffer;
+    uint8_t* m_batchPy2CppBuffer;
+    uint64_t m_batchCpp2PySize;
+    uint64_t m_batchPy2CppSize;
+
+    bool m_async;
+    uint32_t m_maxStaleness;
+    uint64_t m_stateSeq;
 
     Callback<Ptr<OpenGymSpace>> m_actionSpaceCb;
     Callback<Ptr<OpenGymSpace>> m_observationSpaceCb;
@@ -88,6 +164,7 @@ class OpenGymInterface : public Object
     Callback<float> m_rewardCb;
     Callback<std::string> m_extraInfoCb;
     Callback<bool, Ptr<OpenGymDataContainer>> m_actionCb;
+    Callback<Ptr<OpenGymDataContainer>> m_defaultActionCb;
 };
 
 } // end of namespace ns3
@@ -30,4 +30,32 @@ struct Ns3AiGymMsg
     uint32_t size;
 };
 
+// Flat mode: Box observations and actions bypass protobuf and are written
+// into two regions of the shared memory, each made of a header followed by
+// the raw elements. Python side maps the elements as a numpy array.
+
+#define FLAT_OBS_REGION_NAME "Gym Flat Obs"
+#define FLAT_ACT_REGION_NAME "Gym Flat Act"
+#define FLAT_MAX_DIMS 8
+
+struct Ns3AiGymFlatHeader
+{
+    uint32_t dtype;    // value of ns3_ai_gym::Dtype
+    uint32_t itemSize; // size of an element in bytes
+    uint32_t ndim;
+    uint32_t shape[FLAT_MAX_DIMS];
+    uint64_t capacity; // size of the element buffer in bytes
+    uint64_t count;    // number of elements in the buffer
+};
+
+#define FLAT_DATA_OFFSET 64
+
+static_assert(sizeof(Ns3AiGymFlatHeader) <= FLAT_DATA_OFFSET, "Flat header is too large");
+
+// Batched mode: the messages of several environments are serialized into two
+// regions of the shared memory, and Ns3AiGymMsg only carries their size.
+
+#define BATCH_CPP2PY_REGION_NAME "Gym Batch Cpp to Python"
+#define BATCH_PY2CPP_REGION_NAME "Gym Batch Python to Cpp"
+
 #endif // NS3_NS3_AI_GYM_MSG_H
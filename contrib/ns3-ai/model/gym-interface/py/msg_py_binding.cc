@@ -26,6 +26,12 @@ namespace py = pybind11;
 PYBIND11_MODULE(ns3ai_gym_msg_py, m)
 {
     m.attr("msg_buffer_size") = MSG_BUFFER_SIZE;
+    m.attr("flat_obs_region_name") = FLAT_OBS_REGION_NAME;
+    m.attr("flat_act_region_name") = FLAT_ACT_REGION_NAME;
+    m.attr("flat_max_dims") = FLAT_MAX_DIMS;
+    m.attr("flat_data_offset") = FLAT_DATA_OFFSET;
+    m.attr("batch_cpp2py_region_name") = BATCH_CPP2PY_REGION_NAME;
+    m.attr("batch_py2cpp_region_name") = BATCH_PY2CPP_REGION_NAME;
 
     py::class_<Ns3AiGymMsg>(m, "Ns3AiGymMsg")
         .def(py::init<>())
@@ -40,6 +46,11 @@ PYBIND11_MODULE(ns3ai_gym_msg_py, m)
             return py::memoryview::from_memory((void*)msg.buffer, MSG_BUFFER_SIZE);
         });
 
+    py::enum_<Ns3AiSyncMode>(m, "Ns3AiSyncMode", py::module_local())
+        .value("SYNC_MODE_SPIN", SYNC_MODE_SPIN)
+        .value("SYNC_MODE_ADAPTIVE", SYNC_MODE_ADAPTIVE);
+    m.attr("NS3_AI_DEFAULT_SPIN_COUNT") = NS3_AI_DEFAULT_SPIN_COUNT;
+
     py::class_<ns3::Ns3AiMsgInterfaceImpl<Ns3AiGymMsg, Ns3AiGymMsg>>(m, "Ns3AiMsgInterfaceImpl")
         .def(py::init<bool,
                       bool,
@@ -49,6 +60,10 @@ PYBIND11_MODULE(ns3ai_gym_msg_py, m)
                       const char*,
                       const char*,
                       const char*>())
+        .def("SetSyncMode",
+             &ns3::Ns3AiMsgInterfaceImpl<Ns3AiGymMsg, Ns3AiGymMsg>::SetSyncMode,
+             py::arg("mode"),
+             py::arg("spinCount") = NS3_AI_DEFAULT_SPIN_COUNT)
         .def("PyRecvBegin", &ns3::Ns3AiMsgInterfaceImpl<Ns3AiGymMsg, Ns3AiGymMsg>::PyRecvBegin)
         .def("PyRecvEnd", &ns3::Ns3AiMsgInterfaceImpl<Ns3AiGymMsg, Ns3AiGymMsg>::PyRecvEnd)
         .def("PySendBegin", &ns3::Ns3AiMsgInterfaceImpl<Ns3AiGymMsg, Ns3AiGymMsg>::PySendBegin)
@@ -58,5 +73,34 @@ PYBIND11_MODULE(ns3ai_gym_msg_py, m)
              py::return_value_policy::reference)
         .def("GetPy2CppStruct",
              &ns3::Ns3AiMsgInterfaceImpl<Ns3AiGymMsg, Ns3AiGymMsg>::GetPy2CppStruct,
-             py::return_value_policy::reference);
+             py::return_value_policy::reference)
+        .def("CreateCpp2PyRing",
+             &ns3::Ns3AiMsgInterfaceImpl<Ns3AiGymMsg, Ns3AiGymMsg>::CreateCpp2PyRing)
+        .def("GetCpp2PyRingSize",
+             &ns3::Ns3AiMsgInterfaceImpl<Ns3AiGymMsg, Ns3AiGymMsg>::GetCpp2PyRingSize)
+        .def("PyRingRecvBegin",
+             &ns3::Ns3AiMsgInterfaceImpl<Ns3AiGymMsg, Ns3AiGymMsg>::PyRingRecvBegin,
+             py::arg("maxCount") = 0)
+        .def("PyRingRecvEnd", &ns3::Ns3AiMsgInterfaceImpl<Ns3AiGymMsg, Ns3AiGymMsg>::PyRingRecvEnd)
+        .def("GetCpp2PyRingStruct",
+             &ns3::Ns3AiMsgInterfaceImpl<Ns3AiGymMsg, Ns3AiGymMsg>::GetCpp2PyRingStruct,
+             py::return_value_policy::reference)
+        .def("GetCpp2PyRingSeq",
+             &ns3::Ns3AiMsgInterfaceImpl<Ns3AiGymMsg, Ns3AiGymMsg>::GetCpp2PyRingSeq)
+        .def("CreateRegion",
+             [](ns3::Ns3AiMsgInterfaceImpl<Ns3AiGymMsg, Ns3AiGymMsg>& interface,
+                const std::string& name,
+                uint64_t size) { return interface.CreateRegion(name, size) != nullptr; })
+        .def("GetRegion",
+             [](ns3::Ns3AiMsgInterfaceImpl<Ns3AiGymMsg, Ns3AiGymMsg>& interface,
+                const std::string& name) -> py::object {
+                 // Get memoryview of the whole region, or None if not found
+                 uint64_t size = 0;
+                 uint8_t* region = interface.FindRegion(name, &size);
+                 if (!region)
+                 {
+                     return py::none();
+                 }
+                 return py::memoryview::from_memory((void*)region, size);
+             });
 }
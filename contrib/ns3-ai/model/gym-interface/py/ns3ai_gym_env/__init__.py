@@ -4,3 +4,8 @@ register(
     id="ns3ai_gym_env/Ns3-v0",
     entry_point="ns3ai_gym_env.envs:Ns3Env",
 )
+
+register(
+    id="ns3ai_gym_env/Ns3Vec-v0",
+    entry_point="ns3ai_gym_env.envs:Ns3VecEnv",
+)
@@ -1 +1 @@
-from ns3ai_gym_env.envs.ns3_environment import Ns3Env
+from ns3ai_gym_env.envs.ns3_environment import Ns3Env, Ns3VecEnv
@@ -6,8 +6,19 @@ import ns3ai_gym_msg_py as py_binding
 from ns3ai_utils import Experiment
 
 
+# Layout of Ns3AiGymFlatHeader in ns3-ai-gym-msg.h
+FLAT_HEADER_DTYPE = np.dtype([('dtype', '<u4'),
+                              ('itemSize', '<u4'),
+                              ('ndim', '<u4'),
+                              ('shape', '<u4', (py_binding.flat_max_dims,)),
+                              ('capacity', '<u8'),
+                              ('count', '<u8')], align=True)
+
+
 class Ns3Env(gym.Env):
     _created = False
+    # size of the batch message regions, only used by Ns3VecEnv
+    batchBufferSize = None
 
     def _create_space(self, spaceDesc):
         space = None
@@ -109,6 +120,72 @@ class Ns3Env(gym.Env):
             data = myDataDict
             return data
 
+    def _create_flat_region(self, name, space):
+        # large enough for any element type
+        capacity = int(np.prod(space.shape)) * 8
+        region = self.msgInterface.GetRegion(name)
+        if region is None:
+            if not self.msgInterface.CreateRegion(name, py_binding.flat_data_offset + capacity):
+                raise Exception('Ns3Env: Error: shared memory is too small for flat mode, '
+                                'increase shmSize')
+            region = self.msgInterface.GetRegion(name)
+        header = np.frombuffer(region, dtype=FLAT_HEADER_DTYPE, count=1)
+        header['capacity'] = len(region) - py_binding.flat_data_offset
+        return region, header
+
+    def _create_batch_region(self, name):
+        region = self.msgInterface.GetRegion(name)
+        if region is None:
+            if not self.msgInterface.CreateRegion(name, self.batchBufferSize):
+                raise Exception('Ns3Env: Error: shared memory is too small for batched mode, '
+                                'increase shmSize')
+            region = self.msgInterface.GetRegion(name)
+        return region
+
+    @staticmethod
+    def _flat_np_dtype(dtype, itemSize):
+        if dtype == pb.INT:
+            return np.dtype('<i{}'.format(itemSize))
+        elif dtype == pb.UINT:
+            return np.dtype('<u{}'.format(itemSize))
+        elif dtype == pb.DOUBLE:
+            return np.dtype('<f8')
+        else:
+            return np.dtype('<f4')
+
+    def _get_flat_obs(self):
+        # view on the shared memory, valid until the next step
+        header = self.flatObsHeader[0]
+        count = int(header['count'])
+        data = np.frombuffer(self.flatObsRegion,
+                             dtype=self._flat_np_dtype(header['dtype'], header['itemSize']),
+                             count=count, offset=py_binding.flat_data_offset)
+        shape = tuple(int(i) for i in header['shape'][:header['ndim']])
+        if shape and int(np.prod(shape)) == count:
+            data = data.reshape(shape)
+        return data
+
+    def _write_flat_actions(self, actions):
+        # same element types as _pack_data
+        kind = np.dtype(self.action_space.dtype).kind
+        if kind == 'i':
+            dtype, npDtype = pb.INT, np.dtype('<i4')
+        elif kind == 'u':
+            dtype, npDtype = pb.UINT, np.dtype('<u4')
+        else:
+            dtype, npDtype = pb.FLOAT, np.dtype('<f4')
+        data = np.asarray(actions, dtype=npDtype).ravel()
+        header = self.flatActHeader
+        if data.nbytes > int(header['capacity'][0]):
+            raise Exception('Ns3Env: Error: action does not fit into the flat region')
+        header['dtype'] = dtype
+        header['itemSize'] = npDtype.itemsize
+        header['ndim'] = 1
+        header['shape'][0][0] = data.size
+        header['count'] = data.size
+        np.frombuffer(self.flatActRegion, dtype=npDtype, count=data.size,
+                      offset=py_binding.flat_data_offset)[:] = data
+
     def initialize_env(self):
         simInitMsg = pb.SimInitMsg()
         self.msgInterface.PyRecvBegin()
@@ -122,6 +199,24 @@ class Ns3Env(gym.Env):
         reply = pb.SimInitAck()
         reply.done = True
         reply.stopSimReq = False
+        self.numEnvs = max(simInitMsg.numEnvs, 1)
+        self.asyncMode = simInitMsg.asyncMode
+        if self.numEnvs > 1:
+            if not self.batchBufferSize:
+                raise Exception('Ns3Env: Error: ns-3 hosts {} environments, use Ns3VecEnv'
+                                .format(self.numEnvs))
+            self.batchCpp2Py = self._create_batch_region(py_binding.batch_cpp2py_region_name)
+            self.batchPy2Cpp = self._create_batch_region(py_binding.batch_py2cpp_region_name)
+        # flat mode is only available if both spaces are Box
+        self.useFlat = (self.flatMode and self.numEnvs == 1
+                        and isinstance(self.action_space, spaces.Box)
+                        and isinstance(self.observation_space, spaces.Box))
+        if self.useFlat:
+            self.flatObsRegion, self.flatObsHeader = self._create_flat_region(
+                py_binding.flat_obs_region_name, self.observation_space)
+            self.flatActRegion, self.flatActHeader = self._create_flat_region(
+                py_binding.flat_act_region_name, self.action_space)
+            reply.flatMode = True
         reply_str = reply.SerializeToString()
         assert len(reply_str) <= py_binding.msg_buffer_size
 
@@ -153,12 +248,19 @@ class Ns3Env(gym.Env):
         self.msgInterface.PyRecvBegin()
         request = self.msgInterface.GetCpp2PyStruct().get_buffer()
         envStateMsg.ParseFromString(request)
+        if self.useFlat:
+            self.obsData = self._get_flat_obs()
+            if self.asyncMode:
+                # C++ side writes the next state without waiting for the action
+                self.obsData = self.obsData.copy()
         self.msgInterface.PyRecvEnd()
 
-        self.obsData = self._create_data(envStateMsg.obsData)
+        if not self.useFlat:
+            self.obsData = self._create_data(envStateMsg.obsData)
         self.reward = envStateMsg.reward
         self.gameOver = envStateMsg.isGameOver
         self.gameOverReason = envStateMsg.reason
+        self.stateSeq = envStateMsg.seq
 
         if self.gameOver:
             self.send_close_command()
@@ -251,13 +353,19 @@ class Ns3Env(gym.Env):
 
     def send_actions(self, actions):
         reply = pb.EnvActMsg()
+        # lets C++ side drop actions computed for outdated states in async mode
+        reply.seq = self.stateSeq
 
-        actionMsg = self._pack_data(actions, self.action_space)
-        reply.actData.CopyFrom(actionMsg)
+        if not self.useFlat:
+            actionMsg = self._pack_data(actions, self.action_space)
+            reply.actData.CopyFrom(actionMsg)
 
         replyMsg = reply.SerializeToString()
         assert len(replyMsg) <= py_binding.msg_buffer_size
         self.msgInterface.PySendBegin()
+        if self.useFlat:
+            # C++ side may still read the previous action until PySendBegin returns
+            self._write_flat_actions(actions)
         self.msgInterface.GetPy2CppStruct().size = len(replyMsg)
         self.msgInterface.GetPy2CppStruct().get_buffer_full()[:len(replyMsg)] = replyMsg
         self.msgInterface.PySendEnd()
@@ -271,11 +379,16 @@ class Ns3Env(gym.Env):
         extraInfo = {"info": self.get_extra_info()}
         return obs, reward, done, False, extraInfo
 
-    def __init__(self, targetName, ns3Path, ns3Settings=None, shmSize=4096):
+    def __init__(self, targetName, ns3Path, ns3Settings=None, shmSize=4096, adaptiveSync=False,
+                 flatMode=False):
         if self._created:
             raise Exception('Error: Ns3Env is singleton')
         self._created = True
-        self.exp = Experiment(targetName, ns3Path, py_binding, shmSize=shmSize)
+        self.flatMode = flatMode
+        self.useFlat = False
+        self.asyncMode = False
+        self.exp = Experiment(targetName, ns3Path, py_binding, shmSize=shmSize,
+                              adaptiveSync=adaptiveSync)
         self.ns3Settings = ns3Settings
 
         self.newStateRx = False
@@ -284,6 +397,7 @@ class Ns3Env(gym.Env):
         self.gameOver = False
         self.gameOverReason = None
         self.extraInfo = None
+        self.stateSeq = 0
 
         self.msgInterface = self.exp.run(setting=self.ns3Settings, show_output=True)
         self.initialize_env()
@@ -303,7 +417,7 @@ class Ns3Env(gym.Env):
             return obs, {}
 
         # not using self.exp.kill() here in order for semaphores to reset to initial state
-        if not self.gameOver:
+        if not np.all(self.gameOver):
             self.rx_env_state()
             self.send_close_command()
 
@@ -314,6 +428,7 @@ class Ns3Env(gym.Env):
         self.gameOver = False
         self.gameOverReason = None
         self.extraInfo = None
+        self.stateSeq = 0
 
         self.msgInterface = self.exp.run(show_output=True)
         self.initialize_env()
@@ -336,3 +451,81 @@ class Ns3Env(gym.Env):
         self.exp.kill()
         # destroy the message interface and its shared memory segment
         del self.exp
+
+
+class Ns3VecEnv(Ns3Env):
+    """
+    Steps the environments hosted by one ns-3 process together, see
+    OpenGymInterface::SetNumEnvs. Observations, rewards and game status
+    are batched along the first axis, and step expects one action per
+    environment. observation_space and action_space describe a single
+    environment.
+    """
+
+    def __init__(self, targetName, ns3Path, ns3Settings=None, shmSize=1 << 18, adaptiveSync=False,
+                 batchBufferSize=1 << 16):
+        self.batchBufferSize = batchBufferSize
+        super().__init__(targetName, ns3Path, ns3Settings=ns3Settings, shmSize=shmSize,
+                         adaptiveSync=adaptiveSync)
+
+    @property
+    def num_envs(self):
+        return self.numEnvs
+
+    def _send_batch(self, msg):
+        msgStr = msg.SerializeToString()
+        assert len(msgStr) <= len(self.batchPy2Cpp)
+        self.msgInterface.PySendBegin()
+        self.msgInterface.GetPy2CppStruct().size = len(msgStr)
+        self.batchPy2Cpp[:len(msgStr)] = msgStr
+        self.msgInterface.PySendEnd()
+
+    def send_close_command(self):
+        reply = pb.EnvActBatchMsg()
+        reply.stopSimReq = True
+        self._send_batch(reply)
+
+        self.newStateRx = False
+        return True
+
+    def rx_env_state(self):
+        if self.newStateRx:
+            return
+
+        envStateBatchMsg = pb.EnvStateBatchMsg()
+        self.msgInterface.PyRecvBegin()
+        size = self.msgInterface.GetCpp2PyStruct().size
+        envStateBatchMsg.ParseFromString(self.batchCpp2Py[:size])
+        self.msgInterface.PyRecvEnd()
+
+        states = envStateBatchMsg.states
+        obsData = [self._create_data(state.obsData) for state in states]
+        try:
+            self.obsData = np.stack(obsData)
+        except (ValueError, TypeError):
+            self.obsData = obsData
+        self.reward = np.array([state.reward for state in states], dtype=np.float32)
+        self.gameOver = np.array([state.isGameOver for state in states], dtype=bool)
+        self.gameOverReason = [state.reason for state in states]
+        self.extraInfo = [state.info for state in states]
+
+        # the environments share one simulation, which stops when all of them are over
+        if self.gameOver.all():
+            self.send_close_command()
+
+        self.newStateRx = True
+
+    def send_actions(self, actions):
+        if len(actions) != self.numEnvs:
+            raise Exception('Ns3VecEnv: Error: expected {} actions, got {}'
+                            .format(self.numEnvs, len(actions)))
+        reply = pb.EnvActBatchMsg()
+        for action in actions:
+            envActMsg = reply.acts.add()
+            envActMsg.actData.CopyFrom(self._pack_data(action, self.action_space))
+        self._send_batch(reply)
+        self.newStateRx = False
+        return True
+
+    def get_random_action(self):
+        return [self.action_space.sample() for _ in range(self.numEnvs)]
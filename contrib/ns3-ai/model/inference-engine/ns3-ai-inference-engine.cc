@@ -0,0 +1,415 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3-ai-inference-engine.h"
+
+#include <ns3/abort.h>
+#include <ns3/log.h>
+#include <ns3/simulator.h>
+#include <ns3/string.h>
+#include <ns3/uinteger.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+#ifdef NS3AI_WITH_LIBTORCH
+#include <torch/script.h>
+#endif
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("Ns3AiInferenceEngine");
+NS_OBJECT_ENSURE_REGISTERED(Ns3AiInferenceEngine);
+
+/**
+ * Evaluates a batch of inputs, implemented by each model format.
+ */
+class Ns3AiInferenceBackend
+{
+  public:
+    virtual ~Ns3AiInferenceBackend() = default;
+
+    /// \return the input size, 0 if unknown
+    virtual uint32_t GetInputSize() const = 0;
+
+    /**
+     * Evaluates batchSize contiguous inputs and resizes output to hold the
+     * contiguous outputs.
+     *
+     * \return the output size of one input
+     */
+    virtual uint32_t Forward(const float* input,
+                             uint32_t batchSize,
+                             uint32_t inputSize,
+                             std::vector<float>& output) = 0;
+};
+
+/**
+ * Built-in CPU kernel for fully connected networks in the ns3-ai MLP
+ * format.
+ */
+class Ns3AiMlpBackend : public Ns3AiInferenceBackend
+{
+  public:
+    enum Activation
+    {
+        LINEAR,
+        RELU,
+        TANH,
+        SIGMOID
+    };
+
+    struct Layer
+    {
+        uint32_t in;
+        uint32_t out;
+        Activation activation;
+        std::vector<float> weights; //!< out x in, row-major
+        std::vector<float> biases;
+    };
+
+    static bool IsMlpFile(const std::string& path)
+    {
+        std::ifstream file(path);
+        std::string magic;
+        file >> magic;
+        return magic == "ns3ai-mlp";
+    }
+
+    explicit Ns3AiMlpBackend(const std::string& path)
+    {
+        std::ifstream file(path);
+        std::string magic;
+        uint32_t version = 0;
+        uint32_t numLayers = 0;
+        file >> magic >> version >> numLayers;
+        NS_ABORT_MSG_IF(!file || version != 1, "Unsupported MLP file " << path);
+        for (uint32_t l = 0; l < numLayers; ++l)
+        {
+            Layer layer;
+            std::string activation;
+            file >> layer.in >> layer.out >> activation;
+            if (activation == "relu")
+            {
+                layer.activation = RELU;
+            }
+            else if (activation == "tanh")
+            {
+                layer.activation = TANH;
+            }
+            else if (activation == "sigmoid")
+            {
+                layer.activation = SIGMOID;
+            }
+            else
+            {
+                NS_ABORT_MSG_IF(activation != "linear",
+                                "Unknown activation " << activation << " in " << path);
+                layer.activation = LINEAR;
+            }
+            NS_ABORT_MSG_IF(!m_layers.empty() && m_layers.back().out != layer.in,
+                            "Layer " << l << " of " << path << " does not fit the previous one");
+            layer.weights.resize(static_cast<size_t>(layer.in) * layer.out);
+            layer.biases.resize(layer.out);
+            for (auto& w : layer.weights)
+            {
+                file >> w;
+            }
+            for (auto& b : layer.biases)
+            {
+                file >> b;
+            }
+            NS_ABORT_MSG_IF(!file, "Truncated layer " << l << " in " << path);
+            m_layers.push_back(std::move(layer));
+        }
+        NS_ABORT_MSG_IF(m_layers.empty(), "MLP file " << path << " has no layer");
+    }
+
+    uint32_t GetInputSize() const override
+    {
+        return m_layers.front().in;
+    }
+
+    uint32_t Forward(const float* input,
+                     uint32_t batchSize,
+                     uint32_t inputSize,
+                     std::vector<float>& output) override
+    {
+        NS_ABORT_MSG_IF(inputSize != GetInputSize(),
+                        "Input size " << inputSize << " does not match the model ("
+                                      << GetInputSize() << ")");
+        const float* x = input;
+        for (size_t l = 0; l < m_layers.size(); ++l)
+        {
+            const Layer& layer = m_layers[l];
+            // ping-pong between two buffers, the last layer writes output
+            std::vector<float>& y =
+                (l + 1 == m_layers.size()) ? output : m_buffers[l % 2];
+            y.resize(static_cast<size_t>(batchSize) * layer.out);
+            for (uint32_t b = 0; b < batchSize; ++b)
+            {
+                const float* xb = x + static_cast<size_t>(b) * layer.in;
+                float* yb = y.data() + static_cast<size_t>(b) * layer.out;
+                for (uint32_t o = 0; o < layer.out; ++o)
+                {
+                    const float* w = layer.weights.data() + static_cast<size_t>(o) * layer.in;
+                    float sum = layer.biases[o];
+                    for (uint32_t i = 0; i < layer.in; ++i)
+                    {
+                        sum += w[i] * xb[i];
+                    }
+                    yb[o] = Activate(layer.activation, sum);
+                }
+            }
+            x = y.data();
+        }
+        return m_layers.back().out;
+    }
+
+  private:
+    static float Activate(Activation activation, float v)
+    {
+        switch (activation)
+        {
+        case RELU:
+            return v > 0 ? v : 0;
+        case TANH:
+            return std::tanh(v);
+        case SIGMOID:
+            return 1 / (1 + std::exp(-v));
+        default:
+            return v;
+        }
+    }
+
+    std::vector<Layer> m_layers;
+    std::vector<float> m_buffers[2];
+};
+
+#ifdef NS3AI_WITH_LIBTORCH
+/**
+ * TorchScript module evaluated by libtorch on CPU. The module takes a
+ * [batch, input] float tensor and returns a [batch, output] tensor.
+ */
+class Ns3AiTorchBackend : public Ns3AiInferenceBackend
+{
+  public:
+    explicit Ns3AiTorchBackend(const std::string& path)
+    {
+        try
+        {
+            m_module = torch::jit::load(path);
+        }
+        catch (const c10::Error& e)
+        {
+            NS_FATAL_ERROR("Cannot load TorchScript module " << path << ": " << e.what());
+        }
+        m_module.eval();
+    }
+
+    uint32_t GetInputSize() const override
+    {
+        return 0;
+    }
+
+    uint32_t Forward(const float* input,
+                     uint32_t batchSize,
+                     uint32_t inputSize,
+                     std::vector<float>& output) override
+    {
+        torch::NoGradGuard noGrad;
+        torch::Tensor x = torch::from_blob(const_cast<float*>(input),
+                                           {static_cast<int64_t>(batchSize),
+                                            static_cast<int64_t>(inputSize)},
+                                           torch::kFloat);
+        torch::Tensor y = m_module.forward({x}).toTensor().to(torch::kFloat).contiguous();
+        uint32_t outputSize = y.numel() / batchSize;
+        output.assign(y.data_ptr<float>(), y.data_ptr<float>() + y.numel());
+        return outputSize;
+    }
+
+  private:
+    torch::jit::script::Module m_module;
+};
+#endif
+
+TypeId
+Ns3AiInferenceEngine::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::Ns3AiInferenceEngine")
+            .SetParent<Object>()
+            .SetGroupName("Ai")
+            .AddConstructor<Ns3AiInferenceEngine>()
+            .AddAttribute("ModelPath",
+                          "Model loaded at the first evaluation if Load was not called",
+                          StringValue(""),
+                          MakeStringAccessor(&Ns3AiInferenceEngine::m_modelPath),
+                          MakeStringChecker())
+            .AddAttribute("MaxBatchSize",
+                          "Number of submitted inputs that triggers an evaluation before the "
+                          "scheduled flush, 0 for no limit",
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&Ns3AiInferenceEngine::m_maxBatchSize),
+                          MakeUintegerChecker<uint32_t>());
+    return tid;
+}
+
+Ns3AiInferenceEngine::Ns3AiInferenceEngine()
+    : m_maxBatchSize(0),
+      m_pendingInputSize(0),
+      m_numInferences(0),
+      m_numBatches(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+Ns3AiInferenceEngine::~Ns3AiInferenceEngine()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+Ns3AiInferenceEngine::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    m_flushEvent.Cancel();
+    m_pendingInputs.clear();
+    m_pendingCallbacks.clear();
+    m_backend.reset();
+    Object::DoDispose();
+}
+
+void
+Ns3AiInferenceEngine::Load(const std::string& path)
+{
+    NS_LOG_FUNCTION(this << path);
+    m_modelPath = path;
+    if (Ns3AiMlpBackend::IsMlpFile(path))
+    {
+        m_backend = std::make_unique<Ns3AiMlpBackend>(path);
+        return;
+    }
+#ifdef NS3AI_WITH_LIBTORCH
+    m_backend = std::make_unique<Ns3AiTorchBackend>(path);
+#else
+    NS_FATAL_ERROR("Model " << path
+                            << " is not in the ns3-ai MLP format, and ns3-ai is built without "
+                               "libtorch");
+#endif
+}
+
+bool
+Ns3AiInferenceEngine::IsBuiltinMlp() const
+{
+    return dynamic_cast<Ns3AiMlpBackend*>(m_backend.get()) != nullptr;
+}
+
+uint32_t
+Ns3AiInferenceEngine::GetInputSize() const
+{
+    return m_backend ? m_backend->GetInputSize() : 0;
+}
+
+std::vector<float>
+Ns3AiInferenceEngine::Infer(const std::vector<float>& input)
+{
+    std::vector<float> output;
+    InferBatch(input.data(), 1, input.size(), output);
+    return output;
+}
+
+uint32_t
+Ns3AiInferenceEngine::InferBatch(const float* input,
+                                 uint32_t batchSize,
+                                 uint32_t inputSize,
+                                 std::vector<float>& output)
+{
+    NS_LOG_FUNCTION(this << batchSize << inputSize);
+    if (!m_backend)
+    {
+        NS_ABORT_MSG_IF(m_modelPath.empty(), "No model loaded");
+        Load(m_modelPath);
+    }
+    ++m_numBatches;
+    m_numInferences += batchSize;
+    return m_backend->Forward(input, batchSize, inputSize, output);
+}
+
+void
+Ns3AiInferenceEngine::Submit(const std::vector<float>& input, OutputCallback cb)
+{
+    NS_LOG_FUNCTION(this);
+    if (m_pendingCallbacks.empty())
+    {
+        m_pendingInputSize = input.size();
+        // runs after the events already scheduled for this time
+        m_flushEvent = Simulator::ScheduleNow(&Ns3AiInferenceEngine::Flush, this);
+    }
+    NS_ABORT_MSG_IF(input.size() != m_pendingInputSize,
+                    "Inputs of the same batch must have the same size");
+    m_pendingInputs.insert(m_pendingInputs.end(), input.begin(), input.end());
+    m_pendingCallbacks.push_back(cb);
+    if (m_maxBatchSize != 0 && m_pendingCallbacks.size() >= m_maxBatchSize)
+    {
+        Flush();
+    }
+}
+
+void
+Ns3AiInferenceEngine::Flush()
+{
+    NS_LOG_FUNCTION(this);
+    m_flushEvent.Cancel();
+    if (m_pendingCallbacks.empty())
+    {
+        return;
+    }
+    // callbacks may submit again, which starts a new batch
+    std::vector<float> inputs;
+    std::vector<OutputCallback> callbacks;
+    inputs.swap(m_pendingInputs);
+    callbacks.swap(m_pendingCallbacks);
+
+    std::vector<float> outputs;
+    outputs.swap(m_outputs);
+
+    uint32_t outputSize = InferBatch(inputs.data(), callbacks.size(), m_pendingInputSize, outputs);
+    NS_LOG_DEBUG("Evaluated a batch of " << callbacks.size());
+    std::vector<float> output(outputSize);
+    for (size_t b = 0; b < callbacks.size(); ++b)
+    {
+        std::copy_n(outputs.begin() + b * outputSize, outputSize, output.begin());
+        callbacks[b](output);
+    }
+    // keep the allocation for the next batch
+    m_outputs.swap(outputs);
+}
+
+uint64_t
+Ns3AiInferenceEngine::GetNumInferences() const
+{
+    return m_numInferences;
+}
+
+uint64_t
+Ns3AiInferenceEngine::GetNumBatches() const
+{
+    return m_numBatches;
+}
+
+} // namespace ns3
@@ -0,0 +1,134 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef NS3_NS3_AI_INFERENCE_ENGINE_H
+#define NS3_NS3_AI_INFERENCE_ENGINE_H
+
+#include <ns3/callback.h>
+#include <ns3/event-id.h>
+#include <ns3/object.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+
+class Ns3AiInferenceBackend;
+
+/**
+ * \brief Evaluates a trained policy inside the simulation process.
+ *
+ * The model is either a TorchScript module (when ns3-ai is built with
+ * libtorch) or a small MLP in the ns3-ai MLP format, evaluated by a
+ * built-in CPU kernel. The MLP format is a text file:
+ *
+ *     ns3ai-mlp 1
+ *     <number of layers>
+ *     <in> <out> <linear|relu|tanh|sigmoid>
+ *     <out x in weights, row-major>
+ *     <out biases>
+ *     ...
+ *
+ * which save_mlp in python_utils/ns3ai_utils.py writes from trained
+ * weights.
+ *
+ * Inputs passed to Submit are not evaluated immediately. The first input
+ * of a batch schedules a flush with Simulator::ScheduleNow, so the batch
+ * collects the inputs submitted by the events already scheduled for the
+ * current time, and is evaluated after them. The callbacks receive the
+ * outputs in submission order. Inputs submitted at the same time by
+ * events scheduled during or after the flush form the next batch.
+ */
+class Ns3AiInferenceEngine : public Object
+{
+  public:
+    /// Receives the output of one input passed to Submit
+    typedef Callback<void, const std::vector<float>&> OutputCallback;
+
+    static TypeId GetTypeId();
+    Ns3AiInferenceEngine();
+    ~Ns3AiInferenceEngine() override;
+
+    /**
+     * Loads the model. TorchScript is used for files not in the ns3-ai
+     * MLP format.
+     */
+    void Load(const std::string& path);
+
+    /**
+     * \return whether the model is evaluated by the built-in MLP kernel
+     */
+    bool IsBuiltinMlp() const;
+
+    /**
+     * \return the input size of the model, or 0 if it is only known after
+     * the first evaluation (TorchScript)
+     */
+    uint32_t GetInputSize() const;
+
+    /**
+     * Evaluates one input immediately.
+     */
+    std::vector<float> Infer(const std::vector<float>& input);
+
+    /**
+     * Evaluates batchSize inputs of inputSize floats each, stored
+     * contiguously. The outputs are stored contiguously in output.
+     *
+     * \return the output size of one input
+     */
+    uint32_t InferBatch(const float* input,
+                        uint32_t batchSize,
+                        uint32_t inputSize,
+                        std::vector<float>& output);
+
+    /**
+     * Queues an input for the next flush, see the class description.
+     */
+    void Submit(const std::vector<float>& input, OutputCallback cb);
+
+    /**
+     * Evaluates the queued inputs now.
+     */
+    void Flush();
+
+    /// \return the number of inputs evaluated
+    uint64_t GetNumInferences() const;
+    /// \return the number of batches evaluated
+    uint64_t GetNumBatches() const;
+
+  protected:
+    void DoDispose() override;
+
+  private:
+    std::unique_ptr<Ns3AiInferenceBackend> m_backend;
+    std::string m_modelPath;
+    uint32_t m_maxBatchSize;
+
+    std::vector<float> m_pendingInputs;
+    std::vector<OutputCallback> m_pendingCallbacks;
+    uint32_t m_pendingInputSize;
+    EventId m_flushEvent;
+    std::vector<float> m_outputs;
+
+    uint64_t m_numInferences;
+    uint64_t m_numBatches;
+};
+
+} // namespace ns3
+
+#endif // NS3_NS3_AI_INFERENCE_ENGINE_H
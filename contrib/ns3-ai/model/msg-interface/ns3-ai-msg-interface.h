@@ -24,15 +24,24 @@
 
 #include <ns3/singleton.h>
 
+#include <cassert>
 #include <cstddef>
 #include <cstdint>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <stdexcept>
 #include <string>
+#include <typeindex>
 #include <vector>
 #include <boost/interprocess/allocators/allocator.hpp>
 #include <boost/interprocess/containers/vector.hpp>
 #include <boost/interprocess/managed_shared_memory.hpp>
 
+// This header is also compiled into the Python bindings, which do not link
+// the ns-3 libraries: check with assert and report errors with exceptions,
+// not with the ns-3 log, assert or abort macros.
+
 namespace ns3
 {
 
@@ -46,6 +55,47 @@ struct Ns3AiMsgSync
     volatile uint8_t m_py2cppEmptyCount{1};
     volatile uint8_t m_py2cppFullCount{0};
     bool m_isFinished{false};
+    Ns3AiFutex m_cpp2pyEmptyFutex;
+    Ns3AiFutex m_cpp2pyFullFutex;
+    Ns3AiFutex m_py2cppEmptyFutex;
+    Ns3AiFutex m_py2cppFullFutex;
+};
+
+/**
+ * Default number of tries before a waiter in adaptive mode parks on the futex
+ */
+#define NS3_AI_DEFAULT_SPIN_COUNT 20000
+
+/**
+ * Maximum number of slots in the C++ to Python ring, limited by the
+ * width of the semaphore counters
+ */
+#define NS3_AI_MAX_RING_SLOTS 255
+
+/**
+ * \brief Header of the single-producer single-consumer ring used to stream
+ * messages from C++ to Python without waiting for each message to be consumed
+ */
+struct Ns3AiMsgRing
+{
+    uint32_t m_numSlots{0};
+    uint64_t m_head{0};                   //!< Sequence number of the next slot to write (C++)
+    uint64_t m_tail{0};                   //!< Sequence number of the next slot to read (Python)
+    volatile uint64_t m_finishSeq{~0ULL}; //!< Sequence number of the finish marker
+    volatile uint8_t m_emptyCount{0};
+    volatile uint8_t m_fullCount{0};
+    Ns3AiFutex m_emptyFutex;
+    Ns3AiFutex m_fullFutex;
+};
+
+/**
+ * \brief A slot of the C++ to Python ring
+ */
+template <typename MsgType>
+struct Ns3AiMsgRingSlot
+{
+    volatile uint64_t m_seq{0}; //!< Sequence number of the message held in the slot
+    MsgType m_msg;
 };
 
 /**
@@ -69,19 +119,23 @@ class Ns3AiMsgInterfaceImpl
           m_useVector(use_vector),
           m_handleFinish(handle_finish),
           m_segName(segment_name),
-          m_isFinished(false)
+          m_cpp2pyMsgName(cpp2py_msg_name),
+          m_isFinished(false),
+          m_syncMode(SYNC_MODE_SPIN),
+          m_spinCount(NS3_AI_DEFAULT_SPIN_COUNT)
     {
         using namespace boost::interprocess;
         if (m_isCreator)
         {
             shared_memory_object::remove(m_segName.c_str());
-            static managed_shared_memory segment(create_only, m_segName.c_str(), size);
+            m_segment =
+                std::make_unique<managed_shared_memory>(create_only, m_segName.c_str(), size);
             if (m_useVector)
             {
-                static const Cpp2PyMsgAllocator alloc_env(segment.get_segment_manager());
-                static const Cpp2PyMsgAllocator alloc_act(segment.get_segment_manager());
-                m_cpp2pyVector = segment.construct<Cpp2PyMsgVector>(cpp2py_msg_name)(alloc_env);
-                m_py2cppVector = segment.construct<Py2CppMsgVector>(py2cpp_msg_name)(alloc_act);
+                const Cpp2PyMsgAllocator alloc_env(m_segment->get_segment_manager());
+                const Py2CppMsgAllocator alloc_act(m_segment->get_segment_manager());
+                m_cpp2pyVector = m_segment->construct<Cpp2PyMsgVector>(cpp2py_msg_name)(alloc_env);
+                m_py2cppVector = m_segment->construct<Py2CppMsgVector>(py2cpp_msg_name)(alloc_act);
                 m_cpp2pyStruct = nullptr;
                 m_py2CppStruct = nullptr;
             }
@@ -89,18 +143,18 @@ class Ns3AiMsgInterfaceImpl
             {
                 m_cpp2pyVector = nullptr;
                 m_py2cppVector = nullptr;
-                m_cpp2pyStruct = segment.construct<Cpp2PyMsgType>(cpp2py_msg_name)();
-                m_py2CppStruct = segment.construct<Py2CppMsgType>(py2cpp_msg_name)();
+                m_cpp2pyStruct = m_segment->construct<Cpp2PyMsgType>(cpp2py_msg_name)();
+                m_py2CppStruct = m_segment->construct<Py2CppMsgType>(py2cpp_msg_name)();
             }
-            m_sync = segment.construct<Ns3AiMsgSync>(lockable_name)();
+            m_sync = m_segment->construct<Ns3AiMsgSync>(lockable_name)();
         }
         else
         {
-            static managed_shared_memory segment(open_only, segment_name);
+            m_segment = std::make_unique<managed_shared_memory>(open_only, segment_name);
             if (m_useVector)
             {
-                m_cpp2pyVector = segment.find<Cpp2PyMsgVector>(cpp2py_msg_name).first;
-                m_py2cppVector = segment.find<Py2CppMsgVector>(py2cpp_msg_name).first;
+                m_cpp2pyVector = m_segment->find<Cpp2PyMsgVector>(cpp2py_msg_name).first;
+                m_py2cppVector = m_segment->find<Py2CppMsgVector>(py2cpp_msg_name).first;
                 m_cpp2pyStruct = nullptr;
                 m_py2CppStruct = nullptr;
             }
@@ -108,10 +162,10 @@ class Ns3AiMsgInterfaceImpl
             {
                 m_cpp2pyVector = nullptr;
                 m_py2cppVector = nullptr;
-                m_cpp2pyStruct = segment.find<Cpp2PyMsgType>(cpp2py_msg_name).first;
-                m_py2CppStruct = segment.find<Py2CppMsgType>(py2cpp_msg_name).first;
+                m_cpp2pyStruct = m_segment->find<Cpp2PyMsgType>(cpp2py_msg_name).first;
+                m_py2CppStruct = m_segment->find<Py2CppMsgType>(py2cpp_msg_name).first;
             }
-            m_sync = segment.find<Ns3AiMsgSync>(lockable_name).first;
+            m_sync = m_segment->find<Ns3AiMsgSync>(lockable_name).first;
         }
     };
 
@@ -147,7 +201,7 @@ class Ns3AiMsgInterfaceImpl
      */
     Cpp2PyMsgType* GetCpp2PyStruct()
     {
-        assert(!m_useVector);
+        assert(!m_useVector && "Struct used with vector-based interface");
         return m_cpp2pyStruct;
     };
 
@@ -157,7 +211,7 @@ class Ns3AiMsgInterfaceImpl
      */
     Py2CppMsgType* GetPy2CppStruct()
     {
-        assert(!m_useVector);
+        assert(!m_useVector && "Struct used with vector-based interface");
         return m_py2CppStruct;
     };
 
@@ -169,7 +223,7 @@ class Ns3AiMsgInterfaceImpl
      */
     Cpp2PyMsgVector* GetCpp2PyVector()
     {
-        assert(m_useVector);
+        assert(m_useVector && "Vector used with struct-based interface");
         return m_cpp2pyVector;
     };
 
@@ -179,19 +233,139 @@ class Ns3AiMsgInterfaceImpl
      */
     Py2CppMsgVector* GetPy2CppVector()
     {
-        assert(m_useVector);
+        assert(m_useVector && "Vector used with struct-based interface");
         return m_py2cppVector;
     };
 
+    /**
+     * Sets how this side waits when the other side is not ready. In
+     * SYNC_MODE_SPIN (the default) the caller busy-spins. In
+     * SYNC_MODE_ADAPTIVE, it spins for spinCount tries and then sleeps
+     * until the other side posts, so an idle peer costs almost no CPU.
+     * The two sides may use different modes.
+     */
+    void SetSyncMode(Ns3AiSyncMode mode, uint32_t spinCount = NS3_AI_DEFAULT_SPIN_COUNT)
+    {
+        m_syncMode = mode;
+        m_spinCount = spinCount;
+    };
+
+    /**
+     * Gets the wait mode of this side
+     */
+    Ns3AiSyncMode GetSyncMode() const
+    {
+        return m_syncMode;
+    };
+
+    // use ring for streaming multiple structures without waiting for each reply:
+
+    /**
+     * Creates the C++ to Python ring with numSlots slots in the shared
+     * memory segment. Only the memory creator calls this, and the
+     * segment must be large enough to hold all slots. The ring is
+     * independent from the struct-based and vector-based message
+     * interface, which remain available for the Python to C++ direction.
+     */
+    void CreateCpp2PyRing(uint32_t numSlots)
+    {
+        if (!m_isCreator)
+        {
+            throw std::logic_error("Only the shared memory creator can create the ring");
+        }
+        if (m_useVector)
+        {
+            throw std::logic_error("Ring is not available with vector-based interface");
+        }
+        if (numSlots == 0 || numSlots > NS3_AI_MAX_RING_SLOTS)
+        {
+            throw std::invalid_argument("Ring must have between 1 and " +
+                                        std::to_string(NS3_AI_MAX_RING_SLOTS) + " slots");
+        }
+        std::string ringName = m_cpp2pyMsgName + " Ring";
+        m_cpp2pyRing = m_segment->construct<Ns3AiMsgRing>(ringName.c_str())();
+        m_cpp2pyRing->m_numSlots = numSlots;
+        m_cpp2pyRing->m_emptyCount = numSlots;
+        m_cpp2pyRingSlots =
+            m_segment->construct<Cpp2PyRingSlot>((ringName + " Slots").c_str())[numSlots]();
+    };
+
+    /**
+     * Gets the number of slots in the C++ to Python ring, or 0 if
+     * the memory creator did not create the ring
+     */
+    uint32_t GetCpp2PyRingSize()
+    {
+        return FindCpp2PyRing() ? m_cpp2pyRing->m_numSlots : 0;
+    };
+
+    // use raw regions for large data with a layout known to both sides:
+
+    /**
+     * Creates a zero-initialized region of size bytes in the shared
+     * memory segment. Returns nullptr if the segment is too small.
+     */
+    uint8_t* CreateRegion(const std::string& name, uint64_t size)
+    {
+        return m_segment->construct<uint8_t>(name.c_str(), std::nothrow)[size](0);
+    };
+
+    /**
+     * Finds a region created by CreateRegion on either side, and
+     * optionally gets its size in bytes. Returns nullptr if not found.
+     */
+    uint8_t* FindRegion(const std::string& name, uint64_t* size = nullptr)
+    {
+        auto region = m_segment->find<uint8_t>(name.c_str());
+        if (size)
+        {
+            *size = region.second;
+        }
+        return region.first;
+    };
+
     // for C++ side:
 
+    /**
+     * C++ side waits for a free slot in the ring and returns the
+     * struct to be written. Unlike CppSendBegin, this only blocks when
+     * all slots are waiting to be consumed by Python side.
+     */
+    Cpp2PyMsgType* CppRingSendBegin()
+    {
+        if (!FindCpp2PyRing())
+        {
+            throw std::runtime_error("C++ to Python ring was not created");
+        }
+        Ns3AiSemaphore::sem_wait(&m_cpp2pyRing->m_emptyCount,
+                                 &m_cpp2pyRing->m_emptyFutex,
+                                 m_syncMode,
+                                 m_spinCount);
+        return &m_cpp2pyRingSlots[m_cpp2pyRing->m_head % m_cpp2pyRing->m_numSlots].m_msg;
+    };
+
+    /**
+     * C++ side publishes the slot obtained with CppRingSendBegin
+     */
+    void CppRingSendEnd()
+    {
+        assert(m_cpp2pyRing && "CppRingSendEnd called before CppRingSendBegin");
+        Ns3AiMsgRing* ring = m_cpp2pyRing;
+        m_cpp2pyRingSlots[ring->m_head % ring->m_numSlots].m_seq = ring->m_head;
+        ++ring->m_head;
+        Ns3AiSemaphore::sem_post(&ring->m_fullCount, &ring->m_fullFutex);
+    };
+
     /**
      * C++ side starts writing into shared memory, struct-based
      * or vector-based
      */
     void CppSendBegin()
     {
-        Ns3AiSemaphore::sem_wait(&m_sync->m_cpp2pyEmptyCount);
+        Ns3AiSemaphore::sem_wait(&m_sync->m_cpp2pyEmptyCount,
+                                 &m_sync->m_cpp2pyEmptyFutex,
+                                 m_syncMode,
+                                 m_spinCount);
     };
 
     /**
@@ -200,7 +374,7 @@ class Ns3AiMsgInterfaceImpl
      */
     void CppSendEnd()
     {
-        Ns3AiSemaphore::sem_post(&m_sync->m_cpp2pyFullCount);
+        Ns3AiSemaphore::sem_post(&m_sync->m_cpp2pyFullCount, &m_sync->m_cpp2pyFullFutex);
     };
 
     /**
@@ -209,7 +383,10 @@ class Ns3AiMsgInterfaceImpl
      */
     void CppRecvBegin()
     {
-        Ns3AiSemaphore::sem_wait(&m_sync->m_py2cppFullCount);
+        Ns3AiSemaphore::sem_wait(&m_sync->m_py2cppFullCount,
+                                 &m_sync->m_py2cppFullFutex,
+                                 m_syncMode,
+                                 m_spinCount);
     };
 
     /**
@@ -218,7 +395,35 @@ class Ns3AiMsgInterfaceImpl
      */
     void CppRecvEnd()
     {
-        Ns3AiSemaphore::sem_post(&m_sync->m_py2cppEmptyCount);
+        Ns3AiSemaphore::sem_post(&m_sync->m_py2cppEmptyCount, &m_sync->m_py2cppEmptyFutex);
+    };
+
+    /**
+     * Non-blocking version of CppSendBegin. Returns false if Python side
+     * has not consumed the previous message yet.
+     */
+    bool CppTrySendBegin()
+    {
+        return Ns3AiSemaphore::sem_try_wait(&m_sync->m_cpp2pyEmptyCount);
+    };
+
+    /**
+     * Takes back the previous message sent by C++ side if Python side has
+     * not started reading it. On success, C++ side owns the shared memory
+     * as after CppSendBegin, and can overwrite the message.
+     */
+    bool CppTryRetractSend()
+    {
+        return Ns3AiSemaphore::sem_try_wait(&m_sync->m_cpp2pyFullCount);
+    };
+
+    /**
+     * Non-blocking version of CppRecvBegin. Returns false if Python side
+     * has not sent a message.
+     */
+    bool CppTryRecvBegin()
+    {
+        return Ns3AiSemaphore::sem_try_wait(&m_sync->m_py2cppFullCount);
     };
 
     /**
@@ -227,8 +432,16 @@ class Ns3AiMsgInterfaceImpl
      */
     void CppSetFinished()
     {
-        assert(m_handleFinish);
+        assert(m_handleFinish && "Finish is not handled by the interface");
         m_isFinished = true;
+        if (FindCpp2PyRing())
+        {
+            // the finish marker occupies one slot, so that Python side
+            // consumes all messages sent before it
+            CppRingSendBegin();
+            m_cpp2pyRing->m_finishSeq = m_cpp2pyRing->m_head;
+            CppRingSendEnd();
+        }
         CppSendBegin();
         m_sync->m_isFinished = true;
         CppSendEnd();
@@ -242,7 +455,10 @@ class Ns3AiMsgInterfaceImpl
      */
     void PyRecvBegin()
     {
-        Ns3AiSemaphore::sem_wait(&m_sync->m_cpp2pyFullCount);
+        Ns3AiSemaphore::sem_wait(&m_sync->m_cpp2pyFullCount,
+                                 &m_sync->m_cpp2pyFullFutex,
+                                 m_syncMode,
+                                 m_spinCount);
         if (m_handleFinish)
         {
             m_isFinished = m_sync->m_isFinished;
@@ -255,7 +471,7 @@ class Ns3AiMsgInterfaceImpl
      */
     void PyRecvEnd()
     {
-        Ns3AiSemaphore::sem_post(&m_sync->m_cpp2pyEmptyCount);
+        Ns3AiSemaphore::sem_post(&m_sync->m_cpp2pyEmptyCount, &m_sync->m_cpp2pyEmptyFutex);
     };
 
     /**
@@ -264,7 +480,10 @@ class Ns3AiMsgInterfaceImpl
      */
     void PySendBegin()
     {
-        Ns3AiSemaphore::sem_wait(&m_sync->m_py2cppEmptyCount);
+        Ns3AiSemaphore::sem_wait(&m_sync->m_py2cppEmptyCount,
+                                 &m_sync->m_py2cppEmptyFutex,
+                                 m_syncMode,
+                                 m_spinCount);
     };
 
     /**
@@ -273,7 +492,88 @@ class Ns3AiMsgInterfaceImpl
      */
     void PySendEnd()
     {
-        Ns3AiSemaphore::sem_post(&m_sync->m_py2cppFullCount);
+        Ns3AiSemaphore::sem_post(&m_sync->m_py2cppFullCount, &m_sync->m_py2cppFullFutex);
+    };
+
+    /**
+     * Non-blocking version of PySendBegin. Returns false if C++ side
+     * has not consumed the previous message yet, which lets Python side
+     * reply to messages streamed through the ring without waiting for C++.
+     */
+    bool PyTrySendBegin()
+    {
+        return Ns3AiSemaphore::sem_try_wait(&m_sync->m_py2cppEmptyCount);
+    };
+
+    /**
+     * Python side waits until at least one message is in the ring, and
+     * returns the number of messages (at most maxCount, 0 for no limit)
+     * that can be read with GetCpp2PyRingStruct. C++ side keeps sending
+     * into the remaining free slots meanwhile.
+     */
+    uint32_t PyRingRecvBegin(uint32_t maxCount = 0)
+    {
+        if (!FindCpp2PyRing())
+        {
+            throw std::runtime_error("C++ to Python ring was not created");
+        }
+        Ns3AiMsgRing* ring = m_cpp2pyRing;
+        if (maxCount == 0 || maxCount > ring->m_numSlots)
+        {
+            maxCount = ring->m_numSlots;
+        }
+        Ns3AiSemaphore::sem_wait(&ring->m_fullCount, &ring->m_fullFutex, m_syncMode, m_spinCount);
+        m_ringAcquired = 1;
+        while (m_ringAcquired < maxCount && Ns3AiSemaphore::sem_try_wait(&ring->m_fullCount))
+        {
+            ++m_ringAcquired;
+        }
+        m_ringBatch = m_ringAcquired;
+        if (ring->m_tail + m_ringBatch > ring->m_finishSeq)
+        {
+            m_ringBatch = ring->m_finishSeq - ring->m_tail;
+            if (m_handleFinish)
+            {
+                m_isFinished = true;
+            }
+        }
+        return m_ringBatch;
+    };
+
+    /**
+     * Python side gets the i-th struct of the batch acquired by
+     * PyRingRecvBegin
+     */
+    Cpp2PyMsgType* GetCpp2PyRingStruct(uint32_t i)
+    {
+        assert(i < m_ringBatch && "Slot is not in the received batch");
+        return &m_cpp2pyRingSlots[(m_cpp2pyRing->m_tail + i) % m_cpp2pyRing->m_numSlots].m_msg;
+    };
+
+    /**
+     * Python side gets the sequence number of the i-th struct of the
+     * batch, which counts the messages sent by C++ side from 0
+     */
+    uint64_t GetCpp2PyRingSeq(uint32_t i)
+    {
+        assert(i < m_ringBatch && "Slot is not in the received batch");
+        return m_cpp2pyRingSlots[(m_cpp2pyRing->m_tail + i) % m_cpp2pyRing->m_numSlots].m_seq;
+    };
+
+    /**
+     * Python side releases all slots acquired by PyRingRecvBegin
+     */
+    void PyRingRecvEnd()
+    {
+        assert(m_cpp2pyRing && "PyRingRecvEnd called before PyRingRecvBegin");
+        Ns3AiMsgRing* ring = m_cpp2pyRing;
+        ring->m_tail += m_ringAcquired;
+        for (uint32_t i = 0; i < m_ringAcquired; ++i)
+        {
+            Ns3AiSemaphore::sem_post(&ring->m_emptyCount, &ring->m_emptyFutex);
+        }
+        m_ringAcquired = 0;
+        m_ringBatch = 0;
     };
 
     /**
@@ -281,11 +581,29 @@ class Ns3AiMsgInterfaceImpl
      */
     bool PyGetFinished()
     {
-        assert(m_handleFinish);
+        assert(m_handleFinish && "Finish is not handled by the interface");
         return m_isFinished;
     };
 
   private:
+    typedef Ns3AiMsgRingSlot<Cpp2PyMsgType> Cpp2PyRingSlot;
+
+    /**
+     * Looks up the ring created by the memory creator, if not done yet
+     */
+    bool FindCpp2PyRing()
+    {
+        if (!m_cpp2pyRing && !m_isCreator)
+        {
+            std::string ringName = m_cpp2pyMsgName + " Ring";
+            m_cpp2pyRing = m_segment->find<Ns3AiMsgRing>(ringName.c_str()).first;
+            m_cpp2pyRingSlots =
+                m_segment->find<Cpp2PyRingSlot>((ringName + " Slots").c_str()).first;
+        }
+        return m_cpp2pyRing != nullptr;
+    };
+
+    std::unique_ptr<boost::interprocess::managed_shared_memory> m_segment;
     Cpp2PyMsgType* m_cpp2pyStruct;
     Py2CppMsgType* m_py2CppStruct;
     Cpp2PyMsgVector* m_cpp2pyVector;
@@ -296,13 +614,20 @@ class Ns3AiMsgInterfaceImpl
     const bool m_useVector;
     const bool m_handleFinish;
     const std::string m_segName;
+    const std::string m_cpp2pyMsgName;
     bool m_isFinished;
+    Ns3AiSyncMode m_syncMode;
+    uint32_t m_spinCount;
+    Ns3AiMsgRing* m_cpp2pyRing{nullptr};
+    Cpp2PyRingSlot* m_cpp2pyRingSlots{nullptr};
+    uint32_t m_ringAcquired{0}; //!< Slots acquired by Python side, including the finish marker
+    uint32_t m_ringBatch{0};    //!< Slots holding messages in the acquired batch
 };
 
 /**
- * \brief The message interface, a singleton class
+ * \brief The message interface, a singleton class holding one
+ * interface per shared memory segment
  */
-
 class Ns3AiMsgInterface : public Singleton<Ns3AiMsgInterface>
 {
   public:
@@ -359,23 +684,79 @@ class Ns3AiMsgInterface : public Singleton<Ns3AiMsgInterface>
         this->m_lockableName = lockableName;
     };
 
+    /**
+     * Sets how this side waits for the other side. See
+     * Ns3AiMsgInterfaceImpl::SetSyncMode. Adaptive mode keeps
+     * the latency low while both sides are busy, and lets
+     * the process sleep when the other side is idle.
+     */
+    void SetSyncMode(Ns3AiSyncMode mode, uint32_t spinCount = NS3_AI_DEFAULT_SPIN_COUNT)
+    {
+        this->m_syncMode = mode;
+        this->m_spinCount = spinCount;
+    };
+
     /**
      * Gets the impl which has semaphore (synchronization)
-     * methods
+     * methods, for the segment named by SetNames
      */
     template <typename Cpp2PyMsgType, typename Py2CppMsgType>
     Ns3AiMsgInterfaceImpl<Cpp2PyMsgType, Py2CppMsgType>* GetInterface()
     {
-        static Ns3AiMsgInterfaceImpl<Cpp2PyMsgType, Py2CppMsgType> interface(
-            this->m_isMemoryCreator,
-            this->m_useVector,
-            this->m_handleFinish,
-            this->m_size,
-            this->m_segmentName.c_str(),
-            this->m_cpp2pyMsgName.c_str(),
-            this->m_py2cppMsgName.c_str(),
-            this->m_lockableName.c_str());
-        return &interface;
+        return GetInterface<Cpp2PyMsgType, Py2CppMsgType>(this->m_segmentName);
+    };
+
+    /**
+     * Gets the impl for the given shared memory segment, creating it
+     * with the current settings on first use. Interfaces with different
+     * segment names are independent, so that a simulation can talk to
+     * several agents at the same time.
+     */
+    template <typename Cpp2PyMsgType, typename Py2CppMsgType>
+    Ns3AiMsgInterfaceImpl<Cpp2PyMsgType, Py2CppMsgType>* GetInterface(
+        const std::string& segmentName)
+    {
+        typedef Ns3AiMsgInterfaceImpl<Cpp2PyMsgType, Py2CppMsgType> Impl;
+        auto it = m_interfaces.find(segmentName);
+        if (it != m_interfaces.end())
+        {
+            if (it->second.first != std::type_index(typeid(Impl)))
+            {
+                throw std::logic_error("Interface of segment " + segmentName +
+                                       " was created with other message types");
+            }
+            return static_cast<Impl*>(it->second.second.get());
+        }
+        auto interface = std::make_shared<Impl>(this->m_isMemoryCreator,
+                                                this->m_useVector,
+                                                this->m_handleFinish,
+                                                this->m_size,
+                                                segmentName.c_str(),
+                                                this->m_cpp2pyMsgName.c_str(),
+                                                this->m_py2cppMsgName.c_str(),
+                                                this->m_lockableName.c_str());
+        interface->SetSyncMode(this->m_syncMode, this->m_spinCount);
+        m_interfaces.emplace(segmentName,
+                             std::make_pair(std::type_index(typeid(Impl)), interface));
+        return interface.get();
+    };
+
+    /**
+     * Destroys the impl of the given shared memory segment, which
+     * notifies Python side if handling finish. Remaining interfaces
+     * are destroyed when the process exits.
+     */
+    void DeleteInterface(const std::string& segmentName)
+    {
+        m_interfaces.erase(segmentName);
+    };
+
+    /**
+     * Checks whether an impl exists for the given shared memory segment
+     */
+    bool HasInterface(const std::string& segmentName) const
+    {
+        return m_interfaces.find(segmentName) != m_interfaces.end();
     };
 
   private:
@@ -387,6 +768,10 @@ class Ns3AiMsgInterface : public Singleton<Ns3AiMsgInterface>
     std::string m_cpp2pyMsgName = "My Cpp to Python Msg";
     std::string m_py2cppMsgName = "My Python to Cpp Msg";
     std::string m_lockableName = "My Lockable";
+    Ns3AiSyncMode m_syncMode = SYNC_MODE_SPIN;
+    uint32_t m_spinCount = NS3_AI_DEFAULT_SPIN_COUNT;
+    /// Interfaces by segment name, with the type of the impl
+    std::map<std::string, std::pair<std::type_index, std::shared_ptr<void>>> m_interfaces;
 };
 
 } // namespace ns3
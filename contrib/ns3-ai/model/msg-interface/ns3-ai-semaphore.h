@@ -20,8 +20,38 @@
 #ifndef NS3_AI_SEMAPHORE_H
 #define NS3_AI_SEMAPHORE_H
 
+#include <climits>
 #include <cstdint>
 
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#include <sched.h>
+#endif
+
+/**
+ * \brief Wait strategy used when a semaphore cannot be acquired immediately
+ */
+enum Ns3AiSyncMode : uint8_t
+{
+    SYNC_MODE_SPIN = 0, //!< Busy-spin until the semaphore can be acquired
+    SYNC_MODE_ADAPTIVE, //!< Spin for a bounded number of tries, then park on a futex
+};
+
+/**
+ * \brief Futex word accompanying a semaphore in shared memory.
+ *
+ * The waiter count lets the posting side skip the wake-up system call when
+ * nobody is parked, so the spinning fast path costs a single extra read.
+ */
+struct Ns3AiFutex
+{
+    volatile uint32_t m_seq{0};
+    volatile uint32_t m_waiters{0};
+};
+
 /**
  * \brief Structure providing semaphore operations
  */
@@ -80,6 +110,84 @@ struct Ns3AiSemaphore
     {
         return atomic_add8(mem, 1);
     }
+
+    static inline void futex_wait(volatile uint32_t* addr, uint32_t val)
+    {
+#ifdef __linux__
+        // Not FUTEX_PRIVATE_FLAG: the word lives in memory shared across processes
+        syscall(SYS_futex, const_cast<uint32_t*>(addr), FUTEX_WAIT, val, nullptr, nullptr, 0);
+#else
+        if (*addr == val)
+        {
+            sched_yield();
+        }
+#endif
+    }
+
+    static inline void futex_wake(volatile uint32_t* addr)
+    {
+#ifdef __linux__
+        syscall(SYS_futex, const_cast<uint32_t*>(addr), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#endif
+    }
+
+    /**
+     * Waits on the semaphore according to the given mode. In adaptive mode,
+     * the caller spins for up to spin_count tries and then sleeps on the futex
+     * until the other side posts with sem_post(mem, futex).
+     */
+    static inline void sem_wait(volatile uint8_t* mem,
+                                Ns3AiFutex* futex,
+                                Ns3AiSyncMode mode,
+                                uint32_t spin_count)
+    {
+        if (mode == SYNC_MODE_SPIN)
+        {
+            sem_wait(mem);
+            return;
+        }
+        for (uint32_t i = 0; i < spin_count; ++i)
+        {
+            if (sem_try_wait(mem))
+            {
+                return;
+            }
+        }
+        while (true)
+        {
+            // Register as waiter and sample the sequence before the last try, so
+            // that a post racing with us either succeeds the try or bumps the
+            // sequence and makes futex_wait return immediately.
+            __sync_fetch_and_add(const_cast<uint32_t*>(&futex->m_waiters), 1);
+            uint32_t seq = __sync_fetch_and_add(const_cast<uint32_t*>(&futex->m_seq), 0);
+            if (sem_try_wait(mem))
+            {
+                __sync_fetch_and_sub(const_cast<uint32_t*>(&futex->m_waiters), 1);
+                return;
+            }
+            futex_wait(&futex->m_seq, seq);
+            __sync_fetch_and_sub(const_cast<uint32_t*>(&futex->m_waiters), 1);
+            if (sem_try_wait(mem))
+            {
+                return;
+            }
+        }
+    }
+
+    /**
+     * Posts the semaphore and wakes up the other side if it is parked on the
+     * futex. Safe to use regardless of the wait mode of the other side.
+     */
+    static inline uint8_t sem_post(volatile uint8_t* mem, Ns3AiFutex* futex)
+    {
+        uint8_t old_val = atomic_add8(mem, 1);
+        if (__sync_fetch_and_add(const_cast<uint32_t*>(&futex->m_waiters), 0) != 0)
+        {
+            __sync_fetch_and_add(const_cast<uint32_t*>(&futex->m_seq), 1);
+            futex_wake(&futex->m_seq);
+        }
+        return old_val;
+    }
 };
 
 #endif // NS3_AI_SEMAPHORE_H
@@ -79,6 +79,22 @@ def kill_proc_tree(p, timeout=None, on_terminate=None):
     return succ, err
 
 
+# Writes a fully connected network in the format of the built-in MLP kernel
+# of Ns3AiInferenceEngine. layers is a list of (weight, bias, activation),
+# weight has shape (out, in) like torch.nn.Linear.weight, and activation is
+# 'linear', 'relu', 'tanh' or 'sigmoid'.
+def save_mlp(layers, path):
+    with open(path, 'w') as f:
+        f.write('ns3ai-mlp 1\n{}\n'.format(len(layers)))
+        for weight, bias, activation in layers:
+            out_size, in_size = len(weight), len(weight[0])
+            assert len(bias) == out_size
+            f.write('{} {} {}\n'.format(in_size, out_size, activation))
+            for row in weight:
+                f.write(' '.join(repr(float(w)) for w in row) + '\n')
+            f.write(' '.join(repr(float(b)) for b in bias) + '\n')
+
+
 # According to Python signal docs, after a signal is received, the
 # low-level signal handler sets a flag which tells the virtual machine
 # to execute the corresponding Python signal handler at a later point.
@@ -106,7 +122,10 @@ class Experiment:
                  segName="My Seg",
                  cpp2pyMsgName="My Cpp to Python Msg",
                  py2cppMsgName="My Python to Cpp Msg",
-                 lockableName="My Lockable"):
+                 lockableName="My Lockable",
+                 adaptiveSync=False,
+                 spinCount=None,
+                 ringSlots=None):
         if self._created:
             raise Exception('ns3ai_utils: Error: Experiment is singleton')
         self._created = True
@@ -126,6 +145,23 @@ class Experiment:
             True, self.useVector, self.handleFinish,
             self.shmSize, self.segName, self.cpp2pyMsgName, self.py2cppMsgName, self.lockableName
         )
+        # spin for spinCount tries (by default, as many as C++ side), then
+        # sleep until C++ side posts
+        if adaptiveSync:
+            if not hasattr(self.msgInterface, 'SetSyncMode'):
+                raise Exception('ns3ai_utils: Error: {} does not bind SetSyncMode, '
+                                'adaptiveSync is not available'.format(msgModule.__name__))
+            if spinCount is None:
+                spinCount = msgModule.NS3_AI_DEFAULT_SPIN_COUNT
+            self.msgInterface.SetSyncMode(msgModule.Ns3AiSyncMode.SYNC_MODE_ADAPTIVE, spinCount)
+        # streaming C++ to Python messages through a multi-slot ring
+        if ringSlots is not None:
+            if self.useVector:
+                raise Exception('ns3ai_utils: Error: Ring is not available with vector')
+            if not hasattr(self.msgInterface, 'CreateCpp2PyRing'):
+                raise Exception('ns3ai_utils: Error: {} does not bind CreateCpp2PyRing, '
+                                'ringSlots is not available'.format(msgModule.__name__))
+            self.msgInterface.CreateCpp2PyRing(ringSlots)
         if self.useVector:
             if self.vectorSize is None:
                 raise Exception('ns3ai_utils: Error: Using vector but size is unknown')
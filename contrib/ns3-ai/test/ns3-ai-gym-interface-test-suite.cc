@@ -0,0 +1,601 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/ai-module.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace ns3;
+
+/// The message interface of the gym interface, seen from Python side
+typedef Ns3AiMsgInterfaceImpl<Ns3AiGymMsg, Ns3AiGymMsg> Ns3AiGymTestInterface;
+
+/**
+ * \ingroup ns3-ai
+ * \return the name of a shared memory segment used only by this process
+ */
+static std::string
+GetGymTestSegmentName()
+{
+    return "ns3-ai-gym-interface-test-" + std::to_string(getpid());
+}
+
+/**
+ * \ingroup ns3-ai
+ *
+ * \brief Environment of the gym interface tests. Its observation is
+ * 100 times its index plus the number of steps, its reward is its index,
+ * and it records the discrete actions it executes with their step.
+ */
+class Ns3AiGymTestEnv : public OpenGymEnv
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param index the index of the environment in the batch
+     */
+    Ns3AiGymTestEnv(uint32_t index);
+
+    Ptr<OpenGymSpace> GetActionSpace() override;
+    Ptr<OpenGymSpace> GetObservationSpace() override;
+    bool GetGameOver() override;
+    Ptr<OpenGymDataContainer> GetObservation() override;
+    float GetReward() override;
+    std::string GetExtraInfo() override;
+    bool ExecuteActions(Ptr<OpenGymDataContainer> action) override;
+    int64_t AssignStreams(int64_t stream) override;
+
+    /// Counts a step and notifies the interface
+    void Step();
+
+    /// \return the action executed in asynchronous mode without fresh action
+    Ptr<OpenGymDataContainer> GetDefaultAction();
+
+    uint32_t m_index;                    ///< the index of the environment
+    uint32_t m_step{0};                  ///< the number of steps
+    std::vector<uint32_t> m_actions;     ///< the actions executed
+    std::vector<uint32_t> m_actionSteps; ///< the step at which each action was executed
+    Ptr<UniformRandomVariable> m_random; ///< the random variable of the environment
+};
+
+Ns3AiGymTestEnv::Ns3AiGymTestEnv(uint32_t index)
+    : m_index(index),
+      m_random(CreateObject<UniformRandomVariable>())
+{
+}
+
+Ptr<OpenGymSpace>
+Ns3AiGymTestEnv::GetActionSpace()
+{
+    return CreateObject<OpenGymDiscreteSpace>(1000);
+}
+
+Ptr<OpenGymSpace>
+Ns3AiGymTestEnv::GetObservationSpace()
+{
+    return CreateObject<OpenGymBoxSpace>(0, 1000, std::vector<uint32_t>{1}, "uint32_t");
+}
+
+bool
+Ns3AiGymTestEnv::GetGameOver()
+{
+    return false;
+}
+
+Ptr<OpenGymDataContainer>
+Ns3AiGymTestEnv::GetObservation()
+{
+    Ptr<OpenGymBoxContainer<uint32_t>> box =
+        CreateObject<OpenGymBoxContainer<uint32_t>>(std::vector<uint32_t>{1});
+    box->AddValue(100 * m_index + m_step);
+    return box;
+}
+
+float
+Ns3AiGymTestEnv::GetReward()
+{
+    return m_index;
+}
+
+std::string
+Ns3AiGymTestEnv::GetExtraInfo()
+{
+    return "env " + std::to_string(m_index);
+}
+
+bool
+Ns3AiGymTestEnv::ExecuteActions(Ptr<OpenGymDataContainer> action)
+{
+    Ptr<OpenGymDiscreteContainer> discrete = DynamicCast<OpenGymDiscreteContainer>(action);
+    m_actions.push_back(discrete ? discrete->GetValue() : 0);
+    m_actionSteps.push_back(m_step);
+    return true;
+}
+
+int64_t
+Ns3AiGymTestEnv::AssignStreams(int64_t stream)
+{
+    m_random->SetStream(stream);
+    return 1;
+}
+
+void
+Ns3AiGymTestEnv::Step()
+{
+    m_step++;
+    Notify();
+}
+
+Ptr<OpenGymDataContainer>
+Ns3AiGymTestEnv::GetDefaultAction()
+{
+    Ptr<OpenGymDiscreteContainer> action = CreateObject<OpenGymDiscreteContainer>(1000);
+    action->SetValue(999);
+    return action;
+}
+
+/**
+ * \ingroup ns3-ai
+ *
+ * \brief Test case that steps several environments in batched mode, with
+ * the Python side run on a thread of this process. Python side checks the
+ * batched states and replies with the action 10 times the index of the
+ * environment plus the step. The test then checks the actions executed by
+ * each environment, and that disposing the interface releases the
+ * environments.
+ */
+class Ns3AiGymBatchTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param numEnvs the number of environments
+     * \param numSteps the number of steps of each environment
+     */
+    Ns3AiGymBatchTestCase(uint32_t numEnvs, uint32_t numSteps);
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Run the Python side: check the states and reply with the actions
+     * until the simulation ends
+     *
+     * \param interface the Python side of the interface
+     */
+    void RunPySide(Ns3AiGymTestInterface* interface);
+
+    uint32_t m_numEnvs;      ///< the number of environments
+    uint32_t m_numSteps;     ///< the number of steps of each environment
+    uint32_t m_pyErrors{0};  ///< wrong messages received by the Python side
+    uint32_t m_pyBatches{0}; ///< batched states received by the Python side
+    uint32_t m_pyNumEnvs{0}; ///< number of environments in the init message
+};
+
+Ns3AiGymBatchTestCase::Ns3AiGymBatchTestCase(uint32_t numEnvs, uint32_t numSteps)
+    : TestCase(std::to_string(numEnvs) + " environments, " + std::to_string(numSteps) + " steps"),
+      m_numEnvs(numEnvs),
+      m_numSteps(numSteps)
+{
+}
+
+void
+Ns3AiGymBatchTestCase::RunPySide(Ns3AiGymTestInterface* interface)
+{
+    uint8_t* cpp2pyBuffer = interface->FindRegion(BATCH_CPP2PY_REGION_NAME);
+    uint64_t py2cppSize = 0;
+    uint8_t* py2cppBuffer = interface->FindRegion(BATCH_PY2CPP_REGION_NAME, &py2cppSize);
+
+    ns3_ai_gym::SimInitMsg simInitMsg;
+    interface->PyRecvBegin();
+    simInitMsg.ParseFromArray(interface->GetCpp2PyStruct()->buffer,
+                              interface->GetCpp2PyStruct()->size);
+    interface->PyRecvEnd();
+    m_pyNumEnvs = simInitMsg.numenvs();
+
+    ns3_ai_gym::SimInitAck simInitAck;
+    simInitAck.set_done(true);
+    simInitAck.set_stopsimreq(false);
+    interface->PySendBegin();
+    interface->GetPy2CppStruct()->size = simInitAck.ByteSizeLong();
+    simInitAck.SerializeToArray(interface->GetPy2CppStruct()->buffer,
+                                interface->GetPy2CppStruct()->size);
+    interface->PySendEnd();
+
+    bool simEnd = false;
+    while (!simEnd)
+    {
+        ns3_ai_gym::EnvStateBatchMsg envStateBatchMsg;
+        interface->PyRecvBegin();
+        envStateBatchMsg.ParseFromArray(cpp2pyBuffer, interface->GetCpp2PyStruct()->size);
+        interface->PyRecvEnd();
+
+        uint32_t step = ++m_pyBatches;
+        if (envStateBatchMsg.states_size() != static_cast<int>(m_numEnvs))
+        {
+            m_pyErrors++;
+        }
+        ns3_ai_gym::EnvActBatchMsg envActBatchMsg;
+        simEnd = true;
+        for (uint32_t i = 0; i < static_cast<uint32_t>(envStateBatchMsg.states_size()); i++)
+        {
+            const ns3_ai_gym::EnvStateMsg& state = envStateBatchMsg.states(i);
+            simEnd = simEnd && state.isgameover();
+            ns3_ai_gym::DataContainer obsDataContainerPbMsg = state.obsdata();
+            Ptr<OpenGymBoxContainer<uint32_t>> obs = DynamicCast<OpenGymBoxContainer<uint32_t>>(
+                OpenGymDataContainer::CreateFromDataContainerPbMsg(obsDataContainerPbMsg));
+            uint32_t expectedStep = std::min(step, m_numSteps);
+            if (!obs || obs->GetValue(0) != 100 * i + expectedStep || state.reward() != i ||
+                state.info() != "env " + std::to_string(i))
+            {
+                m_pyErrors++;
+            }
+            Ptr<OpenGymDiscreteContainer> act = CreateObject<OpenGymDiscreteContainer>(1000);
+            act->SetValue(10 * i + step);
+            envActBatchMsg.add_acts()->mutable_actdata()->CopyFrom(act->GetDataContainerPbMsg());
+        }
+        envActBatchMsg.set_stopsimreq(simEnd);
+
+        interface->PySendBegin();
+        uint64_t size = envActBatchMsg.ByteSizeLong();
+        if (size > py2cppSize)
+        {
+            m_pyErrors++;
+            size = 0;
+        }
+        envActBatchMsg.SerializeToArray(py2cppBuffer, size);
+        interface->GetPy2CppStruct()->size = size;
+        interface->PySendEnd();
+    }
+}
+
+void
+Ns3AiGymBatchTestCase::DoRun()
+{
+    std::string segmentName = GetGymTestSegmentName();
+    Ns3AiGymTestInterface pySide(true, false, false, 1 << 16, segmentName.c_str());
+    pySide.CreateRegion(BATCH_CPP2PY_REGION_NAME, 1 << 13);
+    pySide.CreateRegion(BATCH_PY2CPP_REGION_NAME, 1 << 13);
+    Ns3AiMsgInterface::Get()->SetNames(segmentName,
+                                       "My Cpp to Python Msg",
+                                       "My Python to Cpp Msg",
+                                       "My Lockable");
+
+    Ptr<OpenGymInterface> openGymInterface = CreateObject<OpenGymInterface>();
+    openGymInterface->SetNumEnvs(m_numEnvs);
+    std::vector<Ptr<Ns3AiGymTestEnv>> envs;
+    for (uint32_t i = 0; i < m_numEnvs; i++)
+    {
+        envs.push_back(CreateObject<Ns3AiGymTestEnv>(i));
+        envs[i]->SetOpenGymInterface(openGymInterface);
+        for (uint32_t s = 1; s <= m_numSteps; s++)
+        {
+            Simulator::Schedule(Seconds(s), &Ns3AiGymTestEnv::Step, envs[i]);
+        }
+    }
+
+    std::thread pyThread(&Ns3AiGymBatchTestCase::RunPySide, this, &pySide);
+    Simulator::Run();
+    openGymInterface->NotifySimulationEnd();
+    pyThread.join();
+    Simulator::Destroy();
+    Ns3AiMsgInterface::Get()->DeleteInterface(segmentName);
+    Ns3AiMsgInterface::Get()->SetNames("My Seg",
+                                       "My Cpp to Python Msg",
+                                       "My Python to Cpp Msg",
+                                       "My Lockable");
+
+    NS_TEST_ASSERT_MSG_EQ(m_pyErrors, 0, "Python side received wrong states");
+    NS_TEST_ASSERT_MSG_EQ(m_pyNumEnvs, m_numEnvs, "wrong number of environments in init message");
+    NS_TEST_ASSERT_MSG_EQ(m_pyBatches, m_numSteps + 1, "wrong number of batched states");
+    for (uint32_t i = 0; i < m_numEnvs; i++)
+    {
+        NS_TEST_ASSERT_MSG_EQ(envs[i]->m_actions.size(),
+                              m_numSteps,
+                              "wrong number of actions executed by environment " << i);
+        for (uint32_t s = 0; s < m_numSteps; s++)
+        {
+            NS_TEST_EXPECT_MSG_EQ(envs[i]->m_actions[s],
+                                  10 * i + s + 1,
+                                  "wrong action executed by environment " << i);
+        }
+    }
+
+    openGymInterface->Dispose();
+    for (uint32_t i = 0; i < m_numEnvs; i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(envs[i]->GetReferenceCount(),
+                              1,
+                              "environment not released by the disposed interface");
+        envs[i]->Dispose();
+    }
+    NS_TEST_EXPECT_MSG_EQ(openGymInterface->GetReferenceCount(),
+                          1,
+                          "interface not released by the disposed environments");
+}
+
+/**
+ * \ingroup ns3-ai
+ *
+ * \brief Test case that steps an environment in asynchronous mode, with
+ * the Python side run on a thread of this process. Python side replies to
+ * each state it reads with its sequence number as action. The test checks
+ * that the mode is sent in the init message, that every step executes an
+ * action without waiting for Python side, and that each executed action is
+ * either the default action or at most maxStaleness states old. The action
+ * for a state is only received once the next state is sent, so with no
+ * staleness allowed only the default action is executed.
+ */
+class Ns3AiGymAsyncTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param maxStaleness the maximum staleness of the executed actions
+     * \param numSteps the number of steps of the environment
+     */
+    Ns3AiGymAsyncTestCase(uint32_t maxStaleness, uint32_t numSteps);
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Run the Python side: reply to each state until the simulation ends
+     *
+     * \param interface the Python side of the interface
+     */
+    void RunPySide(Ns3AiGymTestInterface* interface);
+
+    /**
+     * Give Python side some time, then step the environment
+     *
+     * \param env the environment
+     */
+    void Step(Ptr<Ns3AiGymTestEnv> env);
+
+    uint32_t m_maxStaleness; ///< the maximum staleness of the executed actions
+    uint32_t m_numSteps;     ///< the number of steps of the environment
+    uint32_t m_pyErrors{0};  ///< wrong messages received by the Python side
+    uint32_t m_pyStates{0};  ///< states received by the Python side
+    bool m_pyAsync{false};   ///< asynchronous mode in the init message
+};
+
+Ns3AiGymAsyncTestCase::Ns3AiGymAsyncTestCase(uint32_t maxStaleness, uint32_t numSteps)
+    : TestCase("asynchronous mode, staleness " + std::to_string(maxStaleness) + ", " +
+               std::to_string(numSteps) + " steps"),
+      m_maxStaleness(maxStaleness),
+      m_numSteps(numSteps)
+{
+}
+
+void
+Ns3AiGymAsyncTestCase::RunPySide(Ns3AiGymTestInterface* interface)
+{
+    ns3_ai_gym::SimInitMsg simInitMsg;
+    interface->PyRecvBegin();
+    simInitMsg.ParseFromArray(interface->GetCpp2PyStruct()->buffer,
+                              interface->GetCpp2PyStruct()->size);
+    interface->PyRecvEnd();
+    m_pyAsync = simInitMsg.asyncmode();
+
+    ns3_ai_gym::SimInitAck simInitAck;
+    simInitAck.set_done(true);
+    simInitAck.set_stopsimreq(false);
+    interface->PySendBegin();
+    interface->GetPy2CppStruct()->size = simInitAck.ByteSizeLong();
+    simInitAck.SerializeToArray(interface->GetPy2CppStruct()->buffer,
+                                interface->GetPy2CppStruct()->size);
+    interface->PySendEnd();
+
+    bool simEnd = false;
+    uint64_t lastSeq = 0;
+    while (!simEnd)
+    {
+        ns3_ai_gym::EnvStateMsg envStateMsg;
+        interface->PyRecvBegin();
+        envStateMsg.ParseFromArray(interface->GetCpp2PyStruct()->buffer,
+                                   interface->GetCpp2PyStruct()->size);
+        interface->PyRecvEnd();
+        m_pyStates++;
+        simEnd = envStateMsg.isgameover();
+        // states may be skipped, never reordered
+        if (envStateMsg.seq() <= lastSeq)
+        {
+            m_pyErrors++;
+        }
+        lastSeq = envStateMsg.seq();
+
+        ns3_ai_gym::EnvActMsg envActMsg;
+        Ptr<OpenGymDiscreteContainer> act = CreateObject<OpenGymDiscreteContainer>(1000);
+        act->SetValue(envStateMsg.seq());
+        envActMsg.mutable_actdata()->CopyFrom(act->GetDataContainerPbMsg());
+        envActMsg.set_seq(envStateMsg.seq());
+        envActMsg.set_stopsimreq(simEnd);
+
+        interface->PySendBegin();
+        interface->GetPy2CppStruct()->size = envActMsg.ByteSizeLong();
+        envActMsg.SerializeToArray(interface->GetPy2CppStruct()->buffer,
+                                   interface->GetPy2CppStruct()->size);
+        interface->PySendEnd();
+    }
+}
+
+void
+Ns3AiGymAsyncTestCase::Step(Ptr<Ns3AiGymTestEnv> env)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    env->Step();
+}
+
+void
+Ns3AiGymAsyncTestCase::DoRun()
+{
+    std::string segmentName = GetGymTestSegmentName();
+    Ns3AiGymTestInterface pySide(true, false, false, 1 << 16, segmentName.c_str());
+    Ns3AiMsgInterface::Get()->SetNames(segmentName,
+                                       "My Cpp to Python Msg",
+                                       "My Python to Cpp Msg",
+                                       "My Lockable");
+
+    Ptr<OpenGymInterface> openGymInterface = CreateObject<OpenGymInterface>();
+    openGymInterface->SetAsyncMode(true, m_maxStaleness);
+    Ptr<Ns3AiGymTestEnv> env = CreateObject<Ns3AiGymTestEnv>(0);
+    env->SetOpenGymInterface(openGymInterface);
+    openGymInterface->SetGetDefaultActionCb(MakeCallback(&Ns3AiGymTestEnv::GetDefaultAction, env));
+    for (uint32_t s = 1; s <= m_numSteps; s++)
+    {
+        Simulator::Schedule(Seconds(s), &Ns3AiGymAsyncTestCase::Step, this, env);
+    }
+
+    std::thread pyThread(&Ns3AiGymAsyncTestCase::RunPySide, this, &pySide);
+    Simulator::Run();
+    openGymInterface->NotifySimulationEnd();
+    pyThread.join();
+    Simulator::Destroy();
+    Ns3AiMsgInterface::Get()->DeleteInterface(segmentName);
+    Ns3AiMsgInterface::Get()->SetNames("My Seg",
+                                       "My Cpp to Python Msg",
+                                       "My Python to Cpp Msg",
+                                       "My Lockable");
+    openGymInterface->Dispose();
+    env->Dispose();
+
+    NS_TEST_ASSERT_MSG_EQ(m_pyAsync, true, "asynchronous mode not in init message");
+    NS_TEST_ASSERT_MSG_EQ(m_pyErrors, 0, "Python side received states out of order");
+    NS_TEST_ASSERT_MSG_GT_OR_EQ(m_numSteps + 1, m_pyStates, "too many states received");
+    NS_TEST_ASSERT_MSG_EQ(env->m_actions.size(), m_numSteps, "a step executed no action");
+    uint32_t fresh = 0;
+    for (uint32_t k = 0; k < m_numSteps; k++)
+    {
+        uint32_t action = env->m_actions[k];
+        uint32_t step = env->m_actionSteps[k];
+        if (action == 999)
+        {
+            continue;
+        }
+        fresh++;
+        // the state of step s has the sequence number s
+        NS_TEST_EXPECT_MSG_LT_OR_EQ(action, step, "action for a future state at step " << step);
+        NS_TEST_EXPECT_MSG_LT_OR_EQ(step - action,
+                                    m_maxStaleness,
+                                    "stale action executed at step " << step);
+    }
+    if (m_maxStaleness == 0)
+    {
+        // the action for a state is received after the next state is sent
+        NS_TEST_EXPECT_MSG_EQ(fresh, 0, "action of Python side executed with no staleness allowed");
+    }
+    else
+    {
+        NS_TEST_EXPECT_MSG_GT(fresh, 0, "no action of Python side was executed");
+    }
+}
+
+/**
+ * \ingroup ns3-ai
+ *
+ * \brief Test case that checks that the interface assigns the streams of
+ * the environments of the batch in registration order, so that the numbers
+ * drawn by an environment do not depend on the other environments.
+ */
+class Ns3AiGymStreamTestCase : public TestCase
+{
+  public:
+    Ns3AiGymStreamTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+Ns3AiGymStreamTestCase::Ns3AiGymStreamTestCase()
+    : TestCase("streams of batched environments")
+{
+}
+
+void
+Ns3AiGymStreamTestCase::DoRun()
+{
+    std::vector<double> draws;
+    for (uint32_t numEnvs : {3, 2})
+    {
+        Ptr<OpenGymInterface> openGymInterface = CreateObject<OpenGymInterface>();
+        openGymInterface->SetNumEnvs(numEnvs);
+        std::vector<Ptr<Ns3AiGymTestEnv>> envs;
+        for (uint32_t i = 0; i < numEnvs; i++)
+        {
+            envs.push_back(CreateObject<Ns3AiGymTestEnv>(i));
+            envs[i]->SetOpenGymInterface(openGymInterface);
+        }
+        NS_TEST_ASSERT_MSG_EQ(openGymInterface->AssignStreams(100),
+                              numEnvs,
+                              "wrong number of assigned streams");
+        for (uint32_t i = 0; i < numEnvs; i++)
+        {
+            NS_TEST_EXPECT_MSG_EQ(envs[i]->m_random->GetStream(),
+                                  100 + i,
+                                  "wrong stream of environment " << i);
+        }
+        if (draws.empty())
+        {
+            draws.push_back(envs[1]->m_random->GetValue());
+        }
+        else
+        {
+            NS_TEST_EXPECT_MSG_EQ(envs[1]->m_random->GetValue(),
+                                  draws[0],
+                                  "environment 1 drew other numbers");
+        }
+        openGymInterface->Dispose();
+        for (auto& env : envs)
+        {
+            env->Dispose();
+        }
+    }
+}
+
+/**
+ * \ingroup ns3-ai
+ *
+ * \brief Test suite of the gym interface
+ */
+class Ns3AiGymInterfaceTestSuite : public TestSuite
+{
+  public:
+    Ns3AiGymInterfaceTestSuite();
+};
+
+Ns3AiGymInterfaceTestSuite::Ns3AiGymInterfaceTestSuite()
+    : TestSuite("ns3-ai-gym-interface", Type::UNIT)
+{
+    AddTestCase(new Ns3AiGymBatchTestCase(2, 1), TestCase::Duration::QUICK);
+    AddTestCase(new Ns3AiGymBatchTestCase(3, 5), TestCase::Duration::QUICK);
+    AddTestCase(new Ns3AiGymAsyncTestCase(1, 20), TestCase::Duration::QUICK);
+    AddTestCase(new Ns3AiGymAsyncTestCase(0, 20), TestCase::Duration::QUICK);
+    AddTestCase(new Ns3AiGymStreamTestCase(), TestCase::Duration::QUICK);
+}
+
+/// Static variable for test initialization
+static Ns3AiGymInterfaceTestSuite g_ns3AiGymInterfaceTestSuite;
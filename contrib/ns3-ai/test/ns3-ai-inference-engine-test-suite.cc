@@ -0,0 +1,331 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/ai-module.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/test.h"
+#include "ns3/uinteger.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup ns3-ai
+ *
+ * \brief Writes the MLP used by the inference engine tests: a hidden layer
+ * of 3 inputs and 2 relu outputs, then an output layer of 2 outputs.
+ *
+ * \param path the file to write
+ * \param activation the activation of the output layer
+ */
+static void
+WriteTestMlp(const std::string& path, const std::string& activation)
+{
+    std::ofstream file(path);
+    file << "ns3ai-mlp 1\n2\n";
+    file << "3 2 relu\n";
+    file << "1 -1 0.5\n-2 0 1\n";
+    file << "0.1 -0.2\n";
+    file << "2 2 " << activation << "\n";
+    file << "1 2\n-1 0.5\n";
+    file << "0 0.3\n";
+}
+
+/**
+ * \ingroup ns3-ai
+ *
+ * \brief Evaluates the MLP of WriteTestMlp without the engine.
+ *
+ * \param input the 3 inputs
+ * \param activation the activation of the output layer
+ * \return the 2 outputs
+ */
+static std::vector<float>
+EvaluateTestMlp(const std::vector<float>& input, const std::string& activation)
+{
+    float h0 = std::max(0.0f, input[0] - input[1] + 0.5f * input[2] + 0.1f);
+    float h1 = std::max(0.0f, -2 * input[0] + input[2] - 0.2f);
+    std::vector<float> output{h0 + 2 * h1, -h0 + 0.5f * h1 + 0.3f};
+    for (auto& o : output)
+    {
+        if (activation == "relu")
+        {
+            o = std::max(0.0f, o);
+        }
+        else if (activation == "tanh")
+        {
+            o = std::tanh(o);
+        }
+        else if (activation == "sigmoid")
+        {
+            o = 1 / (1 + std::exp(-o));
+        }
+    }
+    return output;
+}
+
+/// Inputs of the inference engine tests, covering both sides of the relus
+static const std::vector<std::vector<float>> g_testInputs = {
+    {1, 2, 3},
+    {-1, 0.5, 0},
+    {0.2, -0.3, -4},
+    {3, 1, -1},
+};
+
+/**
+ * \ingroup ns3-ai
+ *
+ * \brief Test case that evaluates an MLP with the built-in kernel, one
+ * input at a time and in a batch, and compares the outputs with a direct
+ * evaluation.
+ */
+class Ns3AiInferenceMlpTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param activation the activation of the output layer
+     */
+    Ns3AiInferenceMlpTestCase(std::string activation);
+
+  private:
+    void DoRun() override;
+
+    std::string m_activation; ///< the activation of the output layer
+};
+
+Ns3AiInferenceMlpTestCase::Ns3AiInferenceMlpTestCase(std::string activation)
+    : TestCase("MLP with " + activation + " output"),
+      m_activation(activation)
+{
+}
+
+void
+Ns3AiInferenceMlpTestCase::DoRun()
+{
+    std::string path = CreateTempDirFilename("ns3-ai-test.mlp");
+    WriteTestMlp(path, m_activation);
+
+    Ptr<Ns3AiInferenceEngine> engine = CreateObject<Ns3AiInferenceEngine>();
+    engine->Load(path);
+    NS_TEST_ASSERT_MSG_EQ(engine->IsBuiltinMlp(), true, "MLP not evaluated by the kernel");
+    NS_TEST_ASSERT_MSG_EQ(engine->GetInputSize(), 3, "wrong input size");
+
+    std::vector<float> batch;
+    for (const auto& input : g_testInputs)
+    {
+        std::vector<float> expected = EvaluateTestMlp(input, m_activation);
+        std::vector<float> output = engine->Infer(input);
+        NS_TEST_ASSERT_MSG_EQ(output.size(), 2, "wrong output size");
+        for (uint32_t o = 0; o < 2; o++)
+        {
+            NS_TEST_EXPECT_MSG_EQ_TOL(output[o], expected[o], 1e-5, "wrong output " << o);
+        }
+        batch.insert(batch.end(), input.begin(), input.end());
+    }
+
+    std::vector<float> outputs;
+    uint32_t outputSize = engine->InferBatch(batch.data(), g_testInputs.size(), 3, outputs);
+    NS_TEST_ASSERT_MSG_EQ(outputSize, 2, "wrong output size of the batch");
+    NS_TEST_ASSERT_MSG_EQ(outputs.size(), 2 * g_testInputs.size(), "wrong size of the batch");
+    for (uint32_t b = 0; b < g_testInputs.size(); b++)
+    {
+        std::vector<float> expected = EvaluateTestMlp(g_testInputs[b], m_activation);
+        for (uint32_t o = 0; o < 2; o++)
+        {
+            NS_TEST_EXPECT_MSG_EQ_TOL(outputs[2 * b + o],
+                                      expected[o],
+                                      1e-5,
+                                      "wrong output " << o << " of input " << b);
+        }
+    }
+
+    NS_TEST_EXPECT_MSG_EQ(engine->GetNumInferences(),
+                          2 * g_testInputs.size(),
+                          "wrong number of inferences");
+    NS_TEST_EXPECT_MSG_EQ(engine->GetNumBatches(),
+                          g_testInputs.size() + 1,
+                          "wrong number of batches");
+    engine->Dispose();
+}
+
+/**
+ * \ingroup ns3-ai
+ *
+ * \brief Test case that submits inputs from several events at the same
+ * time. The inputs of the events already scheduled when the first one is
+ * submitted share one batch, split by MaxBatchSize, and an input submitted
+ * by an event scheduled later at the same time starts a new batch. The
+ * callbacks must receive the outputs of their inputs in submission order.
+ */
+class Ns3AiInferenceSubmitTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param maxBatchSize the MaxBatchSize attribute of the engine
+     * \param numBatches the expected number of batches
+     */
+    Ns3AiInferenceSubmitTestCase(uint32_t maxBatchSize, uint32_t numBatches);
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Submits an input of g_testInputs
+     *
+     * \param index the index of the input
+     */
+    void Submit(uint32_t index);
+
+    /**
+     * Submits an input from an event scheduled now, after the flush
+     *
+     * \param index the index of the input
+     */
+    void SubmitLater(uint32_t index);
+
+    /**
+     * Receives the output of an input
+     *
+     * \param index the index of the input
+     * \param output the output
+     */
+    void Receive(uint32_t index, const std::vector<float>& output);
+
+    uint32_t m_maxBatchSize;               ///< the MaxBatchSize attribute
+    uint32_t m_numBatches;                 ///< the expected number of batches
+    Ptr<Ns3AiInferenceEngine> m_engine;    ///< the engine
+    std::vector<uint32_t> m_received;      ///< indexes of the received outputs
+    std::vector<uint64_t> m_receivedBatch; ///< batches evaluated when each output arrived
+};
+
+Ns3AiInferenceSubmitTestCase::Ns3AiInferenceSubmitTestCase(uint32_t maxBatchSize,
+                                                           uint32_t numBatches)
+    : TestCase("submit with MaxBatchSize " + std::to_string(maxBatchSize)),
+      m_maxBatchSize(maxBatchSize),
+      m_numBatches(numBatches)
+{
+}
+
+void
+Ns3AiInferenceSubmitTestCase::Submit(uint32_t index)
+{
+    m_engine->Submit(g_testInputs[index],
+                     MakeCallback(&Ns3AiInferenceSubmitTestCase::Receive, this).Bind(index));
+}
+
+void
+Ns3AiInferenceSubmitTestCase::SubmitLater(uint32_t index)
+{
+    Simulator::ScheduleNow(&Ns3AiInferenceSubmitTestCase::Submit, this, index);
+}
+
+void
+Ns3AiInferenceSubmitTestCase::Receive(uint32_t index, const std::vector<float>& output)
+{
+    NS_TEST_EXPECT_MSG_EQ(Simulator::Now(), Seconds(1), "output received at another time");
+    std::vector<float> expected = EvaluateTestMlp(g_testInputs[index], "linear");
+    NS_TEST_ASSERT_MSG_EQ(output.size(), 2, "wrong output size of input " << index);
+    for (uint32_t o = 0; o < 2; o++)
+    {
+        NS_TEST_EXPECT_MSG_EQ_TOL(output[o],
+                                  expected[o],
+                                  1e-5,
+                                  "wrong output " << o << " of input " << index);
+    }
+    m_received.push_back(index);
+    m_receivedBatch.push_back(m_engine->GetNumBatches());
+}
+
+void
+Ns3AiInferenceSubmitTestCase::DoRun()
+{
+    std::string path = CreateTempDirFilename("ns3-ai-test.mlp");
+    WriteTestMlp(path, "linear");
+
+    // loaded at the first evaluation
+    m_engine = CreateObjectWithAttributes<Ns3AiInferenceEngine>("ModelPath",
+                                                                StringValue(path),
+                                                                "MaxBatchSize",
+                                                                UintegerValue(m_maxBatchSize));
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        Simulator::Schedule(Seconds(1), &Ns3AiInferenceSubmitTestCase::Submit, this, i);
+    }
+    Simulator::Schedule(Seconds(1), &Ns3AiInferenceSubmitTestCase::SubmitLater, this, 3);
+    Simulator::Run();
+
+    NS_TEST_ASSERT_MSG_EQ(m_received.size(), 4, "wrong number of outputs");
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(m_received[i], i, "outputs not in submission order");
+    }
+    NS_TEST_EXPECT_MSG_EQ(m_receivedBatch[3],
+                          m_numBatches,
+                          "the late input did not get a batch of its own");
+    NS_TEST_EXPECT_MSG_EQ(m_receivedBatch[2] + 1,
+                          m_numBatches,
+                          "the first inputs were not evaluated before the late one");
+    NS_TEST_EXPECT_MSG_EQ(m_engine->GetNumBatches(), m_numBatches, "wrong number of batches");
+    NS_TEST_EXPECT_MSG_EQ(m_engine->GetNumInferences(), 4, "wrong number of inferences");
+
+    // the pending inputs are dropped on dispose
+    m_engine->SetAttribute("MaxBatchSize", UintegerValue(0));
+    Simulator::Schedule(Seconds(2), &Ns3AiInferenceSubmitTestCase::Submit, this, 0);
+    Simulator::Schedule(Seconds(2), &Ns3AiInferenceEngine::Dispose, m_engine);
+    Simulator::Run();
+    NS_TEST_EXPECT_MSG_EQ(m_received.size(), 4, "output received after dispose");
+
+    Simulator::Destroy();
+    m_engine = nullptr;
+}
+
+/**
+ * \ingroup ns3-ai
+ *
+ * \brief Test suite of the inference engine
+ */
+class Ns3AiInferenceEngineTestSuite : public TestSuite
+{
+  public:
+    Ns3AiInferenceEngineTestSuite();
+};
+
+Ns3AiInferenceEngineTestSuite::Ns3AiInferenceEngineTestSuite()
+    : TestSuite("ns3-ai-inference-engine", Type::UNIT)
+{
+    AddTestCase(new Ns3AiInferenceMlpTestCase("linear"), TestCase::Duration::QUICK);
+    AddTestCase(new Ns3AiInferenceMlpTestCase("relu"), TestCase::Duration::QUICK);
+    AddTestCase(new Ns3AiInferenceMlpTestCase("tanh"), TestCase::Duration::QUICK);
+    AddTestCase(new Ns3AiInferenceMlpTestCase("sigmoid"), TestCase::Duration::QUICK);
+    // the three inputs of the first events share a batch, the late one gets its own
+    AddTestCase(new Ns3AiInferenceSubmitTestCase(0, 2), TestCase::Duration::QUICK);
+    // the third input waits for the flush
+    AddTestCase(new Ns3AiInferenceSubmitTestCase(2, 3), TestCase::Duration::QUICK);
+    // every input is evaluated when submitted
+    AddTestCase(new Ns3AiInferenceSubmitTestCase(1, 4), TestCase::Duration::QUICK);
+}
+
+/// Static variable for test initialization
+static Ns3AiInferenceEngineTestSuite g_ns3AiInferenceEngineTestSuite;
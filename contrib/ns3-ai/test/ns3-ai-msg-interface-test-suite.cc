@@ -0,0 +1,415 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/ns3-ai-msg-interface.h"
+#include "ns3/test.h"
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <unistd.h>
+
+using namespace ns3;
+
+/**
+ * \ingroup ns3-ai
+ * \brief Message exchanged by the tests of the message interface
+ */
+struct Ns3AiTestMsg
+{
+    uint32_t value; //!< the value of the message
+};
+
+/// The message interface used by the tests
+typedef Ns3AiMsgInterfaceImpl<Ns3AiTestMsg, Ns3AiTestMsg> Ns3AiTestInterface;
+
+/**
+ * \ingroup ns3-ai
+ * \return the name of a shared memory segment used only by this process
+ */
+static std::string
+GetTestSegmentName()
+{
+    return "ns3-ai-msg-interface-test-" + std::to_string(getpid());
+}
+
+/**
+ * \ingroup ns3-ai
+ *
+ * \brief Test case that exchanges messages between the C++ side and the
+ * Python side of the message interface, run on two threads of this process,
+ * with the given wait modes.
+ *
+ * When a side is slow to reply, the other side waits for longer than its
+ * spin budget, so in adaptive mode it sleeps on the futex and the post of the
+ * slow side wakes it up. Without delays, the two sides race on every message,
+ * which checks that a post racing with a waiter going to sleep is not lost.
+ */
+class Ns3AiMsgSyncTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param cppMode the wait mode of the C++ side
+     * \param pyMode the wait mode of the Python side
+     * \param spinCount the number of tries before a waiter in adaptive mode sleeps
+     * \param numRounds the number of messages sent in each direction
+     * \param delay whether each side waits before sending, so that the other side sleeps
+     */
+    Ns3AiMsgSyncTestCase(Ns3AiSyncMode cppMode,
+                         Ns3AiSyncMode pyMode,
+                         uint32_t spinCount,
+                         uint32_t numRounds,
+                         bool delay);
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Run the Python side: reply to each message with its value plus one
+     *
+     * \param interface the Python side of the interface
+     */
+    void RunPySide(Ns3AiTestInterface* interface);
+
+    Ns3AiSyncMode m_cppMode; ///< the wait mode of the C++ side
+    Ns3AiSyncMode m_pyMode;  ///< the wait mode of the Python side
+    uint32_t m_spinCount;    ///< the number of tries before sleeping
+    uint32_t m_numRounds;    ///< the number of messages sent in each direction
+    bool m_delay;            ///< whether each side waits before sending
+    uint32_t m_pyErrors{0};  ///< messages with a wrong value received by the Python side
+};
+
+Ns3AiMsgSyncTestCase::Ns3AiMsgSyncTestCase(Ns3AiSyncMode cppMode,
+                                           Ns3AiSyncMode pyMode,
+                                           uint32_t spinCount,
+                                           uint32_t numRounds,
+                                           bool delay)
+    : TestCase(std::string("C++ ") + (cppMode == SYNC_MODE_ADAPTIVE ? "adaptive" : "spin") +
+               ", Python " + (pyMode == SYNC_MODE_ADAPTIVE ? "adaptive" : "spin") + ", " +
+               std::to_string(spinCount) + " tries, " + std::to_string(numRounds) + " rounds" +
+               (delay ? ", with delays" : "")),
+      m_cppMode(cppMode),
+      m_pyMode(pyMode),
+      m_spinCount(spinCount),
+      m_numRounds(numRounds),
+      m_delay(delay)
+{
+}
+
+void
+Ns3AiMsgSyncTestCase::RunPySide(Ns3AiTestInterface* interface)
+{
+    for (uint32_t i = 0; i < m_numRounds; i++)
+    {
+        interface->PyRecvBegin();
+        uint32_t value = interface->GetCpp2PyStruct()->value;
+        interface->PyRecvEnd();
+        if (value != i)
+        {
+            m_pyErrors++;
+        }
+        if (m_delay)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        interface->PySendBegin();
+        interface->GetPy2CppStruct()->value = value + 1;
+        interface->PySendEnd();
+    }
+}
+
+void
+Ns3AiMsgSyncTestCase::DoRun()
+{
+    std::string segmentName = GetTestSegmentName();
+    Ns3AiTestInterface cppSide(true, false, false, 4096, segmentName.c_str());
+    Ns3AiTestInterface pySide(false, false, false, 4096, segmentName.c_str());
+    cppSide.SetSyncMode(m_cppMode, m_spinCount);
+    pySide.SetSyncMode(m_pyMode, m_spinCount);
+    NS_TEST_ASSERT_MSG_EQ(cppSide.GetSyncMode(), m_cppMode, "wrong wait mode");
+
+    std::thread pyThread(&Ns3AiMsgSyncTestCase::RunPySide, this, &pySide);
+    uint32_t cppErrors = 0;
+    for (uint32_t i = 0; i < m_numRounds; i++)
+    {
+        if (m_delay)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        cppSide.CppSendBegin();
+        cppSide.GetCpp2PyStruct()->value = i;
+        cppSide.CppSendEnd();
+        cppSide.CppRecvBegin();
+        if (cppSide.GetPy2CppStruct()->value != i + 1)
+        {
+            cppErrors++;
+        }
+        cppSide.CppRecvEnd();
+    }
+    pyThread.join();
+
+    NS_TEST_ASSERT_MSG_EQ(m_pyErrors, 0, "wrong messages received by the Python side");
+    NS_TEST_ASSERT_MSG_EQ(cppErrors, 0, "wrong messages received by the C++ side");
+
+    boost::interprocess::managed_shared_memory segment(boost::interprocess::open_only,
+                                                       segmentName.c_str());
+    const Ns3AiMsgSync* sync = segment.find<Ns3AiMsgSync>("My Lockable").first;
+    NS_TEST_ASSERT_MSG_NE(sync, nullptr, "synchronization structure not found");
+    for (const Ns3AiFutex* futex : {&sync->m_cpp2pyEmptyFutex,
+                                    &sync->m_cpp2pyFullFutex,
+                                    &sync->m_py2cppEmptyFutex,
+                                    &sync->m_py2cppFullFutex})
+    {
+        NS_TEST_ASSERT_MSG_EQ(futex->m_waiters, 0, "a waiter is still registered");
+    }
+    // the sequence of a futex only moves when a post finds a sleeping waiter
+    if (m_delay)
+    {
+        NS_TEST_ASSERT_MSG_EQ((sync->m_py2cppFullFutex.m_seq > 0),
+                              (m_cppMode == SYNC_MODE_ADAPTIVE),
+                              "the C++ side did not wait for the reply as set by its mode");
+        NS_TEST_ASSERT_MSG_EQ((sync->m_cpp2pyFullFutex.m_seq > 0),
+                              (m_pyMode == SYNC_MODE_ADAPTIVE),
+                              "the Python side did not wait for the message as set by its mode");
+    }
+}
+
+/**
+ * \ingroup ns3-ai
+ *
+ * \brief Test case that streams messages from the C++ side to the Python side
+ * through the ring, run on two threads of this process.
+ *
+ * It checks that the Python side receives every message once, in order, with
+ * its sequence number, in batches of at most the given size, and that the
+ * finish notification is only seen after the last message. When the Python
+ * side is slow, the ring fills up, so the C++ side waits for free slots and
+ * the Python side gets several messages at once.
+ */
+class Ns3AiMsgRingTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param syncMode the wait mode of both sides
+     * \param numSlots the number of slots in the ring
+     * \param maxCount the maximum number of messages received at once (0 for no limit)
+     * \param numMessages the number of messages sent
+     * \param delay whether the Python side waits after each batch, so that the ring fills up
+     */
+    Ns3AiMsgRingTestCase(Ns3AiSyncMode syncMode,
+                         uint32_t numSlots,
+                         uint32_t maxCount,
+                         uint32_t numMessages,
+                         bool delay);
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Run the Python side: receive batches until the simulation is finished
+     *
+     * \param interface the Python side of the interface
+     */
+    void RunPySide(Ns3AiTestInterface* interface);
+
+    Ns3AiSyncMode m_syncMode; ///< the wait mode of both sides
+    uint32_t m_numSlots;      ///< the number of slots in the ring
+    uint32_t m_maxCount;      ///< the maximum number of messages received at once
+    uint32_t m_numMessages;   ///< the number of messages sent
+    bool m_delay;             ///< whether the Python side waits after each batch
+    uint32_t m_pyErrors{0};   ///< messages with a wrong value or sequence number
+    uint64_t m_received{0};   ///< the number of messages received by the Python side
+    uint32_t m_maxBatch{0};   ///< the largest batch received by the Python side
+};
+
+Ns3AiMsgRingTestCase::Ns3AiMsgRingTestCase(Ns3AiSyncMode syncMode,
+                                           uint32_t numSlots,
+                                           uint32_t maxCount,
+                                           uint32_t numMessages,
+                                           bool delay)
+    : TestCase(std::string("Ring, ") + (syncMode == SYNC_MODE_ADAPTIVE ? "adaptive" : "spin") +
+               ", " + std::to_string(numSlots) + " slots, at most " + std::to_string(maxCount) +
+               " per batch, " + std::to_string(numMessages) + " messages" +
+               (delay ? ", with delays" : "")),
+      m_syncMode(syncMode),
+      m_numSlots(numSlots),
+      m_maxCount(maxCount),
+      m_numMessages(numMessages),
+      m_delay(delay)
+{
+}
+
+void
+Ns3AiMsgRingTestCase::RunPySide(Ns3AiTestInterface* interface)
+{
+    while (true)
+    {
+        uint32_t count = interface->PyRingRecvBegin(m_maxCount);
+        m_maxBatch = std::max(m_maxBatch, count);
+        for (uint32_t i = 0; i < count; i++)
+        {
+            if (interface->GetCpp2PyRingStruct(i)->value != m_received ||
+                interface->GetCpp2PyRingSeq(i) != m_received)
+            {
+                m_pyErrors++;
+            }
+            m_received++;
+        }
+        interface->PyRingRecvEnd();
+        if (interface->PyGetFinished())
+        {
+            break;
+        }
+        if (m_delay)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+}
+
+void
+Ns3AiMsgRingTestCase::DoRun()
+{
+    std::string segmentName = GetTestSegmentName();
+    // as in the examples, the Python side creates the shared memory and the ring
+    Ns3AiTestInterface pySide(true, false, true, 65536, segmentName.c_str());
+    pySide.SetSyncMode(m_syncMode);
+    pySide.CreateCpp2PyRing(m_numSlots);
+    NS_TEST_ASSERT_MSG_EQ(pySide.GetCpp2PyRingSize(), m_numSlots, "wrong number of slots");
+
+    std::thread pyThread(&Ns3AiMsgRingTestCase::RunPySide, this, &pySide);
+    {
+        Ns3AiTestInterface cppSide(false, false, true, 65536, segmentName.c_str());
+        cppSide.SetSyncMode(m_syncMode);
+        NS_TEST_EXPECT_MSG_EQ(cppSide.GetCpp2PyRingSize(),
+                              m_numSlots,
+                              "the C++ side does not find the ring");
+        for (uint32_t i = 0; i < m_numMessages; i++)
+        {
+            cppSide.CppRingSendBegin()->value = i;
+            cppSide.CppRingSendEnd();
+        }
+        // the C++ side queues the finish notification when it is destroyed
+    }
+    pyThread.join();
+
+    NS_TEST_ASSERT_MSG_EQ(m_pyErrors, 0, "wrong messages received by the Python side");
+    NS_TEST_ASSERT_MSG_EQ(m_received, m_numMessages, "wrong number of messages received");
+    NS_TEST_ASSERT_MSG_LT_OR_EQ(m_maxBatch,
+                                (m_maxCount == 0 ? m_numSlots : m_maxCount),
+                                "too many messages received at once");
+    if (m_delay)
+    {
+        NS_TEST_ASSERT_MSG_GT(m_maxBatch, 1, "the messages were not received in batches");
+    }
+}
+
+/**
+ * \ingroup ns3-ai
+ *
+ * \brief Test case that checks the non-blocking calls used when the C++ side
+ * streams messages through the ring and does not wait for the replies.
+ */
+class Ns3AiMsgTryTestCase : public TestCase
+{
+  public:
+    Ns3AiMsgTryTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+Ns3AiMsgTryTestCase::Ns3AiMsgTryTestCase()
+    : TestCase("Non-blocking replies")
+{
+}
+
+void
+Ns3AiMsgTryTestCase::DoRun()
+{
+    std::string segmentName = GetTestSegmentName();
+    Ns3AiTestInterface pySide(true, false, false, 4096, segmentName.c_str());
+    Ns3AiTestInterface cppSide(false, false, false, 4096, segmentName.c_str());
+    NS_TEST_ASSERT_MSG_EQ(cppSide.GetCpp2PyRingSize(), 0, "no ring was created");
+
+    NS_TEST_ASSERT_MSG_EQ(cppSide.CppTryRecvBegin(), false, "no reply was sent");
+    NS_TEST_ASSERT_MSG_EQ(pySide.PyTrySendBegin(), true, "the reply slot is free");
+    pySide.GetPy2CppStruct()->value = 1;
+    pySide.PySendEnd();
+    NS_TEST_ASSERT_MSG_EQ(pySide.PyTrySendBegin(),
+                          false,
+                          "the previous reply was not taken by the C++ side");
+    NS_TEST_ASSERT_MSG_EQ(cppSide.CppTryRecvBegin(), true, "a reply was sent");
+    NS_TEST_ASSERT_MSG_EQ(cppSide.GetPy2CppStruct()->value, 1, "wrong reply");
+    cppSide.CppRecvEnd();
+    NS_TEST_ASSERT_MSG_EQ(cppSide.CppTryRecvBegin(), false, "the reply was already taken");
+    NS_TEST_ASSERT_MSG_EQ(pySide.PyTrySendBegin(), true, "the reply slot is free again");
+    pySide.PySendEnd();
+}
+
+/**
+ * \ingroup ns3-ai
+ *
+ * \brief Test suite for the message interface of ns3-ai
+ */
+class Ns3AiMsgInterfaceTestSuite : public TestSuite
+{
+  public:
+    Ns3AiMsgInterfaceTestSuite();
+};
+
+Ns3AiMsgInterfaceTestSuite::Ns3AiMsgInterfaceTestSuite()
+    : TestSuite("ns3-ai-msg-interface", Type::UNIT)
+{
+    AddTestCase(new Ns3AiMsgSyncTestCase(SYNC_MODE_SPIN, SYNC_MODE_SPIN, 0, 50, true),
+                TestCase::Duration::QUICK);
+    AddTestCase(new Ns3AiMsgSyncTestCase(SYNC_MODE_ADAPTIVE, SYNC_MODE_SPIN, 10, 50, true),
+                TestCase::Duration::QUICK);
+    AddTestCase(new Ns3AiMsgSyncTestCase(SYNC_MODE_SPIN, SYNC_MODE_ADAPTIVE, 10, 50, true),
+                TestCase::Duration::QUICK);
+    AddTestCase(new Ns3AiMsgSyncTestCase(SYNC_MODE_ADAPTIVE, SYNC_MODE_ADAPTIVE, 10, 50, true),
+                TestCase::Duration::QUICK);
+    AddTestCase(new Ns3AiMsgSyncTestCase(SYNC_MODE_ADAPTIVE, SYNC_MODE_ADAPTIVE, 0, 20000, false),
+                TestCase::Duration::QUICK);
+    AddTestCase(new Ns3AiMsgSyncTestCase(SYNC_MODE_ADAPTIVE,
+                                         SYNC_MODE_ADAPTIVE,
+                                         NS3_AI_DEFAULT_SPIN_COUNT,
+                                         5000,
+                                         false),
+                TestCase::Duration::QUICK);
+    AddTestCase(new Ns3AiMsgRingTestCase(SYNC_MODE_SPIN, 1, 0, 1000, false),
+                TestCase::Duration::QUICK);
+    AddTestCase(new Ns3AiMsgRingTestCase(SYNC_MODE_SPIN, 64, 0, 20000, false),
+                TestCase::Duration::QUICK);
+    AddTestCase(new Ns3AiMsgRingTestCase(SYNC_MODE_SPIN, 8, 0, 200, true),
+                TestCase::Duration::QUICK);
+    AddTestCase(new Ns3AiMsgRingTestCase(SYNC_MODE_ADAPTIVE, 8, 3, 200, true),
+                TestCase::Duration::QUICK);
+    AddTestCase(
+        new Ns3AiMsgRingTestCase(SYNC_MODE_ADAPTIVE, NS3_AI_MAX_RING_SLOTS, 0, 20000, false),
+        TestCase::Duration::QUICK);
+    AddTestCase(new Ns3AiMsgTryTestCase(), TestCase::Duration::QUICK);
+}
+
+/**
+ * \ingroup ns3-ai
+ * Static variable for test initialization
+ */
+static Ns3AiMsgInterfaceTestSuite g_ns3AiMsgInterfaceTestSuite;
@@ -11,6 +11,7 @@ from gym.utils import seeding
 from enum import IntEnum
 
 from ns3gym.start_sim import start_sim_script, build_ns3_project
+from ns3gym.shm_bridge import ShmSocket
 
 import ns3gym.messages_pb2 as pb
 from google.protobuf.any_pb2 import Any
@@ -24,37 +25,58 @@ __email__ = "gawlowicz@tkn.tu-berlin.de"
 
 class Ns3ZmqBridge(object):
     """docstring for Ns3ZmqBridge"""
-    def __init__(self, port=0, startSim=True, simSeed=0, simArgs={}, debug=False):
+    def __init__(self, port=0, startSim=True, simSeed=0, simArgs={}, debug=False, transport='tcp'):
         super(Ns3ZmqBridge, self).__init__()
         port = int(port)
         self.port = port
         self.startSim = startSim
         self.simSeed = simSeed
         self.simArgs = simArgs
+        self.transport = transport
         self.envStopped = False
         self.simPid = None
         self.wafPid = None
         self.ns3Process = None
+        self.numEnvs = 1
 
-        context = zmq.Context()
-        self.socket = context.socket(zmq.REP)
-        try:
-            if port == 0 and self.startSim:
-                port = self.socket.bind_to_random_port('tcp://*', min_port=5001, max_port=10000, max_tries=100)
-                print("Got new port for ns3gm interface: ", port)
+        if transport not in ('tcp', 'ipc', 'shm'):
+            print("Unknown transport %s, use tcp, ipc or shm" % str(transport))
+            sys.exit()
 
-            elif port == 0 and not self.startSim:
-                print("Cannot use port %s to bind" % str(port) )
-                print("Please specify correct port" )
-                sys.exit()
+        if port == 0 and not self.startSim:
+            print("Cannot use port %s to bind" % str(port) )
+            print("Please specify correct port" )
+            sys.exit()
+        elif port == 0 and transport != 'tcp':
+            # only identifies the endpoint, no need for a free tcp port
+            port = os.getpid()
+
+        if transport == 'shm':
+            # OpenGymInterface::Address defaults to /ns3gym-<port>
+            self.socket = ShmSocket("ns3gym-%s" % str(port))
+            address = "shm:///ns3gym-%s" % str(port)
+        else:
+            context = zmq.Context()
+            self.socket = context.socket(zmq.REP)
+            try:
+                if transport == 'ipc':
+                    address = "ipc:///tmp/ns3gym-%s" % str(port)
+                    self.socket.bind (address)
+
+                elif port == 0:
+                    port = self.socket.bind_to_random_port('tcp://*', min_port=5001, max_port=10000, max_tries=100)
+                    print("Got new port for ns3gm interface: ", port)
+                    address = "tcp://localhost:%s" % str(port)
 
-            else:
-                self.socket.bind ("tcp://*:%s" % str(port))
+                else:
+                    self.socket.bind ("tcp://*:%s" % str(port))
+                    address = "tcp://localhost:%s" % str(port)
 
-        except Exception as e:
-            print("Cannot bind to tcp://*:%s as port is already in use" % str(port) )
-            print("Please specify different port or use 0 to get free port" )
-            sys.exit()
+            except Exception as e:
+                print("Cannot bind to %s://*:%s as port is already in use" % (transport, str(port)) )
+                print("Please specify different port or use 0 to get free port" )
+                sys.exit()
+        self.port = port
 
         if (startSim == True and simSeed == 0):
             maxSeed = np.iinfo(np.uint32).max
@@ -63,9 +85,9 @@ class Ns3ZmqBridge(object):
 
         if self.startSim:
             # run simulation script
-            self.ns3Process = start_sim_script(port, simSeed, simArgs, debug)
+            self.ns3Process = start_sim_script(port, simSeed, simArgs, debug, transport)
         else:
-            print("Waiting for simulation script to connect on port: tcp://localhost:{}".format(port))
+            print("Waiting for simulation script to connect on port: {}".format(address))
             print('Please start proper ns-3 simulation script using ./waf --run "..."')
 
         self._action_space = None
@@ -95,6 +117,8 @@ class Ns3ZmqBridge(object):
                     self.wafPid = None
         except Exception as e:
             pass
+        if self.transport == 'shm':
+            self.socket.close()
 
     def _create_space(self, spaceDesc):
         space = None
@@ -156,6 +180,7 @@ class Ns3ZmqBridge(object):
         self.wafPid = int(simInitMsg.wafShellProcessId)
         self._action_space = self._create_space(simInitMsg.actSpace)
         self._observation_space = self._create_space(simInitMsg.obsSpace)
+        self.numEnvs = max(1, int(simInitMsg.numEnvs))
 
         reply = pb.SimInitAck()
         reply.done = True
@@ -178,13 +203,25 @@ class Ns3ZmqBridge(object):
             return
 
         request = self.socket.recv()
-        envStateMsg = pb.EnvStateMsg()
-        envStateMsg.ParseFromString(request)
+        if self.numEnvs > 1:
+            # batched mode, one state per environment of the simulation
+            envStateBatchMsg = pb.EnvStateBatchMsg()
+            envStateBatchMsg.ParseFromString(request)
+            states = envStateBatchMsg.states
+
+            self.obsData = [self._create_data(state.obsData) for state in states]
+            self.reward = np.array([state.reward for state in states])
+            self.gameOver = all(state.isGameOver for state in states)
+            self.gameOverReason = states[0].reason
+            envStateMsg = None
+        else:
+            envStateMsg = pb.EnvStateMsg()
+            envStateMsg.ParseFromString(request)
 
-        self.obsData = self._create_data(envStateMsg.obsData)
-        self.reward = envStateMsg.reward
-        self.gameOver = envStateMsg.isGameOver
-        self.gameOverReason = envStateMsg.reason
+            self.obsData = self._create_data(envStateMsg.obsData)
+            self.reward = envStateMsg.reward
+            self.gameOver = envStateMsg.isGameOver
+            self.gameOverReason = envStateMsg.reason
 
         if self.gameOver:
             if self.gameOverReason == pb.EnvStateMsg.SimulationEnd:
@@ -194,14 +231,20 @@ class Ns3ZmqBridge(object):
                 self.forceEnvStop = True
                 self.send_close_command()
 
-        self.extraInfo = envStateMsg.info
-        if not self.extraInfo:
-            self.extraInfo = {}
+        if envStateMsg is None:
+            self.extraInfo = [state.info if state.info else {} for state in states]
+        else:
+            self.extraInfo = envStateMsg.info
+            if not self.extraInfo:
+                self.extraInfo = {}
 
         self.newStateRx = True
 
     def send_close_command(self):
-        reply = pb.EnvActMsg()
+        if self.numEnvs > 1:
+            reply = pb.EnvActBatchMsg()
+        else:
+            reply = pb.EnvActMsg()
         reply.stopSimReq = True
 
         replyMsg = reply.SerializeToString()
@@ -210,10 +253,19 @@ class Ns3ZmqBridge(object):
         return True
 
     def send_actions(self, actions):
-        reply = pb.EnvActMsg()
+        if self.numEnvs > 1:
+            # batched mode, one action per environment of the simulation
+            if len(actions) != self.numEnvs:
+                raise Exception("Expected {} actions, got {}".format(self.numEnvs, len(actions)))
+            reply = pb.EnvActBatchMsg()
+            for action in actions:
+                act = reply.acts.add()
+                act.actData.CopyFrom(self._pack_data(action, self._action_space))
+        else:
+            reply = pb.EnvActMsg()
 
-        actionMsg = self._pack_data(actions, self._action_space)
-        reply.actData.CopyFrom(actionMsg)
+            actionMsg = self._pack_data(actions, self._action_space)
+            reply.actData.CopyFrom(actionMsg)
 
         reply.stopSimReq = False
         if self.forceEnvStop:
@@ -375,9 +427,10 @@ class Ns3ZmqBridge(object):
 
 
 class Ns3Env(gym.Env):
-    def __init__(self, stepTime=0, port=0, startSim=True, simSeed=0, simArgs={}, debug=False):
+    def __init__(self, stepTime=0, port=0, startSim=True, simSeed=0, simArgs={}, debug=False, transport='tcp'):
         self.stepTime = stepTime
         self.port = port
+        self.transport = transport
         self.startSim = startSim
         self.simSeed = simSeed
         self.simArgs = simArgs
@@ -392,7 +445,7 @@ class Ns3Env(gym.Env):
         self.state = None
         self.steps_beyond_done = None
 
-        self.ns3ZmqBridge = Ns3ZmqBridge(self.port, self.startSim, self.simSeed, self.simArgs, self.debug)
+        self.ns3ZmqBridge = Ns3ZmqBridge(self.port, self.startSim, self.simSeed, self.simArgs, self.debug, self.transport)
         self.ns3ZmqBridge.initialize_env(self.stepTime)
         self.action_space = self.ns3ZmqBridge.get_action_space()
         self.observation_space = self.ns3ZmqBridge.get_observation_space()
@@ -427,7 +480,7 @@ class Ns3Env(gym.Env):
             self.ns3ZmqBridge = None
 
         self.envDirty = False
-        self.ns3ZmqBridge = Ns3ZmqBridge(self.port, self.startSim, self.simSeed, self.simArgs, self.debug)
+        self.ns3ZmqBridge = Ns3ZmqBridge(self.port, self.startSim, self.simSeed, self.simArgs, self.debug, self.transport)
         self.ns3ZmqBridge.initialize_env(self.stepTime)
         self.action_space = self.ns3ZmqBridge.get_action_space()
         self.observation_space = self.ns3ZmqBridge.get_observation_space()
@@ -440,9 +493,15 @@ class Ns3Env(gym.Env):
         return
 
     def get_random_action(self):
+        if self.ns3ZmqBridge and self.ns3ZmqBridge.numEnvs > 1:
+            return [self.action_space.sample() for _ in range(self.ns3ZmqBridge.numEnvs)]
         act = self.action_space.sample()
         return act
 
+    @property
+    def num_envs(self):
+        return self.ns3ZmqBridge.numEnvs if self.ns3ZmqBridge else 1
+
     def close(self):
         if self.ns3ZmqBridge:
             self.ns3ZmqBridge.close()
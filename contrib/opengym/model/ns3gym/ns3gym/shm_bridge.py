@@ -0,0 +1,153 @@
+import ctypes
+import ctypes.util
+import os
+import platform
+import struct
+from multiprocessing import shared_memory
+
+
+# futex(2) system call numbers, the wait falls back to short sleeps elsewhere
+_SYS_FUTEX = {'x86_64': 202, 'aarch64': 98, 'i686': 240, 'armv7l': 240}.get(platform.machine())
+_FUTEX_WAIT = 0
+_FUTEX_WAKE = 1
+
+# memory orders of the __atomic builtins, libatomic implements them as functions
+_ATOMIC_ACQUIRE = 2
+_ATOMIC_RELEASE = 3
+# plain loads and stores are enough where the hardware keeps their order
+_TSO_MACHINES = ('x86_64', 'AMD64', 'i386', 'i686')
+
+
+class _Timespec(ctypes.Structure):
+    _fields_ = [('tv_sec', ctypes.c_long), ('tv_nsec', ctypes.c_long)]
+
+
+class ShmSocket(object):
+    """
+    Reply side of the shared memory transport of OpenGymInterface
+    (Transport=Shm), with the recv/send calls of a zmq.REP socket.
+    Layout must match OpenGymShmTransport::Header in opengym_transport.h,
+    in host byte order.
+
+    A side waiting for a message spins shortly, then sleeps on a futex on
+    the sequence number of the other side, which wakes it after publishing.
+    The sequence numbers and the capacity are published with release stores
+    and read with acquire loads, like on C++ side, so that the messages are
+    complete when their sequence number is seen.
+    """
+    DATA_OFFSET = 64
+    SPIN_COUNT = 100
+    # the sleep is bounded so that the agent can be interrupted
+    WAIT_TIMEOUT = 0.1
+
+    def __init__(self, name, capacity=1 << 20):
+        self.name = name
+        self.capacity = capacity
+        self.seq = 0
+        try:
+            old = shared_memory.SharedMemory(name=name)
+            old.close()
+            old.unlink()
+        except FileNotFoundError:
+            pass
+        self.shm = shared_memory.SharedMemory(name=name, create=True,
+                                              size=self.DATA_OFFSET + 2 * capacity)
+        self.buf = self.shm.buf
+        self.buf[:self.DATA_OFFSET] = bytes(self.DATA_OFFSET)
+        self.reqOffset = self.DATA_OFFSET
+        self.repOffset = self.DATA_OFFSET + capacity
+
+        self.reqSeqWord = ctypes.c_uint32.from_buffer(self.buf, 0)
+        self.repSeqWord = ctypes.c_uint32.from_buffer(self.buf, 4)
+        self.capacityWord = ctypes.c_uint32.from_buffer(self.buf, 16)
+
+        self.atomicLoad = None
+        self.atomicStore = None
+        libatomic = ctypes.util.find_library('atomic')
+        if libatomic is not None:
+            # getattr, a double underscore attribute would be mangled in the class
+            libatomic = ctypes.CDLL(libatomic)
+            self.atomicLoad = getattr(libatomic, '__atomic_load_4')
+            self.atomicLoad.argtypes = [ctypes.c_void_p, ctypes.c_int]
+            self.atomicLoad.restype = ctypes.c_uint32
+            self.atomicStore = getattr(libatomic, '__atomic_store_4')
+            self.atomicStore.argtypes = [ctypes.c_void_p, ctypes.c_uint32, ctypes.c_int]
+            self.atomicStore.restype = None
+        elif platform.machine() not in _TSO_MACHINES:
+            self.close()
+            raise Exception("Shared memory transport needs libatomic on {}".format(
+                platform.machine()))
+
+        self.libc = None
+        if _SYS_FUTEX is not None and platform.system() == 'Linux':
+            self.libc = ctypes.CDLL(None, use_errno=True)
+            self.timeout = _Timespec(0, int(self.WAIT_TIMEOUT * 1e9))
+
+        # capacity is written last, the simulation waits for it
+        self._store(self.capacityWord, capacity)
+
+    def _load(self, word):
+        if self.atomicLoad is None:
+            return word.value
+        return self.atomicLoad(ctypes.addressof(word), _ATOMIC_ACQUIRE)
+
+    def _store(self, word, value):
+        if self.atomicStore is None:
+            word.value = value
+        else:
+            self.atomicStore(ctypes.addressof(word), value, _ATOMIC_RELEASE)
+
+    def _wait(self, seq):
+        # returns at once if reqSeq is no longer seq
+        if self.libc is None:
+            os.sched_yield()
+            return
+        self.libc.syscall(_SYS_FUTEX, ctypes.byref(self.reqSeqWord), _FUTEX_WAIT,
+                          ctypes.c_uint32(seq), ctypes.byref(self.timeout), None, 0)
+
+    def _wake(self):
+        if self.libc is not None:
+            self.libc.syscall(_SYS_FUTEX, ctypes.byref(self.repSeqWord), _FUTEX_WAKE, 1,
+                              None, None, 0)
+
+    def recv(self):
+        expected = (self.seq + 1) & 0xFFFFFFFF
+        spins = 0
+        while True:
+            seq = self._load(self.reqSeqWord)
+            if seq == expected:
+                break
+            spins += 1
+            if spins > self.SPIN_COUNT:
+                self._wait(seq)
+        self.seq = expected
+        reqSize = struct.unpack_from('=I', self.buf, 8)[0]
+        return bytes(self.buf[self.reqOffset:self.reqOffset + reqSize])
+
+    def send(self, msg):
+        if len(msg) > self.capacity:
+            raise Exception("Message of {} bytes does not fit into shared memory".format(len(msg)))
+        self.buf[self.repOffset:self.repOffset + len(msg)] = msg
+        struct.pack_into('=I', self.buf, 12, len(msg))
+        # the simulation reads the message once it sees the new repSeq
+        self._store(self.repSeqWord, self.seq)
+        # the simulation may sleep on repSeq
+        self._wake()
+
+    def close(self):
+        if self.shm is None:
+            return
+        # the views keep the buffer exported, release them first
+        self.reqSeqWord = None
+        self.repSeqWord = None
+        self.capacityWord = None
+        self.libc = None
+        self.atomicLoad = None
+        self.atomicStore = None
+        self.buf = None
+        self.shm.close()
+        try:
+            self.shm.unlink()
+        except FileNotFoundError:
+            pass
+        self.shm = None
@@ -67,7 +67,7 @@ def build_ns3_project(debug=True):
 	os.chdir(cwd)
 
 
-def start_sim_script(port=5555, sim_seed=0, sim_args={}, debug=False):
+def start_sim_script(port=5555, sim_seed=0, sim_args={}, debug=False, transport='tcp'):
 	"""
 	Actually run the ns3 scenario
 	"""
@@ -83,6 +83,9 @@ def start_sim_script(port=5555, sim_seed=0, sim_args={}, debug=False):
 	if port:
 		ns3_string += ' --openGymPort=' + str(port)
 
+	if transport != 'tcp':
+		ns3_string += ' --OpenGymInterface::Transport=' + transport.capitalize()
+
 	if sim_seed:
 		ns3_string += ' --simSeed=' + str(sim_seed)
 
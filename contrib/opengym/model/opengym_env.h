@@ -48,6 +48,16 @@ public:
   virtual std::string GetExtraInfo() = 0;
   virtual bool ExecuteActions(Ptr<OpenGymDataContainer> action) = 0;
 
+  /**
+   * Assigns fixed random variable streams to the random variables of the
+   * environment, called by OpenGymInterface::AssignStreams in batched mode.
+   * No stream is assigned by default.
+   *
+   * \param stream first stream index to use
+   * \return the number of stream indices assigned
+   */
+  virtual int64_t AssignStreams (int64_t stream);
+
   void SetOpenGymInterface(Ptr<OpenGymInterface> openGymInterface);
   void Notify();
   void NotifySimulationEnd();
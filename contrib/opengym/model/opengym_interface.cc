@@ -21,14 +21,18 @@
 
 #include <sys/types.h>
 #include <unistd.h>
+#include "ns3/abort.h"
 #include "ns3/log.h"
 #include "ns3/config.h"
+#include "ns3/enum.h"
+#include "ns3/string.h"
 #include "ns3/simulator.h"
 #include "opengym_interface.h"
 #include "opengym_env.h"
 #include "container.h"
 #include "spaces.h"
 #include "messages.pb.h"
+#include <algorithm>
 
 namespace ns3 {
 
@@ -44,6 +48,21 @@ OpenGymInterface::GetTypeId (void)
     .SetParent<Object> ()
     .SetGroupName ("OpenGym")
     .AddConstructor<OpenGymInterface> ()
+    .AddAttribute ("Transport",
+                   "Channel to the Python agent. Ipc and Shm avoid the loopback "
+                   "TCP stack, the agent must use the same transport.",
+                   EnumValue<Transport> (OpenGymInterface::TCP),
+                   MakeEnumAccessor<Transport> (&OpenGymInterface::m_transportType),
+                   MakeEnumChecker (OpenGymInterface::TCP, "Tcp",
+                                    OpenGymInterface::IPC, "Ipc",
+                                    OpenGymInterface::SHM, "Shm"))
+    .AddAttribute ("Address",
+                   "Endpoint of the agent. If empty, it is derived from the port: "
+                   "tcp://localhost:<port>, ipc:///tmp/ns3gym-<port> or the shared "
+                   "memory object /ns3gym-<port>.",
+                   StringValue (""),
+                   MakeStringAccessor (&OpenGymInterface::m_address),
+                   MakeStringChecker ())
     ;
   return tid;
 }
@@ -74,12 +93,14 @@ OpenGymInterface::Delete (void)
 {
   NS_LOG_FUNCTION_NOARGS ();
   Config::UnregisterRootNamespaceObject (Get ());
+  (*DoGet ())->Dispose ();
   (*DoGet ()) = 0;
 }
 
 OpenGymInterface::OpenGymInterface(uint32_t port):
-  m_port(port), m_zmq_context(1), m_zmq_socket(m_zmq_context, ZMQ_REQ),
-  m_simEnd(false), m_stopEnvRequested(false), m_initSimMsgSent(false)
+  m_port(port), m_transportType(TCP),
+  m_simEnd(false), m_stopEnvRequested(false), m_initSimMsgSent(false),
+  m_numEnvs(1), m_batchCount(0)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -93,6 +114,20 @@ void
 OpenGymInterface::DoDispose (void)
 {
   NS_LOG_FUNCTION (this);
+  m_transport = nullptr;
+  // the environments hold the interface, break the cycle
+  m_envs.clear ();
+  m_batchStates.clear ();
+  m_batchPending.clear ();
+  m_batchCount = 0;
+  m_actionSpaceCb = MakeNullCallback< Ptr<OpenGymSpace> > ();
+  m_observationSpaceCb = MakeNullCallback< Ptr<OpenGymSpace> > ();
+  m_gameOverCb = MakeNullCallback<bool> ();
+  m_obsCb = MakeNullCallback< Ptr<OpenGymDataContainer> > ();
+  m_rewardCb = MakeNullCallback<float> ();
+  m_extraInfoCb = MakeNullCallback<std::string> ();
+  m_actionCb = MakeNullCallback<bool, Ptr<OpenGymDataContainer> > ();
+  Object::DoDispose ();
 }
 
 void
@@ -150,6 +185,31 @@ OpenGymInterface::SetExecuteActionsCb(Callback<bool, Ptr<OpenGymDataContainer> >
   m_actionCb = cb;
 }
 
+Ptr<OpenGymTransport>
+OpenGymInterface::CreateTransport () const
+{
+  NS_LOG_FUNCTION (this);
+  std::string address = m_address;
+  switch (m_transportType) {
+    case IPC:
+      if (address.empty()) {
+        address = "ipc:///tmp/ns3gym-" + std::to_string(m_port);
+      }
+      return Create<OpenGymZmqTransport> (address);
+    case SHM:
+      if (address.empty()) {
+        address = "/ns3gym-" + std::to_string(m_port);
+      }
+      return Create<OpenGymShmTransport> (address);
+    case TCP:
+    default:
+      if (address.empty()) {
+        address = "tcp://localhost:" + std::to_string(m_port);
+      }
+      return Create<OpenGymZmqTransport> (address);
+  }
+}
+
 void 
 OpenGymInterface::Init()
 {
@@ -160,8 +220,8 @@ OpenGymInterface::Init()
   }
   m_initSimMsgSent = true;
 
-  std::string connectAddr = "tcp://localhost:" + std::to_string(m_port);
-  zmq_connect ((void*)m_zmq_socket, connectAddr.c_str());
+  m_transport = CreateTransport ();
+  std::string connectAddr = m_transport->GetAddress ();
 
   Ptr<OpenGymSpace> obsSpace = GetObservationSpace();
   Ptr<OpenGymSpace> actionSpace = GetActionSpace();
@@ -169,6 +229,7 @@ OpenGymInterface::Init()
   NS_LOG_UNCOND("Simulation process id: " << ::getpid() << " (parent (waf shell) id: " << ::getppid() << ")");
   NS_LOG_UNCOND("Waiting for Python process to connect on port: "<< connectAddr);
   NS_LOG_UNCOND("Please start proper Python Gym Agent");
+  m_transport->Connect ();
 
   ns3opengym::SimInitMsg simInitMsg;
   simInitMsg.set_simprocessid(::getpid());
@@ -185,17 +246,14 @@ OpenGymInterface::Init()
     spaceDesc = actionSpace->GetSpaceDescription();
     simInitMsg.mutable_actspace()->CopyFrom(spaceDesc);
   }
+  simInitMsg.set_numenvs(m_numEnvs);
 
   // send init msg to python
-  zmq::message_t request(simInitMsg.ByteSizeLong());;
-  simInitMsg.SerializeToArray(request.data(), simInitMsg.ByteSizeLong());
-  m_zmq_socket.send (request, zmq::send_flags::none);
+  m_transport->Send (simInitMsg);
 
   // receive init ack msg form python
   ns3opengym::SimInitAck simInitAck;
-  zmq::message_t reply;
-  (void) m_zmq_socket.recv (reply, zmq::recv_flags::none);
-  simInitAck.ParseFromArray(reply.data(), reply.size());
+  m_transport->Recv (simInitAck);
 
   bool done = simInitAck.done();
   NS_LOG_DEBUG("Sim Init Ack: " << done);
@@ -224,6 +282,40 @@ OpenGymInterface::NotifyCurrentState()
   }
 
   // collect current env state
+  ns3opengym::EnvStateMsg envStateMsg = GetEnvStateMsg ();
+
+  // send env state msg to python
+  m_transport->Send (envStateMsg);
+
+  // receive act msg form python
+  ns3opengym::EnvActMsg envActMsg;
+  m_transport->Recv (envActMsg);
+
+  if (m_simEnd) {
+    // if sim end only rx ms and quit
+    return;
+  }
+
+  bool stopSim = envActMsg.stopsimreq();
+  if (stopSim) {
+    NS_LOG_DEBUG("---Stop requested: " << stopSim);
+    m_stopEnvRequested = true;
+    Simulator::Stop();
+    Simulator::Destroy ();
+    std::exit(0);
+  }
+
+  // first step after reset is called without actions, just to get current state
+  ns3opengym::DataContainer actDataContainerPbMsg = envActMsg.actdata();
+  Ptr<OpenGymDataContainer> actDataContainer = OpenGymDataContainer::CreateFromDataContainerPbMsg(actDataContainerPbMsg);
+  ExecuteActions(actDataContainer);
+
+}
+
+ns3opengym::EnvStateMsg
+OpenGymInterface::GetEnvStateMsg (void)
+{
+  NS_LOG_FUNCTION (this);
   Ptr<OpenGymDataContainer> obsDataContainer = GetObservation();
   float reward = GetReward();
   bool isGameOver = IsGameOver();
@@ -252,24 +344,60 @@ OpenGymInterface::NotifyCurrentState()
 
   // extra info
   envStateMsg.set_info(extraInfo);
+  return envStateMsg;
+}
 
-  // send env state msg to python
-  zmq::message_t request(envStateMsg.ByteSizeLong());;
-  envStateMsg.SerializeToArray(request.data(), envStateMsg.ByteSizeLong());
-  m_zmq_socket.send (request, zmq::send_flags::none);
+void
+OpenGymInterface::NotifyBatchState (Ptr<OpenGymEnv> entity)
+{
+  NS_LOG_FUNCTION (this << entity);
+
+  if (!m_initSimMsgSent) {
+    Init();
+  }
+
+  if (m_stopEnvRequested) {
+    return;
+  }
+
+  std::vector<Ptr<OpenGymEnv> >::iterator it = std::find (m_envs.begin (), m_envs.end (), entity);
+  NS_ABORT_MSG_IF (it == m_envs.end (), "Environment is not in the batch, see AddEnv");
+  uint32_t index = it - m_envs.begin ();
+  NS_ABORT_MSG_IF (m_batchPending[index],
+                   "Environment " << index << " notified twice in the same batch");
+
+  m_batchStates[index] = GetEnvStateMsg ();
+  m_batchPending[index] = true;
+  m_batchCount++;
+  if (m_batchCount == m_numEnvs) {
+    SendBatchState ();
+  }
+}
+
+void
+OpenGymInterface::SendBatchState (void)
+{
+  NS_LOG_FUNCTION (this);
+  ns3opengym::EnvStateBatchMsg envStateBatchMsg;
+  for (uint32_t i = 0; i < m_batchStates.size (); i++) {
+    envStateBatchMsg.add_states()->CopyFrom(m_batchStates[i]);
+  }
+  m_batchCount = 0;
+  std::fill (m_batchPending.begin (), m_batchPending.end (), false);
+
+  // send env states msg to python
+  m_transport->Send (envStateBatchMsg);
 
   // receive act msg form python
-  ns3opengym::EnvActMsg envActMsg;
-  zmq::message_t reply;
-  (void) m_zmq_socket.recv (reply, zmq::recv_flags::none);
-  envActMsg.ParseFromArray(reply.data(), reply.size());
+  ns3opengym::EnvActBatchMsg envActBatchMsg;
+  m_transport->Recv (envActBatchMsg);
 
   if (m_simEnd) {
     // if sim end only rx ms and quit
     return;
   }
 
-  bool stopSim = envActMsg.stopsimreq();
+  bool stopSim = envActBatchMsg.stopsimreq();
   if (stopSim) {
     NS_LOG_DEBUG("---Stop requested: " << stopSim);
     m_stopEnvRequested = true;
@@ -278,11 +406,13 @@ OpenGymInterface::NotifyCurrentState()
     std::exit(0);
   }
 
-  // first step after reset is called without actions, just to get current state
-  ns3opengym::DataContainer actDataContainerPbMsg = envActMsg.actdata();
-  Ptr<OpenGymDataContainer> actDataContainer = OpenGymDataContainer::CreateFromDataContainerPbMsg(actDataContainerPbMsg);
-  ExecuteActions(actDataContainer);
-
+  NS_ABORT_MSG_IF (envActBatchMsg.acts_size() != (int) m_numEnvs,
+                   "Expected " << m_numEnvs << " actions, got " << envActBatchMsg.acts_size());
+  for (uint32_t i = 0; i < m_numEnvs; i++) {
+    ns3opengym::DataContainer actDataContainerPbMsg = envActBatchMsg.acts(i).actdata();
+    Ptr<OpenGymDataContainer> actDataContainer = OpenGymDataContainer::CreateFromDataContainerPbMsg(actDataContainerPbMsg);
+    m_envs[i]->ExecuteActions(actDataContainer);
+  }
 }
 
 void
@@ -298,7 +428,14 @@ OpenGymInterface::NotifySimulationEnd()
 {
   NS_LOG_FUNCTION (this);
   m_simEnd = true;
-  if (m_initSimMsgSent) {
+  if (m_initSimMsgSent && m_numEnvs > 1) {
+    // report the final state of every environment
+    for (uint32_t i = 0; i < m_envs.size (); i++) {
+      SetEnvCallbacks (m_envs[i]);
+      m_batchStates[i] = GetEnvStateMsg ();
+    }
+    SendBatchState ();
+  } else if (m_initSimMsgSent) {
     WaitForStop();
   }
 }
@@ -388,18 +525,68 @@ OpenGymInterface::ExecuteActions(Ptr<OpenGymDataContainer> action)
 }
 
 void
-OpenGymInterface::Notify(Ptr<OpenGymEnv> entity)
+OpenGymInterface::SetEnvCallbacks (Ptr<OpenGymEnv> entity)
 {
-  NS_LOG_FUNCTION (this);
-
+  NS_LOG_FUNCTION (this << entity);
   SetGetGameOverCb( MakeCallback (&OpenGymEnv::GetGameOver, entity) );
   SetGetObservationCb( MakeCallback (&OpenGymEnv::GetObservation, entity) );
   SetGetRewardCb( MakeCallback (&OpenGymEnv::GetReward, entity) );
   SetGetExtraInfoCb( MakeCallback (&OpenGymEnv::GetExtraInfo, entity) );
   SetExecuteActionsCb( MakeCallback (&OpenGymEnv::ExecuteActions, entity) );
+}
+
+void
+OpenGymInterface::Notify(Ptr<OpenGymEnv> entity)
+{
+  NS_LOG_FUNCTION (this);
+
+  SetEnvCallbacks (entity);
 
+  if (m_numEnvs > 1) {
+    NotifyBatchState (entity);
+    return;
+  }
   NotifyCurrentState();
 }
 
+void
+OpenGymInterface::SetNumEnvs (uint32_t numEnvs)
+{
+  NS_LOG_FUNCTION (this << numEnvs);
+  NS_ABORT_MSG_IF (m_initSimMsgSent, "Number of environments must be set before the first step");
+  NS_ABORT_MSG_IF (numEnvs == 0, "At least one environment is needed");
+  m_numEnvs = numEnvs;
+  m_batchStates.resize (numEnvs);
+  m_batchPending.assign (numEnvs, false);
+  m_batchCount = 0;
+}
+
+uint32_t
+OpenGymInterface::GetNumEnvs (void) const
+{
+  return m_numEnvs;
+}
+
+void
+OpenGymInterface::AddEnv (Ptr<OpenGymEnv> entity)
+{
+  NS_LOG_FUNCTION (this << entity);
+  if (std::find (m_envs.begin (), m_envs.end (), entity) == m_envs.end ()) {
+    NS_ABORT_MSG_IF (m_envs.size () >= m_numEnvs, "More environments than set with SetNumEnvs");
+    m_envs.push_back (entity);
+  }
+}
+
+int64_t
+OpenGymInterface::AssignStreams (int64_t stream)
+{
+  NS_LOG_FUNCTION (this << stream);
+  int64_t currentStream = stream;
+  for (uint32_t i = 0; i < m_envs.size (); i++) {
+    currentStream += m_envs[i]->AssignStreams (currentStream);
+  }
+  return (currentStream - stream);
+}
+
 }
 
@@ -23,7 +23,9 @@
 #define OPENGYM_INTERFACE_H
 
 #include "ns3/object.h"
-#include <zmq.hpp>
+#include "opengym_transport.h"
+#include "messages.pb.h"
+#include <vector>
 
 namespace ns3 {
 
@@ -34,6 +36,16 @@ class OpenGymEnv;
 class OpenGymInterface : public Object
 {
 public:
+  /**
+   * Channel to the Python agent, the message schema is the same for all.
+   */
+  enum Transport
+  {
+    TCP, //!< ZMQ over tcp://localhost:port
+    IPC, //!< ZMQ over a unix domain socket
+    SHM  //!< futex-synchronized mailbox in POSIX shared memory
+  };
+
   static Ptr<OpenGymInterface> Get (uint32_t port=5555);
 
   OpenGymInterface (uint32_t port=5555);
@@ -65,6 +77,31 @@ public:
 
   void Notify(Ptr<OpenGymEnv> entity);
 
+  /**
+   * Sets the number of environments stepped together (1 by default).
+   * With more than one environment, Notify only stores the state of the
+   * calling environment. When all environments of the batch have notified,
+   * their states are sent to the agent in one EnvStateBatchMsg, and the
+   * actions of the EnvActBatchMsg reply are executed by each environment.
+   */
+  void SetNumEnvs (uint32_t numEnvs);
+  uint32_t GetNumEnvs (void) const;
+
+  /**
+   * Adds an environment to the batch, its index is the order of addition.
+   * Called by OpenGymEnv::SetOpenGymInterface in batched mode.
+   */
+  void AddEnv (Ptr<OpenGymEnv> entity);
+
+  /**
+   * Assigns consecutive random variable streams to the environments of
+   * the batch, in batch order, see OpenGymEnv::AssignStreams.
+   *
+   * \param stream first stream index to use
+   * \return the number of stream indices assigned
+   */
+  int64_t AssignStreams (int64_t stream);
+
 protected:
   // Inherited
   virtual void DoInitialize (void);
@@ -74,14 +111,27 @@ private:
   static Ptr<OpenGymInterface> *DoGet (uint32_t port=5555);
   static void Delete (void);
 
+  Ptr<OpenGymTransport> CreateTransport () const;
+  void SetEnvCallbacks (Ptr<OpenGymEnv> entity);
+  ns3opengym::EnvStateMsg GetEnvStateMsg (void);
+  void NotifyBatchState (Ptr<OpenGymEnv> entity);
+  void SendBatchState (void);
+
   uint32_t m_port;
-  zmq::context_t m_zmq_context;
-  zmq::socket_t m_zmq_socket;
+  Transport m_transportType;
+  std::string m_address;
+  Ptr<OpenGymTransport> m_transport;
 
   bool m_simEnd;
   bool m_stopEnvRequested;
   bool m_initSimMsgSent;
 
+  uint32_t m_numEnvs;
+  std::vector<Ptr<OpenGymEnv> > m_envs;
+  std::vector<ns3opengym::EnvStateMsg> m_batchStates;
+  std::vector<bool> m_batchPending;
+  uint32_t m_batchCount;
+
   Callback< Ptr<OpenGymSpace> > m_actionSpaceCb;
   Callback< Ptr<OpenGymSpace> > m_observationSpaceCb;
   Callback< bool > m_gameOverCb;
@@ -0,0 +1,173 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "ns3/abort.h"
+#include "ns3/log.h"
+#include "opengym_transport.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("OpenGymTransport");
+
+// not FUTEX_PRIVATE_FLAG, the word is shared with the agent process
+static void
+FutexWait (volatile uint32_t *addr, uint32_t val)
+{
+  syscall (SYS_futex, const_cast<uint32_t *> (addr), FUTEX_WAIT, val, nullptr, nullptr, 0);
+}
+
+static void
+FutexWake (volatile uint32_t *addr)
+{
+  syscall (SYS_futex, const_cast<uint32_t *> (addr), FUTEX_WAKE, 1, nullptr, nullptr, 0);
+}
+
+OpenGymTransport::~OpenGymTransport ()
+{
+}
+
+OpenGymZmqTransport::OpenGymZmqTransport (std::string address):
+  m_address(address), m_zmq_context(1), m_zmq_socket(m_zmq_context, ZMQ_REQ)
+{
+  NS_LOG_FUNCTION (this << address);
+}
+
+OpenGymZmqTransport::~OpenGymZmqTransport ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+OpenGymZmqTransport::Connect ()
+{
+  NS_LOG_FUNCTION (this);
+  zmq_connect ((void*)m_zmq_socket, m_address.c_str());
+}
+
+void
+OpenGymZmqTransport::Send (const google::protobuf::Message &msg)
+{
+  zmq::message_t request(msg.ByteSizeLong());
+  msg.SerializeToArray(request.data(), msg.ByteSizeLong());
+  m_zmq_socket.send (request, zmq::send_flags::none);
+}
+
+void
+OpenGymZmqTransport::Recv (google::protobuf::Message &msg)
+{
+  zmq::message_t reply;
+  (void) m_zmq_socket.recv (reply, zmq::recv_flags::none);
+  msg.ParseFromArray(reply.data(), reply.size());
+}
+
+std::string
+OpenGymZmqTransport::GetAddress () const
+{
+  return m_address;
+}
+
+OpenGymShmTransport::OpenGymShmTransport (std::string name):
+  m_name(name), m_base(nullptr), m_size(0), m_header(nullptr),
+  m_reqBuffer(nullptr), m_repBuffer(nullptr), m_seq(0)
+{
+  NS_LOG_FUNCTION (this << name);
+}
+
+OpenGymShmTransport::~OpenGymShmTransport ()
+{
+  NS_LOG_FUNCTION (this);
+  if (m_base) {
+    munmap (m_base, m_size);
+  }
+}
+
+void
+OpenGymShmTransport::Connect ()
+{
+  NS_LOG_FUNCTION (this);
+  // the agent creates the object, it may not be there yet
+  int fd = -1;
+  struct stat st;
+  while (true) {
+    fd = shm_open (m_name.c_str(), O_RDWR, 0);
+    if (fd >= 0 && fstat (fd, &st) == 0 && (size_t) st.st_size > DATA_OFFSET) {
+      break;
+    }
+    if (fd >= 0) {
+      close (fd);
+    }
+    usleep (10000);
+  }
+  m_size = st.st_size;
+  void *addr = mmap (nullptr, m_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close (fd);
+  NS_ABORT_MSG_IF (addr == MAP_FAILED, "Cannot map shared memory object " << m_name);
+  m_base = static_cast<uint8_t *> (addr);
+  m_header = reinterpret_cast<Header *> (m_base);
+
+  // capacity is written last by the agent
+  while (__atomic_load_n (&m_header->capacity, __ATOMIC_ACQUIRE) == 0) {
+    usleep (1000);
+  }
+  NS_ABORT_MSG_IF (DATA_OFFSET + 2 * (size_t) m_header->capacity > m_size,
+                   "Shared memory object " << m_name << " is too small");
+  m_reqBuffer = m_base + DATA_OFFSET;
+  m_repBuffer = m_reqBuffer + m_header->capacity;
+  m_seq = m_header->reqSeq;
+}
+
+void
+OpenGymShmTransport::Send (const google::protobuf::Message &msg)
+{
+  size_t size = msg.ByteSizeLong();
+  NS_ABORT_MSG_IF (size > m_header->capacity,
+                   "Message of " << size << " bytes does not fit into shared memory");
+  msg.SerializeToArray(m_reqBuffer, size);
+  m_header->reqSize = size;
+  __atomic_store_n (&m_header->reqSeq, ++m_seq, __ATOMIC_RELEASE);
+  // the agent cannot tell us cheaply whether it sleeps, always wake it
+  FutexWake (&m_header->reqSeq);
+}
+
+void
+OpenGymShmTransport::Recv (google::protobuf::Message &msg)
+{
+  // spin shortly, as the agent usually replies fast, then sleep until
+  // it publishes the reply. The futex returns at once if repSeq changed.
+  uint32_t spins = 0;
+  uint32_t seq;
+  while ((seq = __atomic_load_n (&m_header->repSeq, __ATOMIC_ACQUIRE)) != m_seq) {
+    if (++spins > SPIN_COUNT) {
+      FutexWait (&m_header->repSeq, seq);
+    }
+  }
+  msg.ParseFromArray(m_repBuffer, m_header->repSize);
+}
+
+std::string
+OpenGymShmTransport::GetAddress () const
+{
+  return "shm://" + m_name;
+}
+
+}
+
@@ -0,0 +1,111 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef OPENGYM_TRANSPORT_H
+#define OPENGYM_TRANSPORT_H
+
+#include "ns3/simple-ref-count.h"
+#include <google/protobuf/message.h>
+#include <zmq.hpp>
+#include <string>
+
+namespace ns3 {
+
+/**
+ * Request/reply channel between the simulation and the Python agent.
+ * The simulation sends a request and then waits for the reply, exactly
+ * like a ZMQ_REQ socket. Messages are protobuf messages of messages.proto.
+ */
+class OpenGymTransport : public SimpleRefCount<OpenGymTransport>
+{
+public:
+  virtual ~OpenGymTransport ();
+
+  virtual void Connect () = 0;
+  virtual void Send (const google::protobuf::Message &msg) = 0;
+  virtual void Recv (google::protobuf::Message &msg) = 0;
+  virtual std::string GetAddress () const = 0;
+};
+
+/**
+ * ZMQ_REQ socket connected to a tcp:// or ipc:// address.
+ */
+class OpenGymZmqTransport : public OpenGymTransport
+{
+public:
+  OpenGymZmqTransport (std::string address);
+  virtual ~OpenGymZmqTransport ();
+
+  virtual void Connect ();
+  virtual void Send (const google::protobuf::Message &msg);
+  virtual void Recv (google::protobuf::Message &msg);
+  virtual std::string GetAddress () const;
+
+private:
+  std::string m_address;
+  zmq::context_t m_zmq_context;
+  zmq::socket_t m_zmq_socket;
+};
+
+/**
+ * Mailbox in a POSIX shared memory object created by the Python agent.
+ * Each side writes its message into its own buffer and then publishes it
+ * by increasing its sequence number and waking the other side. A side
+ * waiting for a message spins shortly, then sleeps on a futex on the
+ * sequence number of the other side.
+ */
+class OpenGymShmTransport : public OpenGymTransport
+{
+public:
+  /**
+   * Layout of the start of the shared memory object, the request and
+   * reply buffers of capacity bytes each follow at DATA_OFFSET.
+   * Must match ns3gym/shm_bridge.py.
+   */
+  struct Header
+  {
+    volatile uint32_t reqSeq;
+    volatile uint32_t repSeq;
+    uint32_t reqSize;
+    uint32_t repSize;
+    uint32_t capacity;
+  };
+  static const uint32_t DATA_OFFSET = 64;
+  /// tries before sleeping on the futex, a fast agent replies within them
+  static const uint32_t SPIN_COUNT = 100;
+
+  OpenGymShmTransport (std::string name);
+  virtual ~OpenGymShmTransport ();
+
+  virtual void Connect ();
+  virtual void Send (const google::protobuf::Message &msg);
+  virtual void Recv (google::protobuf::Message &msg);
+  virtual std::string GetAddress () const;
+
+private:
+  std::string m_name;
+  uint8_t *m_base;
+  size_t m_size;
+  Header *m_header;
+  uint8_t *m_reqBuffer;
+  uint8_t *m_repBuffer;
+  uint32_t m_seq;
+};
+
+} // end of namespace ns3
+
+#endif /* OPENGYM_TRANSPORT_H */
+
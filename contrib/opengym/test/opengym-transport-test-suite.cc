@@ -0,0 +1,547 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ns3/abort.h"
+#include "ns3/container.h"
+#include "ns3/enum.h"
+#include "ns3/opengym_env.h"
+#include "ns3/opengym_interface.h"
+#include "ns3/opengym_transport.h"
+#include "ns3/simulator.h"
+#include "ns3/spaces.h"
+#include "ns3/string.h"
+#include "ns3/test.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup opengym
+ * \return the name of a shared memory object used only by this process
+ */
+static std::string
+GetTestShmName (void)
+{
+  return "/opengym-transport-test-" + std::to_string (getpid ());
+}
+
+/**
+ * \ingroup opengym
+ *
+ * \brief Agent side of the shared memory transport, as in
+ * ns3gym/shm_bridge.py: it creates the object, and waits for each request
+ * on a futex.
+ */
+class OpenGymTestShmAgent
+{
+public:
+  /**
+   * Creates the shared memory object
+   *
+   * \param name the name of the object
+   * \param capacity the size of each message buffer
+   */
+  OpenGymTestShmAgent (std::string name, uint32_t capacity);
+  ~OpenGymTestShmAgent ();
+
+  /**
+   * Waits for the next request
+   *
+   * \param msg the request
+   */
+  void Recv (google::protobuf::Message &msg);
+
+  /**
+   * Publishes the reply to the last request
+   *
+   * \param msg the reply
+   */
+  void Send (const google::protobuf::Message &msg);
+
+private:
+  typedef OpenGymShmTransport::Header Header; //!< header of the object
+
+  std::string m_name;  //!< the name of the object
+  size_t m_size;       //!< the size of the object
+  uint8_t *m_base;     //!< the mapping of the object
+  Header *m_header;    //!< the header of the object
+  uint32_t m_seq;      //!< the sequence number of the last request
+};
+
+OpenGymTestShmAgent::OpenGymTestShmAgent (std::string name, uint32_t capacity)
+  : m_name (name),
+    m_size (OpenGymShmTransport::DATA_OFFSET + 2 * (size_t) capacity),
+    m_seq (0)
+{
+  shm_unlink (m_name.c_str ());
+  int fd = shm_open (m_name.c_str (), O_CREAT | O_EXCL | O_RDWR, 0600);
+  NS_ABORT_MSG_IF (fd < 0 || ftruncate (fd, m_size) != 0, "Cannot create " << m_name);
+  void *addr = mmap (nullptr, m_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close (fd);
+  NS_ABORT_MSG_IF (addr == MAP_FAILED, "Cannot map " << m_name);
+  m_base = static_cast<uint8_t *> (addr);
+  m_header = reinterpret_cast<Header *> (m_base);
+  // capacity is written last, the simulation waits for it
+  __atomic_store_n (&m_header->capacity, capacity, __ATOMIC_RELEASE);
+}
+
+OpenGymTestShmAgent::~OpenGymTestShmAgent ()
+{
+  munmap (m_base, m_size);
+  shm_unlink (m_name.c_str ());
+}
+
+void
+OpenGymTestShmAgent::Recv (google::protobuf::Message &msg)
+{
+  uint32_t seq;
+  while ((seq = __atomic_load_n (&m_header->reqSeq, __ATOMIC_ACQUIRE)) != m_seq + 1)
+    {
+      syscall (SYS_futex, &m_header->reqSeq, FUTEX_WAIT, seq, nullptr, nullptr, 0);
+    }
+  m_seq++;
+  msg.ParseFromArray (m_base + OpenGymShmTransport::DATA_OFFSET, m_header->reqSize);
+}
+
+void
+OpenGymTestShmAgent::Send (const google::protobuf::Message &msg)
+{
+  uint8_t *repBuffer = m_base + OpenGymShmTransport::DATA_OFFSET + m_header->capacity;
+  msg.SerializeToArray (repBuffer, msg.ByteSizeLong ());
+  m_header->repSize = msg.ByteSizeLong ();
+  __atomic_store_n (&m_header->repSeq, m_seq, __ATOMIC_RELEASE);
+  syscall (SYS_futex, &m_header->repSeq, FUTEX_WAKE, 1, nullptr, nullptr, 0);
+}
+
+/**
+ * \ingroup opengym
+ * \return the cpu time used by this process, in seconds
+ */
+static double
+GetProcessCpuTime (void)
+{
+  struct timespec ts;
+  clock_gettime (CLOCK_PROCESS_CPUTIME_ID, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * \ingroup opengym
+ *
+ * \brief Test case that exchanges messages over the shared memory
+ * transport with an agent run on a thread of this process. The agent
+ * replies to each request with its reward plus one, after the given delay.
+ * With a delay, the simulation side must sleep while it waits for the
+ * reply, so the test checks that the process used much less cpu time than
+ * the time it waited.
+ */
+class OpenGymShmTransportTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor
+   *
+   * \param numMessages the number of requests
+   * \param delayMs the delay of the agent before each reply, in ms
+   */
+  OpenGymShmTransportTestCase (uint32_t numMessages, uint32_t delayMs);
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * Run the agent: reply to each request
+   *
+   * \param agent the agent side of the transport
+   */
+  void RunAgent (OpenGymTestShmAgent *agent);
+
+  uint32_t m_numMessages;   //!< the number of requests
+  uint32_t m_delayMs;       //!< the delay of the agent before each reply, in ms
+  uint32_t m_agentErrors;   //!< wrong requests received by the agent
+};
+
+OpenGymShmTransportTestCase::OpenGymShmTransportTestCase (uint32_t numMessages, uint32_t delayMs)
+  : TestCase (std::to_string (numMessages) + " messages, " + std::to_string (delayMs)
+              + " ms reply delay"),
+    m_numMessages (numMessages),
+    m_delayMs (delayMs),
+    m_agentErrors (0)
+{
+}
+
+void
+OpenGymShmTransportTestCase::RunAgent (OpenGymTestShmAgent *agent)
+{
+  for (uint32_t i = 0; i < m_numMessages; i++)
+    {
+      ns3opengym::EnvStateMsg request;
+      agent->Recv (request);
+      if (request.reward () != i || request.info () != std::string (i * 100, 'x'))
+        {
+          m_agentErrors++;
+        }
+      std::this_thread::sleep_for (std::chrono::milliseconds (m_delayMs));
+      ns3opengym::EnvStateMsg reply;
+      reply.set_reward (request.reward () + 1);
+      reply.set_info (request.info ());
+      agent->Send (reply);
+    }
+}
+
+void
+OpenGymShmTransportTestCase::DoRun (void)
+{
+  OpenGymTestShmAgent agent (GetTestShmName (), 1 << 16);
+  Ptr<OpenGymShmTransport> transport = Create<OpenGymShmTransport> (GetTestShmName ());
+  NS_TEST_ASSERT_MSG_EQ (transport->GetAddress (), "shm://" + GetTestShmName (), "wrong address");
+  std::thread agentThread (&OpenGymShmTransportTestCase::RunAgent, this, &agent);
+  transport->Connect ();
+
+  uint32_t errors = 0;
+  double cpuStart = GetProcessCpuTime ();
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now ();
+  for (uint32_t i = 0; i < m_numMessages; i++)
+    {
+      // messages of different sizes, some larger than a page
+      ns3opengym::EnvStateMsg request;
+      request.set_reward (i);
+      request.set_info (std::string (i * 100, 'x'));
+      transport->Send (request);
+      ns3opengym::EnvStateMsg reply;
+      transport->Recv (reply);
+      if (reply.reward () != i + 1 || reply.info () != request.info ())
+        {
+          errors++;
+        }
+    }
+  double cpu = GetProcessCpuTime () - cpuStart;
+  double wall = std::chrono::duration<double> (std::chrono::steady_clock::now () - start).count ();
+  agentThread.join ();
+
+  NS_TEST_ASSERT_MSG_EQ (m_agentErrors, 0, "agent received wrong requests");
+  NS_TEST_ASSERT_MSG_EQ (errors, 0, "simulation received wrong replies");
+  if (m_delayMs > 0)
+    {
+      NS_TEST_EXPECT_MSG_GT_OR_EQ (wall, m_numMessages * m_delayMs * 1e-3, "replies not delayed");
+      NS_TEST_EXPECT_MSG_LT (cpu, wall / 4, "simulation side busy-polled for the replies");
+    }
+}
+
+/**
+ * \ingroup opengym
+ *
+ * \brief Environment of the interface test. Its observation is 100 times
+ * its index plus the number of steps, and it records the discrete actions
+ * it executes.
+ */
+class OpenGymTestEnv : public OpenGymEnv
+{
+public:
+  /**
+   * Constructor
+   *
+   * \param index the index of the environment in the batch
+   */
+  OpenGymTestEnv (uint32_t index);
+
+  virtual Ptr<OpenGymSpace> GetActionSpace ();
+  virtual Ptr<OpenGymSpace> GetObservationSpace ();
+  virtual bool GetGameOver ();
+  virtual Ptr<OpenGymDataContainer> GetObservation ();
+  virtual float GetReward ();
+  virtual std::string GetExtraInfo ();
+  virtual bool ExecuteActions (Ptr<OpenGymDataContainer> action);
+
+  /// Counts a step and notifies the interface
+  void Step (void);
+
+  uint32_t m_index;                 //!< the index of the environment
+  uint32_t m_step;                  //!< the number of steps
+  std::vector<uint32_t> m_actions;  //!< the actions executed
+};
+
+OpenGymTestEnv::OpenGymTestEnv (uint32_t index)
+  : m_index (index),
+    m_step (0)
+{
+}
+
+Ptr<OpenGymSpace>
+OpenGymTestEnv::GetActionSpace ()
+{
+  return CreateObject<OpenGymDiscreteSpace> (1000);
+}
+
+Ptr<OpenGymSpace>
+OpenGymTestEnv::GetObservationSpace ()
+{
+  return CreateObject<OpenGymBoxSpace> (0, 1000, std::vector<uint32_t> (1, 1), "uint32_t");
+}
+
+bool
+OpenGymTestEnv::GetGameOver ()
+{
+  return false;
+}
+
+Ptr<OpenGymDataContainer>
+OpenGymTestEnv::GetObservation ()
+{
+  Ptr<OpenGymBoxContainer<uint32_t> > box =
+    CreateObject<OpenGymBoxContainer<uint32_t> > (std::vector<uint32_t> (1, 1));
+  box->AddValue (100 * m_index + m_step);
+  return box;
+}
+
+float
+OpenGymTestEnv::GetReward ()
+{
+  return m_index;
+}
+
+std::string
+OpenGymTestEnv::GetExtraInfo ()
+{
+  return "env " + std::to_string (m_index);
+}
+
+bool
+OpenGymTestEnv::ExecuteActions (Ptr<OpenGymDataContainer> action)
+{
+  Ptr<OpenGymDiscreteContainer> discrete = DynamicCast<OpenGymDiscreteContainer> (action);
+  m_actions.push_back (discrete ? discrete->GetValue () : 0);
+  return true;
+}
+
+void
+OpenGymTestEnv::Step (void)
+{
+  m_step++;
+  Notify ();
+}
+
+/**
+ * \ingroup opengym
+ *
+ * \brief Test case that steps environments through OpenGymInterface over
+ * the shared memory transport, in batched mode with more than one
+ * environment, with an agent run on a thread of this process. The agent
+ * checks the states and replies with the action 10 times the index of
+ * the environment plus the step, until the simulation ends.
+ */
+class OpenGymInterfaceShmTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor
+   *
+   * \param numEnvs the number of environments
+   * \param numSteps the number of steps of each environment
+   */
+  OpenGymInterfaceShmTestCase (uint32_t numEnvs, uint32_t numSteps);
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * Check a state received by the agent
+   *
+   * \param state the state
+   * \param index the index of the environment
+   * \param step the step of the environment
+   */
+  void CheckState (const ns3opengym::EnvStateMsg &state, uint32_t index, uint32_t step);
+
+  /**
+   * Run the agent: check the states and reply until the simulation ends
+   *
+   * \param agent the agent side of the transport
+   */
+  void RunAgent (OpenGymTestShmAgent *agent);
+
+  uint32_t m_numEnvs;       //!< the number of environments
+  uint32_t m_numSteps;      //!< the number of steps of each environment
+  uint32_t m_agentErrors;   //!< wrong messages received by the agent
+  uint32_t m_agentSteps;    //!< states received by the agent
+  uint32_t m_agentNumEnvs;  //!< number of environments in the init message
+};
+
+OpenGymInterfaceShmTestCase::OpenGymInterfaceShmTestCase (uint32_t numEnvs, uint32_t numSteps)
+  : TestCase ("interface over shm, " + std::to_string (numEnvs) + " environments, "
+              + std::to_string (numSteps) + " steps"),
+    m_numEnvs (numEnvs),
+    m_numSteps (numSteps),
+    m_agentErrors (0),
+    m_agentSteps (0),
+    m_agentNumEnvs (0)
+{
+}
+
+void
+OpenGymInterfaceShmTestCase::CheckState (const ns3opengym::EnvStateMsg &state, uint32_t index,
+                                         uint32_t step)
+{
+  ns3opengym::DataContainer obsDataContainerPbMsg = state.obsdata ();
+  Ptr<OpenGymBoxContainer<uint32_t> > obs = DynamicCast<OpenGymBoxContainer<uint32_t> > (
+    OpenGymDataContainer::CreateFromDataContainerPbMsg (obsDataContainerPbMsg));
+  if (!obs || obs->GetValue (0) != 100 * index + step || state.reward () != index
+      || state.info () != "env " + std::to_string (index))
+    {
+      m_agentErrors++;
+    }
+}
+
+void
+OpenGymInterfaceShmTestCase::RunAgent (OpenGymTestShmAgent *agent)
+{
+  ns3opengym::SimInitMsg simInitMsg;
+  agent->Recv (simInitMsg);
+  m_agentNumEnvs = std::max<uint32_t> (1, simInitMsg.numenvs ());
+  ns3opengym::SimInitAck simInitAck;
+  simInitAck.set_done (true);
+  simInitAck.set_stopsimreq (false);
+  agent->Send (simInitAck);
+
+  bool simEnd = false;
+  while (!simEnd)
+    {
+      uint32_t step = ++m_agentSteps;
+      uint32_t expectedStep = std::min (step, m_numSteps);
+      std::vector<ns3opengym::EnvStateMsg> states;
+      if (m_agentNumEnvs > 1)
+        {
+          ns3opengym::EnvStateBatchMsg envStateBatchMsg;
+          agent->Recv (envStateBatchMsg);
+          states.assign (envStateBatchMsg.states ().begin (), envStateBatchMsg.states ().end ());
+        }
+      else
+        {
+          states.resize (1);
+          agent->Recv (states[0]);
+        }
+      if (states.size () != m_numEnvs)
+        {
+          m_agentErrors++;
+        }
+      simEnd = true;
+      std::vector<ns3opengym::EnvActMsg> acts (states.size ());
+      for (uint32_t i = 0; i < states.size (); i++)
+        {
+          CheckState (states[i], i, expectedStep);
+          simEnd = simEnd && states[i].isgameover ();
+          Ptr<OpenGymDiscreteContainer> act = CreateObject<OpenGymDiscreteContainer> (1000);
+          act->SetValue (10 * i + step);
+          acts[i].mutable_actdata ()->CopyFrom (act->GetDataContainerPbMsg ());
+          acts[i].set_stopsimreq (simEnd);
+        }
+      if (m_agentNumEnvs > 1)
+        {
+          ns3opengym::EnvActBatchMsg envActBatchMsg;
+          for (uint32_t i = 0; i < acts.size (); i++)
+            {
+              envActBatchMsg.add_acts ()->CopyFrom (acts[i]);
+            }
+          envActBatchMsg.set_stopsimreq (simEnd);
+          agent->Send (envActBatchMsg);
+        }
+      else
+        {
+          agent->Send (acts[0]);
+        }
+    }
+}
+
+void
+OpenGymInterfaceShmTestCase::DoRun (void)
+{
+  OpenGymTestShmAgent agent (GetTestShmName (), 1 << 16);
+  Ptr<OpenGymInterface> openGymInterface = CreateObject<OpenGymInterface> ();
+  openGymInterface->SetAttribute ("Transport", EnumValue<OpenGymInterface::Transport> (OpenGymInterface::SHM));
+  openGymInterface->SetAttribute ("Address", StringValue (GetTestShmName ()));
+  openGymInterface->SetNumEnvs (m_numEnvs);
+  std::vector<Ptr<OpenGymTestEnv> > envs;
+  for (uint32_t i = 0; i < m_numEnvs; i++)
+    {
+      envs.push_back (CreateObject<OpenGymTestEnv> (i));
+      envs[i]->SetOpenGymInterface (openGymInterface);
+      for (uint32_t s = 1; s <= m_numSteps; s++)
+        {
+          Simulator::Schedule (Seconds (s), &OpenGymTestEnv::Step, envs[i]);
+        }
+    }
+
+  std::thread agentThread (&OpenGymInterfaceShmTestCase::RunAgent, this, &agent);
+  Simulator::Run ();
+  openGymInterface->NotifySimulationEnd ();
+  agentThread.join ();
+  Simulator::Destroy ();
+
+  NS_TEST_ASSERT_MSG_EQ (m_agentErrors, 0, "agent received wrong states");
+  NS_TEST_ASSERT_MSG_EQ (m_agentNumEnvs, m_numEnvs, "wrong number of environments in init message");
+  NS_TEST_ASSERT_MSG_EQ (m_agentSteps, m_numSteps + 1, "wrong number of states");
+  for (uint32_t i = 0; i < m_numEnvs; i++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (envs[i]->m_actions.size (), m_numSteps,
+                             "wrong number of actions executed by environment " << i);
+      for (uint32_t s = 0; s < m_numSteps; s++)
+        {
+          NS_TEST_EXPECT_MSG_EQ (envs[i]->m_actions[s], 10 * i + s + 1,
+                                 "wrong action executed by environment " << i);
+        }
+    }
+
+  openGymInterface->Dispose ();
+  for (uint32_t i = 0; i < m_numEnvs; i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ (envs[i]->GetReferenceCount (), 1,
+                             "environment not released by the disposed interface");
+      envs[i]->Dispose ();
+    }
+}
+
+/**
+ * \ingroup opengym
+ *
+ * \brief Test suite of the transports of opengym
+ */
+class OpenGymTransportTestSuite : public TestSuite
+{
+public:
+  OpenGymTransportTestSuite ();
+};
+
+OpenGymTransportTestSuite::OpenGymTransportTestSuite ()
+  : TestSuite ("opengym-transport", Type::UNIT)
+{
+  AddTestCase (new OpenGymShmTransportTestCase (200, 0), TestCase::Duration::QUICK);
+  AddTestCase (new OpenGymShmTransportTestCase (10, 10), TestCase::Duration::QUICK);
+  AddTestCase (new OpenGymInterfaceShmTestCase (1, 4), TestCase::Duration::QUICK);
+  AddTestCase (new OpenGymInterfaceShmTestCase (3, 4), TestCase::Duration::QUICK);
+}
+
+/// Static variable for test initialization
+static OpenGymTransportTestSuite g_openGymTransportTestSuite;
@@ -80,9 +80,12 @@ class BuildingListPriv : public Object
 
     /**
      * Get the Singleton instance of BuildingListPriv (or create one)
+     *
+     * The instance is returned by reference, so that reading the list does not
+     * update its reference count.
      * \return the BuildingListPriv instance
      */
-    static Ptr<BuildingListPriv> Get();
+    static const Ptr<BuildingListPriv>& Get();
 
   private:
     void DoDispose() override;
@@ -118,7 +121,7 @@ BuildingListPriv::GetTypeId()
     return tid;
 }
 
-Ptr<BuildingListPriv>
+const Ptr<BuildingListPriv>&
 BuildingListPriv::Get()
 {
     return *DoGet();
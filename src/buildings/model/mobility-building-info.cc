@@ -156,7 +156,7 @@ MobilityBuildingInfo::GetRoomNumberY()
     return m_roomY;
 }
 
-Ptr<Building>
+const Ptr<Building>&
 MobilityBuildingInfo::GetBuilding()
 {
     NS_LOG_FUNCTION(this);
@@ -124,9 +124,12 @@ class MobilityBuildingInfo : public Object
     /**
      * \brief Get the building in which the MobilityBuildingInfo instance is located
      *
+     * The building is returned by reference, so that reading it does not update
+     * its reference count.
+     *
      * \return The building in which the MobilityBuildingInfo instance is located
      */
-    Ptr<Building> GetBuilding();
+    const Ptr<Building>& GetBuilding();
     /**
      * \brief Make the given mobility model consistent, by determining whether
      * its position falls inside any of the building in BuildingList, and
@@ -100,6 +100,10 @@ DefaultSimulatorImpl::Destroy()
             ev->Invoke();
         }
     }
+
+    auto stats = EventImpl::GetPoolStats();
+    NS_LOG_INFO("event pool: hits " << stats.hits << ", misses " << stats.misses << ", live "
+                                    << stats.live << ", peak live " << stats.peakLive);
 }
 
 void
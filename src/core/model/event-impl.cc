@@ -21,6 +21,11 @@
 
 #include "log.h"
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
 /**
  * \file
  * \ingroup events
@@ -32,6 +37,129 @@ namespace ns3
 
 NS_LOG_COMPONENT_DEFINE("EventImpl");
 
+namespace
+{
+
+/** Size class granularity of the event pool, in bytes. */
+constexpr std::size_t POOL_GRANULE = 16;
+/** Number of size classes, larger events bypass the pool. */
+constexpr std::size_t POOL_CLASSES = 16;
+/** Maximum number of bytes kept in the free list of one size class. */
+constexpr std::size_t POOL_CLASS_BYTES = 1 << 20;
+
+/**
+ * Event pool counters of one thread.
+ *
+ * Only the owning thread writes them; they are atomic so that
+ * EventImpl::GetPoolStats() can read them from any thread.
+ */
+struct PoolCounters
+{
+    std::atomic<uint64_t> hits{0};     //!< Allocations served from the free lists.
+    std::atomic<uint64_t> misses{0};   //!< Allocations from the system allocator.
+    std::atomic<uint64_t> allocs{0};   //!< Events allocated by this thread.
+    std::atomic<uint64_t> frees{0};    //!< Events released by this thread.
+    std::atomic<uint64_t> peakLive{0}; //!< Peak of allocs - frees.
+};
+
+/**
+ * Increment a counter only written by the calling thread.
+ *
+ * \param [in] counter The counter.
+ * \returns The new value.
+ */
+inline uint64_t
+Increment(std::atomic<uint64_t>& counter)
+{
+    uint64_t value = counter.load(std::memory_order_relaxed) + 1;
+    counter.store(value, std::memory_order_relaxed);
+    return value;
+}
+
+/**
+ * Counters of every thread which used the pool.
+ *
+ * Never destroyed, so that events released during static destruction
+ * can still be counted.
+ *
+ * \param [out] lock The mutex protecting the list.
+ * \returns The list of counters.
+ */
+std::vector<PoolCounters*>&
+GetPoolCountersList(std::mutex*& lock)
+{
+    static auto mutex = new std::mutex;
+    static auto list = new std::vector<PoolCounters*>;
+    lock = mutex;
+    return *list;
+}
+
+/** A block in a free list. */
+struct FreeBlock
+{
+    FreeBlock* next; //!< The next block.
+};
+
+/**
+ * Free lists of one thread.
+ *
+ * Trivially destructible, so it stays usable after PoolCacheGuard
+ * released the blocks at thread exit.
+ */
+struct PoolCache
+{
+    FreeBlock* heads[POOL_CLASSES];  //!< Free list of each size class.
+    std::size_t count[POOL_CLASSES]; //!< Number of blocks in each free list.
+    PoolCounters* counters;          //!< The counters of this thread.
+    bool destroyed;                  //!< Whether the thread is exiting.
+};
+
+/** The free lists of this thread. */
+thread_local PoolCache g_poolCache{};
+
+/** Releases the free lists of this thread at thread exit. */
+struct PoolCacheGuard
+{
+    ~PoolCacheGuard()
+    {
+        g_poolCache.destroyed = true;
+        for (std::size_t cls = 0; cls < POOL_CLASSES; cls++)
+        {
+            while (g_poolCache.heads[cls] != nullptr)
+            {
+                FreeBlock* block = g_poolCache.heads[cls];
+                g_poolCache.heads[cls] = block->next;
+                ::operator delete(block);
+            }
+            g_poolCache.count[cls] = 0;
+        }
+    }
+};
+
+/**
+ * Get the free lists of this thread, registering its counters on first use.
+ *
+ * \returns The free lists.
+ */
+inline PoolCache&
+GetPoolCache()
+{
+    PoolCache& cache = g_poolCache;
+    if (cache.counters == nullptr)
+    {
+        static thread_local PoolCacheGuard guard;
+        (void)guard;
+        cache.counters = new PoolCounters;
+        std::mutex* lock;
+        auto& list = GetPoolCountersList(lock);
+        std::lock_guard<std::mutex> guardList(*lock);
+        list.push_back(cache.counters);
+    }
+    return cache;
+}
+
+} // unnamed namespace
+
 EventImpl::~EventImpl()
 {
     NS_LOG_FUNCTION(this);
@@ -67,4 +195,88 @@ EventImpl::IsCancelled()
     return m_cancel;
 }
 
+void*
+EventImpl::operator new(std::size_t size)
+{
+    PoolCache& cache = GetPoolCache();
+    PoolCounters& counters = *cache.counters;
+    std::size_t cls = (size - 1) / POOL_GRANULE;
+    void* p;
+    if (cls < POOL_CLASSES && cache.heads[cls] != nullptr)
+    {
+        FreeBlock* block = cache.heads[cls];
+        cache.heads[cls] = block->next;
+        cache.count[cls]--;
+        p = block;
+        Increment(counters.hits);
+    }
+    else
+    {
+        // allocate the full size class, so the block can be reused by
+        // any event of the same class
+        p = ::operator new(cls < POOL_CLASSES ? (cls + 1) * POOL_GRANULE : size);
+        Increment(counters.misses);
+    }
+    // events released by another thread make this negative
+    auto live = static_cast<int64_t>(Increment(counters.allocs) -
+                                     counters.frees.load(std::memory_order_relaxed));
+    if (live > static_cast<int64_t>(counters.peakLive.load(std::memory_order_relaxed)))
+    {
+        counters.peakLive.store(live, std::memory_order_relaxed);
+    }
+    return p;
+}
+
+void
+EventImpl::operator delete(void* p, std::size_t size)
+{
+    PoolCache& cache = GetPoolCache();
+    Increment(cache.counters->frees);
+    std::size_t cls = (size - 1) / POOL_GRANULE;
+    if (cls < POOL_CLASSES && !cache.destroyed &&
+        cache.count[cls] < POOL_CLASS_BYTES / ((cls + 1) * POOL_GRANULE))
+    {
+        auto block = static_cast<FreeBlock*>(p);
+        block->next = cache.heads[cls];
+        cache.heads[cls] = block;
+        cache.count[cls]++;
+        return;
+    }
+    ::operator delete(p);
+}
+
+void*
+EventImpl::operator new(std::size_t size, std::align_val_t align)
+{
+    return ::operator new(size, align);
+}
+
+void
+EventImpl::operator delete(void* p, std::size_t /* size */, std::align_val_t align)
+{
+    ::operator delete(p, align);
+}
+
+EventImpl::PoolStats
+EventImpl::GetPoolStats()
+{
+    PoolStats stats{0, 0, 0, 0};
+    uint64_t allocs = 0;
+    uint64_t frees = 0;
+    std::mutex* lock;
+    auto& list = GetPoolCountersList(lock);
+    std::lock_guard<std::mutex> guard(*lock);
+    for (const auto counters : list)
+    {
+        stats.hits += counters->hits.load(std::memory_order_relaxed);
+        stats.misses += counters->misses.load(std::memory_order_relaxed);
+        allocs += counters->allocs.load(std::memory_order_relaxed);
+        frees += counters->frees.load(std::memory_order_relaxed);
+        stats.peakLive =
+            std::max(stats.peakLive, counters->peakLive.load(std::memory_order_relaxed));
+    }
+    stats.live = allocs - frees;
+    return stats;
+}
+
 } // namespace ns3
@@ -21,6 +21,8 @@
 
 #include "simple-ref-count.h"
 
+#include <cstddef>
+#include <new>
 #include <stdint.h>
 
 /**
@@ -41,6 +43,14 @@ namespace ns3
  * when it reaches the time associated to this event. Most subclasses
  * are usually created by one of the many Simulator::Schedule
  * methods.
+ *
+ * Events are allocated from a pool of fixed size blocks, one free
+ * list per 16 byte size class up to 256 bytes, so that scheduling and
+ * running an event does not go through the system allocator once the
+ * pool holds enough blocks.  Each thread keeps its own free lists:
+ * an event scheduled by another thread with ScheduleWithContext()
+ * is returned to the free lists of the simulation thread, without
+ * any locking.
  */
 class EventImpl : public SimpleRefCount<EventImpl>
 {
@@ -67,6 +77,56 @@ class EventImpl : public SimpleRefCount<EventImpl>
      */
     bool IsCancelled();
 
+    /**
+     * Allocate an event from the pool.
+     *
+     * \param [in] size The size of the event.
+     * \returns The event memory.
+     */
+    static void* operator new(std::size_t size);
+    /**
+     * Return an event to the pool.
+     *
+     * \param [in] p The event memory.
+     * \param [in] size The size of the event.
+     */
+    static void operator delete(void* p, std::size_t size);
+    /**
+     * Allocate an over-aligned event, bypassing the pool.
+     *
+     * \param [in] size The size of the event.
+     * \param [in] align The alignment of the event.
+     * \returns The event memory.
+     */
+    static void* operator new(std::size_t size, std::align_val_t align);
+    /**
+     * Release an over-aligned event.
+     *
+     * \param [in] p The event memory.
+     * \param [in] size The size of the event.
+     * \param [in] align The alignment of the event.
+     */
+    static void operator delete(void* p, std::size_t size, std::align_val_t align);
+
+    /** Event pool counters, summed over all threads. */
+    struct PoolStats
+    {
+        uint64_t hits;     //!< Allocations served from the pool.
+        uint64_t misses;   //!< Allocations which went to the system allocator.
+        uint64_t live;     //!< Events currently allocated.
+        uint64_t peakLive; //!< Largest number of events allocated at once by one thread.
+    };
+
+    /**
+     * Get the event pool counters.
+     *
+     * The peak is exact when events are created and released by the same
+     * thread, as in non-realtime simulations.
+     *
+     * \returns The event pool counters.
+     */
+    static PoolStats GetPoolStats();
+
   protected:
     /**
      * Implementation for Invoke().
@@ -0,0 +1,412 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ladder-scheduler.h"
+
+#include "assert.h"
+#include "event-impl.h"
+#include "log.h"
+#include "type-id.h"
+#include "uinteger.h"
+
+#include <algorithm>
+#include <utility>
+
+/**
+ * \file
+ * \ingroup scheduler
+ * ns3::LadderScheduler class implementation.
+ */
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("LadderScheduler");
+
+NS_OBJECT_ENSURE_REGISTERED(LadderScheduler);
+
+TypeId
+LadderScheduler::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::LadderScheduler")
+            .SetParent<Scheduler>()
+            .SetGroupName("Core")
+            .AddConstructor<LadderScheduler>()
+            .AddAttribute("Threshold",
+                          "Maximum number of events in a bucket before it is spread "
+                          "over a finer rung, and in Bottom before it is moved to a rung",
+                          TypeId::ATTR_CONSTRUCT,
+                          UintegerValue(50),
+                          MakeUintegerAccessor(&LadderScheduler::m_threshold),
+                          MakeUintegerChecker<uint32_t>(1))
+            .AddAttribute("MaxRungs",
+                          "Maximum number of rungs of the ladder",
+                          TypeId::ATTR_CONSTRUCT,
+                          UintegerValue(8),
+                          MakeUintegerAccessor(&LadderScheduler::m_maxRungs),
+                          MakeUintegerChecker<uint32_t>(1));
+    return tid;
+}
+
+LadderScheduler::LadderScheduler()
+    : m_topMin(UINT64_MAX),
+      m_topMax(0),
+      m_topStart(0),
+      m_nRungs(0),
+      m_bottomHead(0),
+      m_freeNodes(NONE),
+      m_qSize(0),
+      m_threshold(50),
+      m_maxRungs(8)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+LadderScheduler::~LadderScheduler()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+uint32_t
+LadderScheduler::AllocNode(const Scheduler::Event& ev)
+{
+    uint32_t index;
+    if (m_freeNodes != NONE)
+    {
+        index = m_freeNodes;
+        m_freeNodes = m_nodes[index].next;
+        m_nodes[index].ev = ev;
+    }
+    else
+    {
+        index = m_nodes.size();
+        m_nodes.push_back({ev, NONE});
+    }
+    return index;
+}
+
+void
+LadderScheduler::InsertInRung(Rung& rung, const Scheduler::Event& ev)
+{
+    uint32_t bucket = (ev.key.m_ts - rung.start) / rung.width;
+    NS_ASSERT(bucket >= rung.current && bucket < rung.buckets.size());
+    uint32_t node = AllocNode(ev);
+    m_nodes[node].next = rung.buckets[bucket].head;
+    rung.buckets[bucket].head = node;
+    rung.buckets[bucket].count++;
+    rung.count++;
+}
+
+void
+LadderScheduler::InsertInBottom(const Scheduler::Event& ev)
+{
+    // drop the dequeued prefix once it dominates, so that the vector does
+    // not grow while the simulation keeps scheduling near-term events
+    if (m_bottomHead > 0 && m_bottomHead >= m_bottom.size() / 2)
+    {
+        m_bottom.erase(m_bottom.begin(), m_bottom.begin() + m_bottomHead);
+        m_bottomHead = 0;
+    }
+    auto i = std::upper_bound(m_bottom.begin() + m_bottomHead,
+                              m_bottom.end(),
+                              ev,
+                              [](const Scheduler::Event& a, const Scheduler::Event& b) {
+                                  return a.key < b.key;
+                              });
+    m_bottom.insert(i, ev);
+}
+
+uint32_t
+LadderScheduler::AddRung(uint64_t start, uint64_t end, uint64_t last, uint32_t n)
+{
+    NS_LOG_FUNCTION(this << start << end << last << n);
+    NS_ASSERT(start <= last && last < end && n > 0);
+    // size buckets for about one event each over the occupied span, but
+    // bound the bucket count when the rung must reach much further
+    uint64_t width = std::max<uint64_t>(1, (last - start + n) / n);
+    uint64_t maxBuckets = 2 * static_cast<uint64_t>(n) + 16;
+    if ((end - start + width - 1) / width > maxBuckets)
+    {
+        width = (end - start + maxBuckets - 1) / maxBuckets;
+    }
+    uint64_t nBuckets = (end - start + width - 1) / width;
+
+    if (m_nRungs == m_rungs.size())
+    {
+        m_rungs.emplace_back();
+    }
+    Rung& rung = m_rungs[m_nRungs];
+    rung.start = start;
+    rung.width = width;
+    rung.current = 0;
+    rung.count = 0;
+    rung.buckets.assign(nBuckets, {NONE, 0});
+    NS_LOG_LOGIC("rung " << m_nRungs << " start=" << start << " width=" << width
+                         << " buckets=" << nBuckets);
+    return m_nRungs++;
+}
+
+uint32_t
+LadderScheduler::FindRung(uint64_t ts) const
+{
+    for (uint32_t i = 0; i < m_nRungs; i++)
+    {
+        if (ts >= m_rungs[i].CurrentStart())
+        {
+            return i;
+        }
+    }
+    return m_nRungs;
+}
+
+void
+LadderScheduler::SpillBottom()
+{
+    NS_LOG_FUNCTION(this);
+    uint64_t first = m_bottom[m_bottomHead].key.m_ts;
+    uint64_t last = m_bottom.back().key.m_ts;
+    if (first == last)
+    {
+        // a finer rung would put every event into the same bucket again
+        return;
+    }
+    uint64_t end = m_nRungs > 0 ? m_rungs[m_nRungs - 1].CurrentStart() : m_topStart;
+    uint32_t r = AddRung(first, end, last, m_bottom.size() - m_bottomHead);
+    for (uint32_t i = m_bottomHead; i < m_bottom.size(); i++)
+    {
+        InsertInRung(m_rungs[r], m_bottom[i]);
+    }
+    m_bottom.clear();
+    m_bottomHead = 0;
+}
+
+void
+LadderScheduler::RefillBottom()
+{
+    if (m_bottomHead < m_bottom.size())
+    {
+        return;
+    }
+    NS_LOG_FUNCTION(this);
+    m_bottom.clear();
+    m_bottomHead = 0;
+    if (m_qSize == 0)
+    {
+        return;
+    }
+
+    auto byKey = [](const Scheduler::Event& a, const Scheduler::Event& b) {
+        return a.key < b.key;
+    };
+
+    while (true)
+    {
+        if (m_nRungs == 0)
+        {
+            NS_ASSERT(!m_top.empty());
+            uint64_t first = m_topMin;
+            uint64_t last = m_topMax;
+            m_topStart = last + 1;
+            m_topMin = UINT64_MAX;
+            m_topMax = 0;
+            if (m_top.size() <= m_threshold || first == last)
+            {
+                std::swap(m_bottom, m_top);
+                std::sort(m_bottom.begin(), m_bottom.end(), byKey);
+                return;
+            }
+            uint32_t r = AddRung(first, last + 1, last, m_top.size());
+            for (const auto& ev : m_top)
+            {
+                InsertInRung(m_rungs[r], ev);
+            }
+            m_top.clear();
+            continue;
+        }
+
+        Rung& rung = m_rungs[m_nRungs - 1];
+        while (rung.current < rung.buckets.size() && rung.buckets[rung.current].count == 0)
+        {
+            rung.current++;
+        }
+        if (rung.current == rung.buckets.size())
+        {
+            NS_ASSERT(rung.count == 0);
+            m_nRungs--;
+            continue;
+        }
+
+        Bucket bucket = rung.buckets[rung.current];
+        uint64_t start = rung.CurrentStart();
+        uint64_t width = rung.width;
+        rung.buckets[rung.current] = {NONE, 0};
+        rung.current++;
+        rung.count -= bucket.count;
+
+        if (bucket.count > m_threshold && width > 1 && m_nRungs < m_maxRungs)
+        {
+            uint64_t first = UINT64_MAX;
+            uint64_t last = 0;
+            for (uint32_t i = bucket.head; i != NONE; i = m_nodes[i].next)
+            {
+                first = std::min(first, m_nodes[i].ev.key.m_ts);
+                last = std::max(last, m_nodes[i].ev.key.m_ts);
+            }
+            if (first != last)
+            {
+                // spread the bucket over a finer rung, reusing its nodes
+                uint32_t r = AddRung(first, start + width, last, bucket.count);
+                Rung& finer = m_rungs[r];
+                uint32_t i = bucket.head;
+                while (i != NONE)
+                {
+                    uint32_t next = m_nodes[i].next;
+                    Bucket& b = finer.buckets[(m_nodes[i].ev.key.m_ts - finer.start) / finer.width];
+                    m_nodes[i].next = b.head;
+                    b.head = i;
+                    b.count++;
+                    i = next;
+                }
+                finer.count = bucket.count;
+                continue;
+            }
+        }
+
+        m_bottom.reserve(bucket.count);
+        uint32_t i = bucket.head;
+        while (i != NONE)
+        {
+            uint32_t next = m_nodes[i].next;
+            m_bottom.push_back(m_nodes[i].ev);
+            m_nodes[i].next = m_freeNodes;
+            m_freeNodes = i;
+            i = next;
+        }
+        std::sort(m_bottom.begin(), m_bottom.end(), byKey);
+        return;
+    }
+}
+
+void
+LadderScheduler::Insert(const Scheduler::Event& ev)
+{
+    NS_LOG_FUNCTION(this << ev.impl << ev.key.m_ts << ev.key.m_uid);
+    uint64_t ts = ev.key.m_ts;
+    m_qSize++;
+    if (ts >= m_topStart)
+    {
+        m_top.push_back(ev);
+        m_topMin = std::min(m_topMin, ts);
+        m_topMax = std::max(m_topMax, ts);
+    }
+    else
+    {
+        uint32_t r = FindRung(ts);
+        if (r < m_nRungs)
+        {
+            InsertInRung(m_rungs[r], ev);
+        }
+        else
+        {
+            InsertInBottom(ev);
+            if (m_bottom.size() - m_bottomHead > m_threshold && m_nRungs < m_maxRungs)
+            {
+                SpillBottom();
+            }
+        }
+    }
+    RefillBottom();
+}
+
+bool
+LadderScheduler::IsEmpty() const
+{
+    NS_LOG_FUNCTION(this);
+    return m_qSize == 0;
+}
+
+Scheduler::Event
+LadderScheduler::PeekNext() const
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT(!IsEmpty());
+    return m_bottom[m_bottomHead];
+}
+
+Scheduler::Event
+LadderScheduler::RemoveNext()
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT(!IsEmpty());
+    Scheduler::Event ev = m_bottom[m_bottomHead];
+    m_bottomHead++;
+    m_qSize--;
+    RefillBottom();
+    return ev;
+}
+
+void
+LadderScheduler::Remove(const Scheduler::Event& ev)
+{
+    NS_LOG_FUNCTION(this << ev.impl << ev.key.m_ts << ev.key.m_uid);
+    NS_ASSERT(!IsEmpty());
+    uint64_t ts = ev.key.m_ts;
+    if (ts >= m_topStart)
+    {
+        auto i = std::find_if(m_top.begin(), m_top.end(), [&ev](const Scheduler::Event& e) {
+            return e.key.m_uid == ev.key.m_uid;
+        });
+        NS_ASSERT(i != m_top.end());
+        *i = m_top.back();
+        m_top.pop_back();
+    }
+    else
+    {
+        uint32_t r = FindRung(ts);
+        if (r < m_nRungs)
+        {
+            Rung& rung = m_rungs[r];
+            Bucket& bucket = rung.buckets[(ts - rung.start) / rung.width];
+            uint32_t* link = &bucket.head;
+            while (m_nodes[*link].ev.key.m_uid != ev.key.m_uid)
+            {
+                link = &m_nodes[*link].next;
+                NS_ASSERT(*link != NONE);
+            }
+            uint32_t node = *link;
+            *link = m_nodes[node].next;
+            m_nodes[node].next = m_freeNodes;
+            m_freeNodes = node;
+            bucket.count--;
+            rung.count--;
+        }
+        else
+        {
+            auto i = std::lower_bound(m_bottom.begin() + m_bottomHead,
+                                      m_bottom.end(),
+                                      ev,
+                                      [](const Scheduler::Event& a, const Scheduler::Event& b) {
+                                          return a.key < b.key;
+                                      });
+            NS_ASSERT(i != m_bottom.end() && i->key.m_uid == ev.key.m_uid);
+            m_bottom.erase(i);
+        }
+    }
+    m_qSize--;
+    RefillBottom();
+}
+
+} // namespace ns3
@@ -0,0 +1,210 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LADDER_SCHEDULER_H
+#define LADDER_SCHEDULER_H
+
+#include "scheduler.h"
+
+#include <stdint.h>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup scheduler
+ * ns3::LadderScheduler declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * \ingroup scheduler
+ * \brief a ladder queue event scheduler
+ *
+ * This event scheduler implements the Ladder Queue published in
+ * ["Ladder Queue: An O(1) Priority Queue Structure for Large-Scale
+ * Discrete Event Simulation" by Wai Teng Tang, Rick Siow Mong Goh and
+ * Ian Li-Jin Thng][Tang].
+ *
+ * [Tang]: https://doi.org/10.1145/1103323.1103324 "Tang"
+ *
+ * Events are kept in three tiers:
+ *  - Top: an unsorted `std::vector` of the events later than every
+ *    event in the other tiers.
+ *  - Ladder: up to `MaxRungs` rungs of buckets, each bucket covering
+ *    a uniform time span.  Buckets are unsorted; when the bucket with the
+ *    earliest events is reached, it is either moved to Bottom or, if it
+ *    holds more than `Threshold` events, spread over a finer rung.
+ *  - Bottom: a small `std::vector`, sorted in increasing time stamp order,
+ *    of the earliest events.  Events are removed by advancing an index.
+ *
+ * Unlike the CalendarScheduler, buckets never need to be sorted or resized
+ * as a whole, and sorting is limited to Bottom.  Bucket entries are nodes
+ * of a single pool, linked by index, so inserting or moving events does not
+ * allocate memory once the pool has grown to the peak event population.
+ *
+ * \par Time Complexity
+ *
+ * Operation    | Amortized %Time | Reason
+ * :----------- | :-------------- | :-----
+ * Insert()     | ~Constant       | Append to Top or a bucket; Bottom is short
+ * IsEmpty()    | Constant        | Explicit queue size
+ * PeekNext()   | Constant        | Bottom is kept non-empty
+ * Remove()     | ~Constant       | Search within bucket; linear in Top
+ * RemoveNext() | ~Constant       | Bottom refilled from one bucket at a time
+ *
+ * \par Memory Complexity
+ *
+ * Category  | Memory                           | Reason
+ * :-------- | :------------------------------- | :-----
+ * Overhead  | `MaxRungs` x `std::vector`       | Rung bucket heads
+ * Per Event | `sizeof (uint32_t)` + bucket head| Pool node link, bucket
+ */
+class LadderScheduler : public Scheduler
+{
+  public:
+    /**
+     *  Register this type.
+     *  \return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    /** Constructor. */
+    LadderScheduler();
+    /** Destructor. */
+    ~LadderScheduler() override;
+
+    // Inherited
+    void Insert(const Scheduler::Event& ev) override;
+    bool IsEmpty() const override;
+    Scheduler::Event PeekNext() const override;
+    Scheduler::Event RemoveNext() override;
+    void Remove(const Scheduler::Event& ev) override;
+
+  private:
+    /** Marks the end of a bucket list. */
+    static constexpr uint32_t NONE = UINT32_MAX;
+
+    /** Pool node holding one event of a bucket. */
+    struct Node
+    {
+        Scheduler::Event ev; //!< The event.
+        uint32_t next;       //!< Index of the next node of the bucket, or NONE.
+    };
+
+    /** Singly linked list of pool nodes. */
+    struct Bucket
+    {
+        uint32_t head;  //!< Index of the first node, or NONE.
+        uint32_t count; //!< Number of nodes.
+    };
+
+    /** One rung of the ladder. */
+    struct Rung
+    {
+        uint64_t start;              //!< Time stamp at the start of bucket 0.
+        uint64_t width;              //!< Time span of each bucket.
+        uint32_t current;            //!< Index of the earliest bucket not yet dequeued.
+        uint32_t count;              //!< Number of events in the rung.
+        std::vector<Bucket> buckets; //!< Bucket heads.
+
+        /**
+         * \return The time stamp at the start of the current bucket.
+         */
+        uint64_t CurrentStart() const
+        {
+            return start + width * current;
+        }
+    };
+
+    /**
+     * Take a node from the pool.
+     *
+     * \param [in] ev The event to store.
+     * \returns The node index.
+     */
+    uint32_t AllocNode(const Scheduler::Event& ev);
+    /**
+     * Put an event into a rung, the bucket must exist.
+     *
+     * \param [in] rung The rung.
+     * \param [in] ev The event.
+     */
+    void InsertInRung(Rung& rung, const Scheduler::Event& ev);
+    /**
+     * Insert an event into Bottom, keeping the order.
+     *
+     * \param [in] ev The event.
+     */
+    void InsertInBottom(const Scheduler::Event& ev);
+    /**
+     * Add a rung covering `[start, end)`, with about one event per bucket.
+     *
+     * \param [in] start The time stamp at the start of the rung.
+     * \param [in] end The time stamp at the end of the rung.
+     * \param [in] last The largest time stamp of the events to insert.
+     * \param [in] n The number of events to insert.
+     * \returns The index of the new rung.
+     */
+    uint32_t AddRung(uint64_t start, uint64_t end, uint64_t last, uint32_t n);
+    /**
+     * Find the rung an event with the given time stamp belongs to.
+     *
+     * \param [in] ts The time stamp.
+     * \returns The rung index, or the number of rungs for Bottom.
+     */
+    uint32_t FindRung(uint64_t ts) const;
+    /** Move Bottom to a new rung, when it has grown too large. */
+    void SpillBottom();
+    /** Fill Bottom with the earliest events, if it is empty. */
+    void RefillBottom();
+
+    /** Events later than every event in the ladder and in Bottom. */
+    std::vector<Scheduler::Event> m_top;
+    /** Smallest time stamp in Top. */
+    uint64_t m_topMin;
+    /** Largest time stamp in Top. */
+    uint64_t m_topMax;
+    /** Events with a time stamp at or after this go to Top. */
+    uint64_t m_topStart;
+
+    /** Rungs, the first one is the coarsest. */
+    std::vector<Rung> m_rungs;
+    /** Number of rungs in use; the others are kept for their buckets. */
+    uint32_t m_nRungs;
+
+    /** Earliest events, in increasing order from m_bottomHead. */
+    std::vector<Scheduler::Event> m_bottom;
+    /** Index of the earliest event in m_bottom. */
+    uint32_t m_bottomHead;
+
+    /** Node pool of the rungs. */
+    std::vector<Node> m_nodes;
+    /** First free node in the pool, or NONE. */
+    uint32_t m_freeNodes;
+
+    /** Number of events in queue. */
+    uint32_t m_qSize;
+
+    /** Maximum number of events in a bucket or Bottom before spreading it. */
+    uint32_t m_threshold;
+    /** Maximum number of rungs. */
+    uint32_t m_maxRungs;
+};
+
+} // namespace ns3
+
+#endif /* LADDER_SCHEDULER_H */
@@ -107,17 +107,22 @@ MatrixArray<T>::operator*(const MatrixArray<T>& rhs) const
 
 #else // Eigen not found or Eigen optimizations not enabled
 
-        size_t matrixOffset = page * m_numRows * m_numCols;
-        size_t rhsMatrixOffset = page * rhs.m_numRows * rhs.m_numCols;
-        for (size_t i = 0; i < res.m_numRows; ++i)
+        // Accumulate the columns of lhs scaled by the elements of the column of rhs, so that
+        // the inner loop runs over contiguous memory and can be vectorized by the compiler
+        const T* lhsPage = GetPagePtr(page);
+        const T* rhsPage = rhs.GetPagePtr(page);
+        T* resPage = res.GetPagePtr(page);
+        for (size_t j = 0; j < res.m_numCols; ++j)
         {
-            for (size_t j = 0; j < res.m_numCols; ++j)
+            T* resCol = resPage + j * res.m_numRows;
+            for (size_t k = 0; k < m_numCols; ++k)
             {
-                res(i, j, page) = (m_values[std::slice(matrixOffset + i, m_numCols, m_numRows)] *
-                                   rhs.m_values[std::slice(rhsMatrixOffset + j * rhs.m_numRows,
-                                                           rhs.m_numRows,
-                                                           1)])
-                                      .sum();
+                const T rhsElem = rhsPage[j * rhs.m_numRows + k];
+                const T* lhsCol = lhsPage + k * m_numRows;
+                for (size_t i = 0; i < res.m_numRows; ++i)
+                {
+                    resCol[i] += lhsCol[i] * rhsElem;
+                }
             }
         }
 
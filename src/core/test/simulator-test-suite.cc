@@ -17,12 +17,19 @@
  * Author: Mathieu Lacage <mathieu.lacage@sophia.inria.fr>
  */
 #include "ns3/calendar-scheduler.h"
+#include "ns3/event-impl.h"
 #include "ns3/heap-scheduler.h"
+#include "ns3/ladder-scheduler.h"
 #include "ns3/list-scheduler.h"
 #include "ns3/map-scheduler.h"
 #include "ns3/priority-queue-scheduler.h"
+#include "ns3/random-variable-stream.h"
 #include "ns3/simulator.h"
 #include "ns3/test.h"
+#include "ns3/uinteger.h"
+
+#include <algorithm>
+#include <vector>
 
 using namespace ns3;
 
@@ -707,6 +714,219 @@ SimulatorTemplateTestCase::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup simulator-tests
+ *
+ * \brief Check that events are reused from the EventImpl pool.
+ */
+class SimulatorEventPoolTestCase : public TestCase
+{
+  public:
+    SimulatorEventPoolTestCase();
+
+  private:
+    void DoRun() override;
+
+    /** Schedule a round of events and run them. */
+    void RunRound();
+
+    /** Event function. */
+    void Foo()
+    {
+        m_count++;
+    }
+
+    uint32_t m_count; //!< Number of events run.
+};
+
+SimulatorEventPoolTestCase::SimulatorEventPoolTestCase()
+    : TestCase("Check the EventImpl pool"),
+      m_count(0)
+{
+}
+
+void
+SimulatorEventPoolTestCase::RunRound()
+{
+    for (uint32_t i = 0; i < 100; i++)
+    {
+        Simulator::Schedule(MicroSeconds(i), &SimulatorEventPoolTestCase::Foo, this);
+        Simulator::Schedule(MicroSeconds(i), [this]() { Foo(); });
+    }
+    Simulator::Run();
+}
+
+void
+SimulatorEventPoolTestCase::DoRun()
+{
+    RunRound();
+    auto before = EventImpl::GetPoolStats();
+    RunRound();
+    auto after = EventImpl::GetPoolStats();
+    Simulator::Destroy();
+
+    NS_TEST_EXPECT_MSG_EQ(m_count, 400, "Not all events were run");
+    NS_TEST_EXPECT_MSG_GT_OR_EQ(after.hits - before.hits,
+                                200,
+                                "Events of the second round were not taken from the pool");
+    NS_TEST_EXPECT_MSG_EQ(after.misses, before.misses, "Events were allocated outside the pool");
+    NS_TEST_EXPECT_MSG_EQ(after.live, before.live, "Events were not returned to the pool");
+    NS_TEST_EXPECT_MSG_GT_OR_EQ(after.peakLive, 200, "Wrong peak of live events");
+}
+
+/**
+ * \ingroup simulator-tests
+ *
+ * \brief Check the LadderScheduler against the MapScheduler under load.
+ *
+ * A random sequence of insertions, dequeues and cancellations is applied
+ * to both schedulers, and the events must come out in the same order.
+ * The events are scheduled on slot boundaries (many events with the same
+ * time stamp), after short delays and after long timers, so that Top is
+ * converted into rungs, buckets are spread over finer rungs and Bottom
+ * is spilled into new rungs; the cancellations remove events from Top,
+ * from the rungs and from Bottom.
+ */
+class LadderSchedulerStressTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor.
+     * \param threshold The Threshold attribute of the LadderScheduler.
+     * \param maxRungs The MaxRungs attribute of the LadderScheduler.
+     * \param nOperations The number of operations to apply.
+     */
+    LadderSchedulerStressTestCase(uint32_t threshold, uint32_t maxRungs, uint32_t nOperations);
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Check that the two schedulers have the same next event.
+     * \param ladder The scheduler under test.
+     * \param map The reference scheduler.
+     */
+    void CheckNext(Ptr<Scheduler> ladder, Ptr<Scheduler> map);
+
+    uint32_t m_threshold;   //!< The Threshold attribute of the LadderScheduler.
+    uint32_t m_maxRungs;    //!< The MaxRungs attribute of the LadderScheduler.
+    uint32_t m_nOperations; //!< The number of operations to apply.
+};
+
+LadderSchedulerStressTestCase::LadderSchedulerStressTestCase(uint32_t threshold,
+                                                             uint32_t maxRungs,
+                                                             uint32_t nOperations)
+    : TestCase("Check LadderScheduler against MapScheduler, threshold " +
+               std::to_string(threshold) + ", " + std::to_string(maxRungs) + " rungs"),
+      m_threshold(threshold),
+      m_maxRungs(maxRungs),
+      m_nOperations(nOperations)
+{
+}
+
+void
+LadderSchedulerStressTestCase::CheckNext(Ptr<Scheduler> ladder, Ptr<Scheduler> map)
+{
+    NS_TEST_ASSERT_MSG_EQ(ladder->IsEmpty(), map->IsEmpty(), "Wrong emptiness");
+    if (!map->IsEmpty())
+    {
+        NS_TEST_ASSERT_MSG_EQ(ladder->PeekNext().key.m_uid,
+                              map->PeekNext().key.m_uid,
+                              "Wrong next event");
+    }
+}
+
+void
+LadderSchedulerStressTestCase::DoRun()
+{
+    ObjectFactory factory;
+    factory.SetTypeId(LadderScheduler::GetTypeId());
+    factory.Set("Threshold", UintegerValue(m_threshold));
+    factory.Set("MaxRungs", UintegerValue(m_maxRungs));
+    Ptr<Scheduler> ladder = factory.Create<Scheduler>();
+    Ptr<Scheduler> map = CreateObject<MapScheduler>();
+
+    Ptr<UniformRandomVariable> rng = CreateObject<UniformRandomVariable>();
+    rng->SetStream(1);
+
+    const uint64_t slot = 125000;
+    std::vector<Scheduler::Event> pending;
+    uint64_t now = 0;
+    uint32_t uid = 0;
+    uint32_t removed = 0;
+    uint32_t cancelled = 0;
+
+    for (uint32_t i = 0; i < m_nOperations; i++)
+    {
+        double op = rng->GetValue();
+        // keep inserting until there are enough events for the rungs
+        if (op < 0.5 || pending.size() < 4 * m_threshold)
+        {
+            Scheduler::Event ev;
+            ev.impl = nullptr;
+            ev.key.m_uid = uid++;
+            ev.key.m_context = 0;
+            double kind = rng->GetValue();
+            if (kind < 0.4)
+            {
+                // one of the next slot boundaries
+                ev.key.m_ts = (now / slot + rng->GetInteger(1, 4)) * slot;
+            }
+            else if (kind < 0.9)
+            {
+                // short delay, possibly zero
+                ev.key.m_ts = now + rng->GetInteger(0, 2 * slot);
+            }
+            else
+            {
+                // long timer
+                ev.key.m_ts = now + rng->GetInteger(100 * slot, 10000 * slot);
+            }
+            ladder->Insert(ev);
+            map->Insert(ev);
+            pending.push_back(ev);
+        }
+        else if (op < 0.85)
+        {
+            Scheduler::Event ev = map->RemoveNext();
+            NS_TEST_ASSERT_MSG_EQ(ladder->RemoveNext().key.m_uid,
+                                  ev.key.m_uid,
+                                  "Wrong event removed at operation " << i);
+            now = ev.key.m_ts;
+            auto it = std::find_if(pending.begin(),
+                                   pending.end(),
+                                   [&ev](const Scheduler::Event& e) {
+                                       return e.key.m_uid == ev.key.m_uid;
+                                   });
+            *it = pending.back();
+            pending.pop_back();
+            removed++;
+        }
+        else
+        {
+            uint32_t index = rng->GetInteger(0, pending.size() - 1);
+            Scheduler::Event ev = pending[index];
+            ladder->Remove(ev);
+            map->Remove(ev);
+            pending[index] = pending.back();
+            pending.pop_back();
+            cancelled++;
+        }
+        CheckNext(ladder, map);
+    }
+
+    while (!map->IsEmpty())
+    {
+        NS_TEST_ASSERT_MSG_EQ(ladder->RemoveNext().key.m_uid,
+                              map->RemoveNext().key.m_uid,
+                              "Wrong event removed while draining");
+        CheckNext(ladder, map);
+        removed++;
+    }
+    NS_TEST_ASSERT_MSG_EQ(removed + cancelled, uid, "Wrong number of events");
+    NS_TEST_ASSERT_MSG_GT(cancelled, 0, "No event was cancelled");
+}
+
 /**
  * \ingroup simulator-tests
  *
@@ -730,6 +950,11 @@ class SimulatorTestSuite : public TestSuite
         AddTestCase(new SimulatorEventsTestCase(factory), TestCase::Duration::QUICK);
         factory.SetTypeId(PriorityQueueScheduler::GetTypeId());
         AddTestCase(new SimulatorEventsTestCase(factory), TestCase::Duration::QUICK);
+        factory.SetTypeId(LadderScheduler::GetTypeId());
+        AddTestCase(new SimulatorEventsTestCase(factory), TestCase::Duration::QUICK);
+        AddTestCase(new SimulatorEventPoolTestCase(), TestCase::Duration::QUICK);
+        AddTestCase(new LadderSchedulerStressTestCase(4, 3, 50000), TestCase::Duration::QUICK);
+        AddTestCase(new LadderSchedulerStressTestCase(50, 8, 50000), TestCase::Duration::QUICK);
     }
 };
 
@@ -0,0 +1,299 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+//
+// This program measures the wall clock time spent by a FemtoForum MAC scheduler
+// (--scheduler option) to schedule the TTIs of an eNB serving a large number of
+// UEs (--nUes option).
+//
+// The scheduler is driven through its SAPs in the same way as the LteEnbMac does
+// at every subframe: every UE has a single full-buffer data radio bearer, reports
+// a wideband DL CQI every --cqiPeriod TTIs and is sent HARQ ACKs for all its DL
+// transmissions; the RLC buffer status and the BSR of the UEs served in a TTI are
+// reported again in the next TTI and the UL CQI is reported for every UL
+// allocation. For --nTtis TTIs, the program triggers the DL and the UL scheduling
+// and prints the time spent by the scheduler and the number of TTIs scheduled per
+// second of wall clock time.
+//
+// No PHY and channel are involved, hence the wall clock time only accounts for
+// the scheduler and the (no-op) frequency reuse algorithm.
+//
+
+#include "ns3/command-line.h"
+#include "ns3/ff-mac-csched-sap.h"
+#include "ns3/ff-mac-sched-sap.h"
+#include "ns3/ff-mac-scheduler.h"
+#include "ns3/lte-common.h"
+#include "ns3/lte-fr-no-op-algorithm.h"
+#include "ns3/object-factory.h"
+#include "ns3/simulator.h"
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("LenaFfMacSchedulerBenchmark");
+
+/// CSCHED SAP user of the benchmark, ignoring all the confirmations of the scheduler
+class BenchmarkCschedSapUser : public FfMacCschedSapUser
+{
+  public:
+    void CschedCellConfigCnf(const CschedCellConfigCnfParameters& params) override
+    {
+    }
+
+    void CschedUeConfigCnf(const CschedUeConfigCnfParameters& params) override
+    {
+    }
+
+    void CschedLcConfigCnf(const CschedLcConfigCnfParameters& params) override
+    {
+    }
+
+    void CschedLcReleaseCnf(const CschedLcReleaseCnfParameters& params) override
+    {
+    }
+
+    void CschedUeReleaseCnf(const CschedUeReleaseCnfParameters& params) override
+    {
+    }
+
+    void CschedUeConfigUpdateInd(const CschedUeConfigUpdateIndParameters& params) override
+    {
+    }
+
+    void CschedCellConfigUpdateInd(const CschedCellConfigUpdateIndParameters& params) override
+    {
+    }
+};
+
+/// SCHED SAP user of the benchmark, storing the last scheduling decisions
+class BenchmarkSchedSapUser : public FfMacSchedSapUser
+{
+  public:
+    void SchedDlConfigInd(const SchedDlConfigIndParameters& params) override
+    {
+        m_dlConfig = params;
+    }
+
+    void SchedUlConfigInd(const SchedUlConfigIndParameters& params) override
+    {
+        m_ulConfig = params;
+    }
+
+    SchedDlConfigIndParameters m_dlConfig; //!< the last DL scheduling decisions
+    SchedUlConfigIndParameters m_ulConfig; //!< the last UL scheduling decisions
+};
+
+int
+main(int argc, char* argv[])
+{
+    std::string scheduler = "ns3::PfFfMacScheduler";
+    uint16_t nUes = 500;
+    uint32_t nTtis = 10000;
+    uint16_t bandwidth = 100;
+    uint32_t cqiPeriod = 10;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("scheduler", "TypeId of the FemtoForum MAC scheduler", scheduler);
+    cmd.AddValue("nUes", "Number of UEs attached to the eNB", nUes);
+    cmd.AddValue("nTtis", "Number of TTIs to schedule", nTtis);
+    cmd.AddValue("bandwidth", "DL and UL bandwidth in number of RBs", bandwidth);
+    cmd.AddValue("cqiPeriod", "Periodicity of the DL CQI reports of a UE in TTIs", cqiPeriod);
+    cmd.Parse(argc, argv);
+
+    NS_ABORT_MSG_IF(nUes == 0, "At least one UE is needed");
+    NS_ABORT_MSG_IF(cqiPeriod == 0, "The CQI periodicity cannot be null");
+
+    ObjectFactory factory(scheduler);
+    auto sched = factory.Create<FfMacScheduler>();
+    auto ffr = CreateObject<LteFrNoOpAlgorithm>();
+    ffr->SetDlBandwidth(bandwidth);
+    ffr->SetUlBandwidth(bandwidth);
+    sched->SetLteFfrSapProvider(ffr->GetLteFfrSapProvider());
+    ffr->SetLteFfrSapUser(sched->GetLteFfrSapUser());
+
+    BenchmarkCschedSapUser cschedSapUser;
+    BenchmarkSchedSapUser schedSapUser;
+    sched->SetFfMacCschedSapUser(&cschedSapUser);
+    sched->SetFfMacSchedSapUser(&schedSapUser);
+    auto cschedSapProvider = sched->GetFfMacCschedSapProvider();
+    auto schedSapProvider = sched->GetFfMacSchedSapProvider();
+
+    FfMacCschedSapProvider::CschedCellConfigReqParameters cellConfig;
+    cellConfig.m_dlBandwidth = bandwidth;
+    cellConfig.m_ulBandwidth = bandwidth;
+    cschedSapProvider->CschedCellConfigReq(cellConfig);
+
+    // a default data radio bearer per UE, as set up by the LteEnbMac
+    const uint8_t lcId = 3;
+    for (uint16_t rnti = 1; rnti <= nUes; ++rnti)
+    {
+        FfMacCschedSapProvider::CschedUeConfigReqParameters ueConfig;
+        ueConfig.m_rnti = rnti;
+        ueConfig.m_transmissionMode = 0;
+        cschedSapProvider->CschedUeConfigReq(ueConfig);
+
+        LogicalChannelConfigListElement_s lc;
+        lc.m_logicalChannelIdentity = lcId;
+        lc.m_logicalChannelGroup = 1;
+        lc.m_direction = LogicalChannelConfigListElement_s::DIR_BOTH;
+        lc.m_qosBearerType = LogicalChannelConfigListElement_s::QBT_NON_GBR;
+        lc.m_qci = 9;
+        lc.m_eRabMaximulBitrateUl = 0;
+        lc.m_eRabMaximulBitrateDl = 0;
+        lc.m_eRabGuaranteedBitrateUl = 0;
+        lc.m_eRabGuaranteedBitrateDl = 0;
+        FfMacCschedSapProvider::CschedLcConfigReqParameters lcConfig;
+        lcConfig.m_rnti = rnti;
+        lcConfig.m_reconfigureFlag = false;
+        lcConfig.m_logicalChannelConfigList.push_back(lc);
+        cschedSapProvider->CschedLcConfigReq(lcConfig);
+    }
+
+    auto reportRlcBuffer = [&](uint16_t rnti) {
+        FfMacSchedSapProvider::SchedDlRlcBufferReqParameters req;
+        req.m_rnti = rnti;
+        req.m_logicalChannelIdentity = lcId;
+        req.m_rlcTransmissionQueueSize = 100000;
+        req.m_rlcTransmissionQueueHolDelay = 10;
+        req.m_rlcRetransmissionQueueSize = 0;
+        req.m_rlcRetransmissionHolDelay = 0;
+        req.m_rlcStatusPduSize = 0;
+        schedSapProvider->SchedDlRlcBufferReq(req);
+    };
+
+    auto bsr = [](uint16_t rnti) {
+        MacCeListElement_s bsr;
+        bsr.m_rnti = rnti;
+        bsr.m_macCeType = MacCeListElement_s::BSR;
+        bsr.m_macCeValue.m_bufferStatus = {0, 63, 0, 0};
+        return bsr;
+    };
+
+    FfMacSchedSapProvider::SchedUlMacCtrlInfoReqParameters ulMacReq;
+    for (uint16_t rnti = 1; rnti <= nUes; ++rnti)
+    {
+        reportRlcBuffer(rnti);
+        ulMacReq.m_macCeList.push_back(bsr(rnti));
+    }
+
+    uint32_t frameNo = 1;
+    uint32_t subframeNo = 1;
+    uint32_t nTti = 0;
+    uint16_t lastUlSfnSf = 0;
+    uint64_t nDlAllocations = 0;
+    uint64_t nUlAllocations = 0;
+    std::chrono::duration<double> dlTime{0};
+    std::chrono::duration<double> ulTime{0};
+
+    // each TTI is a separate event, so that the time seen by the scheduler advances
+    std::function<void()> tti = [&]() {
+        const uint16_t sfnSf = ((0x3FF & frameNo) << 4) | (0xF & subframeNo);
+
+        // --- DOWNLINK ---
+        auto start = std::chrono::steady_clock::now();
+        FfMacSchedSapProvider::SchedDlCqiInfoReqParameters dlCqiReq;
+        dlCqiReq.m_sfnSf = sfnSf;
+        for (uint32_t rnti = 1 + nTti % cqiPeriod; rnti <= nUes; rnti += cqiPeriod)
+        {
+            CqiListElement_s cqi;
+            cqi.m_rnti = rnti;
+            cqi.m_ri = 1;
+            cqi.m_cqiType = CqiListElement_s::P10;
+            cqi.m_wbCqi.push_back(1 + (rnti + nTti / cqiPeriod) % 15);
+            dlCqiReq.m_cqiList.push_back(cqi);
+        }
+        if (!dlCqiReq.m_cqiList.empty())
+        {
+            schedSapProvider->SchedDlCqiInfoReq(dlCqiReq);
+        }
+
+        // the UEs served in the previous TTI acknowledge their transmissions and
+        // report their refilled RLC buffers
+        FfMacSchedSapProvider::SchedDlTriggerReqParameters dlReq;
+        dlReq.m_sfnSf = sfnSf;
+        for (const auto& data : schedSapUser.m_dlConfig.m_buildDataList)
+        {
+            DlInfoListElement_s info;
+            info.m_rnti = data.m_rnti;
+            info.m_harqProcessId = data.m_dci.m_harqProcess;
+            info.m_harqStatus.resize(data.m_dci.m_ndi.size(), DlInfoListElement_s::ACK);
+            dlReq.m_dlInfoList.push_back(info);
+            reportRlcBuffer(data.m_rnti);
+        }
+        schedSapProvider->SchedDlTriggerReq(dlReq);
+        nDlAllocations += schedSapUser.m_dlConfig.m_buildDataList.size();
+        auto middle = std::chrono::steady_clock::now();
+        dlTime += middle - start;
+
+        // --- UPLINK ---
+        // UL CQI of the UEs allocated in the previous UL trigger and BSR of the UEs
+        // that were granted resources
+        if (nTti > 0)
+        {
+            FfMacSchedSapProvider::SchedUlCqiInfoReqParameters ulCqiReq;
+            ulCqiReq.m_sfnSf = lastUlSfnSf;
+            ulCqiReq.m_ulCqi.m_type = UlCqi_s::PUSCH;
+            ulCqiReq.m_ulCqi.m_sinr.resize(bandwidth, LteFfConverter::double2fpS11dot3(15.0));
+            schedSapProvider->SchedUlCqiInfoReq(ulCqiReq);
+        }
+        for (const auto& dci : schedSapUser.m_ulConfig.m_dciList)
+        {
+            ulMacReq.m_macCeList.push_back(bsr(dci.m_rnti));
+        }
+        if (!ulMacReq.m_macCeList.empty())
+        {
+            ulMacReq.m_sfnSf = sfnSf;
+            schedSapProvider->SchedUlMacCtrlInfoReq(ulMacReq);
+            ulMacReq.m_macCeList.clear();
+        }
+        FfMacSchedSapProvider::SchedUlTriggerReqParameters ulReq;
+        ulReq.m_sfnSf = sfnSf;
+        schedSapProvider->SchedUlTriggerReq(ulReq);
+        lastUlSfnSf = sfnSf;
+        nUlAllocations += schedSapUser.m_ulConfig.m_dciList.size();
+        ulTime += std::chrono::steady_clock::now() - middle;
+
+        if (++subframeNo > 10)
+        {
+            subframeNo = 1;
+            ++frameNo;
+        }
+        if (++nTti < nTtis)
+        {
+            Simulator::Schedule(MilliSeconds(1), tti);
+        }
+    };
+
+    Simulator::ScheduleNow(tti);
+    auto start = std::chrono::steady_clock::now();
+    Simulator::Run();
+    std::chrono::duration<double> totalTime = std::chrono::steady_clock::now() - start;
+    Simulator::Destroy();
+
+    std::cout << "Scheduler:        " << scheduler << " (" << nUes << " UEs, " << bandwidth
+              << " RBs)" << std::endl
+              << "DL allocations:   " << nDlAllocations << " in " << dlTime.count() << " s"
+              << std::endl
+              << "UL allocations:   " << nUlAllocations << " in " << ulTime.count() << " s"
+              << std::endl
+              << "Total time:       " << totalTime.count() << " s (" << nTtis / totalTime.count()
+              << " TTI/s)" << std::endl;
+
+    return 0;
+}
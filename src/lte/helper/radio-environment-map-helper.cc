@@ -20,6 +20,8 @@
 #include "radio-environment-map-helper.h"
 
 #include <ns3/abort.h>
+#include <ns3/angles.h>
+#include <ns3/antenna-model.h>
 #include <ns3/boolean.h>
 #include <ns3/buildings-helper.h>
 #include <ns3/config.h>
@@ -27,18 +29,26 @@
 #include <ns3/double.h>
 #include <ns3/integer.h>
 #include <ns3/log.h>
+#include <ns3/lte-spectrum-signal-parameters.h>
 #include <ns3/lte-spectrum-value-helper.h>
 #include <ns3/mobility-building-info.h>
 #include <ns3/node.h>
 #include <ns3/pointer.h>
+#include <ns3/propagation-loss-model.h>
 #include <ns3/rem-spectrum-phy.h>
 #include <ns3/simulator.h>
 #include <ns3/spectrum-channel.h>
+#include <ns3/spectrum-converter.h>
+#include <ns3/spectrum-propagation-loss-model.h>
+#include <ns3/spectrum-transmit-filter.h>
 #include <ns3/string.h>
 #include <ns3/uinteger.h>
 
+#include <algorithm>
+#include <cmath>
 #include <fstream>
 #include <limits>
+#include <thread>
 
 namespace ns3
 {
@@ -59,6 +69,13 @@ void
 RadioEnvironmentMapHelper::DoDispose()
 {
     NS_LOG_FUNCTION(this);
+    m_filterPhy = nullptr;
+    m_transmissions.clear();
+    m_txPsds.clear();
+    m_gains.clear();
+    m_rxPsds.clear();
+    m_sinrs.clear();
+    Object::DoDispose();
 }
 
 TypeId
@@ -169,7 +186,22 @@ RadioEnvironmentMapHelper::GetTypeId()
                           "default value is -1, what means REM will be averaged from all RBs",
                           IntegerValue(-1),
                           MakeIntegerAccessor(&RadioEnvironmentMapHelper::m_rbId),
-                          MakeIntegerChecker<int32_t>());
+                          MakeIntegerChecker<int32_t>())
+            .AddAttribute("DirectEvaluation",
+                          "If true, the SINR of the points is computed directly from the "
+                          "transmissions of one subframe, instead of being measured by "
+                          "listeners attached to the channel. It is faster and needs less "
+                          "memory, and it gives the same map if the transmissions are the "
+                          "same in every subframe, as those of the control channel.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&RadioEnvironmentMapHelper::m_directEvaluation),
+                          MakeBooleanChecker())
+            .AddAttribute("NumThreads",
+                          "Number of threads computing the SINR of the points when "
+                          "DirectEvaluation is true. 0 means one per hardware thread.",
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&RadioEnvironmentMapHelper::m_numThreads),
+                          MakeUintegerChecker<uint32_t>());
     return tid;
 }
 
@@ -250,6 +282,33 @@ RadioEnvironmentMapHelper::DelayedInstall()
         m_maxPointsPerIteration = m_xRes * m_yRes;
     }
 
+    if (m_directEvaluation)
+    {
+        // The points only need a position, which is moved from batch to batch
+        for (uint32_t i = 0; i < m_maxPointsPerIteration; ++i)
+        {
+            RemPoint p;
+            p.bmm = CreateObject<ConstantPositionMobilityModel>();
+            Ptr<MobilityBuildingInfo> buildingInfo = CreateObject<MobilityBuildingInfo>();
+            p.bmm->AggregateObject(buildingInfo);
+            m_rem.push_back(p);
+        }
+        if (m_channel->GetSpectrumTransmitFilter())
+        {
+            m_filterPhy = CreateObject<RemSpectrumPhy>();
+            m_filterPhy->SetRxSpectrumModel(
+                LteSpectrumValueHelper::GetSpectrumModel(m_earfcn, m_bandwidth));
+        }
+
+        // Record the transmissions received by the listeners of the first
+        // iteration of the other mode
+        m_channel->TraceConnectWithoutContext(
+            "TxSigParams",
+            MakeCallback(&RadioEnvironmentMapHelper::RecordTransmission, this));
+        Simulator::Schedule(Seconds(0.0006), &RadioEnvironmentMapHelper::RunDirectEvaluation, this);
+        return;
+    }
+
     for (uint32_t i = 0; i < m_maxPointsPerIteration; ++i)
     {
         RemPoint p;
@@ -359,6 +418,249 @@ RadioEnvironmentMapHelper::PrintAndReset()
     }
 }
 
+void
+RadioEnvironmentMapHelper::RecordTransmission(Ptr<SpectrumSignalParameters> params)
+{
+    NS_LOG_FUNCTION(this << params);
+    if (m_useDataChannel)
+    {
+        if (DynamicCast<LteSpectrumSignalParametersDataFrame>(params))
+        {
+            m_transmissions.push_back(params);
+        }
+    }
+    else
+    {
+        if (DynamicCast<LteSpectrumSignalParametersDlCtrlFrame>(params))
+        {
+            m_transmissions.push_back(params);
+        }
+    }
+}
+
+void
+RadioEnvironmentMapHelper::RunDirectEvaluation()
+{
+    NS_LOG_FUNCTION(this);
+    m_channel->TraceDisconnectWithoutContext(
+        "TxSigParams",
+        MakeCallback(&RadioEnvironmentMapHelper::RecordTransmission, this));
+    NS_LOG_LOGIC("recorded " << m_transmissions.size() << " transmissions");
+
+    NS_ABORT_MSG_IF(!m_channel->GetSpectrumPropagationLossModel() &&
+                        m_channel->GetPhasedArraySpectrumPropagationLossModel(),
+                    "the REM does not support a PhasedArraySpectrumPropagationLossModel");
+
+    Ptr<const SpectrumModel> rxSpectrumModel =
+        LteSpectrumValueHelper::GetSpectrumModel(m_earfcn, m_bandwidth);
+    NS_ABORT_MSG_IF(m_rbId >= static_cast<int32_t>(rxSpectrumModel->GetNumBands()),
+                    "invalid RbId " << m_rbId);
+    m_bandWidths.clear();
+    for (auto it = rxSpectrumModel->Begin(); it != rxSpectrumModel->End(); ++it)
+    {
+        m_bandWidths.push_back(it->fh - it->fl);
+    }
+    DoubleValue maxLossDb;
+    m_channel->GetAttribute("MaxLossDb", maxLossDb);
+    m_maxLossDb = maxLossDb.Get();
+
+    // Convert the transmitted PSDs to the spectrum model of the map, once per
+    // transmission, and drop the transmissions on other frequencies
+    std::vector<Ptr<SpectrumSignalParameters>> transmissions;
+    m_txPsds.clear();
+    for (auto& params : m_transmissions)
+    {
+        Ptr<const SpectrumModel> txSpectrumModel = params->psd->GetSpectrumModel();
+        if (txSpectrumModel->GetUid() != rxSpectrumModel->GetUid())
+        {
+            if (txSpectrumModel->IsOrthogonal(*rxSpectrumModel))
+            {
+                continue;
+            }
+            SpectrumConverter converter(txSpectrumModel, rxSpectrumModel);
+            params->psd = converter.Convert(params->psd);
+        }
+        m_txPsds.insert(m_txPsds.end(),
+                        params->psd->ConstValuesBegin(),
+                        params->psd->ConstValuesEnd());
+        transmissions.push_back(params);
+    }
+    m_transmissions.swap(transmissions);
+
+    auto remIt = m_rem.begin();
+    size_t numPoints = 0;
+    for (double x = m_xMin; x < m_xMax + 0.5 * m_xStep; x += m_xStep)
+    {
+        for (double y = m_yMin; y < m_yMax + 0.5 * m_yStep; y += m_yStep)
+        {
+            remIt->bmm->SetPosition(Vector(x, y, m_z));
+            Ptr<MobilityBuildingInfo> buildingInfo =
+                (remIt->bmm)->GetObject<MobilityBuildingInfo>();
+            buildingInfo->MakeConsistent(remIt->bmm);
+            ++remIt;
+            if (++numPoints == m_maxPointsPerIteration)
+            {
+                EvaluateBatch(numPoints);
+                remIt = m_rem.begin();
+                numPoints = 0;
+            }
+        }
+    }
+    if (numPoints > 0)
+    {
+        EvaluateBatch(numPoints);
+    }
+
+    Finalize();
+}
+
+void
+RadioEnvironmentMapHelper::EvaluateBatch(size_t numPoints)
+{
+    NS_LOG_FUNCTION(this << numPoints);
+    const size_t numTx = m_transmissions.size();
+    const size_t numBands = m_bandWidths.size();
+    Ptr<SpectrumPropagationLossModel> spectrumLoss = m_channel->GetSpectrumPropagationLossModel();
+
+    // The models of the channel are not thread safe, so the gains are
+    // computed on this thread
+    m_gains.assign(numPoints * numTx, 0.0);
+    if (spectrumLoss)
+    {
+        m_rxPsds.assign(numPoints * numTx * numBands, 0.0);
+    }
+    auto remIt = m_rem.begin();
+    for (size_t i = 0; i < numPoints; ++i, ++remIt)
+    {
+        for (size_t j = 0; j < numTx; ++j)
+        {
+            double gain = CalcPathGain(m_transmissions[j], remIt->bmm);
+            if (spectrumLoss && gain > 0)
+            {
+                Ptr<SpectrumSignalParameters> rxParams = m_transmissions[j]->Copy();
+                rxParams->psd = Copy<SpectrumValue>(m_transmissions[j]->psd);
+                *(rxParams->psd) *= gain;
+                Ptr<SpectrumValue> rxPsd = spectrumLoss->CalcRxPowerSpectralDensity(
+                    rxParams,
+                    m_transmissions[j]->txPhy->GetMobility(),
+                    remIt->bmm);
+                std::copy(rxPsd->ConstValuesBegin(),
+                          rxPsd->ConstValuesEnd(),
+                          m_rxPsds.begin() + (i * numTx + j) * numBands);
+                gain = 1.0;
+            }
+            m_gains[i * numTx + j] = gain;
+        }
+    }
+
+    m_sinrs.resize(numPoints);
+    uint32_t numThreads = m_numThreads;
+    if (numThreads == 0)
+    {
+        numThreads = std::max(1U, std::thread::hardware_concurrency());
+    }
+    numThreads = std::min<size_t>(numThreads, numPoints);
+    std::vector<std::thread> threads;
+    for (uint32_t t = 1; t < numThreads; ++t)
+    {
+        threads.emplace_back(&RadioEnvironmentMapHelper::CalcSinrs,
+                             this,
+                             numPoints * t / numThreads,
+                             numPoints * (t + 1) / numThreads);
+    }
+    CalcSinrs(0, numPoints / numThreads);
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    remIt = m_rem.begin();
+    for (size_t i = 0; i < numPoints; ++i, ++remIt)
+    {
+        Vector pos = remIt->bmm->GetPosition();
+        NS_LOG_LOGIC("output: " << pos.x << "\t" << pos.y << "\t" << pos.z << "\t"
+                                << m_sinrs[i]);
+        m_outFile << pos.x << "\t" << pos.y << "\t" << pos.z << "\t" << m_sinrs[i] << std::endl;
+    }
+}
+
+double
+RadioEnvironmentMapHelper::CalcPathGain(Ptr<const SpectrumSignalParameters> params,
+                                        Ptr<MobilityModel> rxMobility) const
+{
+    if (m_filterPhy)
+    {
+        m_filterPhy->SetMobility(rxMobility);
+        if (m_channel->GetSpectrumTransmitFilter()->Filter(params, m_filterPhy))
+        {
+            return 0.0;
+        }
+    }
+    Ptr<MobilityModel> txMobility = params->txPhy->GetMobility();
+    if (!txMobility)
+    {
+        return 1.0;
+    }
+
+    double pathLossDb = 0.0;
+    if (params->txAntenna)
+    {
+        Angles txAngles(rxMobility->GetPosition(), txMobility->GetPosition());
+        pathLossDb -= params->txAntenna->GetGainDb(txAngles);
+    }
+    Ptr<PropagationLossModel> propagationLoss = m_channel->GetPropagationLossModel();
+    if (propagationLoss)
+    {
+        pathLossDb -= propagationLoss->CalcRxPower(0, txMobility, rxMobility);
+    }
+    if (pathLossDb > m_maxLossDb)
+    {
+        // beyond range
+        return 0.0;
+    }
+    return std::pow(10.0, (-pathLossDb) / 10.0);
+}
+
+void
+RadioEnvironmentMapHelper::CalcSinrs(size_t begin, size_t end)
+{
+    const size_t numTx = m_transmissions.size();
+    const size_t numBands = m_bandWidths.size();
+    const bool hasRxPsds = !m_rxPsds.empty();
+
+    for (size_t i = begin; i < end; ++i)
+    {
+        // The same computation as the one of RemSpectrumPhy on the received PSDs
+        double referenceSignalPower = 0;
+        double sumPower = 0;
+        for (size_t j = 0; j < numTx; ++j)
+        {
+            const double gain = m_gains[i * numTx + j];
+            if (gain == 0)
+            {
+                continue;
+            }
+            const double* psd = hasRxPsds ? &m_rxPsds[(i * numTx + j) * numBands]
+                                          : &m_txPsds[j * numBands];
+            double power = 0;
+            if (m_rbId >= 0)
+            {
+                power = (psd[m_rbId] * gain) * 180000;
+            }
+            else
+            {
+                for (size_t k = 0; k < numBands; ++k)
+                {
+                    power += (psd[k] * gain) * m_bandWidths[k];
+                }
+            }
+            sumPower += power;
+            referenceSignalPower = std::max(referenceSignalPower, power);
+        }
+        m_sinrs[i] = referenceSignalPower / (sumPower - referenceSignalPower + m_noisePower);
+    }
+}
+
 void
 RadioEnvironmentMapHelper::Finalize()
 {
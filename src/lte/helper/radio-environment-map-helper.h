@@ -23,6 +23,8 @@
 #include <ns3/object.h>
 
 #include <fstream>
+#include <list>
+#include <vector>
 
 namespace ns3
 {
@@ -31,6 +33,7 @@ class RemSpectrumPhy;
 class Node;
 class NetDevice;
 class SpectrumChannel;
+class SpectrumSignalParameters;
 // class BuildingsMobilityModel;
 class MobilityModel;
 
@@ -40,6 +43,13 @@ class MobilityModel;
  * Generates a 2D map of the SINR from the strongest transmitter in the
  * downlink of an LTE FDD system. For instructions on usage, please refer to
  * the User Documentation.
+ *
+ * By default, the map is measured by RemSpectrumPhy listeners attached to
+ * the channel. With the `DirectEvaluation` attribute, the transmissions of
+ * one subframe are recorded instead, and the SINR of the points is computed
+ * directly from them, in batches of `MaxPointsPerIteration` points. The path
+ * gains are computed by the models of the channel on the simulator thread,
+ * while the received PSDs are accumulated by `NumThreads` threads.
  */
 class RadioEnvironmentMapHelper : public Object
 {
@@ -101,6 +111,52 @@ class RadioEnvironmentMapHelper : public Object
     /// Go through every listener, write the computed SINR, and then reset it.
     void PrintAndReset();
 
+    /**
+     * Record a transmission on the channel, if it is of the kind of frame
+     * for which the map is generated. Connected to the `TxSigParams` trace
+     * source of the channel when the `DirectEvaluation` attribute is set.
+     *
+     * \param params the parameters of the transmitted signal
+     */
+    void RecordTransmission(Ptr<SpectrumSignalParameters> params);
+
+    /**
+     * Scheduled by DelayedInstall() when the `DirectEvaluation` attribute is
+     * set, after the transmissions of one subframe have been recorded.
+     * Evaluates all the points of the map, in batches of at most
+     * `MaxPointsPerIteration` points, and then calls Finalize().
+     */
+    void RunDirectEvaluation();
+
+    /**
+     * Evaluate the SINR of a batch of points, placed on the first listeners
+     * of the list, and write it to the output file.
+     *
+     * \param numPoints the number of points of the batch
+     */
+    void EvaluateBatch(size_t numPoints);
+
+    /**
+     * Compute the path gain between a transmitter and a point, as the
+     * channel does for a receiver without antenna.
+     *
+     * \param params the parameters of the transmitted signal
+     * \param rxMobility the position of the point
+     * \return the path gain (linear), or 0 if the signal does not reach the point
+     */
+    double CalcPathGain(Ptr<const SpectrumSignalParameters> params,
+                        Ptr<MobilityModel> rxMobility) const;
+
+    /**
+     * Compute the SINR of a range of points of the current batch from the
+     * path gains and the received PSDs. Called by several threads at the
+     * same time, on disjoint ranges.
+     *
+     * \param begin the index of the first point
+     * \param end the index after the last point
+     */
+    void CalcSinrs(size_t begin, size_t end);
+
     /// Called when the map generation procedure has been completed.
     void Finalize();
 
@@ -159,6 +215,30 @@ class RadioEnvironmentMapHelper : public Object
     bool m_useDataChannel; ///< The `UseDataChannel` attribute.
     int32_t m_rbId;        ///< The `RbId` attribute.
 
+    bool m_directEvaluation; ///< The `DirectEvaluation` attribute.
+    uint32_t m_numThreads;   ///< The `NumThreads` attribute.
+
+    /// Listener used to apply the transmit filter of the channel to the points.
+    Ptr<RemSpectrumPhy> m_filterPhy;
+    /// The `MaxLossDb` attribute of the channel, read once for the direct evaluation.
+    double m_maxLossDb;
+    /// Transmissions recorded for the direct evaluation, in the order of the channel.
+    std::vector<Ptr<SpectrumSignalParameters>> m_transmissions;
+    /// Width of the bands of the spectrum model of the map.
+    std::vector<double> m_bandWidths;
+    /// Transmitted PSDs on the spectrum model of the map, by transmission and band.
+    std::vector<double> m_txPsds;
+    /// Path gains of the current batch, by point and transmission.
+    std::vector<double> m_gains;
+    /**
+     * Received PSDs of the current batch, by point, transmission and band.
+     * Only used if the channel has a SpectrumPropagationLossModel; the PSDs
+     * then include the path gain, and the gains are 1.
+     */
+    std::vector<double> m_rxPsds;
+    /// SINR of the points of the current batch.
+    std::vector<double> m_sinrs;
+
 }; // end of `class RadioEnvironmentMapHelper`
 
 } // namespace ns3
@@ -24,6 +24,7 @@
 #define CQA_FF_MAC_SCHEDULER_H
 
 #include "ff-mac-csched-sap.h"
+#include "ff-mac-rnti-map.h"
 #include "ff-mac-sched-sap.h"
 #include "ff-mac-scheduler.h"
 #include "lte-amc.h"
@@ -285,12 +286,12 @@ class CqaFfMacScheduler : public FfMacScheduler
     /**
      * Map of UE statistics (per RNTI basis) in downlink
      */
-    std::map<uint16_t, CqasFlowPerf_t> m_flowStatsDl;
+    FfMacRntiMap<CqasFlowPerf_t> m_flowStatsDl;
 
     /**
      * Map of UE statistics (per RNTI basis)
      */
-    std::map<uint16_t, CqasFlowPerf_t> m_flowStatsUl;
+    FfMacRntiMap<CqasFlowPerf_t> m_flowStatsUl;
 
     /**
      * Map of UE logical channel config list
@@ -300,22 +301,22 @@ class CqaFfMacScheduler : public FfMacScheduler
     /**
      * Map of UE's DL CQI P01 received
      */
-    std::map<uint16_t, uint8_t> m_p10CqiRxed;
+    FfMacRntiMap<uint8_t> m_p10CqiRxed;
 
     /**
      * Map of UE's timers on DL CQI P01 received
      */
-    std::map<uint16_t, uint32_t> m_p10CqiTimers;
+    FfMacRntiMap<uint32_t> m_p10CqiTimers;
 
     /**
      * Map of UE's DL CQI A30 received
      */
-    std::map<uint16_t, SbMeasResult_s> m_a30CqiRxed;
+    FfMacRntiMap<SbMeasResult_s> m_a30CqiRxed;
 
     /**
      * Map of UE's timers on DL CQI A30 received
      */
-    std::map<uint16_t, uint32_t> m_a30CqiTimers;
+    FfMacRntiMap<uint32_t> m_a30CqiTimers;
 
     /**
      * Map of previous allocated UE per RBG
@@ -326,17 +327,17 @@ class CqaFfMacScheduler : public FfMacScheduler
     /**
      * Map of UEs' UL-CQI per RBG
      */
-    std::map<uint16_t, std::vector<double>> m_ueCqi;
+    FfMacRntiMap<std::vector<double>> m_ueCqi;
 
     /**
      * Map of UEs' timers on UL-CQI per RBG
      */
-    std::map<uint16_t, uint32_t> m_ueCqiTimers;
+    FfMacRntiMap<uint32_t> m_ueCqiTimers;
 
     /**
      * Map of UE's buffer status reports received
      */
-    std::map<uint16_t, uint32_t> m_ceBsrRxed;
+    FfMacRntiMap<uint32_t> m_ceBsrRxed;
 
     // MAC SAPs
     FfMacCschedSapUser* m_cschedSapUser;         ///< MAC Csched SAP user
@@ -357,29 +358,28 @@ class CqaFfMacScheduler : public FfMacScheduler
 
     uint32_t m_cqiTimersThreshold; ///< # of TTIs for which a CQI can be considered valid
 
-    std::map<uint16_t, uint8_t> m_uesTxMode; ///< txMode of the UEs
+    FfMacRntiMap<uint8_t> m_uesTxMode; ///< txMode of the UEs
 
     // HARQ attributes
     bool m_harqOn; ///< m_harqOn when false inhibit the HARQ mechanisms (by default active)
-    std::map<uint16_t, uint8_t> m_dlHarqCurrentProcessId; ///< DL HARQ process ID
+    FfMacRntiMap<uint8_t> m_dlHarqCurrentProcessId; ///< DL HARQ process ID
     // HARQ status
     //  0: process Id available
     //  x>0: process Id equal to `x` transmission count
-    std::map<uint16_t, DlHarqProcessesStatus_t>
-        m_dlHarqProcessesStatus;                                       ///< DL HARQ process statuses
-    std::map<uint16_t, DlHarqProcessesTimer_t> m_dlHarqProcessesTimer; ///< DL HARQ process timers
-    std::map<uint16_t, DlHarqProcessesDciBuffer_t>
+    FfMacRntiMap<DlHarqProcessesStatus_t> m_dlHarqProcessesStatus; ///< DL HARQ process statuses
+    FfMacRntiMap<DlHarqProcessesTimer_t> m_dlHarqProcessesTimer;   ///< DL HARQ process timers
+    FfMacRntiMap<DlHarqProcessesDciBuffer_t>
         m_dlHarqProcessesDciBuffer; ///< DL HARQ process DCI buffer
-    std::map<uint16_t, DlHarqRlcPduListBuffer_t>
+    FfMacRntiMap<DlHarqRlcPduListBuffer_t>
         m_dlHarqProcessesRlcPduListBuffer;                 ///< DL HARQ process RLC PDU list buffer
     std::vector<DlInfoListElement_s> m_dlInfoListBuffered; ///< DL HARQ retx buffered
 
-    std::map<uint16_t, uint8_t> m_ulHarqCurrentProcessId; ///< UL HARQ current process ID
+    FfMacRntiMap<uint8_t> m_ulHarqCurrentProcessId; ///< UL HARQ current process ID
     // HARQ status
     //  0: process Id available
     //  x>0: process Id equal to `x` transmission count
-    std::map<uint16_t, UlHarqProcessesStatus_t> m_ulHarqProcessesStatus; ///< UL HARQ process status
-    std::map<uint16_t, UlHarqProcessesDciBuffer_t>
+    FfMacRntiMap<UlHarqProcessesStatus_t> m_ulHarqProcessesStatus; ///< UL HARQ process status
+    FfMacRntiMap<UlHarqProcessesDciBuffer_t>
         m_ulHarqProcessesDciBuffer; ///< UL HARQ process DCI buffer
 
     // RACH attributes
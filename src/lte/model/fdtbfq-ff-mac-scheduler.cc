@@ -393,7 +393,8 @@ unsigned int
 FdTbfqFfMacScheduler::LcActivePerFlow(uint16_t rnti)
 {
     unsigned int lcActive = 0;
-    for (auto it = m_rlcBufferReq.begin(); it != m_rlcBufferReq.end(); it++)
+    for (auto it = m_rlcBufferReq.lower_bound(LteFlowId_t(rnti, 0)); it != m_rlcBufferReq.end();
+         it++)
     {
         if (((*it).first.m_rnti == rnti) && (((*it).second.m_rlcTransmissionQueueSize > 0) ||
                                              ((*it).second.m_rlcRetransmissionQueueSize > 0) ||
@@ -990,7 +991,7 @@ FdTbfqFfMacScheduler::DoSchedDlTriggerReq(
     while (totalRbg < rbgNum)
     {
         // select UE with largest metric
-        std::map<uint16_t, fdtbfqsFlowPerf_t>::iterator it;
+        FfMacRntiMap<fdtbfqsFlowPerf_t>::iterator it;
         auto itMax = m_flowStatsDl.end();
         double metricMax = 0.0;
         bool firstRnti = true;
@@ -1106,13 +1107,11 @@ FdTbfqFfMacScheduler::DoSchedDlTriggerReq(
             // calculate rlc buffer size
             uint32_t rlcBufSize = 0;
             uint8_t lcid = 0;
-            for (auto itRlcBuf = m_rlcBufferReq.begin(); itRlcBuf != m_rlcBufferReq.end();
+            for (auto itRlcBuf = m_rlcBufferReq.lower_bound(LteFlowId_t((*itMax).first, 0));
+                 itRlcBuf != m_rlcBufferReq.end() && (*itRlcBuf).first.m_rnti == (*itMax).first;
                  itRlcBuf++)
             {
-                if ((*itRlcBuf).first.m_rnti == (*itMax).first)
-                {
-                    lcid = (*itRlcBuf).first.m_lcId;
-                }
+                lcid = (*itRlcBuf).first.m_lcId;
             }
             LteFlowId_t flow((*itMax).first, lcid);
             auto itRlcBuf = m_rlcBufferReq.find(flow);
@@ -1458,12 +1457,13 @@ FdTbfqFfMacScheduler::DoSchedDlTriggerReq(
         newDci.m_rbBitmap = rbgMask; // (32 bit bitmap see 7.1.6 of 36.213)
 
         // create the rlc PDUs -> equally divide resources among actives LCs
-        for (auto itBufReq = m_rlcBufferReq.begin(); itBufReq != m_rlcBufferReq.end(); itBufReq++)
+        for (auto itBufReq = m_rlcBufferReq.lower_bound(LteFlowId_t((*itMap).first, 0));
+             itBufReq != m_rlcBufferReq.end() && (*itBufReq).first.m_rnti == (*itMap).first;
+             itBufReq++)
         {
-            if (((*itBufReq).first.m_rnti == (*itMap).first) &&
-                (((*itBufReq).second.m_rlcTransmissionQueueSize > 0) ||
-                 ((*itBufReq).second.m_rlcRetransmissionQueueSize > 0) ||
-                 ((*itBufReq).second.m_rlcStatusPduSize > 0)))
+            if (((*itBufReq).second.m_rlcTransmissionQueueSize > 0) ||
+                ((*itBufReq).second.m_rlcRetransmissionQueueSize > 0) ||
+                ((*itBufReq).second.m_rlcStatusPduSize > 0))
             {
                 std::vector<RlcPduListElement_s> newRlcPduLe;
                 for (uint8_t j = 0; j < nLayer; j++)
@@ -1758,7 +1758,7 @@ FdTbfqFfMacScheduler::DoSchedUlTriggerReq(
         }
     }
 
-    std::map<uint16_t, uint32_t>::iterator it;
+    FfMacRntiMap<uint32_t>::iterator it;
     int nflows = 0;
 
     for (it = m_ceBsrRxed.begin(); it != m_ceBsrRxed.end(); it++)
@@ -2232,9 +2232,7 @@ FdTbfqFfMacScheduler::RefreshDlCqiMaps()
                           " Does not find CQI report for user " << (*itP10).first);
             NS_LOG_INFO(this << " P10-CQI expired for user " << (*itP10).first);
             m_p10CqiRxed.erase(itMap);
-            auto temp = itP10;
-            itP10++;
-            m_p10CqiTimers.erase(temp);
+            itP10 = m_p10CqiTimers.erase(itP10);
         }
         else
         {
@@ -2257,9 +2255,7 @@ FdTbfqFfMacScheduler::RefreshDlCqiMaps()
                           " Does not find CQI report for user " << (*itA30).first);
             NS_LOG_INFO(this << " A30-CQI expired for user " << (*itA30).first);
             m_a30CqiRxed.erase(itMap);
-            auto temp = itA30;
-            itA30++;
-            m_a30CqiTimers.erase(temp);
+            itA30 = m_a30CqiTimers.erase(itA30);
         }
         else
         {
@@ -2287,9 +2283,7 @@ FdTbfqFfMacScheduler::RefreshUlCqiMaps()
             NS_LOG_INFO(this << " UL-CQI exired for user " << (*itUl).first);
             (*itMap).second.clear();
             m_ueCqi.erase(itMap);
-            auto temp = itUl;
-            itUl++;
-            m_ueCqiTimers.erase(temp);
+            itUl = m_ueCqiTimers.erase(itUl);
         }
         else
         {
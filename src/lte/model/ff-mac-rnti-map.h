@@ -0,0 +1,292 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef FF_MAC_RNTI_MAP_H
+#define FF_MAC_RNTI_MAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup lte
+ *
+ * Dense table holding a piece of per-UE state of a MAC scheduler, keyed by RNTI.
+ *
+ * The FemtoForum MAC schedulers keep each piece of per-UE state (CQI reports and
+ * their timers, HARQ processes, flow statistics, BSRs, ...) in a separate table
+ * that is looked up for every UE at every TTI. This class provides the subset of
+ * the std::map interface used by the schedulers, with a layout suited to these
+ * lookups: the elements are stored contiguously in increasing order of RNTI, so
+ * that they are iterated in the same order as in a std::map, and an index
+ * indexed by RNTI holds the position of the element of each UE, so that the
+ * element of a UE is found in constant time.
+ *
+ * Unlike with a std::map, inserting or erasing an element invalidates the
+ * iterators and the references to the elements that follow it, hence elements
+ * must be erased while iterating over the table as in:
+ *
+ * \code
+ *   for (auto it = map.begin(); it != map.end();)
+ *   {
+ *       it = expired ? map.erase(it) : std::next(it);
+ *   }
+ * \endcode
+ *
+ * As RNTIs are allocated in increasing order by the eNB RRC, new UEs are
+ * appended to the table in most cases.
+ *
+ * \tparam T the type of the per-UE state
+ */
+template <class T>
+class FfMacRntiMap
+{
+  public:
+    using key_type = uint16_t;                                         //!< the key type
+    using mapped_type = T;                                             //!< the mapped type
+    using value_type = std::pair<uint16_t, T>;                         //!< the value type
+    using size_type = std::size_t;                                     //!< the size type
+    using iterator = typename std::vector<value_type>::iterator;       //!< iterator
+    using const_iterator = typename std::vector<value_type>::const_iterator; //!< const iterator
+
+    /// \return an iterator to the element with the lowest RNTI
+    iterator begin() noexcept
+    {
+        return m_elements.begin();
+    }
+
+    /// \return a const iterator to the element with the lowest RNTI
+    const_iterator begin() const noexcept
+    {
+        return m_elements.begin();
+    }
+
+    /// \return an iterator past the element with the highest RNTI
+    iterator end() noexcept
+    {
+        return m_elements.end();
+    }
+
+    /// \return a const iterator past the element with the highest RNTI
+    const_iterator end() const noexcept
+    {
+        return m_elements.end();
+    }
+
+    /// \return whether the table is empty
+    bool empty() const noexcept
+    {
+        return m_elements.empty();
+    }
+
+    /// \return the number of elements in the table
+    size_type size() const noexcept
+    {
+        return m_elements.size();
+    }
+
+    /// Remove all the elements from the table
+    void clear() noexcept
+    {
+        m_elements.clear();
+        m_index.clear();
+    }
+
+    /**
+     * \param rnti the RNTI
+     * \return an iterator to the element of the given RNTI, or end() if there is none
+     */
+    iterator find(uint16_t rnti)
+    {
+        auto pos = GetPosition(rnti);
+        return pos < m_elements.size() ? m_elements.begin() + pos : m_elements.end();
+    }
+
+    /**
+     * \param rnti the RNTI
+     * \return a const iterator to the element of the given RNTI, or end() if there is none
+     */
+    const_iterator find(uint16_t rnti) const
+    {
+        auto pos = GetPosition(rnti);
+        return pos < m_elements.size() ? m_elements.begin() + pos : m_elements.end();
+    }
+
+    /**
+     * \param rnti the RNTI
+     * \return the number (0 or 1) of elements of the given RNTI
+     */
+    size_type count(uint16_t rnti) const
+    {
+        return GetPosition(rnti) < m_elements.size() ? 1 : 0;
+    }
+
+    /**
+     * \param rnti the RNTI
+     * \return a reference to the state of the given RNTI
+     * \throw std::out_of_range if there is no element of the given RNTI
+     */
+    T& at(uint16_t rnti)
+    {
+        auto it = find(rnti);
+        if (it == end())
+        {
+            throw std::out_of_range("No element for the given RNTI");
+        }
+        return it->second;
+    }
+
+    /**
+     * \param rnti the RNTI
+     * \return a const reference to the state of the given RNTI
+     * \throw std::out_of_range if there is no element of the given RNTI
+     */
+    const T& at(uint16_t rnti) const
+    {
+        auto it = find(rnti);
+        if (it == end())
+        {
+            throw std::out_of_range("No element for the given RNTI");
+        }
+        return it->second;
+    }
+
+    /**
+     * \param rnti the RNTI
+     * \return a reference to the state of the given RNTI, which is value-initialized
+     *         if there was no element of the given RNTI
+     */
+    T& operator[](uint16_t rnti)
+    {
+        return try_emplace(rnti).first->second;
+    }
+
+    /**
+     * Insert an element, unless the table already has an element with the same RNTI.
+     *
+     * \tparam P the type of the RNTI-state pair
+     * \param value the RNTI-state pair
+     * \return an iterator to the element of the RNTI and whether the element was inserted
+     */
+    template <class P>
+    std::pair<iterator, bool> insert(P&& value)
+    {
+        return try_emplace(value.first, std::forward<P>(value).second);
+    }
+
+    /**
+     * Construct an element in place, unless the table already has an element with
+     * the given RNTI.
+     *
+     * \tparam Args the types of the arguments of the constructor of the state
+     * \param rnti the RNTI
+     * \param args the arguments of the constructor of the state
+     * \return an iterator to the element of the RNTI and whether the element was inserted
+     */
+    template <class... Args>
+    std::pair<iterator, bool> try_emplace(uint16_t rnti, Args&&... args)
+    {
+        if (auto pos = GetPosition(rnti); pos < m_elements.size())
+        {
+            return {m_elements.begin() + pos, false};
+        }
+        if (rnti >= m_index.size())
+        {
+            m_index.resize(rnti + 1, NO_ELEMENT);
+        }
+        auto it = m_elements.end();
+        if (!m_elements.empty() && m_elements.back().first > rnti)
+        {
+            it = std::lower_bound(m_elements.begin(),
+                                 m_elements.end(),
+                                 rnti,
+                                 [](const value_type& a, uint16_t b) { return a.first < b; });
+        }
+        it = m_elements.emplace(it,
+                                std::piecewise_construct,
+                                std::forward_as_tuple(rnti),
+                                std::forward_as_tuple(std::forward<Args>(args)...));
+        UpdateIndex(it - m_elements.begin());
+        return {it, true};
+    }
+
+    /**
+     * \param pos an iterator to the element to remove
+     * \return an iterator to the element following the removed one
+     */
+    iterator erase(const_iterator pos)
+    {
+        m_index[pos->first] = NO_ELEMENT;
+        auto it = m_elements.erase(pos);
+        UpdateIndex(it - m_elements.begin());
+        return it;
+    }
+
+    /**
+     * \param rnti the RNTI
+     * \return the number (0 or 1) of elements removed
+     */
+    size_type erase(uint16_t rnti)
+    {
+        auto it = find(rnti);
+        if (it == end())
+        {
+            return 0;
+        }
+        erase(it);
+        return 1;
+    }
+
+  private:
+    /// value of the index for the RNTIs that have no element
+    static constexpr uint32_t NO_ELEMENT = UINT32_MAX;
+
+    /**
+     * \param rnti the RNTI
+     * \return the position of the element of the given RNTI, or NO_ELEMENT if there is none
+     */
+    std::size_t GetPosition(uint16_t rnti) const
+    {
+        return rnti < m_index.size() ? m_index[rnti] : NO_ELEMENT;
+    }
+
+    /**
+     * Update the index of the elements from the given position to the end of the table,
+     * after that an element has been inserted or erased at that position.
+     *
+     * \param from the position of the first element to update
+     */
+    void UpdateIndex(std::size_t from)
+    {
+        for (auto pos = from; pos < m_elements.size(); ++pos)
+        {
+            m_index[m_elements[pos].first] = pos;
+        }
+    }
+
+    std::vector<value_type> m_elements; //!< the elements, in increasing order of RNTI
+    std::vector<uint32_t> m_index;      //!< the position of the element of each RNTI
+};
+
+} // namespace ns3
+
+#endif /* FF_MAC_RNTI_MAP_H */
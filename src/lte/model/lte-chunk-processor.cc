@@ -50,7 +50,11 @@ void
 LteChunkProcessor::Start()
 {
     NS_LOG_FUNCTION(this);
-    m_sumValues = nullptr;
+    if (m_sumValues)
+    {
+        // reuse the buffer of the previous calculation
+        (*m_sumValues) = 0.0;
+    }
     m_totDuration = MicroSeconds(0);
 }
 
@@ -58,11 +62,17 @@ void
 LteChunkProcessor::EvaluateChunk(const SpectrumValue& sinr, Time duration)
 {
     NS_LOG_FUNCTION(this << sinr << duration);
-    if (!m_sumValues)
+    if (!m_sumValues || m_sumValues->GetSpectrumModel() != sinr.GetSpectrumModel())
     {
         m_sumValues = Create<SpectrumValue>(sinr.GetSpectrumModel());
     }
-    (*m_sumValues) += sinr * duration.GetSeconds();
+    // accumulate the weighted values in place, without building a temporary SpectrumValue
+    double seconds = duration.GetSeconds();
+    auto itSum = m_sumValues->ValuesBegin();
+    for (auto it = sinr.ConstValuesBegin(); it != sinr.ConstValuesEnd(); ++it, ++itSum)
+    {
+        *itSum += *it * seconds;
+    }
     m_totDuration += duration;
 }
 
@@ -72,11 +82,13 @@ LteChunkProcessor::End()
     NS_LOG_FUNCTION(this);
     if (m_totDuration.GetSeconds() > 0)
     {
+        // the sum is turned into the average in place, it is reset by the next Start()
+        (*m_sumValues) /= m_totDuration.GetSeconds();
         for (auto it = m_lteChunkProcessorCallbacks.begin();
              it != m_lteChunkProcessorCallbacks.end();
              it++)
         {
-            (*it)((*m_sumValues) / m_totDuration.GetSeconds());
+            (*it)(*m_sumValues);
         }
     }
     else
@@ -22,6 +22,7 @@
 #define LTE_FFR_ALGORITHM_H
 
 #include "epc-x2-sap.h"
+#include "ff-mac-rnti-map.h"
 #include "ff-mac-sched-sap.h"
 #include "lte-rrc-sap.h"
 
@@ -192,7 +193,7 @@ class LteFfrAlgorithm : public Object
      * \param ulCqiMap
      *
      */
-    virtual void DoReportUlCqiInfo(std::map<uint16_t, std::vector<double>> ulCqiMap) = 0;
+    virtual void DoReportUlCqiInfo(const FfMacRntiMap<std::vector<double>>& ulCqiMap) = 0;
 
     /**
      * \brief DoGetTpc for UE
@@ -321,7 +321,7 @@ LteFfrDistributedAlgorithm::DoReportUlCqiInfo(
 }
 
 void
-LteFfrDistributedAlgorithm::DoReportUlCqiInfo(std::map<uint16_t, std::vector<double>> ulCqiMap)
+LteFfrDistributedAlgorithm::DoReportUlCqiInfo(const FfMacRntiMap<std::vector<double>>& ulCqiMap)
 {
     NS_LOG_FUNCTION(this);
     NS_LOG_WARN("Method should not be called, because it is empty");
@@ -72,7 +72,7 @@ class LteFfrDistributedAlgorithm : public LteFfrAlgorithm
         const FfMacSchedSapProvider::SchedDlCqiInfoReqParameters& params) override;
     void DoReportUlCqiInfo(
         const FfMacSchedSapProvider::SchedUlCqiInfoReqParameters& params) override;
-    void DoReportUlCqiInfo(std::map<uint16_t, std::vector<double>> ulCqiMap) override;
+    void DoReportUlCqiInfo(const FfMacRntiMap<std::vector<double>>& ulCqiMap) override;
     uint8_t DoGetTpc(uint16_t rnti) override;
     uint16_t DoGetMinContinuousUlBandwidth() override;
 
@@ -779,7 +779,7 @@ LteFfrEnhancedAlgorithm::DoReportUlCqiInfo(
 }
 
 void
-LteFfrEnhancedAlgorithm::DoReportUlCqiInfo(std::map<uint16_t, std::vector<double>> ulCqiMap)
+LteFfrEnhancedAlgorithm::DoReportUlCqiInfo(const FfMacRntiMap<std::vector<double>>& ulCqiMap)
 {
     NS_LOG_FUNCTION(this);
     NS_LOG_WARN("Method should not be called, because it is empty");
@@ -788,7 +788,7 @@ LteFfrEnhancedAlgorithm::DoReportUlCqiInfo(std::map<uint16_t, std::vector<double
 double
 LteFfrEnhancedAlgorithm::EstimateUlSinr(uint16_t rnti,
                                         uint16_t rb,
-                                        std::map<uint16_t, std::vector<double>> ulCqiMap)
+                                        const FfMacRntiMap<std::vector<double>>& ulCqiMap)
 {
     auto itCqi = ulCqiMap.find(rnti);
     if (itCqi == ulCqiMap.end())
@@ -810,10 +810,7 @@ LteFfrEnhancedAlgorithm::EstimateUlSinr(uint16_t rnti,
                 sinrNum++;
             }
         }
-        double estimatedSinr = (sinrNum > 0) ? (sinrSum / sinrNum) : DBL_MAX;
-        // store the value
-        (*itCqi).second.at(rb) = estimatedSinr;
-        return estimatedSinr;
+        return (sinrNum > 0) ? (sinrSum / sinrNum) : DBL_MAX;
     }
 }
 
@@ -81,7 +81,7 @@ class LteFfrEnhancedAlgorithm : public LteFfrAlgorithm
         const FfMacSchedSapProvider::SchedDlCqiInfoReqParameters& params) override;
     void DoReportUlCqiInfo(
         const FfMacSchedSapProvider::SchedUlCqiInfoReqParameters& params) override;
-    void DoReportUlCqiInfo(std::map<uint16_t, std::vector<double>> ulCqiMap) override;
+    void DoReportUlCqiInfo(const FfMacRntiMap<std::vector<double>>& ulCqiMap) override;
     uint8_t DoGetTpc(uint16_t rnti) override;
     uint16_t DoGetMinContinuousUlBandwidth() override;
 
@@ -123,7 +123,7 @@ class LteFfrEnhancedAlgorithm : public LteFfrAlgorithm
      */
     double EstimateUlSinr(uint16_t rnti,
                           uint16_t rb,
-                          std::map<uint16_t, std::vector<double>> ulCqiMap);
+                          const FfMacRntiMap<std::vector<double>>& ulCqiMap);
     /**
      * Get CQI from spectral efficiency
      *
@@ -21,6 +21,7 @@
 #ifndef LTE_FFR_SAP_H
 #define LTE_FFR_SAP_H
 
+#include "ff-mac-rnti-map.h"
 #include "ff-mac-sched-sap.h"
 
 #include <map>
@@ -113,7 +114,7 @@ class LteFfrSapProvider
      * \brief ReportUlCqiInfo
      * \param ulCqiMap the UL CQI map
      */
-    virtual void ReportUlCqiInfo(std::map<uint16_t, std::vector<double>> ulCqiMap) = 0;
+    virtual void ReportUlCqiInfo(const FfMacRntiMap<std::vector<double>>& ulCqiMap) = 0;
 
     /**
      * \brief GetTpc
@@ -169,7 +170,7 @@ class MemberLteFfrSapProvider : public LteFfrSapProvider
     bool IsUlRbgAvailableForUe(int i, uint16_t rnti) override;
     void ReportDlCqiInfo(const FfMacSchedSapProvider::SchedDlCqiInfoReqParameters& params) override;
     void ReportUlCqiInfo(const FfMacSchedSapProvider::SchedUlCqiInfoReqParameters& params) override;
-    void ReportUlCqiInfo(std::map<uint16_t, std::vector<double>> ulCqiMap) override;
+    void ReportUlCqiInfo(const FfMacRntiMap<std::vector<double>>& ulCqiMap) override;
     uint8_t GetTpc(uint16_t rnti) override;
     uint16_t GetMinContinuousUlBandwidth() override;
 
@@ -230,7 +231,7 @@ MemberLteFfrSapProvider<C>::ReportUlCqiInfo(
 
 template <class C>
 void
-MemberLteFfrSapProvider<C>::ReportUlCqiInfo(std::map<uint16_t, std::vector<double>> ulCqiMap)
+MemberLteFfrSapProvider<C>::ReportUlCqiInfo(const FfMacRntiMap<std::vector<double>>& ulCqiMap)
 {
     m_owner->DoReportUlCqiInfo(ulCqiMap);
 }
@@ -536,7 +536,7 @@ LteFfrSoftAlgorithm::DoReportUlCqiInfo(
 }
 
 void
-LteFfrSoftAlgorithm::DoReportUlCqiInfo(std::map<uint16_t, std::vector<double>> ulCqiMap)
+LteFfrSoftAlgorithm::DoReportUlCqiInfo(const FfMacRntiMap<std::vector<double>>& ulCqiMap)
 {
     NS_LOG_FUNCTION(this);
     NS_LOG_WARN("Method should not be called, because it is empty");
@@ -152,7 +152,7 @@ LteFrNoOpAlgorithm::DoReportUlCqiInfo(
 }
 
 void
-LteFrNoOpAlgorithm::DoReportUlCqiInfo(std::map<uint16_t, std::vector<double>> ulCqiMap)
+LteFrNoOpAlgorithm::DoReportUlCqiInfo(const FfMacRntiMap<std::vector<double>>& ulCqiMap)
 {
     NS_LOG_FUNCTION(this);
     NS_LOG_WARN("Method should not be called, because it is empty");
@@ -21,14 +21,19 @@
 
 #include "lte-chunk-processor.h"
 
+#include <ns3/boolean.h>
 #include <ns3/log.h>
 #include <ns3/simulator.h>
 
+#include <algorithm>
+
 namespace ns3
 {
 
 NS_LOG_COMPONENT_DEFINE("LteInterference");
 
+NS_OBJECT_ENSURE_REGISTERED(LteInterference);
+
 LteInterference::LteInterference()
     : m_receiving(false),
       m_lastSignalId(0),
@@ -52,13 +57,28 @@ LteInterference::DoDispose()
     m_rxSignal = nullptr;
     m_allSignals = nullptr;
     m_noise = nullptr;
+    m_interf = nullptr;
+    m_sinr = nullptr;
+    m_signalEnds.clear();
     Object::DoDispose();
 }
 
 TypeId
 LteInterference::GetTypeId()
 {
-    static TypeId tid = TypeId("ns3::LteInterference").SetParent<Object>().SetGroupName("Lte");
+    static TypeId tid =
+        TypeId("ns3::LteInterference")
+            .SetParent<Object>()
+            .SetGroupName("Lte")
+            .AddAttribute("LazyChunkEvaluation",
+                          "If true, the end of the incoming signals is not scheduled as an "
+                          "event; the signals that have ended are subtracted, and the "
+                          "corresponding chunks evaluated, when the next signal is added "
+                          "or the reception ends. Not supported by NrInterference, which "
+                          "overrides the chunk evaluation.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&LteInterference::m_lazyChunkEvaluation),
+                          MakeBooleanChecker());
     return tid;
 }
 
@@ -69,7 +89,16 @@ LteInterference::StartRx(Ptr<const SpectrumValue> rxPsd)
     if (!m_receiving)
     {
         NS_LOG_LOGIC("first signal");
-        m_rxSignal = rxPsd->Copy();
+        SubtractEndedSignals();
+        if (m_rxSignal)
+        {
+            // reuse the buffer of the previous reception
+            *m_rxSignal = *rxPsd;
+        }
+        else
+        {
+            m_rxSignal = rxPsd->Copy();
+        }
         m_lastChangeTime = Now();
         m_receiving = true;
         for (auto it = m_rsPowerChunkProcessorList.begin(); it != m_rsPowerChunkProcessorList.end();
@@ -108,6 +137,7 @@ LteInterference::EndRx()
     }
     else
     {
+        SubtractEndedSignals();
         ConditionallyEvaluateChunk();
         m_receiving = false;
         for (auto it = m_rsPowerChunkProcessorList.begin(); it != m_rsPowerChunkProcessorList.end();
@@ -142,13 +172,22 @@ LteInterference::AddSignal(Ptr<const SpectrumValue> spd, const Time duration)
         // boundary further.
         m_lastSignalIdBeforeReset += 0x10000000;
     }
-    Simulator::Schedule(duration, &LteInterference::DoSubtractSignal, this, spd, signalId);
+    if (m_lazyChunkEvaluation)
+    {
+        m_signalEnds.push_back({Now() + duration, spd});
+        std::push_heap(m_signalEnds.begin(), m_signalEnds.end(), &SignalEndsAfter);
+    }
+    else
+    {
+        Simulator::Schedule(duration, &LteInterference::DoSubtractSignal, this, spd, signalId);
+    }
 }
 
 void
 LteInterference::DoAddSignal(Ptr<const SpectrumValue> spd)
 {
     NS_LOG_FUNCTION(this << *spd);
+    SubtractEndedSignals();
     ConditionallyEvaluateChunk();
     (*m_allSignals) += (*spd);
 }
@@ -169,6 +208,29 @@ LteInterference::DoSubtractSignal(Ptr<const SpectrumValue> spd, uint32_t signalI
     }
 }
 
+bool
+LteInterference::SignalEndsAfter(const SignalEnd& a, const SignalEnd& b)
+{
+    return a.end > b.end;
+}
+
+void
+LteInterference::SubtractEndedSignals()
+{
+    NS_LOG_FUNCTION(this);
+    while (!m_signalEnds.empty() && m_signalEnds.front().end <= Now())
+    {
+        std::pop_heap(m_signalEnds.begin(), m_signalEnds.end(), &SignalEndsAfter);
+        const auto& signal = m_signalEnds.back();
+        if (m_receiving && (signal.end > m_lastChangeTime))
+        {
+            EvaluateChunk(signal.end);
+        }
+        (*m_allSignals) -= (*signal.spd);
+        m_signalEnds.pop_back();
+    }
+}
+
 void
 LteInterference::ConditionallyEvaluateChunk()
 {
@@ -180,40 +242,64 @@ LteInterference::ConditionallyEvaluateChunk()
     NS_LOG_DEBUG(this << " now " << Now() << " last " << m_lastChangeTime);
     if (m_receiving && (Now() > m_lastChangeTime))
     {
-        NS_LOG_LOGIC(this << " signal = " << *m_rxSignal << " allSignals = " << *m_allSignals
-                          << " noise = " << *m_noise);
+        EvaluateChunk(Now());
+    }
+}
 
-        SpectrumValue interf = (*m_allSignals) - (*m_rxSignal) + (*m_noise);
+void
+LteInterference::EvaluateChunk(Time end)
+{
+    NS_LOG_FUNCTION(this << end);
+    NS_LOG_LOGIC(this << " signal = " << *m_rxSignal << " allSignals = " << *m_allSignals
+                      << " noise = " << *m_noise);
 
-        SpectrumValue sinr = (*m_rxSignal) / interf;
-        Time duration = Now() - m_lastChangeTime;
-        for (auto it = m_sinrChunkProcessorList.begin(); it != m_sinrChunkProcessorList.end(); ++it)
-        {
-            (*it)->EvaluateChunk(sinr, duration);
-        }
-        for (auto it = m_interfChunkProcessorList.begin(); it != m_interfChunkProcessorList.end();
-             ++it)
-        {
-            (*it)->EvaluateChunk(interf, duration);
-        }
-        for (auto it = m_rsPowerChunkProcessorList.begin(); it != m_rsPowerChunkProcessorList.end();
-             ++it)
-        {
-            (*it)->EvaluateChunk(*m_rxSignal, duration);
-        }
-        m_lastChangeTime = Now();
+    NS_ASSERT(m_rxSignal->GetSpectrumModel() == m_allSignals->GetSpectrumModel());
+    NS_ASSERT(m_noise->GetSpectrumModel() == m_allSignals->GetSpectrumModel());
+
+    // compute the interference plus noise and the SINR in a single pass, in the
+    // buffers allocated along with m_allSignals
+    auto itAll = m_allSignals->ConstValuesBegin();
+    auto itNoise = m_noise->ConstValuesBegin();
+    auto itInterf = m_interf->ValuesBegin();
+    auto itSinr = m_sinr->ValuesBegin();
+    for (auto itRx = m_rxSignal->ConstValuesBegin(); itRx != m_rxSignal->ConstValuesEnd();
+         ++itRx, ++itAll, ++itNoise, ++itInterf, ++itSinr)
+    {
+        *itInterf = (*itAll - *itRx) + *itNoise;
+        *itSinr = *itRx / *itInterf;
+    }
+
+    Time duration = end - m_lastChangeTime;
+    for (auto it = m_sinrChunkProcessorList.begin(); it != m_sinrChunkProcessorList.end(); ++it)
+    {
+        (*it)->EvaluateChunk(*m_sinr, duration);
+    }
+    for (auto it = m_interfChunkProcessorList.begin(); it != m_interfChunkProcessorList.end(); ++it)
+    {
+        (*it)->EvaluateChunk(*m_interf, duration);
+    }
+    for (auto it = m_rsPowerChunkProcessorList.begin(); it != m_rsPowerChunkProcessorList.end();
+         ++it)
+    {
+        (*it)->EvaluateChunk(*m_rxSignal, duration);
     }
+    m_lastChangeTime = end;
 }
 
 void
 LteInterference::SetNoisePowerSpectralDensity(Ptr<const SpectrumValue> noisePsd)
 {
     NS_LOG_FUNCTION(this << *noisePsd);
+    SubtractEndedSignals();
     ConditionallyEvaluateChunk();
     m_noise = noisePsd;
     // reset m_allSignals (will reset if already set previously)
     // this is needed since this method can potentially change the SpectrumModel
     m_allSignals = Create<SpectrumValue>(noisePsd->GetSpectrumModel());
+    m_interf = Create<SpectrumValue>(noisePsd->GetSpectrumModel());
+    m_sinr = Create<SpectrumValue>(noisePsd->GetSpectrumModel());
+    // the signals that have not ended yet are not part of m_allSignals anymore
+    m_signalEnds.clear();
     if (m_receiving)
     {
         // abort rx
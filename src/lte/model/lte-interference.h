@@ -26,6 +26,7 @@
 #include <ns3/spectrum-value.h>
 
 #include <list>
+#include <vector>
 
 namespace ns3
 {
@@ -36,6 +37,14 @@ class LteChunkProcessor;
  * This class implements a gaussian interference model, i.e., all
  * incoming signals are added to the total interference.
  *
+ * By default, the end of each incoming signal is scheduled as a simulator
+ * event, which evaluates the current chunk and subtracts the signal. If the
+ * LazyChunkEvaluation attribute is set, the ends of the signals are instead
+ * kept in a heap and processed, in time order, the next time a signal is
+ * added or the reception ends, which evaluates the same chunks. In this mode,
+ * the chunks ending with a signal are evaluated by EvaluateChunk() rather than
+ * by ConditionallyEvaluateChunk(), hence subclasses that override the latter
+ * must not enable it.
  */
 class LteInterference : public Object
 {
@@ -45,7 +54,7 @@ class LteInterference : public Object
 
     /**
      * \brief Get the type ID.
-     * \return the object TypeId
+     * @return the object TypeId
      */
     static TypeId GetTypeId();
     void DoDispose() override;
@@ -127,6 +136,37 @@ class LteInterference : public Object
      */
     virtual void DoSubtractSignal(Ptr<const SpectrumValue> spd, uint32_t signalId);
 
+    /// A signal perceived in the medium, whose end has not been processed yet
+    struct SignalEnd
+    {
+        Time end;                     ///< the end of the signal
+        Ptr<const SpectrumValue> spd; ///< the power spectral density of the signal
+    };
+
+    /**
+     * Evaluate the chunk ending at the given time, i.e., compute the SINR and
+     * the interference since the last change and pass them to the chunk processors
+     *
+     * @param end the end of the chunk
+     */
+    void EvaluateChunk(Time end);
+
+    /**
+     * Subtract the signals that have ended, if chunks are evaluated lazily,
+     * evaluating the chunks that end with each of them
+     */
+    void SubtractEndedSignals();
+
+    /**
+     * Compare two signal ends, so that the heap of the signal ends has the
+     * signal that ends first at the top
+     *
+     * @param a the first signal end
+     * @param b the second signal end
+     * @return whether the first signal ends after the second one
+     */
+    static bool SignalEndsAfter(const SignalEnd& a, const SignalEnd& b);
+
     bool m_receiving{false}; ///< are we receiving?
 
     Ptr<SpectrumValue> m_rxSignal{nullptr}; /**< stores the power spectral density of
@@ -149,6 +189,17 @@ class LteInterference : public Object
     uint32_t m_lastSignalId{0};            ///< the last signal ID
     uint32_t m_lastSignalIdBeforeReset{0}; ///< the last signal ID before reset
 
+    Ptr<SpectrumValue> m_interf{nullptr}; ///< the interference plus noise of the current chunk
+    Ptr<SpectrumValue> m_sinr{nullptr};   ///< the SINR of the current chunk
+
+    bool m_lazyChunkEvaluation{false}; ///< whether the chunks are evaluated lazily
+
+    /**
+     * the signals whose end has not been processed yet, if chunks are evaluated
+     * lazily, as a min-heap on their end time
+     */
+    std::vector<SignalEnd> m_signalEnds;
+
     /** all the processor instances that need to be notified whenever
     a new interference chunk is calculated */
     std::list<Ptr<LteChunkProcessor>> m_rsPowerChunkProcessorList;
@@ -38,6 +38,7 @@ cpp_examples = [
         "True",
     ),
     ("lena-fading", "True", "True"),
+    ("lena-ff-mac-scheduler-benchmark --nUes=20 --nTtis=100", "True", "True"),
     ("lena-gtpu-tunnel", "True", "True"),
     ("lena-intercell-interference --simTime=0.1", "True", "True"),
     ("lena-pathloss-traces", "True", "True"),
@@ -80,7 +80,13 @@ LteDownlinkSinrTestSuite::LteDownlinkSinrTestSuite()
     (*theoreticalSinr1)[0] = 3.72589167251055;
     (*theoreticalSinr1)[1] = 3.72255684126076;
 
-    AddTestCase(new LteDownlinkDataSinrTestCase(rxPsd1, theoreticalSinr1, "sdBm = [-46 -48]"),
+    AddTestCase(
+        new LteDownlinkDataSinrTestCase(rxPsd1, theoreticalSinr1, false, "sdBm = [-46 -48]"),
+        TestCase::Duration::QUICK);
+    AddTestCase(new LteDownlinkDataSinrTestCase(rxPsd1,
+                                                theoreticalSinr1,
+                                                true,
+                                                "sdBm = [-46 -48], lazy chunk evaluation"),
                 TestCase::Duration::QUICK);
     AddTestCase(new LteDownlinkCtrlSinrTestCase(rxPsd1, theoreticalSinr1, "sdBm = [-46 -48]"),
                 TestCase::Duration::QUICK);
@@ -97,7 +103,13 @@ LteDownlinkSinrTestSuite::LteDownlinkSinrTestSuite()
     (*theoreticalSinr2)[0] = 0.0743413124381667;
     (*theoreticalSinr2)[1] = 0.1865697965291756;
 
-    AddTestCase(new LteDownlinkDataSinrTestCase(rxPsd2, theoreticalSinr2, "sdBm = [-63 -61]"),
+    AddTestCase(
+        new LteDownlinkDataSinrTestCase(rxPsd2, theoreticalSinr2, false, "sdBm = [-63 -61]"),
+        TestCase::Duration::QUICK);
+    AddTestCase(new LteDownlinkDataSinrTestCase(rxPsd2,
+                                                theoreticalSinr2,
+                                                true,
+                                                "sdBm = [-63 -61], lazy chunk evaluation"),
                 TestCase::Duration::QUICK);
     AddTestCase(new LteDownlinkCtrlSinrTestCase(rxPsd2, theoreticalSinr2, "sdBm = [-63 -61]"),
                 TestCase::Duration::QUICK);
@@ -115,11 +127,13 @@ static LteDownlinkSinrTestSuite lteDownlinkSinrTestSuite;
 
 LteDownlinkDataSinrTestCase::LteDownlinkDataSinrTestCase(Ptr<SpectrumValue> sv,
                                                          Ptr<SpectrumValue> sinr,
+                                                         bool lazyChunkEvaluation,
                                                          std::string name)
     : TestCase("SINR calculation in downlink Data frame: " + name),
       m_sv(sv),
       m_sm(sv->GetSpectrumModel()),
-      m_expectedSinr(sinr)
+      m_expectedSinr(sinr),
+      m_lazyChunkEvaluation(lazyChunkEvaluation)
 {
     NS_LOG_INFO("Creating LenaDownlinkSinrTestCase");
 }
@@ -132,6 +146,8 @@ void
 LteDownlinkDataSinrTestCase::DoRun()
 {
     Config::SetDefault("ns3::LteSpectrumPhy::CtrlErrorModelEnabled", BooleanValue(false));
+    Config::SetDefault("ns3::LteInterference::LazyChunkEvaluation",
+                       BooleanValue(m_lazyChunkEvaluation));
     /**
      * Instantiate a single receiving LteSpectrumPhy
      */
@@ -148,6 +164,19 @@ LteDownlinkDataSinrTestCase::DoRun()
         MakeCallback(&LteSpectrumValueCatcher::ReportValue, &actualSinrCatcher));
     dlPhy->AddDataSinrChunkProcessor(chunkProcessor);
 
+    // also check the time-averaged interference and power of the signal of interest
+    Ptr<LteChunkProcessor> interfProcessor = Create<LteChunkProcessor>();
+    LteSpectrumValueCatcher actualInterfCatcher;
+    interfProcessor->AddCallback(
+        MakeCallback(&LteSpectrumValueCatcher::ReportValue, &actualInterfCatcher));
+    dlPhy->AddInterferenceDataChunkProcessor(interfProcessor);
+
+    Ptr<LteChunkProcessor> powerProcessor = Create<LteChunkProcessor>();
+    LteSpectrumValueCatcher actualPowerCatcher;
+    powerProcessor->AddCallback(
+        MakeCallback(&LteSpectrumValueCatcher::ReportValue, &actualPowerCatcher));
+    dlPhy->AddDataPowerChunkProcessor(powerProcessor);
+
     /**
      * Generate several calls to LteSpectrumPhy::StartRx corresponding to
      * several signals. One will be the signal of interest, i.e., the
@@ -275,6 +304,20 @@ LteDownlinkDataSinrTestCase::DoRun()
                                              *m_expectedSinr,
                                              0.0000001,
                                              "Data Frame - Wrong SINR !");
+
+    // the signal of interest is received from 1 s to 2 s, during which the
+    // interferers are present for 1 s, 0.7 s, 0.8 s and 0.1 s, respectively
+    SpectrumValue expectedInterf = (*noisePsd) + (*i1) + (*i2) * 0.7 + (*i3) * 0.8 + (*i4) * 0.1;
+    NS_LOG_INFO("Data Frame - Theoretical interference: " << expectedInterf);
+    NS_LOG_INFO("Data Frame - Calculated interference: " << *(actualInterfCatcher.GetValue()));
+    NS_TEST_ASSERT_MSG_SPECTRUM_VALUE_EQ_TOL(*(actualInterfCatcher.GetValue()),
+                                             expectedInterf,
+                                             1e-24,
+                                             "Data Frame - Wrong interference !");
+    NS_TEST_ASSERT_MSG_SPECTRUM_VALUE_EQ_TOL(*(actualPowerCatcher.GetValue()),
+                                             *m_sv,
+                                             1e-24,
+                                             "Data Frame - Wrong signal power !");
     dlPhy->Dispose();
     Simulator::Destroy();
 }
@@ -56,9 +56,13 @@ class LteDownlinkDataSinrTestCase : public TestCase
      *
      * \param sv the spectrum value
      * \param sinr the SINR
+     * \param lazyChunkEvaluation whether the LteInterference evaluates the chunks lazily
      * \param name the name of the test
      */
-    LteDownlinkDataSinrTestCase(Ptr<SpectrumValue> sv, Ptr<SpectrumValue> sinr, std::string name);
+    LteDownlinkDataSinrTestCase(Ptr<SpectrumValue> sv,
+                                Ptr<SpectrumValue> sinr,
+                                bool lazyChunkEvaluation,
+                                std::string name);
     ~LteDownlinkDataSinrTestCase() override;
 
   private:
@@ -67,6 +71,7 @@ class LteDownlinkDataSinrTestCase : public TestCase
     Ptr<SpectrumValue> m_sv;           ///< the spectrum value
     Ptr<const SpectrumModel> m_sm;     ///< the spectrum model
     Ptr<SpectrumValue> m_expectedSinr; ///< the expected SINR
+    bool m_lazyChunkEvaluation;        ///< whether the chunks are evaluated lazily
 };
 
 /**
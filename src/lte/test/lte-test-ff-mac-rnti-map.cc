@@ -0,0 +1,162 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/ff-mac-rnti-map.h"
+#include "ns3/log.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/test.h"
+
+#include <map>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("LteTestFfMacRntiMap");
+
+/**
+ * \ingroup lte-test
+ *
+ * \brief Test case that applies a random sequence of insertions, lookups and
+ * removals to a FfMacRntiMap and to a std::map, and checks that the content of
+ * the two containers and the order of iteration are the same after each operation.
+ */
+class LteFfMacRntiMapTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param maxRnti the highest RNTI used in the test
+     * \param nOperations the number of operations to apply
+     */
+    LteFfMacRntiMapTestCase(uint16_t maxRnti, uint32_t nOperations);
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Check that the content of the two containers is the same
+     *
+     * \param map the table under test
+     * \param ref the reference container
+     */
+    void CheckContent(const FfMacRntiMap<uint32_t>& map, const std::map<uint16_t, uint32_t>& ref);
+
+    uint16_t m_maxRnti;     ///< the highest RNTI used in the test
+    uint32_t m_nOperations; ///< the number of operations to apply
+};
+
+LteFfMacRntiMapTestCase::LteFfMacRntiMapTestCase(uint16_t maxRnti, uint32_t nOperations)
+    : TestCase("RNTIs up to " + std::to_string(maxRnti) + ", " + std::to_string(nOperations) +
+               " operations"),
+      m_maxRnti(maxRnti),
+      m_nOperations(nOperations)
+{
+}
+
+void
+LteFfMacRntiMapTestCase::CheckContent(const FfMacRntiMap<uint32_t>& map,
+                                      const std::map<uint16_t, uint32_t>& ref)
+{
+    NS_TEST_ASSERT_MSG_EQ(map.size(), ref.size(), "wrong number of elements");
+    auto itRef = ref.begin();
+    for (auto it = map.begin(); it != map.end(); ++it, ++itRef)
+    {
+        NS_TEST_ASSERT_MSG_EQ(it->first, itRef->first, "wrong order of iteration");
+        NS_TEST_ASSERT_MSG_EQ(it->second, itRef->second, "wrong state for RNTI " << it->first);
+        NS_TEST_ASSERT_MSG_EQ((map.find(it->first) == it), true, "wrong position in the index");
+    }
+}
+
+void
+LteFfMacRntiMapTestCase::DoRun()
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+    auto rv = CreateObject<UniformRandomVariable>();
+
+    FfMacRntiMap<uint32_t> map;
+    std::map<uint16_t, uint32_t> ref;
+
+    for (uint32_t i = 0; i < m_nOperations; i++)
+    {
+        uint16_t rnti = rv->GetInteger(1, m_maxRnti);
+        switch (rv->GetInteger(0, 4))
+        {
+        case 0: {
+            auto ret = map.insert(std::pair<uint16_t, uint32_t>(rnti, i));
+            auto retRef = ref.insert(std::pair<uint16_t, uint32_t>(rnti, i));
+            NS_TEST_ASSERT_MSG_EQ(ret.second, retRef.second, "wrong insertion result");
+            NS_TEST_ASSERT_MSG_EQ(ret.first->first, rnti, "wrong element returned");
+            break;
+        }
+        case 1:
+            map[rnti] = i;
+            ref[rnti] = i;
+            break;
+        case 2:
+            NS_TEST_ASSERT_MSG_EQ(map.erase(rnti), ref.erase(rnti), "wrong number of removals");
+            break;
+        case 3:
+            NS_TEST_ASSERT_MSG_EQ(map.count(rnti), ref.count(rnti), "wrong count");
+            break;
+        case 4: {
+            // remove the elements of the RNTIs multiple of a random divisor while iterating
+            uint16_t divisor = rv->GetInteger(2, 8);
+            for (auto it = map.begin(); it != map.end();)
+            {
+                it = (it->first % divisor == 0) ? map.erase(it) : std::next(it);
+            }
+            for (auto it = ref.begin(); it != ref.end();)
+            {
+                it = (it->first % divisor == 0) ? ref.erase(it) : std::next(it);
+            }
+            break;
+        }
+        }
+        CheckContent(map, ref);
+    }
+
+    NS_TEST_ASSERT_MSG_EQ((map.find(m_maxRnti + 1) == map.end()), true, "unexpected element");
+    map.clear();
+    NS_TEST_ASSERT_MSG_EQ(map.empty(), true, "the table is not empty");
+    NS_TEST_ASSERT_MSG_EQ(map.count(rv->GetInteger(1, m_maxRnti)), 0, "unexpected element");
+}
+
+/**
+ * \ingroup lte-test
+ *
+ * \brief Test suite for the dense per-RNTI tables of the MAC schedulers.
+ */
+class LteFfMacRntiMapTestSuite : public TestSuite
+{
+  public:
+    LteFfMacRntiMapTestSuite();
+};
+
+/**
+ * \ingroup lte-test
+ * Static variable for test initialization
+ */
+static LteFfMacRntiMapTestSuite g_lteFfMacRntiMapTestSuite;
+
+LteFfMacRntiMapTestSuite::LteFfMacRntiMapTestSuite()
+    : TestSuite("lte-ff-mac-rnti-map", Type::UNIT)
+{
+    NS_LOG_FUNCTION(this);
+
+    AddTestCase(new LteFfMacRntiMapTestCase(8, 1000), TestCase::Duration::QUICK);
+    AddTestCase(new LteFfMacRntiMapTestCase(500, 5000), TestCase::Duration::QUICK);
+}
@@ -0,0 +1,204 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/boolean.h"
+#include "ns3/double.h"
+#include "ns3/integer.h"
+#include "ns3/log.h"
+#include "ns3/lte-helper.h"
+#include "ns3/mobility-helper.h"
+#include "ns3/radio-environment-map-helper.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/test.h"
+#include "ns3/uinteger.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("LteTestRadioEnvironmentMap");
+
+/**
+ * \ingroup lte-test
+ *
+ * \brief Test case that generates the same REM of the DL control channel
+ * with and without the DirectEvaluation attribute, and checks that the two
+ * output files are identical.
+ *
+ * The scenario has a three-sector site, with cosine antennas, and a small
+ * cell with an isotropic antenna, so that the antenna gains and the
+ * interference of the other cells matter.
+ */
+class LteRadioEnvironmentMapTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param rbId the RbId attribute of the REM (-1 for all the RBs)
+     * \param maxPointsPerIteration the MaxPointsPerIteration attribute of the REM
+     * \param numThreads the NumThreads attribute of the REM, in direct evaluation
+     */
+    LteRadioEnvironmentMapTestCase(int32_t rbId,
+                                   uint32_t maxPointsPerIteration,
+                                   uint32_t numThreads);
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Generate the REM
+     *
+     * \param directEvaluation the DirectEvaluation attribute of the REM
+     * \return the content of the output file
+     */
+    std::string GenerateRem(bool directEvaluation);
+
+    int32_t m_rbId;                   ///< the RbId attribute of the REM
+    uint32_t m_maxPointsPerIteration; ///< the MaxPointsPerIteration attribute of the REM
+    uint32_t m_numThreads;            ///< the NumThreads attribute of the REM
+};
+
+LteRadioEnvironmentMapTestCase::LteRadioEnvironmentMapTestCase(int32_t rbId,
+                                                               uint32_t maxPointsPerIteration,
+                                                               uint32_t numThreads)
+    : TestCase("RbId " + std::to_string(rbId) + ", " + std::to_string(maxPointsPerIteration) +
+               " points per iteration, " + std::to_string(numThreads) + " threads"),
+      m_rbId(rbId),
+      m_maxPointsPerIteration(maxPointsPerIteration),
+      m_numThreads(numThreads)
+{
+}
+
+std::string
+LteRadioEnvironmentMapTestCase::GenerateRem(bool directEvaluation)
+{
+    Ptr<LteHelper> lteHelper = CreateObject<LteHelper>();
+    lteHelper->SetAttribute("PathlossModel", StringValue("ns3::FriisPropagationLossModel"));
+
+    NodeContainer enbNodes;
+    enbNodes.Create(4);
+    NodeContainer ueNodes;
+    ueNodes.Create(4);
+
+    Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator>();
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        positionAlloc->Add(Vector(0, 0, 30));
+    }
+    positionAlloc->Add(Vector(400, 300, 10));
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        positionAlloc->Add(Vector(50 * i, 20, 1.5));
+    }
+    MobilityHelper mobility;
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.SetPositionAllocator(positionAlloc);
+    mobility.Install(enbNodes);
+    mobility.Install(ueNodes);
+
+    NetDeviceContainer enbDevs;
+    lteHelper->SetEnbAntennaModelType("ns3::CosineAntennaModel");
+    lteHelper->SetEnbAntennaModelAttribute("HorizontalBeamwidth", DoubleValue(100));
+    lteHelper->SetEnbAntennaModelAttribute("MaxGain", DoubleValue(0.0));
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        lteHelper->SetEnbAntennaModelAttribute("Orientation", DoubleValue(120.0 * i));
+        enbDevs.Add(lteHelper->InstallEnbDevice(enbNodes.Get(i)));
+    }
+    Config::SetDefault("ns3::LteEnbPhy::TxPower", DoubleValue(20.0));
+    lteHelper->SetEnbAntennaModelType("ns3::IsotropicAntennaModel");
+    enbDevs.Add(lteHelper->InstallEnbDevice(enbNodes.Get(3)));
+
+    NetDeviceContainer ueDevs = lteHelper->InstallUeDevice(ueNodes);
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        lteHelper->Attach(ueDevs.Get(i), enbDevs.Get(i));
+    }
+
+    std::string fileName =
+        CreateTempDirFilename(std::string("rem-") + (directEvaluation ? "direct" : "classic"));
+    Ptr<RadioEnvironmentMapHelper> remHelper = CreateObject<RadioEnvironmentMapHelper>();
+    remHelper->SetAttribute("ChannelPath", StringValue("/ChannelList/0"));
+    remHelper->SetAttribute("OutputFile", StringValue(fileName));
+    remHelper->SetAttribute("XMin", DoubleValue(-500.0));
+    remHelper->SetAttribute("XMax", DoubleValue(700.0));
+    remHelper->SetAttribute("XRes", UintegerValue(31));
+    remHelper->SetAttribute("YMin", DoubleValue(-500.0));
+    remHelper->SetAttribute("YMax", DoubleValue(600.0));
+    remHelper->SetAttribute("YRes", UintegerValue(23));
+    remHelper->SetAttribute("Z", DoubleValue(1.5));
+    remHelper->SetAttribute("MaxPointsPerIteration", UintegerValue(m_maxPointsPerIteration));
+    remHelper->SetAttribute("RbId", IntegerValue(m_rbId));
+    remHelper->SetAttribute("DirectEvaluation", BooleanValue(directEvaluation));
+    remHelper->SetAttribute("NumThreads", UintegerValue(m_numThreads));
+    remHelper->Install();
+
+    // the REM stops the simulation when it is done
+    Simulator::Stop(Seconds(1));
+    Simulator::Run();
+    Simulator::Destroy();
+
+    std::ifstream file(fileName);
+    NS_TEST_EXPECT_MSG_EQ(file.is_open(), true, "cannot open " << fileName);
+    std::ostringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+void
+LteRadioEnvironmentMapTestCase::DoRun()
+{
+    std::string classic = GenerateRem(false);
+    Config::Reset();
+    std::string direct = GenerateRem(true);
+
+    NS_TEST_ASSERT_MSG_EQ(std::count(classic.begin(), classic.end(), '\n'),
+                          31 * 23,
+                          "wrong number of points in the classic REM");
+    NS_TEST_ASSERT_MSG_EQ((direct == classic),
+                          true,
+                          "the REMs generated with and without DirectEvaluation differ");
+}
+
+/**
+ * \ingroup lte-test
+ *
+ * \brief Test suite that checks the direct evaluation of the REM.
+ */
+class LteRadioEnvironmentMapTestSuite : public TestSuite
+{
+  public:
+    LteRadioEnvironmentMapTestSuite();
+};
+
+/**
+ * \ingroup lte-test
+ * Static variable for test initialization
+ */
+static LteRadioEnvironmentMapTestSuite g_lteRadioEnvironmentMapTestSuite;
+
+LteRadioEnvironmentMapTestSuite::LteRadioEnvironmentMapTestSuite()
+    : TestSuite("lte-radio-environment-map", Type::SYSTEM)
+{
+    NS_LOG_FUNCTION(this);
+
+    AddTestCase(new LteRadioEnvironmentMapTestCase(-1, 20000, 1), TestCase::Duration::QUICK);
+    AddTestCase(new LteRadioEnvironmentMapTestCase(-1, 200, 3), TestCase::Duration::QUICK);
+    AddTestCase(new LteRadioEnvironmentMapTestCase(10, 200, 2), TestCase::Duration::QUICK);
+}
@@ -91,7 +91,7 @@ DoBeamforming (Ptr<NetDevice> thisDevice, Ptr<UniformPlanarArray> thisAntenna, P
 
 
   // retrieve the number of antenna elements
-  int totNoArrayElements = thisAntenna->GetNumberOfElements ();
+  int totNoArrayElements = thisAntenna->GetNumElems ();
 
   // the total power is divided equally among the antenna elements
   double power = 1 / sqrt (totNoArrayElements);
@@ -0,0 +1,149 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License version 2 as
+ *   published by the Free Software Foundation;
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \ingroup examples
+ * \file cttc-error-model-decodification.cc
+ *
+ * Micro-benchmark of the decodification of the EESM error models.
+ *
+ * The example draws random MCS, RB allocations and SINR per RB, and then
+ * asks each EESM error model (HARQ-IR and HARQ-CC, MCS Table1 and Table2)
+ * for the decodification statistics of the resulting transport blocks,
+ * both for a first transmission and for a retransmission that is combined
+ * with it. It prints the number of transport blocks decoded per second by
+ * each model, and the mean TBLER, which does not depend on the
+ * implementation of the BLER tables.
+ *
+ * \code{.unparsed}
+$ ./ns3 run "cttc-error-model-decodification --PrintHelp"
+    \endcode
+ *
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/nr-module.h"
+
+#include <chrono>
+#include <iomanip>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE ("CttcErrorModelDecodification");
+
+/**
+ * \brief A transport block to decode
+ */
+struct BenchTb
+{
+  SpectrumValue m_sinr;   //!< SINR per RB
+  std::vector<int> m_map; //!< Allocated RBs
+  uint8_t m_mcs;          //!< MCS
+};
+
+/**
+ * \brief Decode the transport blocks with an error model, and print the results
+ * \param typeName the name of the type of the error model
+ * \param tbs the transport blocks
+ * \param rbs the number of RBs
+ * \param symbols the number of OFDM symbols of each transport block
+ */
+static void
+DecodeTbs (const std::string &typeName, const std::vector<BenchTb> &tbs, uint32_t rbs,
+           uint32_t symbols)
+{
+  ObjectFactory factory;
+  factory.SetTypeId (typeName);
+  Ptr<NrEesmErrorModel> model = factory.Create<NrEesmErrorModel> ();
+
+  std::chrono::duration<double> elapsed[2];
+  elapsed[0] = elapsed[1] = std::chrono::duration<double>::zero ();
+  double tbler[2] = {0.0, 0.0};
+
+  for (const auto &tb : tbs)
+    {
+      uint8_t mcs = std::min (tb.m_mcs, model->GetMaxMcs ());
+      uint32_t size = model->GetPayloadSize (NrSpectrumValueHelper::SUBCARRIERS_PER_RB, mcs,
+                                             tb.m_map.size () * symbols, NrErrorModel::DL);
+      NrErrorModel::NrErrorModelHistory history;
+
+      // first transmission, and retransmission of the same transport block
+      for (uint32_t i = 0; i < 2; ++i)
+        {
+          auto start = std::chrono::steady_clock::now ();
+          Ptr<NrErrorModelOutput> output = model->GetTbDecodificationStats (tb.m_sinr, tb.m_map,
+                                                                            size, mcs, history);
+          elapsed[i] += std::chrono::steady_clock::now () - start;
+          tbler[i] += output->m_tbler;
+          history.push_back (output);
+        }
+    }
+
+  std::cout << std::left << std::setw (18) << typeName
+            << " first tx " << std::setw (10) << tbs.size () / elapsed[0].count ()
+            << " TB/s (TBLER " << std::setw (8) << tbler[0] / tbs.size () << ")"
+            << " retx " << std::setw (10) << tbs.size () / elapsed[1].count ()
+            << " TB/s (TBLER " << std::setw (8) << tbler[1] / tbs.size () << ")"
+            << std::endl;
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t tbNum = 100000;
+  uint32_t rbs = 273;
+  uint32_t symbols = 12;
+  double meanSinrDb = 10.0;
+  double sinrSpreadDb = 15.0;
+
+  CommandLine cmd (__FILE__);
+  cmd.AddValue ("tbs", "Number of transport blocks", tbNum);
+  cmd.AddValue ("rbs", "Number of RBs of the bandwidth", rbs);
+  cmd.AddValue ("symbols", "Number of OFDM symbols of each transport block", symbols);
+  cmd.AddValue ("meanSinr", "Mean SINR (dB) of the transport blocks", meanSinrDb);
+  cmd.AddValue ("sinrSpread", "Spread (dB) of the SINR around its mean", sinrSpreadDb);
+  cmd.Parse (argc, argv);
+
+  NrSpectrumValueHelper helper;
+  Ptr<const SpectrumModel> spectrumModel = helper.GetSpectrumModel (rbs, 3.5e9, 30000);
+
+  Ptr<UniformRandomVariable> rng = CreateObject<UniformRandomVariable> ();
+  std::vector<BenchTb> tbs;
+  tbs.reserve (tbNum);
+  for (uint32_t t = 0; t < tbNum; ++t)
+    {
+      BenchTb tb {SpectrumValue (spectrumModel), {}, 0};
+      tb.m_mcs = rng->GetInteger (0, 28);
+      uint32_t first = rng->GetInteger (0, rbs - 1);
+      uint32_t last = rng->GetInteger (first, rbs - 1);
+      double tbSinrDb = meanSinrDb + rng->GetValue (-sinrSpreadDb, sinrSpreadDb);
+      for (uint32_t rb = first; rb <= last; ++rb)
+        {
+          tb.m_map.push_back (rb);
+          tb.m_sinr[rb] = std::pow (10.0, (tbSinrDb + rng->GetValue (-3.0, 3.0)) / 10.0);
+        }
+      tbs.push_back (std::move (tb));
+    }
+
+  for (const auto &typeName : {"ns3::NrEesmIrT1", "ns3::NrEesmIrT2",
+                               "ns3::NrEesmCcT1", "ns3::NrEesmCcT2"})
+    {
+      DecodeTbs (typeName, tbs, rbs, symbols);
+    }
+
+  return 0;
+}
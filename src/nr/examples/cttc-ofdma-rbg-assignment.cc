@@ -0,0 +1,407 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License version 2 as
+ *   published by the Free Software Foundation;
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \ingroup examples
+ * \file cttc-ofdma-rbg-assignment.cc
+ *
+ * Micro-benchmark of the RBG assignment of the OFDMA schedulers.
+ *
+ * For each slot, the example draws random MCS, rank and buffer sizes for
+ * the UEs, and then asks three instances of the same OFDMA scheduler to assign
+ * the DL and UL RBG:
+ *
+ * - the baseline sorts the UEs for each RBG with the comparison function of
+ *   the scheduler, as the schedulers that do not override
+ *   NrMacSchedulerOfdma::IsNotAssignedIdempotent() do;
+ * - the reference sorts them in the same way, but breaks the ties of the
+ *   comparison function by RNTI, which is the order of the UEs in each beam;
+ * - the heap instance keeps the UEs in a heap, as PF, RR and MR do.
+ *
+ * The heap instance must assign the same RBG as the reference in every
+ * slot. The baseline must assign the same RBG as the reference in the slots
+ * in which the reference never found two UEs with the same metric; in the
+ * other slots, std::sort may leave the UEs with the same metric in any order.
+ * The example aborts if an assignment differs, and prints the time spent by
+ * the baseline and the heap instances.
+ *
+ * \code{.unparsed}
+$ ./ns3 run "cttc-ofdma-rbg-assignment --PrintHelp"
+    \endcode
+ *
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/nr-module.h"
+
+#include <chrono>
+#include <functional>
+#include <iomanip>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE ("CttcOfdmaRbgAssignment");
+
+/**
+ * \brief The part of the MAC that the RBG assignment needs
+ */
+class BenchSchedSapUser : public NrMacSchedSapUser
+{
+public:
+  /**
+   * \brief BenchSchedSapUser constructor
+   * \param rbPerRbg the number of RB per RBG
+   */
+  BenchSchedSapUser (uint32_t rbPerRbg)
+    : m_rbPerRbg (rbPerRbg)
+  {
+  }
+
+  virtual void SchedConfigInd (const struct SchedConfigIndParameters& params) override
+  {
+  }
+  virtual Ptr<const SpectrumModel> GetSpectrumModel () const override
+  {
+    return nullptr;
+  }
+  virtual uint32_t GetNumRbPerRbg () const override
+  {
+    return m_rbPerRbg;
+  }
+  virtual uint8_t GetNumHarqProcess () const override
+  {
+    return 16;
+  }
+  virtual uint16_t GetBwpId () const override
+  {
+    return 0;
+  }
+  virtual uint16_t GetCellId () const override
+  {
+    return 0;
+  }
+  virtual uint32_t GetSymbolsPerSlot () const override
+  {
+    return 14;
+  }
+  virtual Time GetSlotPeriod () const override
+  {
+    return MilliSeconds (1);
+  }
+
+private:
+  uint32_t m_rbPerRbg; //!< Number of RB per RBG
+};
+
+/**
+ * \brief How a BenchScheduler assigns the RBG
+ */
+enum BenchMode
+{
+  BASELINE,  //!< Sort the UEs for each RBG
+  REFERENCE, //!< Sort the UEs for each RBG, breaking the ties by RNTI
+  HEAP       //!< Keep the UEs in a heap
+};
+
+/**
+ * \brief An OFDMA scheduler whose RBG assignment can be called directly
+ */
+template <class T>
+class BenchScheduler : public T
+{
+public:
+  /// Comparison function of the scheduler
+  typedef std::function<bool (const NrMacSchedulerNs3::UePtrAndBufferReq &,
+                              const NrMacSchedulerNs3::UePtrAndBufferReq &)> CompareFn;
+
+  /**
+   * \brief BenchScheduler constructor
+   * \param mode how the RBG are assigned
+   */
+  BenchScheduler (BenchMode mode)
+    : m_mode (mode)
+  {
+  }
+
+  /**
+   * \brief Tell if two UEs had the same metric since the last call
+   * \return true if the comparison function found a tie, in REFERENCE mode
+   */
+  bool
+  GetAndResetTie () const
+  {
+    bool tie = m_tie;
+    m_tie = false;
+    return tie;
+  }
+
+  /**
+   * \brief Create the representation of a UE
+   * \param rnti the RNTI of the UE
+   * \param beam the beam of the UE
+   * \return the UE
+   */
+  UePtr
+  CreateUe (uint16_t rnti, const BeamConfId &beam) const
+  {
+    NrMacCschedSapProvider::CschedUeConfigReqParameters params;
+    params.m_rnti = rnti;
+    params.m_beamConfId = beam;
+    return this->CreateUeRepresentation (params);
+  }
+
+  /**
+   * \brief Assign the DL RBG
+   * \param symAvail the symbols available
+   * \param activeDl the active UEs
+   * \return the symbols of each beam
+   */
+  NrMacSchedulerNs3::BeamSymbolMap
+  AssignDl (uint32_t symAvail, const NrMacSchedulerNs3::ActiveUeMap &activeDl) const
+  {
+    return this->AssignDLRBG (symAvail, activeDl);
+  }
+
+  /**
+   * \brief Assign the UL RBG
+   * \param symAvail the symbols available
+   * \param activeUl the active UEs
+   * \return the symbols of each beam
+   */
+  NrMacSchedulerNs3::BeamSymbolMap
+  AssignUl (uint32_t symAvail, const NrMacSchedulerNs3::ActiveUeMap &activeUl) const
+  {
+    return this->AssignULRBG (symAvail, activeUl);
+  }
+
+protected:
+  virtual bool
+  IsNotAssignedIdempotent () const override
+  {
+    return m_mode == HEAP ? T::IsNotAssignedIdempotent () : false;
+  }
+
+  virtual CompareFn
+  GetUeCompareDlFn () const override
+  {
+    return BreakTies (T::GetUeCompareDlFn ());
+  }
+
+  virtual CompareFn
+  GetUeCompareUlFn () const override
+  {
+    return BreakTies (T::GetUeCompareUlFn ());
+  }
+
+private:
+  /**
+   * \brief Break the ties of a comparison function by RNTI, in REFERENCE mode
+   * \param cmp the comparison function of the scheduler
+   * \return the comparison function to use
+   */
+  CompareFn
+  BreakTies (const CompareFn &cmp) const
+  {
+    if (m_mode != REFERENCE)
+      {
+        return cmp;
+      }
+    return [this, cmp] (const NrMacSchedulerNs3::UePtrAndBufferReq &lhs,
+                        const NrMacSchedulerNs3::UePtrAndBufferReq &rhs)
+      {
+        if (cmp (lhs, rhs))
+          {
+            return true;
+          }
+        if (cmp (rhs, lhs))
+          {
+            return false;
+          }
+        m_tie = true;
+        return lhs.first->m_rnti < rhs.first->m_rnti;
+      };
+  }
+
+  BenchMode m_mode;          //!< How the RBG are assigned
+  mutable bool m_tie {false}; //!< Whether a tie was found, in REFERENCE mode
+};
+
+/**
+ * \brief Compare two assignments of a slot
+ * \param what the name of the assignment
+ * \param ref the UEs of the reference instance
+ * \param other the UEs of the other instance
+ */
+static void
+CheckSameAssignment (const std::string &what,
+                     const std::vector<UePtr> &ref,
+                     const std::vector<UePtr> &other)
+{
+  for (uint32_t i = 0; i < ref.size (); ++i)
+    {
+      const auto &a = ref.at (i);
+      const auto &b = other.at (i);
+      NS_ABORT_MSG_IF (a->m_dlRBG != b->m_dlRBG || a->m_dlSym != b->m_dlSym
+                       || a->m_dlTbSize != b->m_dlTbSize,
+                       what << ": DL assignment of UE " << a->m_rnti << " differs: " <<
+                       a->m_dlRBG << " vs " << b->m_dlRBG << " RBG");
+      NS_ABORT_MSG_IF (a->m_ulRBG != b->m_ulRBG || a->m_ulSym != b->m_ulSym
+                       || a->m_ulTbSize != b->m_ulTbSize,
+                       what << ": UL assignment of UE " << a->m_rnti << " differs: " <<
+                       a->m_ulRBG << " vs " << b->m_ulRBG << " RBG");
+    }
+}
+
+/**
+ * \brief Run the benchmark for one scheduler
+ * \param name the name of the scheduler
+ * \param ues the number of UEs
+ * \param beams the number of beams
+ * \param rbg the number of RBG
+ * \param rbPerRbg the number of RB per RBG
+ * \param slots the number of slots
+ * \param mimo the probability that a UE reports rank 2
+ */
+template <class T>
+static void
+Run (const std::string &name, uint32_t ues, uint32_t beams, uint32_t rbg,
+     uint32_t rbPerRbg, uint32_t slots, double mimo)
+{
+  BenchSchedSapUser sapUser (rbPerRbg);
+  Ptr<NrAmc> dlAmc = CreateObject<NrAmc> ();
+  Ptr<NrAmc> ulAmc = CreateObject<NrAmc> ();
+
+  Ptr<BenchScheduler<T>> sched[3] = {CreateObject<BenchScheduler<T>> (BASELINE),
+                                     CreateObject<BenchScheduler<T>> (REFERENCE),
+                                     CreateObject<BenchScheduler<T>> (HEAP)};
+  std::vector<UePtr> ue[3];
+  for (uint32_t i = 0; i < 3; ++i)
+    {
+      sched[i]->SetMacSchedSapUser (&sapUser);
+      sched[i]->InstallDlAmc (dlAmc);
+      sched[i]->InstallUlAmc (ulAmc);
+      sched[i]->SetDlNotchedRbgMask (std::vector<uint8_t> (rbg, 1));
+      sched[i]->SetUlNotchedRbgMask (std::vector<uint8_t> (rbg, 1));
+      for (uint32_t u = 0; u < ues; ++u)
+        {
+          BeamConfId beam (BeamId (u % beams, 0), BeamId (u % beams, 0));
+          ue[i].push_back (sched[i]->CreateUe (u + 1, beam));
+        }
+    }
+
+  Ptr<UniformRandomVariable> rng = CreateObject<UniformRandomVariable> ();
+  // Most of the buffers are covered by a few RBG, some need the whole band
+  Ptr<ExponentialRandomVariable> buffer = CreateObject<ExponentialRandomVariable> ();
+  buffer->SetAttribute ("Mean", DoubleValue (2000));
+  buffer->SetAttribute ("Bound", DoubleValue (200000));
+
+  std::chrono::duration<double> elapsed[3];
+  elapsed[0] = elapsed[1] = elapsed[2] = std::chrono::duration<double>::zero ();
+  uint32_t tieSlots = 0;
+
+  for (uint32_t slot = 0; slot < slots; ++slot)
+    {
+      NrMacSchedulerNs3::ActiveUeMap active[3][2];
+      for (uint32_t u = 0; u < ues; ++u)
+        {
+          uint8_t ri = rng->GetValue () < mimo ? 2 : 1;
+          std::vector<uint8_t> dlMcs (ri);
+          for (auto &mcs : dlMcs)
+            {
+              mcs = rng->GetInteger (0, 27);
+            }
+          uint8_t ulMcs = rng->GetInteger (0, 27);
+          uint32_t dlBuffer = buffer->GetInteger ();
+          uint32_t ulBuffer = buffer->GetInteger ();
+
+          for (uint32_t i = 0; i < 3; ++i)
+            {
+              auto &info = ue[i].at (u);
+              info->m_dlCqi.m_ri = ri;
+              info->m_dlCqi.m_wbCqi = std::vector<uint8_t> (ri, 15);
+              info->m_dlMcs = dlMcs;
+              info->m_dlTbSize = std::vector<uint32_t> (ri, 0);
+              info->m_ulMcs = ulMcs;
+              info->ResetDlSchedInfo ();
+              info->ResetUlSchedInfo ();
+              active[i][0][info->m_beamConfId].emplace_back (info, dlBuffer);
+              active[i][1][info->m_beamConfId].emplace_back (info, ulBuffer);
+            }
+        }
+
+      NrMacSchedulerNs3::BeamSymbolMap symPerBeam[3][2];
+      for (uint32_t i = 0; i < 3; ++i)
+        {
+          auto start = std::chrono::steady_clock::now ();
+          symPerBeam[i][0] = sched[i]->AssignDl (12, active[i][0]);
+          symPerBeam[i][1] = sched[i]->AssignUl (12, active[i][1]);
+          elapsed[i] += std::chrono::steady_clock::now () - start;
+        }
+
+      for (uint32_t i : {0, 2})
+        {
+          NS_ABORT_MSG_IF (symPerBeam[i][0] != symPerBeam[1][0]
+                           || symPerBeam[i][1] != symPerBeam[1][1],
+                           name << ": symbols per beam differ at slot " << slot);
+        }
+      CheckSameAssignment (name + " heap", ue[1], ue[2]);
+      if (sched[1]->GetAndResetTie ())
+        {
+          ++tieSlots;
+        }
+      else
+        {
+          CheckSameAssignment (name + " baseline", ue[1], ue[0]);
+        }
+    }
+
+  std::cout << std::left << std::setw (6) << name
+            << " baseline " << std::setw (10) << elapsed[0].count () * 1e6 / slots
+            << " heap " << std::setw (10) << elapsed[2].count () * 1e6 / slots
+            << " us/slot, same assignment as the baseline in " << slots - tieSlots
+            << " slots without ties, as the reference in " << slots << " slots"
+            << std::endl;
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t ues = 64;
+  uint32_t beams = 4;
+  uint32_t rbg = 273;
+  uint32_t rbPerRbg = 1;
+  uint32_t slots = 1000;
+  double mimo = 0.3;
+
+  CommandLine cmd (__FILE__);
+  cmd.AddValue ("ues", "Number of UEs", ues);
+  cmd.AddValue ("beams", "Number of beams", beams);
+  cmd.AddValue ("rbg", "Number of RBG", rbg);
+  cmd.AddValue ("rbPerRbg", "Number of RB per RBG", rbPerRbg);
+  cmd.AddValue ("slots", "Number of slots", slots);
+  cmd.AddValue ("mimo", "Probability that a UE reports rank 2", mimo);
+  cmd.Parse (argc, argv);
+
+  NS_ABORT_MSG_IF (ues == 0 || beams == 0 || rbg == 0 || slots == 0,
+                   "ues, beams, rbg and slots must be positive");
+
+  Run<NrMacSchedulerOfdmaPF> ("PF", ues, beams, rbg, rbPerRbg, slots, mimo);
+  Run<NrMacSchedulerOfdmaRR> ("RR", ues, beams, rbg, rbPerRbg, slots, mimo);
+  Run<NrMacSchedulerOfdmaMR> ("MR", ues, beams, rbg, rbPerRbg, slots, mimo);
+
+  return 0;
+}
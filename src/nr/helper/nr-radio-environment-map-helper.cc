@@ -31,15 +31,19 @@
 #include <ns3/node.h>
 #include <ns3/mobility-model.h>
 #include <ns3/spectrum-converter.h>
+#include <ns3/spectrum-signal-parameters.h>
 #include <ns3/buildings-module.h>
 #include <ns3/nr-gnb-net-device.h>
 #include <ns3/nr-ue-net-device.h>
 #include <ns3/nr-spectrum-phy.h>
 #include "nr-spectrum-value-helper.h"
 #include <ns3/beamforming-vector.h>
+#include <algorithm>
 #include <ctime>
 #include <fstream>
 #include <limits>
+#include <map>
+#include <thread>
 
 namespace ns3 {
 
@@ -148,7 +152,7 @@ NrRadioEnvironmentMapHelper::GetTypeId (void)
                                      "pointing their beams towards the Rx gNB. In case of TDD, the SINR map"
                                      "will show the interference caused by the DL of these gNBs.",
                                      EnumValue (NrRadioEnvironmentMapHelper::COVERAGE_AREA),
-                                     MakeEnumAccessor (&NrRadioEnvironmentMapHelper::SetRemMode,
+                                     MakeEnumAccessor<RemMode> (&NrRadioEnvironmentMapHelper::SetRemMode,
                                                        &NrRadioEnvironmentMapHelper::GetRemMode),
                                      MakeEnumChecker (NrRadioEnvironmentMapHelper::BEAM_SHAPE, "BeamShape",
                                                       NrRadioEnvironmentMapHelper::COVERAGE_AREA, "CoverageArea",
@@ -159,6 +163,31 @@ NrRadioEnvironmentMapHelper::GetTypeId (void)
                                      TimeValue (MilliSeconds (100)),
                                      MakeTimeAccessor (&NrRadioEnvironmentMapHelper::SetInstallationDelay),
                                      MakeTimeChecker())
+                      .AddAttribute ("NumThreads",
+                                     "Number of threads that compute the REM points, including "
+                                     "the simulator thread. 0 means one thread per hardware thread. "
+                                     "The map does not depend on the number of threads.",
+                                     UintegerValue (0),
+                                     MakeUintegerAccessor (&NrRadioEnvironmentMapHelper::SetNumThreads,
+                                                           &NrRadioEnvironmentMapHelper::GetNumThreads),
+                                     MakeUintegerChecker<uint32_t> ())
+                      .AddAttribute ("TileSize",
+                                     "Number of consecutive REM points that a thread computes "
+                                     "at once. The REM output file is written one tile at a time.",
+                                     UintegerValue (16),
+                                     MakeUintegerAccessor (&NrRadioEnvironmentMapHelper::SetTileSize,
+                                                           &NrRadioEnvironmentMapHelper::GetTileSize),
+                                     MakeUintegerChecker<uint32_t> (1, std::numeric_limits<uint32_t>::max ()))
+                      .AddAttribute ("Stream",
+                                     "First random stream of the propagation models created for "
+                                     "the REM points. Each point uses its own streams, which depend "
+                                     "only on its position in the map. -1 means that the streams "
+                                     "are allocated automatically, so the map depends on the "
+                                     "streams allocated before in the simulation.",
+                                     IntegerValue (-1),
+                                     MakeIntegerAccessor (&NrRadioEnvironmentMapHelper::SetStream,
+                                                          &NrRadioEnvironmentMapHelper::GetStream),
+                                     MakeIntegerChecker<int64_t> (-1, std::numeric_limits<int64_t>::max ()))
     ;
   return tid;
 }
@@ -229,6 +258,28 @@ NrRadioEnvironmentMapHelper::SetInstallationDelay (const Time &installationDelay
   m_installationDelay = installationDelay;
 }
 
+void
+NrRadioEnvironmentMapHelper::SetNumThreads (uint32_t numThreads)
+{
+  if (numThreads == 0)
+    {
+      numThreads = std::max (std::thread::hardware_concurrency (), 1U);
+    }
+  m_numThreads = numThreads;
+}
+
+void
+NrRadioEnvironmentMapHelper::SetTileSize (uint32_t tileSize)
+{
+  m_tileSize = tileSize;
+}
+
+void
+NrRadioEnvironmentMapHelper::SetStream (int64_t stream)
+{
+  m_stream = stream;
+}
+
 NrRadioEnvironmentMapHelper::RemMode
 NrRadioEnvironmentMapHelper::GetRemMode () const
 {
@@ -277,6 +328,24 @@ NrRadioEnvironmentMapHelper::GetZ () const
   return m_z;
 }
 
+uint32_t
+NrRadioEnvironmentMapHelper::GetNumThreads () const
+{
+  return m_numThreads;
+}
+
+uint32_t
+NrRadioEnvironmentMapHelper::GetTileSize () const
+{
+  return m_tileSize;
+}
+
+int64_t
+NrRadioEnvironmentMapHelper::GetStream () const
+{
+  return m_stream;
+}
+
 double
 NrRadioEnvironmentMapHelper::DbmToW (double dBm) const
 {
@@ -390,8 +459,10 @@ NrRadioEnvironmentMapHelper::ConfigurePropagationModelsFactories (const Ptr<cons
 
   /***** configure pathloss model factory *****/
   m_propagationLossModel = txSpectrumChannel->GetPropagationLossModel ();
+  m_propagationLossModelFactory = ConfigureObjectFactory (m_propagationLossModel);
   /***** configure spectrum model factory *****/
   m_phasedArraySpectrumLossModel = txSpectrumChannel->GetPhasedArraySpectrumPropagationLossModel ();
+  m_spectrumLossModelFactory = ConfigureObjectFactory (m_phasedArraySpectrumLossModel);
 
   /***** configure ChannelConditionModel factory if ThreeGppPropagationLossModel propagation model is being used ****/
   Ptr<ThreeGppPropagationLossModel> propagationLossModel =  DynamicCast<ThreeGppPropagationLossModel> (txSpectrumChannel->GetPropagationLossModel ());
@@ -419,6 +490,18 @@ NrRadioEnvironmentMapHelper::ConfigurePropagationModelsFactories (const Ptr<cons
       if (spectrumLossModel->GetChannelModel ())
         {
           m_matrixBasedChannelModelFactory = ConfigureObjectFactory (spectrumLossModel->GetChannelModel ());
+          // The REM copies of the channel model live for a single calculation on
+          // one of the REM threads: they must neither schedule bulk updates nor
+          // write to the channel cache file of the scenario
+          TypeId::AttributeInformation info;
+          if (m_matrixBasedChannelModelFactory.GetTypeId ().LookupAttributeByName ("BulkUpdate", &info))
+            {
+              m_matrixBasedChannelModelFactory.Set ("BulkUpdate", BooleanValue (false));
+            }
+          if (m_matrixBasedChannelModelFactory.GetTypeId ().LookupAttributeByName ("CacheFile", &info))
+            {
+              m_matrixBasedChannelModelFactory.Set ("CacheFile", StringValue (""));
+            }
         }
       else
         {
@@ -579,30 +662,19 @@ NrRadioEnvironmentMapHelper::DelayedInstall (const NetDeviceContainer &rtdNetDev
   ConfigureRrd (rrdDevice);
   ConfigureRtdList (rtdNetDev);
   CreateListOfRemPoints ();
-  if (m_remMode == COVERAGE_AREA)
-    {
-      CalcCoverageAreaRemMap ();
-    }
-  else if (m_remMode == BEAM_SHAPE)
-    {
-      CalcBeamShapeRemMap ();
-    }
-  else if (m_remMode == UE_COVERAGE)
-    {
-      CalcUeCoverageRemMap ();
-    }
-  else
-    {
-      NS_FATAL_ERROR ("Unknown REM mode");
-    }
-  PrintRemToFile ();
 
+  // The files of the plot are written before the map, so that the partial map
+  // can be plotted while it is being generated
   std::ostringstream ossGnbs;
   ossGnbs << "nr-rem-" << m_simTag.c_str () << "-gnbs.txt";
   PrintGnuplottableGnbListToFile (ossGnbs.str ());
   std::ostringstream ossBuildings;
   ossBuildings << "nr-rem-" << m_simTag.c_str () << "-buildings.txt";
   PrintGnuplottableBuildingListToFile (ossBuildings.str ());
+  CreateCustomGnuplotFile ();
+
+  CalcRemMap ();
+  Finalize ();
 }
 
 void
@@ -671,9 +743,10 @@ NrRadioEnvironmentMapHelper::ConfigureDirectPathBfv (RemDevice& device,
 }
 
 Ptr<SpectrumValue>
-NrRadioEnvironmentMapHelper::CalcRxPsdValue (RemDevice& device, RemDevice& otherDevice) const
+NrRadioEnvironmentMapHelper::CalcRxPsdValue (RemTile& tile, RemDevice& device, RemDevice& otherDevice) const
 {
-  PropagationModels tempPropModels = CreateTemporalPropagationModels ();
+  NS_ASSERT_MSG (tile.nextModels != tile.models.end (), "No propagation models left in the tile");
+  const PropagationModels &tempPropModels = *tile.nextModels++;
 
   std::vector<int> activeRbs;
   for (size_t rbId = 0; rbId < device.spectrumModel->GetNumBands(); rbId++)
@@ -717,7 +790,9 @@ NrRadioEnvironmentMapHelper::CalcRxPsdValue (RemDevice& device, RemDevice& other
   NS_LOG_DEBUG ("RX power in dBm after pathloss:" << WToDbm (Integral (*rxPsd)));
 
   // Now we call spectrum model, which in this keys add a beamforming gain
-  rxPsd = tempPropModels.remSpectrumLossModelCopy->DoCalcRxPowerSpectralDensity (rxPsd, device.mob, otherDevice.mob, device.antenna, otherDevice.antenna);
+  Ptr<SpectrumSignalParameters> rxParams = Create<SpectrumSignalParameters> ();
+  rxParams->psd = rxPsd;
+  rxPsd = tempPropModels.remSpectrumLossModelCopy->DoCalcRxPowerSpectralDensity (rxParams, device.mob, otherDevice.mob, device.antenna, otherDevice.antenna)->psd;
 
   NS_LOG_DEBUG ("RX power in dBm after fading: " << WToDbm (Integral (*rxPsd)));
 
@@ -730,7 +805,7 @@ NrRadioEnvironmentMapHelper::GetMaxValue (const std::list <Ptr<SpectrumValue>>&
   //TODO add this abort, if necessary add include for abort.h
   NS_ABORT_MSG_IF (values.size () == 0, "Must provide a list of values.");
 
-  Ptr<SpectrumValue> maxValue = Create <SpectrumValue> (m_rrd.spectrumModel);
+  Ptr<SpectrumValue> maxValue = Create <SpectrumValue> ((*values.begin ())->GetSpectrumModel ());
   *maxValue = **(values.begin ());
 
   for (const auto &value: values)
@@ -744,34 +819,37 @@ NrRadioEnvironmentMapHelper::GetMaxValue (const std::list <Ptr<SpectrumValue>>&
 }
 
 double
-NrRadioEnvironmentMapHelper::CalculateMaxSnr (const std::list <Ptr<SpectrumValue>>& receivedPowerList) const
+NrRadioEnvironmentMapHelper::CalculateMaxSnr (const std::list <Ptr<SpectrumValue>>& receivedPowerList,
+                                              const Ptr<const SpectrumValue>& noisePsd) const
 {
   Ptr<SpectrumValue> maxSnr = GetMaxValue (receivedPowerList);
-  SpectrumValue snr = (*maxSnr) / (*m_noisePsd);
+  SpectrumValue snr = (*maxSnr) / (*noisePsd);
   return RatioToDb (Sum (snr) / snr.GetSpectrumModel ()->GetNumBands ());
 }
 
 double
-NrRadioEnvironmentMapHelper::CalculateSnr (const Ptr<SpectrumValue>& usefulSignal) const
+NrRadioEnvironmentMapHelper::CalculateSnr (const Ptr<SpectrumValue>& usefulSignal,
+                                           const Ptr<const SpectrumValue>& noisePsd) const
 {
-   SpectrumValue snr = (*usefulSignal) / (*m_noisePsd);
+   SpectrumValue snr = (*usefulSignal) / (*noisePsd);
 
    return RatioToDb (Sum (snr) / snr.GetSpectrumModel ()->GetNumBands ());
 }
 
 double
 NrRadioEnvironmentMapHelper::CalculateSinr (const Ptr<SpectrumValue>& usefulSignal,
-                                            const std::list <Ptr<SpectrumValue>>& interferenceSignals) const
+                                            const std::list <Ptr<SpectrumValue>>& interferenceSignals,
+                                            const Ptr<const SpectrumValue>& noisePsd) const
 {
   Ptr<SpectrumValue> interferencePsd = nullptr;
 
   if (interferenceSignals.size () == 0)
     {
-      return CalculateSnr (usefulSignal);
+      return CalculateSnr (usefulSignal, noisePsd);
     }
   else
     {
-      interferencePsd = Create<SpectrumValue> (m_rrd.spectrumModel);
+      interferencePsd = Create<SpectrumValue> (usefulSignal->GetSpectrumModel ());
     }
 
   // sum all interfering signals
@@ -781,7 +859,7 @@ NrRadioEnvironmentMapHelper::CalculateSinr (const Ptr<SpectrumValue>& usefulSign
     }
   // calculate sinr
 
-  SpectrumValue sinr = (*usefulSignal) / (*interferencePsd + *m_noisePsd) ;
+  SpectrumValue sinr = (*usefulSignal) / (*interferencePsd + *noisePsd) ;
 
   // calculate average sinr over RBs, convert it from linear to dB units, and return it
   return RatioToDb (Sum (sinr) / sinr.GetSpectrumModel ()->GetNumBands ()) ;
@@ -801,7 +879,7 @@ NrRadioEnvironmentMapHelper::CalculateSir (const Ptr<SpectrumValue>& usefulSigna
     }
   else
     {
-      interferencePsd = Create<SpectrumValue> (m_rrd.spectrumModel);
+      interferencePsd = Create<SpectrumValue> (usefulSignal->GetSpectrumModel ());
     }
 
   // sum all interfering signals
@@ -818,7 +896,8 @@ NrRadioEnvironmentMapHelper::CalculateSir (const Ptr<SpectrumValue>& usefulSigna
 }
 
 double
-NrRadioEnvironmentMapHelper::CalculateMaxSinr (const std::list <Ptr<SpectrumValue>>& receivedPowerList) const
+NrRadioEnvironmentMapHelper::CalculateMaxSinr (const std::list <Ptr<SpectrumValue>>& receivedPowerList,
+                                               const Ptr<const SpectrumValue>& noisePsd) const
 {
   // we calculate sinr considering for each RTD as if it would be TX device, and the rest of RTDs interferers
   std::list <double> sinrList;
@@ -837,7 +916,7 @@ NrRadioEnvironmentMapHelper::CalculateMaxSinr (const std::list <Ptr<SpectrumValu
 
       interferenceSignals.insert (interferenceSignals.end (), ++tempit, receivedPowerList.end ());
       NS_ASSERT(interferenceSignals.size () == receivedPowerList.size ()-1);
-      sinrList.push_back (CalculateSinr (*it, interferenceSignals));
+      sinrList.push_back (CalculateSinr (*it, interferenceSignals, noisePsd));
     }
   return GetMaxValue (sinrList);
 }
@@ -868,76 +947,325 @@ NrRadioEnvironmentMapHelper::CalculateMaxSir (const std::list <Ptr<SpectrumValue
 }
 
 void
-NrRadioEnvironmentMapHelper::CalcBeamShapeRemMap ()
+NrRadioEnvironmentMapHelper::CalcRemMap ()
 {
   NS_LOG_FUNCTION (this);
-  uint16_t calcRxPsdCounter = 0;
+
+  std::ostringstream oss;
+  oss << "nr-rem-" << m_simTag.c_str () << ".out";
+
+  std::ofstream outFile;
+  std::string outputFile = oss.str ();
+  outFile.open (outputFile.c_str ());
+
+  if (!outFile.is_open ())
+    {
+      NS_FATAL_ERROR ("Can't open file " << (outputFile));
+      return;
+    }
+
+  size_t numTiles = (m_rem.size () + m_tileSize - 1) / m_tileSize;
+  // Twice as many tiles as threads, so that the simulator thread prepares the
+  // next tiles while the other threads compute the current ones
+  size_t numSlots = std::max<size_t> (1, std::min<size_t> (2 * m_numThreads, numTiles));
+  m_remTiles.clear ();
+  m_remTiles.resize (numSlots);
+  for (auto &tile : m_remTiles)
+    {
+      CreateRemTileDevices (tile);
+    }
+  m_streamsPerModels = 0;
+  if (m_stream >= 0)
+    {
+      m_streamsPerModels = AssignStreams (CreateTemporalPropagationModels (), m_stream);
+    }
+  m_nextTileToPrepare = 0;
+  m_nextTileToCompute = 0;
+  m_stopRemWorkers = false;
+
+  std::vector<std::thread> workers;
+  for (uint32_t i = 1; i < m_numThreads; i++)
+    {
+      workers.emplace_back (&NrRadioEnvironmentMapHelper::RemWorkerLoop, this);
+    }
 
   uint32_t remSizeNextReport = m_rem.size () / 100;
-  uint32_t remPointCounter = 0;
+  size_t nextTileToWrite = 0;
+  std::unique_lock<std::mutex> lock (m_remMutex);
+  while (nextTileToWrite < numTiles)
+    {
+      RemTile &head = m_remTiles[nextTileToWrite % numSlots];
+      if (nextTileToWrite < m_nextTileToPrepare && head.done)
+        {
+          // the tiles are written in order, so the file always holds the
+          // first rows of the map
+          lock.unlock ();
+          PrintRemToFile (outFile, head);
+          head.models.clear ();
+          ++nextTileToWrite;
+          while (remSizeNextReport > 0 && head.end >= remSizeNextReport)
+            {
+              PrintProgressReport (&remSizeNextReport);
+            }
+          lock.lock ();
+        }
+      else if (m_nextTileToPrepare < numTiles && m_nextTileToPrepare < nextTileToWrite + numSlots)
+        {
+          // the propagation models are created here, in the order of the
+          // points, so that they get the same random streams whatever the
+          // number of threads
+          RemTile &tile = m_remTiles[m_nextTileToPrepare % numSlots];
+          size_t begin = m_nextTileToPrepare * m_tileSize;
+          lock.unlock ();
+          PrepareRemTile (tile, begin, std::min<size_t> (begin + m_tileSize, m_rem.size ()));
+          lock.lock ();
+          ++m_nextTileToPrepare;
+          m_tileReady.notify_one ();
+        }
+      else if (m_nextTileToCompute < m_nextTileToPrepare)
+        {
+          RemTile &tile = m_remTiles[m_nextTileToCompute++ % numSlots];
+          lock.unlock ();
+          CalcRemTile (tile);
+          lock.lock ();
+          tile.done = true;
+        }
+      else
+        {
+          m_tileDone.wait (lock);
+        }
+    }
+  m_stopRemWorkers = true;
+  lock.unlock ();
+  m_tileReady.notify_all ();
+  for (auto &worker : workers)
+    {
+      worker.join ();
+    }
+  m_remTiles.clear ();
+
+  outFile.close ();
+
+  auto remEndTime = std::chrono::system_clock::now ();
+  std::chrono::duration<double> remElapsedSeconds = remEndTime - m_remStartTime;
+  NS_LOG_INFO ("REM map created. Total time needed to create the REM map:" <<
+                 remElapsedSeconds.count () / 60 << " minutes.");
+}
 
-  for (std::list<RemPoint>::iterator itRemPoint = m_rem.begin ();
-      itRemPoint != m_rem.end ();
-      ++itRemPoint)
+void
+NrRadioEnvironmentMapHelper::RemWorkerLoop ()
+{
+  NS_LOG_FUNCTION (this);
+
+  std::unique_lock<std::mutex> lock (m_remMutex);
+  while (true)
     {
-      //perform calculation m_numOfIterationsToAverage times and get the average value
-      double sumSnr = 0.0, sumSinr = 0.0;
-      double sumSir = 0.0;
-      std::list<double> rxPsdsListPerIt; //list to save the summed rxPower in each RemPoint for each Iteration (linear)
-      m_rrd.mob->SetPosition (itRemPoint->pos);
-
-      Ptr <MobilityBuildingInfo> buildingInfo = m_rrd.mob->GetObject <MobilityBuildingInfo> ();
-      buildingInfo->MakeConsistent (m_rrd.mob);
-      NS_ASSERT_MSG (buildingInfo, "buildingInfo is null");
+      m_tileReady.wait (lock, [this] ()
+                        {
+                          return m_stopRemWorkers || m_nextTileToCompute < m_nextTileToPrepare;
+                        });
+      if (m_stopRemWorkers)
+        {
+          return;
+        }
+      RemTile &tile = m_remTiles[m_nextTileToCompute++ % m_remTiles.size ()];
+      lock.unlock ();
+      CalcRemTile (tile);
+      lock.lock ();
+      tile.done = true;
+      m_tileDone.notify_one ();
+    }
+}
 
-      for (uint16_t i = 0; i < m_numOfIterationsToAverage; i++)
+void
+NrRadioEnvironmentMapHelper::CreateRemTileDevices (RemTile& tile) const
+{
+  NS_LOG_FUNCTION (this);
+
+  // Each tile has its own spectrum models, whose reference counts are updated
+  // by the SpectrumValues of the calculation. The same model of two devices
+  // is cloned once, to keep the devices on the same spectrum.
+  std::map<Ptr<const SpectrumModel>, Ptr<const SpectrumModel>> spectrumModels;
+  auto cloneSpectrumModel = [&spectrumModels] (const Ptr<const SpectrumModel>& model)
+    {
+      auto it = spectrumModels.find (model);
+      if (it == spectrumModels.end ())
         {
-          std::list <Ptr<SpectrumValue>> receivedPowerList;// RTD node id, rxPsd of the singal coming from that node
+          Ptr<const SpectrumModel> clone = Create<SpectrumModel> (Bands (model->Begin (), model->End ()));
+          it = spectrumModels.insert (std::make_pair (model, clone)).first;
+        }
+      return it->second;
+    };
 
-          for (std::list<RemDevice>::iterator itRtd = m_remDev.begin ();
-               itRtd != m_remDev.end ();
-               ++itRtd)
-            {
-              calcRxPsdCounter++;
+  // The copies of the RRD are created before the ones of the RTDs, so that
+  // their nodes have lower ids, as the RRD and the RTDs have
+  tile.rrds.clear ();
+  for (uint32_t i = 0; i < m_tileSize; i++)
+    {
+      tile.rrds.push_back (CopyRemDevice (m_rrd, cloneSpectrumModel (m_rrd.spectrumModel)));
+    }
+  tile.rtds.clear ();
+  for (const auto &rtd : m_remDev)
+    {
+      tile.rtds.push_back (CopyRemDevice (rtd, cloneSpectrumModel (rtd.spectrumModel)));
+    }
+
+  tile.noisePsd = Create<SpectrumValue> (cloneSpectrumModel (m_rrd.spectrumModel));
+  std::copy (m_noisePsd->ConstValuesBegin (), m_noisePsd->ConstValuesEnd (), tile.noisePsd->ValuesBegin ());
+}
 
-               // calculate received power from the current RTD device
-              receivedPowerList.push_back (CalcRxPsdValue (*itRtd, m_rrd));
-            } //end for std::list<RemDev>::iterator  (RTDs)
+NrRadioEnvironmentMapHelper::RemDevice
+NrRadioEnvironmentMapHelper::CopyRemDevice (const RemDevice& device,
+                                            const Ptr<const SpectrumModel>& spectrumModel) const
+{
+  NS_LOG_FUNCTION (this);
 
-          sumSnr += CalculateMaxSnr (receivedPowerList);
-          sumSinr += CalculateMaxSinr (receivedPowerList);
-          sumSir += CalculateMaxSir (receivedPowerList);
+  RemDevice copy;
+  copy.mob->SetPosition (device.mob->GetPosition ());
+  Ptr<MobilityBuildingInfo> buildingInfo = CreateObject<MobilityBuildingInfo> ();
+  copy.mob->AggregateObject (buildingInfo);
+  buildingInfo->MakeConsistent (copy.mob);
+
+  copy.antenna = Copy (device.antenna);
+  ObjectFactory elementFactory = ConfigureObjectFactory (ConstCast<AntennaModel> (device.antenna->GetAntennaElement ()));
+  copy.antenna->SetAntennaElement (elementFactory.Create<AntennaModel> ());
+
+  copy.txPower = device.txPower;
+  copy.bandwidth = device.bandwidth;
+  copy.frequency = device.frequency;
+  copy.numerology = device.numerology;
+  copy.spectrumModel = spectrumModel;
+  return copy;
+}
 
-          //Sum all the rxPowers (for this RemPoint) and put the result to the list for each Iteration (linear)
-          rxPsdsListPerIt.push_back (CalculateAggregatedIpsd (receivedPowerList));
+void
+NrRadioEnvironmentMapHelper::PrepareRemTile (RemTile& tile, size_t begin, size_t end)
+{
+  NS_LOG_FUNCTION (this << begin << end);
 
-          receivedPowerList.clear ();
-        }//end for m_numOfIterationsToAverage  (Average)
+  tile.begin = begin;
+  tile.end = end;
+  tile.done = false;
 
-      //Sum the rxPower for all the Iterations (linear)
-      double rxPsdsAllIt = SumListElements (rxPsdsListPerIt);
+  for (size_t i = begin; i < end; i++)
+    {
+      RemDevice &rrd = tile.rrds[i - begin];
+      rrd.mob->SetPosition (m_rem[i].pos);
+      Ptr <MobilityBuildingInfo> buildingInfo = rrd.mob->GetObject <MobilityBuildingInfo> ();
+      NS_ASSERT_MSG (buildingInfo, "buildingInfo is null");
+      buildingInfo->MakeConsistent (rrd.mob);
+    }
 
-      itRemPoint->avgSnrDb = sumSnr / static_cast <double> (m_numOfIterationsToAverage);
-      itRemPoint->avgSinrDb = sumSinr / static_cast <double> (m_numOfIterationsToAverage);
-      itRemPoint->avgSirDb = sumSir / static_cast <double> (m_numOfIterationsToAverage);
-      //do the average (for the rxPowers in each RemPoint) in linear and then convert to dBm
-      itRemPoint->avRxPowerDbm = WToDbm (rxPsdsAllIt / static_cast <double> (m_numOfIterationsToAverage));
+  size_t numOfModels = (end - begin) * GetNumOfCalcRxPsdPerRemPoint ();
+  tile.models.clear ();
+  tile.models.reserve (numOfModels);
+  for (size_t i = 0; i < numOfModels; i++)
+    {
+      tile.models.push_back (CreateTemporalPropagationModels ());
+      if (m_stream >= 0)
+        {
+          size_t index = begin * GetNumOfCalcRxPsdPerRemPoint () + i;
+          AssignStreams (tile.models.back (), m_stream + index * m_streamsPerModels);
+        }
+    }
+  tile.nextModels = tile.models.begin ();
+}
 
-      NS_LOG_INFO ("Avg snr value saved:" << itRemPoint->avgSnrDb);
-      NS_LOG_INFO ("Avg sinr value saved:" << itRemPoint->avgSinrDb);
-      NS_LOG_INFO ("Avg ipsd value saved (dBm):" << itRemPoint->avRxPowerDbm);
+void
+NrRadioEnvironmentMapHelper::CalcRemTile (RemTile& tile)
+{
+  NS_LOG_FUNCTION (this << tile.begin << tile.end);
 
-      if (++remPointCounter == remSizeNextReport)
+  for (size_t i = tile.begin; i < tile.end; i++)
+    {
+      RemDevice &rrd = tile.rrds[i - tile.begin];
+      if (m_remMode == COVERAGE_AREA)
+        {
+          CalcCoverageAreaRemPoint (tile, m_rem[i], rrd);
+        }
+      else if (m_remMode == BEAM_SHAPE)
         {
-          PrintProgressReport (&remSizeNextReport);
+          CalcBeamShapeRemPoint (tile, m_rem[i], rrd);
         }
+      else if (m_remMode == UE_COVERAGE)
+        {
+          CalcUeCoverageRemPoint (tile, m_rem[i], rrd);
+        }
+      else
+        {
+          NS_FATAL_ERROR ("Unknown REM mode");
+        }
+    }
+  NS_ASSERT_MSG (tile.nextModels == tile.models.end (),
+                 "The propagation models of the tile have not all been used");
+}
 
-    } //end for std::list<RemPoint>::iterator  (RemPoints)
+size_t
+NrRadioEnvironmentMapHelper::GetNumOfCalcRxPsdPerRemPoint () const
+{
+  size_t numRtds = m_remDev.size ();
+  if (m_remMode == COVERAGE_AREA)
+    {
+      // for each beam of the RRD, the beam itself and all the RTDs
+      return m_numOfIterationsToAverage * numRtds * (numRtds + 1);
+    }
+  else if (m_remMode == BEAM_SHAPE)
+    {
+      return m_numOfIterationsToAverage * numRtds;
+    }
+  else if (m_remMode == UE_COVERAGE)
+    {
+      // for each associated RTD, the useful signal and the interferers
+      return m_numOfIterationsToAverage * numRtds * numRtds;
+    }
+  NS_FATAL_ERROR ("Unknown REM mode");
+  return 0;
+}
 
-  auto remEndTime = std::chrono::system_clock::now ();
-  std::chrono::duration<double> remElapsedSeconds = remEndTime - m_remStartTime;
-  NS_LOG_INFO ("REM map created. Total time needed to create the REM map:" <<
-                 remElapsedSeconds.count () / 60 << " minutes.");
+void
+NrRadioEnvironmentMapHelper::CalcBeamShapeRemPoint (RemTile& tile, RemPoint& remPoint, RemDevice& rrd)
+{
+  NS_LOG_FUNCTION (this);
+
+  //perform calculation m_numOfIterationsToAverage times and get the average value
+  double sumSnr = 0.0, sumSinr = 0.0;
+  double sumSir = 0.0;
+  std::list<double> rxPsdsListPerIt; //list to save the summed rxPower in each RemPoint for each Iteration (linear)
+
+  for (uint16_t i = 0; i < m_numOfIterationsToAverage; i++)
+    {
+      std::list <Ptr<SpectrumValue>> receivedPowerList;// RTD node id, rxPsd of the singal coming from that node
+
+      for (std::vector<RemDevice>::iterator itRtd = tile.rtds.begin ();
+           itRtd != tile.rtds.end ();
+           ++itRtd)
+        {
+           // calculate received power from the current RTD device
+          receivedPowerList.push_back (CalcRxPsdValue (tile, *itRtd, rrd));
+        } //end for std::vector<RemDevice>::iterator  (RTDs)
+
+      sumSnr += CalculateMaxSnr (receivedPowerList, tile.noisePsd);
+      sumSinr += CalculateMaxSinr (receivedPowerList, tile.noisePsd);
+      sumSir += CalculateMaxSir (receivedPowerList);
+
+      //Sum all the rxPowers (for this RemPoint) and put the result to the list for each Iteration (linear)
+      rxPsdsListPerIt.push_back (CalculateAggregatedIpsd (receivedPowerList));
+
+      receivedPowerList.clear ();
+    }//end for m_numOfIterationsToAverage  (Average)
+
+  //Sum the rxPower for all the Iterations (linear)
+  double rxPsdsAllIt = SumListElements (rxPsdsListPerIt);
+
+  remPoint.avgSnrDb = sumSnr / static_cast <double> (m_numOfIterationsToAverage);
+  remPoint.avgSinrDb = sumSinr / static_cast <double> (m_numOfIterationsToAverage);
+  remPoint.avgSirDb = sumSir / static_cast <double> (m_numOfIterationsToAverage);
+  //do the average (for the rxPowers in each RemPoint) in linear and then convert to dBm
+  remPoint.avRxPowerDbm = WToDbm (rxPsdsAllIt / static_cast <double> (m_numOfIterationsToAverage));
+
+  NS_LOG_INFO ("Avg snr value saved:" << remPoint.avgSnrDb);
+  NS_LOG_INFO ("Avg sinr value saved:" << remPoint.avgSinrDb);
+  NS_LOG_INFO ("Avg ipsd value saved (dBm):" << remPoint.avRxPowerDbm);
 }
 
 double
@@ -962,7 +1290,7 @@ double
 NrRadioEnvironmentMapHelper::CalculateAggregatedIpsd (const std::list <Ptr<SpectrumValue>>& receivedSignals)
 {
     Ptr<SpectrumValue> sumRxPowers = nullptr;
-    sumRxPowers = Create<SpectrumValue> (m_rrd.spectrumModel);
+    sumRxPowers = Create<SpectrumValue> ((*receivedSignals.begin ())->GetSpectrumModel ());
 
     // sum the received power of all the rtds
     for (auto rxPowersIt: receivedSignals)
@@ -991,121 +1319,95 @@ NrRadioEnvironmentMapHelper::SumListElements (const std::list<double>& listOfVal
 }
 
 void
-NrRadioEnvironmentMapHelper::CalcCoverageAreaRemMap ()
+NrRadioEnvironmentMapHelper::CalcCoverageAreaRemPoint (RemTile& tile, RemPoint& remPoint, RemDevice& rrd)
 {
   NS_LOG_FUNCTION (this);
-  uint16_t calcRxPsdCounter = 0;
-  uint32_t remSizeNextReport = m_rem.size () / 100;
-  uint32_t remPointCounter = 0;
 
-  for (std::list<RemPoint>::iterator itRemPoint = m_rem.begin ();
-      itRemPoint != m_rem.end ();
-      ++itRemPoint)
+  //perform calculation m_numOfIterationsToAverage times and get the average value
+  double sumSnr = 0.0, sumSinr = 0.0;
+
+  // all RTDs should point toward that RemPoint with DirectPah beam, this is definition of worst-case scenario
+  for (std::vector<RemDevice>::iterator itRtd = tile.rtds.begin ();
+       itRtd != tile.rtds.end ();
+       ++itRtd)
     {
-      //perform calculation m_numOfIterationsToAverage times and get the average value
-      double sumSnr = 0.0, sumSinr = 0.0;
-      m_rrd.mob->SetPosition (itRemPoint->pos);
-
-      // all RTDs should point toward that RemPoint with DirectPah beam, this is definition of worst-case scenario
-     for(std::list<RemDevice>::iterator itRtd = m_remDev.begin ();
-         itRtd != m_remDev.end ();
-                ++itRtd)
-        {
-          ConfigureDirectPathBfv (*itRtd, m_rrd, itRtd->antenna);
-        }
+      ConfigureDirectPathBfv (*itRtd, rrd, itRtd->antenna);
+    }
 
-      std::list<double> rxPsdsListPerIt; //list to save the summed rxPower in each RemPoint for each Iteration (linear)
+  std::list<double> rxPsdsListPerIt; //list to save the summed rxPower in each RemPoint for each Iteration (linear)
 
-      for (uint16_t i = 0; i < m_numOfIterationsToAverage; i++)
-        {
-          std::list<double> sinrsPerBeam; // vector in which we will save sinr per each RRD beam
-          std::list<double> snrsPerBeam; // vector in which we will save snr per each RRD beam
+  for (uint16_t i = 0; i < m_numOfIterationsToAverage; i++)
+    {
+      std::list<double> sinrsPerBeam; // vector in which we will save sinr per each RRD beam
+      std::list<double> snrsPerBeam; // vector in which we will save snr per each RRD beam
 
-          std::list<Ptr<SpectrumValue>> rxPsdsList; //vector in which we will save the sum of rxPowers per remPoint (linear)
+      std::list<Ptr<SpectrumValue>> rxPsdsList; //vector in which we will save the sum of rxPowers per remPoint (linear)
 
-          // For each beam configuration at RemPoint/RRD we should calculate SINR, there are as many beam configurations at RemPoint as many RTDs
-          for (std::list<RemDevice>::iterator itRtdBeam = m_remDev.begin (); itRtdBeam != m_remDev.end (); ++itRtdBeam)
-            {
-              //configure RRD beam toward RTD
-              ConfigureDirectPathBfv (m_rrd, *itRtdBeam, m_rrd.antenna);
+      // For each beam configuration at RemPoint/RRD we should calculate SINR, there are as many beam configurations at RemPoint as many RTDs
+      for (std::vector<RemDevice>::iterator itRtdBeam = tile.rtds.begin (); itRtdBeam != tile.rtds.end (); ++itRtdBeam)
+        {
+          //configure RRD beam toward RTD
+          ConfigureDirectPathBfv (rrd, *itRtdBeam, rrd.antenna);
 
-              //Calculate the received power from this RTD for this RemPoint
-              Ptr<SpectrumValue> receivedPowerFromRtd = CalcRxPsdValue (*itRtdBeam, m_rrd);
-              //and put it to the list of the received powers for this RemPoint (to sum all later)
-              rxPsdsList.push_back (receivedPowerFromRtd);
+          //Calculate the received power from this RTD for this RemPoint
+          Ptr<SpectrumValue> receivedPowerFromRtd = CalcRxPsdValue (tile, *itRtdBeam, rrd);
+          //and put it to the list of the received powers for this RemPoint (to sum all later)
+          rxPsdsList.push_back (receivedPowerFromRtd);
 
-              NS_LOG_DEBUG ("beam node: " << itRtdBeam->dev->GetNode ()->GetId () <<
-                            " is Rxed in RemPoint with Rx Power in W: " << (Integral (*receivedPowerFromRtd)));
-              NS_LOG_DEBUG ("RxPower in dBm: " << WToDbm (Integral (*receivedPowerFromRtd)));
+          NS_LOG_DEBUG ("beam node: " << itRtdBeam->dev->GetNode ()->GetId () <<
+                        " is Rxed in RemPoint with Rx Power in W: " << (Integral (*receivedPowerFromRtd)));
+          NS_LOG_DEBUG ("RxPower in dBm: " << WToDbm (Integral (*receivedPowerFromRtd)));
 
-              std::list<Ptr<SpectrumValue>> interferenceSignalsRxPsds;
-              Ptr<SpectrumValue> usefulSignalRxPsd;
+          std::list<Ptr<SpectrumValue>> interferenceSignalsRxPsds;
+          Ptr<SpectrumValue> usefulSignalRxPsd;
 
-              // For this configuration of beam at RRD, we need to calculate RX PSD,
-              // and in order to be able to calculate SINR for that beam,
-              // we need to calculate received PSD for each RTD using this beam at RRD
-              for(std::list<RemDevice>::iterator itRtdCalc = m_remDev.begin (); itRtdCalc != m_remDev.end (); ++itRtdCalc)
-                {
-                  // increase counter de calcRXPsd calls
-                  calcRxPsdCounter++;
-                  // calculate received power from the current RTD device
-                  Ptr<SpectrumValue> receivedPower = CalcRxPsdValue (*itRtdCalc, m_rrd);
+          // For this configuration of beam at RRD, we need to calculate RX PSD,
+          // and in order to be able to calculate SINR for that beam,
+          // we need to calculate received PSD for each RTD using this beam at RRD
+          for (std::vector<RemDevice>::iterator itRtdCalc = tile.rtds.begin (); itRtdCalc != tile.rtds.end (); ++itRtdCalc)
+            {
+              // calculate received power from the current RTD device
+              Ptr<SpectrumValue> receivedPower = CalcRxPsdValue (tile, *itRtdCalc, rrd);
 
-                  // is this received power useful signal (from RTD for which I configured my beam) or is interference signal
+              // is this received power useful signal (from RTD for which I configured my beam) or is interference signal
 
-                  if (itRtdBeam->dev->GetNode ()->GetId () == itRtdCalc->dev->GetNode ()->GetId ())
-                    {
-                      if (usefulSignalRxPsd != nullptr)
-                        {
-                          NS_FATAL_ERROR ("Already assigned usefulSignal!");
-                        }
-                      usefulSignalRxPsd = receivedPower;
-                    }
-                  else
+              if (itRtdBeam->dev->GetNode ()->GetId () == itRtdCalc->dev->GetNode ()->GetId ())
+                {
+                  if (usefulSignalRxPsd != nullptr)
                     {
-                      interferenceSignalsRxPsds.push_back (receivedPower);  //interference
+                      NS_FATAL_ERROR ("Already assigned usefulSignal!");
                     }
+                  usefulSignalRxPsd = receivedPower;
+                }
+              else
+                {
+                  interferenceSignalsRxPsds.push_back (receivedPower);  //interference
+                }
 
-                } //end for std::list<RemDev>::iterator itRtdCalc (RTDs)
-
-              sinrsPerBeam.push_back (CalculateSinr (usefulSignalRxPsd, interferenceSignalsRxPsds));
-              snrsPerBeam.push_back (CalculateSnr (usefulSignalRxPsd));
-
-              NS_LOG_INFO ("Done:" <<
-                           (double)calcRxPsdCounter/(m_rem.size()*m_numOfIterationsToAverage*m_remDev.size ()*m_remDev.size()) * 100 <<
-                           " %."); // how many times will be called CalcRxPsdValues
+            } //end for std::vector<RemDevice>::iterator itRtdCalc (RTDs)
 
-            } //end for std::list<RemDev>::iterator itRtdBeam (RTDs)
+          sinrsPerBeam.push_back (CalculateSinr (usefulSignalRxPsd, interferenceSignalsRxPsds, tile.noisePsd));
+          snrsPerBeam.push_back (CalculateSnr (usefulSignalRxPsd, tile.noisePsd));
 
-          sumSnr += GetMaxValue (snrsPerBeam);
-          sumSinr += GetMaxValue (sinrsPerBeam);
+        } //end for std::vector<RemDevice>::iterator itRtdBeam (RTDs)
 
-          //Sum all the rxPowers (for this RemPoint) and put the result to the list for each Iteration (linear)
-          rxPsdsListPerIt.push_back (CalculateAggregatedIpsd (rxPsdsList));
+      sumSnr += GetMaxValue (snrsPerBeam);
+      sumSinr += GetMaxValue (sinrsPerBeam);
 
-        }//end for m_numOfIterationsToAverage  (Average)
+      //Sum all the rxPowers (for this RemPoint) and put the result to the list for each Iteration (linear)
+      rxPsdsListPerIt.push_back (CalculateAggregatedIpsd (rxPsdsList));
 
-      //Sum the rxPower for all the Iterations (linear)
-      double rxPsdsAllIt = SumListElements (rxPsdsListPerIt);
+    }//end for m_numOfIterationsToAverage  (Average)
 
-      itRemPoint->avgSnrDb = sumSnr / static_cast <double> (m_numOfIterationsToAverage);
-      itRemPoint->avgSinrDb = sumSinr / static_cast <double> (m_numOfIterationsToAverage);
-      //do the average (for the rxPowers in each RemPoint) in linear and then convert to dBm
-      itRemPoint->avRxPowerDbm = WToDbm (rxPsdsAllIt / static_cast <double> (m_numOfIterationsToAverage));
+  //Sum the rxPower for all the Iterations (linear)
+  double rxPsdsAllIt = SumListElements (rxPsdsListPerIt);
 
-      if (++remPointCounter == remSizeNextReport)
-        {
-          PrintProgressReport (&remSizeNextReport);
-        }
+  remPoint.avgSnrDb = sumSnr / static_cast <double> (m_numOfIterationsToAverage);
+  remPoint.avgSinrDb = sumSinr / static_cast <double> (m_numOfIterationsToAverage);
+  //do the average (for the rxPowers in each RemPoint) in linear and then convert to dBm
+  remPoint.avRxPowerDbm = WToDbm (rxPsdsAllIt / static_cast <double> (m_numOfIterationsToAverage));
 
-      NS_LOG_DEBUG ("itRemPoint->avRxPowerDb  in dB: " << itRemPoint->avRxPowerDbm);
-
-    } //end for std::list<RemPoint>::iterator  (RemPoints)
-
-  auto remEndTime = std::chrono::system_clock::now ();
-  std::chrono::duration<double> remElapsedSeconds = remEndTime - m_remStartTime;
-  NS_LOG_INFO ("REM map created. Total time needed to create the REM map:" <<
-                 remElapsedSeconds.count () / 60 << " minutes.");
+  NS_LOG_DEBUG ("remPoint.avRxPowerDb  in dB: " << remPoint.avRxPowerDbm);
 }
 
 void
@@ -1128,90 +1430,70 @@ NrRadioEnvironmentMapHelper::PrintProgressReport (uint32_t* remSizeNextReport)
 }
 
 void
-NrRadioEnvironmentMapHelper::CalcUeCoverageRemMap ()
+NrRadioEnvironmentMapHelper::CalcUeCoverageRemPoint (RemTile& tile, RemPoint& remPoint, RemDevice& rrd)
 {
     NS_LOG_FUNCTION (this);
 
-    uint32_t remSizeNextReport = m_rem.size () / 100;
-    uint32_t remPointCounter = 0;
+    //perform calculation m_numOfIterationsToAverage times and get the average value
+    double sumSnr = 0.0, sumSinr = 0.0;
 
-    for (std::list<RemPoint>::iterator itRemPoint = m_rem.begin ();
-        itRemPoint != m_rem.end ();
-        ++itRemPoint)
+    for (uint16_t i = 0; i < m_numOfIterationsToAverage; i++)
       {
-        //perform calculation m_numOfIterationsToAverage times and get the average value
-        double sumSnr = 0.0, sumSinr = 0.0;
-        m_rrd.mob->SetPosition (itRemPoint->pos);
+        std::list<double> sinrsPerBeam; // vector in which we will save sinr per each RRD beam
+        std::list<double> snrsPerBeam; // vector in which we will save snr per each RRD beam
 
-        for (uint16_t i = 0; i < m_numOfIterationsToAverage; i++)
+        //"Associate" UE (RemPoint) with this RTD
+        for (std::vector<RemDevice>::iterator itRtdAssociated = tile.rtds.begin ();
+             itRtdAssociated != tile.rtds.end ();
+             ++itRtdAssociated)
           {
-            std::list<double> sinrsPerBeam; // vector in which we will save sinr per each RRD beam
-            std::list<double> snrsPerBeam; // vector in which we will save snr per each RRD beam
+            //configure RRD (RemPoint) beam toward RTD (itRtdAssociated)
+            ConfigureDirectPathBfv (rrd, *itRtdAssociated, rrd.antenna);
+            //configure RTD (itRtdAssociated) beam toward RRD (RemPoint)
+            ConfigureDirectPathBfv (*itRtdAssociated, rrd, itRtdAssociated->antenna);
+
+            std::list<Ptr<SpectrumValue>> interferenceSignalsRxPsds;
+            Ptr<SpectrumValue> usefulSignalRxPsd;
 
-            //"Associate" UE (RemPoint) with this RTD
-            for (std::list<RemDevice>::iterator itRtdAssociated = m_remDev.begin ();
-                 itRtdAssociated != m_remDev.end ();
-                 ++itRtdAssociated)
+            for (std::vector<RemDevice>::iterator itRtdInterferer = tile.rtds.begin ();
+                 itRtdInterferer != tile.rtds.end ();
+                 ++itRtdInterferer)
               {
-                //configure RRD (RemPoint) beam toward RTD (itRtdAssociated)
-                ConfigureDirectPathBfv (m_rrd, *itRtdAssociated, m_rrd.antenna);
-                //configure RTD (itRtdAssociated) beam toward RRD (RemPoint)
-                ConfigureDirectPathBfv (*itRtdAssociated, m_rrd, itRtdAssociated->antenna);
-
-                std::list<Ptr<SpectrumValue>> interferenceSignalsRxPsds;
-                Ptr<SpectrumValue> usefulSignalRxPsd;
-
-                for(std::list<RemDevice>::iterator itRtdInterferer = m_remDev.begin ();
-                    itRtdInterferer != m_remDev.end ();
-                    ++itRtdInterferer)
-                  {
-                    if (itRtdAssociated->dev->GetNode ()->GetId () != itRtdInterferer->dev->GetNode ()->GetId ())
-                    {
-                      //configure RTD (itRtdInterferer) beam toward RTD (itRtdAssociated)
-                      ConfigureDirectPathBfv (*itRtdInterferer, *itRtdAssociated, itRtdInterferer->antenna);
+                if (itRtdAssociated->dev->GetNode ()->GetId () != itRtdInterferer->dev->GetNode ()->GetId ())
+                {
+                  //configure RTD (itRtdInterferer) beam toward RTD (itRtdAssociated)
+                  ConfigureDirectPathBfv (*itRtdInterferer, *itRtdAssociated, itRtdInterferer->antenna);
 
-                      // calculate received power (interference) from the current RTD device
-                      Ptr<SpectrumValue> receivedPower = CalcRxPsdValue (*itRtdInterferer, *itRtdAssociated);
+                  // calculate received power (interference) from the current RTD device
+                  Ptr<SpectrumValue> receivedPower = CalcRxPsdValue (tile, *itRtdInterferer, *itRtdAssociated);
 
-                      interferenceSignalsRxPsds.push_back (receivedPower);  //interference
-                    }
-                    else
+                  interferenceSignalsRxPsds.push_back (receivedPower);  //interference
+                }
+                else
+                {
+                  // calculate received power (useful Signal) from the current RRD device
+                  Ptr<SpectrumValue> receivedPower = CalcRxPsdValue (tile, rrd, *itRtdAssociated);
+                  if (usefulSignalRxPsd != nullptr)
                     {
-                      // calculate received power (useful Signal) from the current RRD device
-                      Ptr<SpectrumValue> receivedPower = CalcRxPsdValue (m_rrd, *itRtdAssociated);
-                      if (usefulSignalRxPsd != nullptr)
-                        {
-                          NS_FATAL_ERROR ("Already assigned usefulSignal!");
-                        }
-                      usefulSignalRxPsd = receivedPower;
+                      NS_FATAL_ERROR ("Already assigned usefulSignal!");
                     }
+                  usefulSignalRxPsd = receivedPower;
+                }
 
-                  }//end for std::list<RemDev>::iterator itRtdInterferer (RTD)
-
-                sinrsPerBeam.push_back (CalculateSinr (usefulSignalRxPsd, interferenceSignalsRxPsds));
-                snrsPerBeam.push_back (CalculateSnr (usefulSignalRxPsd));
-
-              }//end for std::list<RemDev>::iterator itRtdAssociated (RTD)
+              }//end for std::vector<RemDevice>::iterator itRtdInterferer (RTD)
 
-            sumSnr += GetMaxValue (snrsPerBeam);
-            sumSinr += GetMaxValue (sinrsPerBeam);
+            sinrsPerBeam.push_back (CalculateSinr (usefulSignalRxPsd, interferenceSignalsRxPsds, tile.noisePsd));
+            snrsPerBeam.push_back (CalculateSnr (usefulSignalRxPsd, tile.noisePsd));
 
-          }//end for m_numOfIterationsToAverage  (Average)
+          }//end for std::vector<RemDevice>::iterator itRtdAssociated (RTD)
 
-        itRemPoint->avgSnrDb = sumSnr / static_cast <double> (m_numOfIterationsToAverage);
-        itRemPoint->avgSinrDb = sumSinr / static_cast <double> (m_numOfIterationsToAverage);
+        sumSnr += GetMaxValue (snrsPerBeam);
+        sumSinr += GetMaxValue (sinrsPerBeam);
 
-        if (++remPointCounter == remSizeNextReport)
-          {
-            PrintProgressReport (&remSizeNextReport);
-          }
+      }//end for m_numOfIterationsToAverage  (Average)
 
-      }//end for std::list<RemPoint>::iterator  (RemPoints)
-
-    auto remEndTime = std::chrono::system_clock::now ();
-    std::chrono::duration<double> remElapsedSeconds = remEndTime - m_remStartTime;
-    NS_LOG_INFO ("REM map created. Total time needed to create the REM map:" <<
-                 remElapsedSeconds.count () / 60 << " minutes.");
+    remPoint.avgSnrDb = sumSnr / static_cast <double> (m_numOfIterationsToAverage);
+    remPoint.avgSinrDb = sumSinr / static_cast <double> (m_numOfIterationsToAverage);
 }
 
 NrRadioEnvironmentMapHelper::PropagationModels
@@ -1224,12 +1506,11 @@ NrRadioEnvironmentMapHelper::CreateTemporalPropagationModels () const
   Ptr<ChannelConditionModel> condModelCopy = m_channelConditionModelFactory.Create<ChannelConditionModel> ();
 
   //create rem copy of propagation model
-  ObjectFactory propLossModelFactory = ConfigureObjectFactory (m_propagationLossModel);
-  propModels.remPropagationLossModelCopy = propLossModelFactory.Create <ThreeGppPropagationLossModel> ();
+  propModels.remPropagationLossModelCopy = m_propagationLossModelFactory.Create <ThreeGppPropagationLossModel> ();
   propModels.remPropagationLossModelCopy->SetChannelConditionModel (condModelCopy);
 
   //create rem copy of spectrum loss model
-  ObjectFactory spectrumLossModelFactory = ConfigureObjectFactory (m_phasedArraySpectrumLossModel);
+  ObjectFactory spectrumLossModelFactory = m_spectrumLossModelFactory;
   if (spectrumLossModelFactory.IsTypeIdSet())
     {
       Ptr<MatrixBasedChannelModel> channelModelCopy = m_matrixBasedChannelModelFactory.Create<MatrixBasedChannelModel>();
@@ -1240,6 +1521,25 @@ NrRadioEnvironmentMapHelper::CreateTemporalPropagationModels () const
   return propModels;
 }
 
+int64_t
+NrRadioEnvironmentMapHelper::AssignStreams (const PropagationModels& models, int64_t stream) const
+{
+  NS_LOG_FUNCTION (this << stream);
+
+  int64_t currentStream = stream;
+  currentStream += models.remPropagationLossModelCopy->GetChannelConditionModel ()->AssignStreams (currentStream);
+  currentStream += models.remPropagationLossModelCopy->AssignStreams (currentStream);
+  if (models.remSpectrumLossModelCopy)
+    {
+      Ptr<ThreeGppChannelModel> channelModel = DynamicCast<ThreeGppChannelModel> (models.remSpectrumLossModelCopy->GetChannelModel ());
+      if (channelModel)
+        {
+          currentStream += channelModel->AssignStreams (currentStream);
+        }
+    }
+  return currentStream - stream;
+}
+
 void
 NrRadioEnvironmentMapHelper::PrintGnuplottableGnbListToFile (const std::string &filename)
 {
@@ -1317,41 +1617,22 @@ NrRadioEnvironmentMapHelper::PrintGnuplottableBuildingListToFile (const std::str
 }
 
 void
-NrRadioEnvironmentMapHelper::PrintRemToFile ()
+NrRadioEnvironmentMapHelper::PrintRemToFile (std::ofstream &outFile, const RemTile &tile) const
 {
   NS_LOG_FUNCTION (this);
 
-  std::ostringstream oss;
-  oss << "nr-rem-" << m_simTag.c_str() <<".out";
-
-  std::ofstream outFile;
-  std::string outputFile = oss.str ();
-  outFile.open (outputFile.c_str ());
-
-  if (!outFile.is_open ())
-      {
-        NS_FATAL_ERROR ("Can't open file " << (outputFile));
-        return;
-      }
-
-  for (std::list<RemPoint>::iterator it = m_rem.begin ();
-       it != m_rem.end ();
-       ++it)
+  for (size_t i = tile.begin; i < tile.end; i++)
     {
-      outFile << it->pos.x << "\t" <<
-                 it->pos.y << "\t" <<
-                 it->pos.z << "\t" <<
-                 it->avgSnrDb << "\t" <<
-                 it->avgSinrDb << "\t" <<
-                 it->avRxPowerDbm << "\t" <<
-                 it->avgSirDb << "\t" <<
+      const RemPoint &remPoint = m_rem[i];
+      outFile << remPoint.pos.x << "\t" <<
+                 remPoint.pos.y << "\t" <<
+                 remPoint.pos.z << "\t" <<
+                 remPoint.avgSnrDb << "\t" <<
+                 remPoint.avgSinrDb << "\t" <<
+                 remPoint.avRxPowerDbm << "\t" <<
+                 remPoint.avgSirDb << "\t" <<
                  std::endl;
     }
-
-  outFile.close();
-
-  CreateCustomGnuplotFile ();
-  Finalize ();
 }
 
 void
@@ -31,6 +31,9 @@
 #include <fstream>
 #include <ns3/mobility-helper.h>
 #include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
 
 namespace ns3 {
 
@@ -73,6 +76,13 @@ class UniformPlanarArray;
  * N iterations (specified by the user) in order to consider the randomness of
  * the channel
  *
+ * The REM points are computed in tiles of consecutive points by "NumThreads"
+ * threads. Each tile has its own copies of the devices, and the propagation
+ * models of its points are created on the simulator thread, in the order of the
+ * points, so the map does not depend on the number of threads. The tiles are
+ * written to the output file as soon as they are computed, in the order of the
+ * points, so the file holds a partial map while the map is being generated.
+ *
  * For the CoverageArea REM generation the user can include the following code
  * in the desired example script:
  *
@@ -199,6 +209,26 @@ public:
    */
   void SetInstallationDelay (const Time &installationDelay);
 
+  /**
+   * \brief Sets the number of threads that compute the REM points
+   * \param numThreads The number of threads, including the simulator thread,
+   * or 0 for one thread per hardware thread
+   */
+  void SetNumThreads (uint32_t numThreads);
+
+  /**
+   * \brief Sets the number of REM points of a tile
+   * \param tileSize The number of REM points
+   */
+  void SetTileSize (uint32_t tileSize);
+
+  /**
+   * \brief Sets the first random stream of the propagation models of the
+   * REM points
+   * \param stream The stream, or -1 to allocate the streams automatically
+   */
+  void SetStream (int64_t stream);
+
   /**
    * \brief Get the type of REM Map to be generated
    * \return The type of the map (BeamShape/CoverageArea/UeCoverage)
@@ -242,6 +272,22 @@ public:
    */
   double GetZ () const;
 
+  /**
+   * \return Gets the number of threads that compute the REM points
+   */
+  uint32_t GetNumThreads () const;
+
+  /**
+   * \return Gets the number of REM points of a tile
+   */
+  uint32_t GetTileSize () const;
+
+  /**
+   * \return Gets the first random stream of the propagation models of the
+   * REM points, or -1 if they are allocated automatically
+   */
+  int64_t GetStream () const;
+
   /**
    * \brief Convert from Watts to dBm.
    * \param w the power in Watts
@@ -338,6 +384,25 @@ private:
     Ptr<ThreeGppSpectrumPropagationLossModel> remSpectrumLossModelCopy;
   };
 
+  /**
+   * \brief This struct includes a range of consecutive Rem Points, and the
+   * devices and the propagation models used to compute them. A tile is
+   * prepared on the simulator thread and computed by a single thread, so the
+   * threads never share an object. The tiles are reused for the next points
+   * once they are written.
+   */
+  struct RemTile
+  {
+    size_t begin {0};  ///< Index of the first Rem Point of the tile
+    size_t end {0};    ///< Index after the last Rem Point of the tile
+    bool done {false}; ///< Whether the Rem Points of the tile have been computed
+    std::vector<RemDevice> rrds; ///< Copies of the RRD, one per Rem Point
+    std::vector<RemDevice> rtds; ///< Copies of the RTDs
+    Ptr<SpectrumValue> noisePsd; ///< Noise PSD on the spectrum model of the RRD copies
+    std::vector<PropagationModels> models; ///< Propagation models of the CalcRxPsdValue calls, in call order
+    std::vector<PropagationModels>::const_iterator nextModels; ///< Propagation models of the next call
+  };
+
   /**
    * \brief This method creates the list of Rem Points (coordinates) based on
    * the min/max coprdinates and the resolution defined by the user
@@ -375,40 +440,101 @@ private:
                                          const Ptr<NetDevice> &rrdDevice);
 
   /**
-   * \brief This function generates a BeamShape map. Using the configuration
-   * of antennas as have been set in the user scenario script, it calculates
-   * the SNR/SINR/IPSD.
+   * \brief This function generates the map: it prepares the tiles of Rem
+   * Points, computes them on NumThreads threads, and writes them to the
+   * output file in the order of the points.
    */
-  void CalcBeamShapeRemMap ();
+  void CalcRemMap ();
 
   /**
-   * \brief This function generates a CoverageArea map. In this case, all the
-   * antennas of the rtds are set to point towards the rem point and the antenna
-   * of the rem point towards each rtd device.
+   * \brief Loop of the threads that compute the tiles, besides the
+   * simulator thread
    */
-  void CalcCoverageAreaRemMap ();
+  void RemWorkerLoop ();
 
   /**
-   * \brief This function generates a Ue Coverage map that depicts the SNR of
-   * this UE with respect to its UL transmission towards the gNB form various
-   * points on the map.
+   * \brief Creates the devices of a tile, copying the RRD and the RTDs
+   * \param tile The tile
+   */
+  void CreateRemTileDevices (RemTile& tile) const;
+
+  /**
+   * \brief Creates a copy of a device, with its own node, antenna and
+   * spectrum model
+   * \param device The device to copy
+   * \param spectrumModel The spectrum model of the copy
+   * \return The copy of the device
+   */
+  RemDevice CopyRemDevice (const RemDevice& device,
+                           const Ptr<const SpectrumModel>& spectrumModel) const;
+
+  /**
+   * \brief Prepares a tile for a range of Rem Points: it places the copies
+   * of the RRD, and creates the propagation models that the points use
+   * \param tile The tile
+   * \param begin The index of the first Rem Point of the tile
+   * \param end The index after the last Rem Point of the tile
+   */
+  void PrepareRemTile (RemTile& tile, size_t begin, size_t end);
+
+  /**
+   * \brief Computes the Rem Points of a tile
+   * \param tile The tile
+   */
+  void CalcRemTile (RemTile& tile);
+
+  /**
+   * \return The number of calls to CalcRxPsdValue needed by a Rem Point
+   */
+  size_t GetNumOfCalcRxPsdPerRemPoint () const;
+
+  /**
+   * \brief This function computes a Rem Point of a BeamShape map. Using the
+   * configuration of antennas as have been set in the user scenario script,
+   * it calculates the SNR/SINR/IPSD.
+   * \param tile The tile of the Rem Point
+   * \param remPoint The Rem Point
+   * \param rrd The copy of the RRD placed at the Rem Point
+   */
+  void CalcBeamShapeRemPoint (RemTile& tile, RemPoint& remPoint, RemDevice& rrd);
+
+  /**
+   * \brief This function computes a Rem Point of a CoverageArea map. In this
+   * case, all the antennas of the rtds are set to point towards the rem point
+   * and the antenna of the rem point towards each rtd device.
+   * \param tile The tile of the Rem Point
+   * \param remPoint The Rem Point
+   * \param rrd The copy of the RRD placed at the Rem Point
+   */
+  void CalcCoverageAreaRemPoint (RemTile& tile, RemPoint& remPoint, RemDevice& rrd);
+
+  /**
+   * \brief This function computes a Rem Point of a Ue Coverage map that
+   * depicts the SNR of this UE with respect to its UL transmission towards the
+   * gNB form various points on the map.
    * An additional SINR map is also generated that can be used in mixed TDD/FDD
    * scenarios considering interference from neighbor gNBs that transmit in DL.
+   * \param tile The tile of the Rem Point
+   * \param remPoint The Rem Point
+   * \param rrd The copy of the RRD placed at the Rem Point
    */
-  void CalcUeCoverageRemMap ();
+  void CalcUeCoverageRemPoint (RemTile& tile, RemPoint& remPoint, RemDevice& rrd);
 
   /**
-   * \brief This method calculates the PSD
+   * \brief This method calculates the PSD, with the next propagation models
+   * of the tile
    * \return The PSD (spectrumValue)
    */
-  Ptr<SpectrumValue> CalcRxPsdValue (RemDevice& device, RemDevice& otherDevice) const;
+  Ptr<SpectrumValue> CalcRxPsdValue (RemTile& tile, RemDevice& device, RemDevice& otherDevice) const;
 
   /**
    * \brief This function calculates the SNR.
    * \param usefulSignal The useful Signal
+   * \param noisePsd The noise PSD
    * \return The snr
    */
-  double CalculateSnr (const Ptr<SpectrumValue>& usefulSignal) const;
+  double CalculateSnr (const Ptr<SpectrumValue>& usefulSignal,
+                       const Ptr<const SpectrumValue>& noisePsd) const;
 
   /**
    * \brief This function finds the max value in a space of frequency-dependent
@@ -422,17 +548,21 @@ private:
    * \brief This function finds the max value in a space of frequency-dependent
    * values (such as PSD).
    * \param values The list of spectrumValues for which we want to find the max
+   * \param noisePsd The noise PSD
    * \return The max value (snr)
    */
-  double CalculateMaxSnr (const std::list <Ptr<SpectrumValue>>& receivedPowerList) const;
+  double CalculateMaxSnr (const std::list <Ptr<SpectrumValue>>& receivedPowerList,
+                          const Ptr<const SpectrumValue>& noisePsd) const;
 
   /**
    * \brief This function finds the max value in a space of frequency-dependent
    * values (such as PSD).
    * \param values The list of spectrumValues for which we want to find the max
+   * \param noisePsd The noise PSD
    * \return The max value (sinr)
    */
-  double CalculateMaxSinr (const std::list <Ptr<SpectrumValue>>& receivedPowerList) const;
+  double CalculateMaxSinr (const std::list <Ptr<SpectrumValue>>& receivedPowerList,
+                           const Ptr<const SpectrumValue>& noisePsd) const;
 
   /**
    * \brief This function finds the max value in a space of frequency-dependent
@@ -447,10 +577,12 @@ private:
    * values (such as PSD).
    * \param usefulSignal The spectrumValue considered as useful signal
    * \param interferenceSignals The list of spectrumValues considered as interference
+   * \param noisePsd The noise PSD
    * \return The max value (sinr)
    */
   double CalculateSinr (const Ptr<SpectrumValue>& usefulSignal,
-                        const std::list <Ptr<SpectrumValue>>& interferenceSignals) const;
+                        const std::list <Ptr<SpectrumValue>>& interferenceSignals,
+                        const Ptr<const SpectrumValue>& noisePsd) const;
 
   /**
    * \brief This function calculates the SIR for a given space of frequency-dependent
@@ -501,6 +633,14 @@ private:
    */
   PropagationModels CreateTemporalPropagationModels () const;
 
+  /**
+   * \brief Assigns fixed random streams to temporal propagation models
+   * \param models The temporal propagation models
+   * \param stream The first stream to use
+   * \return The number of streams assigned
+   */
+  int64_t AssignStreams (const PropagationModels& models, int64_t stream) const;
+
   /**
    * \brief Prints REM generation progress report
    */
@@ -522,10 +662,12 @@ private:
   void PrintGnuplottableBuildingListToFile (const std::string &filename);
 
   /**
-   * \brief this method goes through every Rem Point and prints the
+   * \brief this method goes through the Rem Points of a tile and prints the
    * calculated SNR/SINR/IPSD values.
+   * \param outFile The REM output file
+   * \param tile The tile
    */
-  void PrintRemToFile ();
+  void PrintRemToFile (std::ofstream &outFile, const RemTile &tile) const;
 
   /*
    * Creates rem_plot${SimTag}.gnuplot file
@@ -553,7 +695,7 @@ private:
                                const Ptr<const UniformPlanarArray>& antenna);
 
   std::list<RemDevice> m_remDev; ///< List of REM Transmiting Devices (RTDs).
-  std::list<RemPoint> m_rem; ///< List of REM points.
+  std::vector<RemPoint> m_rem; ///< REM points, in the order of the output file.
 
   std::chrono::system_clock::time_point m_remStartTime; //!< Time at which REM generation has started
 
@@ -572,6 +714,18 @@ private:
 
   uint16_t m_numOfIterationsToAverage {1};
   Time m_installationDelay {Seconds(0)};
+  uint32_t m_numThreads {1}; ///< The `NumThreads` attribute.
+  uint32_t m_tileSize {16};  ///< The `TileSize` attribute.
+  int64_t m_stream {-1};     ///< The `Stream` attribute.
+  int64_t m_streamsPerModels {0}; ///< Number of streams of the models of a calculation
+
+  std::vector<RemTile> m_remTiles;  ///< Tiles, indexed by tile number modulo their number
+  size_t m_nextTileToPrepare {0};   ///< Number of the next tile to prepare
+  size_t m_nextTileToCompute {0};   ///< Number of the next tile to compute
+  bool m_stopRemWorkers {false};    ///< Whether the threads must exit
+  std::mutex m_remMutex;            ///< Mutex protecting the state of the tiles
+  std::condition_variable m_tileReady; ///< Notified when a tile is prepared
+  std::condition_variable m_tileDone;  ///< Notified when a tile is computed
 
   RemDevice m_rrd;
 
@@ -583,6 +737,8 @@ private:
   Ptr<PhasedArraySpectrumPropagationLossModel> m_phasedArraySpectrumLossModel;
   ObjectFactory m_channelConditionModelFactory;
   ObjectFactory m_matrixBasedChannelModelFactory;
+  ObjectFactory m_propagationLossModelFactory;
+  ObjectFactory m_spectrumLossModelFactory;
 
   Ptr<SpectrumValue> m_noisePsd; // noise figure PSD that will be used for calculations
 
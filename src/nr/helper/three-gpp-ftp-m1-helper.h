@@ -24,7 +24,7 @@
 #include <ns3/internet-module.h>
 #include <ns3/internet-apps-module.h>
 #include <ns3/file-transfer-application.h>
-#include <ns3/v4ping-helper.h>
+#include <ns3/ping-helper.h>
 #include <ns3/file-transfer-helper.h>
 
 namespace ns3 {
@@ -28,8 +28,8 @@ namespace ns3{
 
 complexVector_t CreateQuasiOmniBfv (uint32_t antennaRows, uint32_t antennaColumns)
 {
-  complexVector_t omni;
   uint32_t size = antennaRows * antennaColumns;
+  complexVector_t omni (size);
   double power = 1 / sqrt (size);
   for (uint32_t ind = 0; ind < antennaRows; ind++)
     {
@@ -55,7 +55,7 @@ complexVector_t CreateQuasiOmniBfv (uint32_t antennaRows, uint32_t antennaColumn
               d = exp(std::complex<double> (0, M_PI * ind2 * (ind2+1) / antennaColumns));
             }
 
-          omni.push_back (c * d * power);
+          omni[ind * antennaColumns + ind2] = c * d * power;
         }
     }
   return omni;
@@ -64,18 +64,17 @@ complexVector_t CreateQuasiOmniBfv (uint32_t antennaRows, uint32_t antennaColumn
 complexVector_t CreateDirectionalBfv (const Ptr<const UniformPlanarArray>& antenna,
                                       uint16_t sector, double elevation)
 {
-  complexVector_t tempVector;
-
   UintegerValue uintValueNumRows;
   antenna->GetAttribute ("NumRows", uintValueNumRows);
 
   double hAngle_radian = M_PI * (static_cast<double> (sector) / static_cast<double> (uintValueNumRows.Get ())) - 0.5 * M_PI;
   double vAngle_radian = elevation * M_PI / 180;
-  uint16_t size = antenna->GetNumberOfElements ();
+  uint16_t size = antenna->GetNumElems ();
   double power = 1 / sqrt (size);
+  complexVector_t tempVector (size);
   if (size == 1)
     {
-      tempVector.push_back (power);  // single AE, no BF
+      tempVector[0] = power;  // single AE, no BF
     }
   else
     {
@@ -85,7 +84,7 @@ complexVector_t CreateDirectionalBfv (const Ptr<const UniformPlanarArray>& anten
         double phase = -2 * M_PI * (sin (vAngle_radian) * cos (hAngle_radian) * loc.x
                                     + sin (vAngle_radian) * sin (hAngle_radian) * loc.y
                                     + cos (vAngle_radian) * loc.z);
-        tempVector.push_back (exp (std::complex<double> (0, phase)) * power);
+        tempVector[ind] = exp (std::complex<double> (0, phase)) * power;
         }
     }
   return tempVector;
@@ -94,18 +93,17 @@ complexVector_t CreateDirectionalBfv (const Ptr<const UniformPlanarArray>& anten
 complexVector_t CreateDirectionalBfvAz (const Ptr<const UniformPlanarArray>& antenna,
                                         double azimuth, double zenith)
 {
-  complexVector_t tempVector;
-
   UintegerValue uintValueNumRows;
   antenna->GetAttribute ("NumRows", uintValueNumRows);
 
   double hAngle_radian = azimuth * M_PI / 180;
   double vAngle_radian = zenith * M_PI / 180;
-  uint16_t size = antenna->GetNumberOfElements ();
+  uint16_t size = antenna->GetNumElems ();
   double power = 1 / sqrt (size);
+  complexVector_t tempVector (size);
   if (size == 1)
     {
-      tempVector.push_back (power);  // single AE, no BF
+      tempVector[0] = power;  // single AE, no BF
     }
   else
     {
@@ -115,7 +113,7 @@ complexVector_t CreateDirectionalBfvAz (const Ptr<const UniformPlanarArray>& ant
         double phase = -2 * M_PI * (sin (vAngle_radian) * cos (hAngle_radian) * loc.x
                                     + sin (vAngle_radian) * sin (hAngle_radian) * loc.y
                                     + cos (vAngle_radian) * loc.z);
-        tempVector.push_back (exp (std::complex<double> (0, phase)) * power);
+        tempVector[ind] = exp (std::complex<double> (0, phase)) * power;
         }
     }
   return tempVector;
@@ -125,8 +123,6 @@ complexVector_t CreateDirectPathBfv (const Ptr<MobilityModel>& a,
                                      const Ptr<MobilityModel>& b,
                                      const Ptr<const UniformPlanarArray>& antenna)
 {
-  complexVector_t antennaWeights;
-
   // retrieve the position of the two devices
   Vector aPos = a->GetPosition ();
   Vector bPos = b->GetPosition ();
@@ -139,10 +135,11 @@ complexVector_t CreateDirectPathBfv (const Ptr<MobilityModel>& a,
   double vAngleRadian = completeAngle.GetInclination (); // the elevation angle
 
   // retrieve the number of antenna elements
-  int totNoArrayElements = antenna->GetNumberOfElements ();
+  int totNoArrayElements = antenna->GetNumElems ();
 
   // the total power is divided equally among the antenna elements
   double power = 1 / sqrt (totNoArrayElements);
+  complexVector_t antennaWeights (totNoArrayElements);
 
   // compute the antenna weights
   for (int ind = 0; ind < totNoArrayElements; ind++)
@@ -151,7 +148,7 @@ complexVector_t CreateDirectPathBfv (const Ptr<MobilityModel>& a,
       double phase = -2 * M_PI * (sin (vAngleRadian) * cos (hAngleRadian) * loc.x
                                   + sin (vAngleRadian) * sin (hAngleRadian) * loc.y
                                   + cos (vAngleRadian) * loc.z);
-      antennaWeights.push_back (exp (std::complex<double> (0, phase)) * power);
+      antennaWeights[ind] = exp (std::complex<double> (0, phase)) * power;
     }
 
   return antennaWeights;
@@ -21,12 +21,13 @@
 #define SRC_NR_MODEL_BEAMFORMING_VECTOR_H_
 
 #include "beam-id.h"
+#include <ns3/phased-array-model.h>
 #include <ns3/uniform-planar-array.h>
 #include <ns3/mobility-model.h>
 
 namespace ns3{
 
-typedef std::vector<std::complex<double>> complexVector_t; //!< type definition for complex vectors
+typedef PhasedArrayModel::ComplexVector complexVector_t; //!< type definition for complex vectors
 
 /**
  * \ingroup utils
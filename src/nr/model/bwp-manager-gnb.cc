@@ -22,6 +22,7 @@
 
 #include <ns3/log.h>
 #include <ns3/uinteger.h>
+#include <ns3/pointer.h>
 #include <ns3/object-map.h>
 
 namespace ns3 {
@@ -69,7 +70,7 @@ BwpManagerGnb::IsGbr (LteMacSapProvider::ReportBufferStatusParameters params)
 {
   NS_ASSERT_MSG (m_ueInfo.find (params.rnti) != m_ueInfo.end (), "Trying to check the QoS of unknown UE");
   NS_ASSERT_MSG (m_ueInfo.at (params.rnti).m_rlcLcInstantiated.find (params.lcid) != m_ueInfo.at (params.rnti).m_rlcLcInstantiated.end (), "Trying to check the QoS of unknown logical channel");
-  return (m_ueInfo[params.rnti].m_rlcLcInstantiated[params.lcid]).isGbr;
+  return (m_ueInfo[params.rnti].m_rlcLcInstantiated[params.lcid]).resourceType > 0; // 1, 2 for GBR and DC-GBR
 }
 
 std::vector<LteCcmRrcSapProvider::LcsConfig>
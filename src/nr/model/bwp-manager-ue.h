@@ -21,6 +21,7 @@
 
 #include <ns3/simple-ue-component-carrier-manager.h>
 #include <ns3/nr-phy-mac-common.h>
+#include <ns3/eps-bearer.h>
 
 namespace ns3 {
 
@@ -24,6 +24,7 @@
 #include <ns3/mobility-module.h>
 #include <ns3/node.h>
 #include <ns3/multi-model-spectrum-channel.h>
+#include <ns3/spectrum-signal-parameters.h>
 #include "nr-spectrum-phy.h"
 #include "beam-manager.h"
 #include <ns3/nr-spectrum-value-helper.h>
@@ -101,8 +102,9 @@ CellScanBeamforming::GetBeamformingVectors (const Ptr<NrSpectrumPhy>& gnbSpectru
       activeRbs.push_back(rbId);
     }
 
-  Ptr<const SpectrumValue> fakePsd = NrSpectrumValueHelper::CreateTxPowerSpectralDensity (0.0, activeRbs, gnbSpectrumPhy->GetRxSpectrumModel (),
-                                                                                          NrSpectrumValueHelper::UNIFORM_POWER_ALLOCATION_BW);
+  Ptr<SpectrumSignalParameters> fakeParams = Create<SpectrumSignalParameters> ();
+  fakeParams->psd = NrSpectrumValueHelper::CreateTxPowerSpectralDensity (0.0, activeRbs, gnbSpectrumPhy->GetRxSpectrumModel (),
+                                                                          NrSpectrumValueHelper::UNIFORM_POWER_ALLOCATION_BW);
 
   double max = 0, maxTxTheta = 0, maxRxTheta = 0;
   uint16_t maxTxSector = 0, maxRxSector = 0;
@@ -114,7 +116,7 @@ CellScanBeamforming::GetBeamformingVectors (const Ptr<NrSpectrumPhy>& gnbSpectru
   ueSpectrumPhy->GetAntenna ()->GetAttribute ("NumRows", uintValue);
   uint32_t rxNumRows = static_cast<uint32_t> (uintValue.Get ());
 
-  NS_ASSERT (gnbSpectrumPhy->GetAntenna ()->GetObject <PhasedArrayModel> ()->GetNumberOfElements() && ueSpectrumPhy->GetAntenna ()->GetObject <PhasedArrayModel> ()->GetNumberOfElements());
+  NS_ASSERT (gnbSpectrumPhy->GetAntenna ()->GetObject <PhasedArrayModel> ()->GetNumElems () && ueSpectrumPhy->GetAntenna ()->GetObject <PhasedArrayModel> ()->GetNumElems ());
 
   for (double txTheta = 60; txTheta < 121; txTheta = txTheta + m_beamSearchAngleStep)
     {
@@ -125,7 +127,7 @@ CellScanBeamforming::GetBeamformingVectors (const Ptr<NrSpectrumPhy>& gnbSpectru
           gnbSpectrumPhy->GetBeamManager ()->SetSector (txSector, txTheta);
           complexVector_t txW = gnbSpectrumPhy->GetBeamManager ()->GetCurrentBeamformingVector ();
 
-          if (maxTxW.size () == 0)
+          if (maxTxW.GetSize () == 0)
             {
               maxTxW = txW; // initialize maxTxW
             }
@@ -139,18 +141,18 @@ CellScanBeamforming::GetBeamformingVectors (const Ptr<NrSpectrumPhy>& gnbSpectru
                   ueSpectrumPhy->GetBeamManager ()->SetSector (rxSector, rxTheta);
                   complexVector_t rxW = ueSpectrumPhy->GetBeamManager ()->GetCurrentBeamformingVector ();
 
-                  if (maxRxW.size () == 0)
+                  if (maxRxW.GetSize () == 0)
                     {
                       maxRxW = rxW; // initialize maxRxW
                     }
 
-                  NS_ABORT_MSG_IF (txW.size()==0 || rxW.size()==0, "Beamforming vectors must be initialized in order to calculate the long term matrix.");
+                  NS_ABORT_MSG_IF (txW.GetSize ()==0 || rxW.GetSize ()==0, "Beamforming vectors must be initialized in order to calculate the long term matrix.");
 
-                  Ptr<SpectrumValue> rxPsd = gnbThreeGppSpectrumPropModel->CalcRxPowerSpectralDensity (fakePsd,
+                  Ptr<SpectrumValue> rxPsd = gnbThreeGppSpectrumPropModel->CalcRxPowerSpectralDensity (fakeParams,
                                                                                                        gnbSpectrumPhy->GetMobility (),
                                                                                                        ueSpectrumPhy->GetMobility (),
                                                                                                        gnbSpectrumPhy->GetAntenna ()->GetObject <PhasedArrayModel>(),
-                                                                                                       ueSpectrumPhy->GetAntenna ()->GetObject <PhasedArrayModel>());
+                                                                                                       ueSpectrumPhy->GetAntenna ()->GetObject <PhasedArrayModel>())->psd;
 
                   size_t nbands = rxPsd->GetSpectrumModel ()->GetNumBands ();
                   double power = Sum (*rxPsd) / nbands;
@@ -183,7 +185,7 @@ CellScanBeamforming::GetBeamformingVectors (const Ptr<NrSpectrumPhy>& gnbSpectru
                 " tx sector " << (M_PI * static_cast<double> (maxTxSector) / static_cast<double> (txNumRows) - 0.5 * M_PI) / (M_PI) * 180 <<
                 " rx sector " << (M_PI * static_cast<double> (maxRxSector) / static_cast<double> (rxNumRows) - 0.5 * M_PI) / (M_PI) * 180);
 
-  NS_ASSERT (maxTxW.size () && maxRxW.size ());
+  NS_ASSERT (maxTxW.GetSize () && maxRxW.GetSize ());
 
   return BeamformingVectorPair (std::make_pair (gnbBfv, ueBfv));
 }
@@ -222,8 +224,9 @@ CellScanBeamformingAzimuthZenith::GetBeamformingVectors (const Ptr<NrSpectrumPhy
       activeRbs.push_back (rbId);
     }
 
-  Ptr<const SpectrumValue> fakePsd = NrSpectrumValueHelper::CreateTxPowerSpectralDensity (0.0, activeRbs, gnbSpectrumPhy->GetRxSpectrumModel (),
-                                                                                          NrSpectrumValueHelper::UNIFORM_POWER_ALLOCATION_BW);
+  Ptr<SpectrumSignalParameters> fakeParams = Create<SpectrumSignalParameters> ();
+  fakeParams->psd = NrSpectrumValueHelper::CreateTxPowerSpectralDensity (0.0, activeRbs, gnbSpectrumPhy->GetRxSpectrumModel (),
+                                                                          NrSpectrumValueHelper::UNIFORM_POWER_ALLOCATION_BW);
 
   double max = 0, maxTxAzimuth = 0, maxRxAzimuth = 0, maxTxZenith = 0, maxRxZenith = 0;
   complexVector_t  maxTxW, maxRxW;
@@ -232,7 +235,7 @@ CellScanBeamformingAzimuthZenith::GetBeamformingVectors (const Ptr<NrSpectrumPhy
   gnbSpectrumPhy->GetAntenna ()->GetAttribute ("NumRows", uintValue);
   ueSpectrumPhy->GetAntenna ()->GetAttribute ("NumRows", uintValue);
 
-  NS_ASSERT (gnbSpectrumPhy->GetAntenna ()->GetObject <PhasedArrayModel> ()->GetNumberOfElements () && ueSpectrumPhy->GetAntenna ()->GetObject <PhasedArrayModel> ()->GetNumberOfElements ());
+  NS_ASSERT (gnbSpectrumPhy->GetAntenna ()->GetObject <PhasedArrayModel> ()->GetNumElems () && ueSpectrumPhy->GetAntenna ()->GetObject <PhasedArrayModel> ()->GetNumElems ());
 
   for (uint i = 0; i < m_azimuth.size (); i++)
     {
@@ -244,7 +247,7 @@ CellScanBeamformingAzimuthZenith::GetBeamformingVectors (const Ptr<NrSpectrumPhy
           gnbSpectrumPhy->GetBeamManager ()->SetSectorAz (azimuthTx, zenithTx);
           complexVector_t txW = gnbSpectrumPhy->GetBeamManager ()->GetCurrentBeamformingVector ();
 
-          if (maxTxW.size () == 0)
+          if (maxTxW.GetSize () == 0)
             {
               maxTxW = txW; // initialize maxTxW
             }
@@ -259,20 +262,20 @@ CellScanBeamformingAzimuthZenith::GetBeamformingVectors (const Ptr<NrSpectrumPhy
                   ueSpectrumPhy->GetBeamManager ()->SetSectorAz (azimuthRx, zenithRx);
                   complexVector_t rxW = ueSpectrumPhy->GetBeamManager ()->GetCurrentBeamformingVector ();
 
-                  if (maxRxW.size () == 0)
+                  if (maxRxW.GetSize () == 0)
                     {
                       maxRxW = rxW; // initialize maxRxW
                     }
 
-                  NS_ABORT_MSG_IF (txW.size ()==0 || rxW.size ()==0,
+                  NS_ABORT_MSG_IF (txW.GetSize ()==0 || rxW.GetSize ()==0,
                                    "Beamforming vectors must be initialized in "
                                    "order to calculate the long term matrix.");
 
-                  Ptr<SpectrumValue> rxPsd = gnbThreeGppSpectrumPropModel->CalcRxPowerSpectralDensity (fakePsd,
+                  Ptr<SpectrumValue> rxPsd = gnbThreeGppSpectrumPropModel->CalcRxPowerSpectralDensity (fakeParams,
                                                                                                        gnbSpectrumPhy->GetMobility (),
                                                                                                        ueSpectrumPhy->GetMobility (),
                                                                                                        gnbSpectrumPhy->GetAntenna ()->GetObject <PhasedArrayModel>(),
-                                                                                                       ueSpectrumPhy->GetAntenna ()->GetObject <PhasedArrayModel>());
+                                                                                                       ueSpectrumPhy->GetAntenna ()->GetObject <PhasedArrayModel>())->psd;
 
                   size_t nbands = rxPsd->GetSpectrumModel ()->GetNumBands ();
                   double power = Sum (*rxPsd) / nbands;
@@ -305,7 +308,7 @@ CellScanBeamformingAzimuthZenith::GetBeamformingVectors (const Ptr<NrSpectrumPhy
                 " are azimuthTx " << maxTxAzimuth << " zenithTx " << maxTxZenith <<
                 " azimuthRx " << maxRxAzimuth << " zenithRx " << maxRxZenith);
 
-  NS_ASSERT (maxTxW.size () && maxRxW.size ());
+  NS_ASSERT (maxTxW.GetSize () && maxRxW.GetSize ());
 
   return BeamformingVectorPair (std::make_pair (gnbBfv, ueBfv));
 }
@@ -356,8 +359,9 @@ CellScanQuasiOmniBeamforming::GetBeamformingVectors (const Ptr<NrSpectrumPhy>& g
       activeRbs.push_back(rbId);
     }
 
-  Ptr<const SpectrumValue> fakePsd = NrSpectrumValueHelper::CreateTxPowerSpectralDensity (0.0, activeRbs, gnbSpectrumPhy->GetRxSpectrumModel (),
-                                                                                          NrSpectrumValueHelper::UNIFORM_POWER_ALLOCATION_BW);
+  Ptr<SpectrumSignalParameters> fakeParams = Create<SpectrumSignalParameters> ();
+  fakeParams->psd = NrSpectrumValueHelper::CreateTxPowerSpectralDensity (0.0, activeRbs, gnbSpectrumPhy->GetRxSpectrumModel (),
+                                                                          NrSpectrumValueHelper::UNIFORM_POWER_ALLOCATION_BW);
 
   double max = 0, maxTxTheta = 0;
   uint16_t maxTxSector = 0;
@@ -381,13 +385,13 @@ CellScanQuasiOmniBeamforming::GetBeamformingVectors (const Ptr<NrSpectrumPhy>& g
           gnbSpectrumPhy->GetBeamManager ()->SetSector (txSector, txTheta);
           complexVector_t txW = gnbSpectrumPhy->GetBeamManager ()->GetCurrentBeamformingVector ();
 
-          NS_ABORT_MSG_IF (txW.size ()== 0 || rxW.size ()== 0,
+          NS_ABORT_MSG_IF (txW.GetSize ()== 0 || rxW.GetSize ()== 0,
                            "Beamforming vectors must be initialized in order to calculate the long term matrix.");
-          Ptr<SpectrumValue> rxPsd = txThreeGppSpectrumPropModel->CalcRxPowerSpectralDensity (fakePsd,
+          Ptr<SpectrumValue> rxPsd = txThreeGppSpectrumPropModel->CalcRxPowerSpectralDensity (fakeParams,
                                                                                               gnbSpectrumPhy ->GetMobility (),
                                                                                               ueSpectrumPhy ->GetMobility(),
                                                                                               gnbSpectrumPhy->GetAntenna ()->GetObject <PhasedArrayModel>(),
-                                                                                              ueSpectrumPhy->GetAntenna ()->GetObject <PhasedArrayModel>());
+                                                                                              ueSpectrumPhy->GetAntenna ()->GetObject <PhasedArrayModel>())->psd;
 
           size_t nbands = rxPsd->GetSpectrumModel ()->GetNumBands ();
           double power = Sum (*rxPsd) / nbands;
@@ -69,7 +69,7 @@ NrAmc::GetTypeId (void)
     .AddAttribute ("AmcModel",
                    "AMC model used to assign CQI",
                    EnumValue (NrAmc::ErrorModel),
-                   MakeEnumAccessor (&NrAmc::SetAmcModel,
+                   MakeEnumAccessor<AmcModel> (&NrAmc::SetAmcModel,
                                      &NrAmc::GetAmcModel),
                    MakeEnumChecker (NrAmc::ErrorModel, "ErrorModel",
                                     NrAmc::ShannonModel, "ShannonModel"))
@@ -47,44 +47,16 @@ NrEesmCc::GetTypeId (void)
 double
 NrEesmCc::ComputeSINR (const SpectrumValue& sinr, const std::vector<int>& map, uint8_t mcs,
                        [[maybe_unused]] uint32_t sizeBit,
-                         const NrErrorModel::NrErrorModelHistory &sinrHistory) const
+                       const NrErrorModel::NrErrorModelHistory &sinrHistory,
+                       const Ptr<NrEesmErrorModelOutput> &output) const
 {
   NS_LOG_FUNCTION (this);
 
   // HARQ CHASE COMBINING: update SINReff, but not ECR after retx
   // repetition of coded bits
 
-  // make a vector of history that contains the last tx (but without modifying
-  // sinrHistory, as it will be modified by the caller when it will be the time)
-  Ptr<NrEesmErrorModelOutput> last = Create<NrEesmErrorModelOutput> (0.0);
-  last->m_map = map;
-  last->m_sinr = sinr;
-
-  NrErrorModel::NrErrorModelHistory total = sinrHistory;
-  total.push_back (last);
-
-  // evaluate SINR_eff over "total", as per Chase Combining
-
   NS_ASSERT (sinr.GetSpectrumModel()->GetNumBands() == sinr.GetValuesN());
 
-  SpectrumValue sinr_sum (sinr.GetSpectrumModel());
-  uint32_t historySize = static_cast<uint32_t> (total.size ());
-  uint32_t maxRBUsed = 0;
-  for (uint32_t i = 0; i < historySize; ++i)
-    {
-      Ptr<NrEesmErrorModelOutput> output = DynamicCast<NrEesmErrorModelOutput> (total.at(i));
-      maxRBUsed = std::max (maxRBUsed, static_cast<uint32_t> (output->m_map.size ()));
-    }
-
-  std::vector<int> map_sum;
-  map_sum.reserve (maxRBUsed);
-
-  for (uint32_t i = 0 ; i < maxRBUsed; ++i)
-    {
-      sinr_sum[i] = 0;
-      map_sum.push_back (static_cast<int> (i));
-    }
-
   /* combine at the bit level. Example:
    * SINR{1}=[0 0 10 20 10 0 0];
    * SINR{2}=[1 2 1 2 1 0 3];
@@ -99,29 +71,55 @@ NrEesmCc::ComputeSINR (const SpectrumValue& sinr, const std::vector<int>& map, u
    *
    * (the value at SINR_SUM[0] is SINR{1}[2] + SINR{2}[0] + SINR{3}[0])
    */
-  for (uint32_t i = 0; i < historySize; ++i)
+  Ptr<NrEesmErrorModelOutput> previous = DynamicCast<NrEesmErrorModelOutput> (sinrHistory.back ());
+  NS_ASSERT (previous != nullptr);
+  std::vector<double> &sinr_sum = output->m_sinrSum;
+  uint32_t size = map.size ();
+
+  if (previous->m_sinrSum.size () >= size)
     {
-      Ptr<NrEesmErrorModelOutput> output = DynamicCast<NrEesmErrorModelOutput> (total.at(i));
-      uint32_t size = output->m_map.size ();
-      for (uint32_t j = 0 ; j < maxRBUsed; ++j)
+      // the previous tx already combined the SINRs of all the tx before this
+      // one over at least as many RBs as this one uses: add this tx to them
+      sinr_sum = previous->m_sinrSum;
+      for (uint32_t j = 0 ; j < sinr_sum.size (); ++j)
         {
-          sinr_sum[j] += output->m_sinr [ output->m_map [ j % size ] ];
+          sinr_sum[j] += sinr [ map [ j % size ] ];
         }
     }
-
-  NS_LOG_INFO ("\tHISTORY:");
-  for (const auto & element : total)
+  else
     {
-      Ptr<NrEesmErrorModelOutput> output = DynamicCast<NrEesmErrorModelOutput> (element);
-      NS_LOG_INFO ("\tMAP:" << PrintMap (output->m_map));
-      NS_LOG_INFO ("\tSINR: " << output->m_sinr);
+      // this tx uses more RBs than the combined ones (or the previous tx is
+      // the first one): combine all the tx of the history, and this one
+      uint32_t maxRBUsed = size;
+      for (const auto & element : sinrHistory)
+        {
+          Ptr<NrEesmErrorModelOutput> txOutput = DynamicCast<NrEesmErrorModelOutput> (element);
+          maxRBUsed = std::max (maxRBUsed, static_cast<uint32_t> (txOutput->m_map.size ()));
+        }
+
+      sinr_sum.assign (maxRBUsed, 0.0);
+      for (const auto & element : sinrHistory)
+        {
+          Ptr<NrEesmErrorModelOutput> txOutput = DynamicCast<NrEesmErrorModelOutput> (element);
+          uint32_t txSize = txOutput->m_map.size ();
+          for (uint32_t j = 0 ; j < maxRBUsed; ++j)
+            {
+              sinr_sum[j] += txOutput->m_sinr [ txOutput->m_map [ j % txSize ] ];
+            }
+        }
+      for (uint32_t j = 0 ; j < maxRBUsed; ++j)
+        {
+          sinr_sum[j] += sinr [ map [ j % size ] ];
+        }
     }
 
-  NS_LOG_INFO ("MAP_SUM: " << PrintMap (map_sum));
-  NS_LOG_INFO ("SINR_SUM: " << sinr_sum);
+  NS_LOG_INFO ("\tMAP:" << PrintMap (map));
+  NS_LOG_INFO ("\tSINR: " << sinr);
+  NS_LOG_INFO ("HISTORY: " << sinrHistory.size () << " previous tx combined over " <<
+               sinr_sum.size () << " RBs");
 
-  // compute effective SINR with the sinr_sum vector and map_sum RB map
-  return SinrEff (sinr_sum, map_sum, mcs, 0.0, map_sum.size());
+  // compute effective SINR with the combined SINRs of all the tx
+  return SinrEff (SinrExp (sinr_sum, mcs), mcs, sinr_sum.size ());
 }
 
 double
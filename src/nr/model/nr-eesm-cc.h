@@ -36,7 +36,9 @@ namespace ns3 {
  *
  * In HARQ-CC, the HARQ history contains the SINR per allocated RB. Given the current
  * SINR vector and RB map, and the HARQ history, the effective SINR is computed
- * according to EESM.
+ * according to EESM. Each output of a retransmission keeps the combined SINR
+ * values, so that the next retransmission only adds its own SINR values to
+ * them, unless it uses more RBs than the previous ones.
  *
  * Please, don't use this class directly, but one between NrEesmCcT1 or NrEesmCcT2,
  * depending on what table you want to use.
@@ -67,10 +69,12 @@ protected:
    * \param sizeBit the Transport block size in bits
    * \param mcs the MCS of the transmission
    * \param sinrHistory the History of the previous transmissions of the same block
+   * \param output the output of current transmission
    * \return The effective SINR
    */
   double ComputeSINR (const SpectrumValue& sinr, const std::vector<int>& map, uint8_t mcs,
-                      uint32_t sizeBit, const NrErrorModel::NrErrorModelHistory &sinrHistory) const override;
+                      uint32_t sizeBit, const NrErrorModel::NrErrorModelHistory &sinrHistory,
+                      const Ptr<NrEesmErrorModelOutput> &output) const override;
 
   /**
    * \brief Returns the MCS corresponding to the ECR after retransmissions. As the ECR
@@ -76,8 +76,14 @@ NrEesmErrorModel::SinrEff (const SpectrumValue& sinr, const std::vector<int>& ma
   // for HARQ-CC: b = map.size(), a = 0.0 (SINRs are already combined in sinr input)
 
   double sinrExpSum = SinrExp (sinr, map, mcs);
+  return SinrEff (a + sinrExpSum, mcs, b);
+}
+
+double
+NrEesmErrorModel::SinrEff (double sinrExpSum, uint8_t mcs, double b) const
+{
   double beta = GetBetaTable ()->at (mcs);
-  double SINR = -beta * log ((a + sinrExpSum)/b);
+  double SINR = -beta * log (sinrExpSum / b);
 
   NS_LOG_INFO (" Effective SINR = " << SINR);
 
@@ -92,31 +98,30 @@ NrEesmErrorModel::SinrExp (const SpectrumValue& sinr, const std::vector<int>& ma
   NS_ABORT_MSG_IF (map.size () == 0,
                    " Error: number of allocated RBs cannot be 0 - EESM method - SinrEff function");
 
-  double SINRexp = 0.0;
   double SINRsum = 0.0;
   double beta = GetBetaTable ()->at (mcs);
-  SpectrumValue sinrCopy = sinr;
-  for (uint32_t i = 0; i < map.size (); i++)
+  for (int rb : map)
     {
-      double sinrLin = sinrCopy [map.at (i)];
-      SINRexp = exp (-sinrLin / beta);
-      SINRsum += SINRexp;
+      SINRsum += exp (-sinr[rb] / beta);
     }
   return SINRsum;
 }
 
-const std::vector<double> &
-NrEesmErrorModel::GetSinrDbVectorFromSimulatedValues (NrEesmErrorModel::GraphType graphType,
-                                                      uint8_t mcs, uint32_t cbSizeIndex) const
+double
+NrEesmErrorModel::SinrExp (const std::vector<double>& sinr, uint8_t mcs) const
 {
-  return std::get<0> (GetSimulatedBlerFromSINR ()->at (graphType).at (mcs).at (cbSizeIndex));
-}
+  // it returns sum_n (exp (-SINR/beta))
+  NS_LOG_FUNCTION (sinr.size () << (uint8_t) mcs);
+  NS_ABORT_MSG_IF (sinr.size () == 0,
+                   " Error: number of allocated RBs cannot be 0 - EESM method - SinrEff function");
 
-const std::vector<double> &
-NrEesmErrorModel::GetBLERVectorFromSimulatedValues (NrEesmErrorModel::GraphType graphType,
-                                                    uint8_t mcs, uint32_t cbSizeIndex) const
-{
-  return std::get<1> (GetSimulatedBlerFromSINR ()->at (graphType).at (mcs).at (cbSizeIndex));
+  double SINRsum = 0.0;
+  double beta = GetBetaTable ()->at (mcs);
+  for (double sinrLin : sinr)
+    {
+      SINRsum += exp (-sinrLin / beta);
+    }
+  return SINRsum;
 }
 
 double
@@ -135,37 +140,43 @@ NrEesmErrorModel::MappingSinrBler (double sinr, uint8_t mcs, uint32_t cbSizeBit)
   // Get the index of CBSIZE in the map
   NS_LOG_INFO ("For sinr " << sinr << " and mcs " << +mcs <<
                 " CbSizebit " << cbSizeBit << " we got bg type " << m_bgTypeName[bg_type]);
-  auto cbMap = GetSimulatedBlerFromSINR ()->at (bg_type).at (mcs);
-  auto cbIt = cbMap.upper_bound (cbSizeBit);
-
-  if (cbIt != cbMap.begin ())
+  const SimulatedBlerFromSINR *table = GetSimulatedBlerFromSINR ();
+  NS_ASSERT (mcs < table->m_numMcs);
+  const BlerCurve *cbBegin = table->m_curves + table->m_firstCurve[bg_type * table->m_numMcs + mcs];
+  const BlerCurve *cbEnd = table->m_curves + table->m_firstCurve[bg_type * table->m_numMcs + mcs + 1];
+  auto cbIt = std::upper_bound (cbBegin, cbEnd, cbSizeBit,
+                                [] (uint32_t cbSize, const BlerCurve &curve)
+                                {
+                                  return cbSize < curve.m_cbSize;
+                                });
+
+  if (cbIt != cbBegin)
     {
       cbIt--;
     }
 
-  if (sinr_db < GetSinrDbVectorFromSimulatedValues (bg_type, mcs, cbIt->first).front ())
+  const double *sinrBegin = table->m_sinrDb + cbIt->m_begin;
+  const double *sinrEnd = table->m_sinrDb + cbIt->m_end;
+
+  if (sinr_db < *sinrBegin)
     {
       bler = 1.0;
     }
-  else if (sinr_db > GetSinrDbVectorFromSimulatedValues (bg_type, mcs, cbIt->first).back ())
+  else if (sinr_db > *(sinrEnd - 1))
     {
       bler = 0.0;
     }
   else
     {
-      // Get the index of SINR in the vector
-      auto sinrIt = std::upper_bound (GetSinrDbVectorFromSimulatedValues (bg_type, mcs, cbIt->first).begin (),
-                                      GetSinrDbVectorFromSimulatedValues (bg_type, mcs, cbIt->first).end (),
-                                      sinr_db);
+      // Get the index of SINR in the curve
+      auto sinrIt = std::upper_bound (sinrBegin, sinrEnd, sinr_db);
 
-      if (sinrIt != GetSinrDbVectorFromSimulatedValues (bg_type, mcs, cbIt->first).begin ())
+      if (sinrIt != sinrBegin)
         {
           sinrIt--;
         }
 
-      auto sinr_index = std::distance (GetSinrDbVectorFromSimulatedValues (bg_type, mcs, cbIt->first).begin (),
-                                       sinrIt);
-      bler = GetBLERVectorFromSimulatedValues (bg_type, mcs, cbIt->first).at (sinr_index);
+      bler = table->m_bler[cbIt->m_begin + std::distance (sinrBegin, sinrIt)];
     }
 
   NS_LOG_LOGIC ("SINR effective: " << sinr << " BLER:" << bler);
@@ -291,18 +302,38 @@ NrEesmErrorModel::GetTbBitDecodificationStats (const SpectrumValue& sinr,
   NS_LOG_FUNCTION (this);
   NS_ABORT_IF (mcs > GetMaxMcs ());
 
-  double tbSinr = SinrEff (sinr, map, mcs, 0, map.size());  // effective SINR for this tx
-  double SINR = tbSinr;
   double sinrExpSum = SinrExp (sinr, map, mcs);  // exponential sum of SINRs for this tx
+  double tbSinr = SinrEff (sinrExpSum, mcs, map.size ());  // effective SINR for this tx
+  double SINR = tbSinr;
 
   NS_LOG_DEBUG (" mcs " << +mcs << " TBSize in bit " << sizeBit <<
                 " history elements: " << sinrHistory.size () << " SINR of the tx: " <<
                 tbSinr << std::endl << "MAP: " << PrintMap (map) << std::endl <<
                 "SINR: " << sinr);
 
-  if (sinrHistory.size () > 0)
+  NS_ASSERT (GetMcsEcrTable () != nullptr);
+
+  Ptr<NrEesmErrorModelOutput> ret = Create<NrEesmErrorModelOutput> (1.0);
+  ret->m_sinr = sinr;
+  ret->m_map = map;
+  ret->m_infoBits = sizeBit;
+  ret->m_codeBits = sizeBit / GetMcsEcrTable ()->at (mcs);
+  if (sinrHistory.size () == 0)
+    {
+      ret->m_sinrExp =  sinrExpSum;  // it is first tx!
+      ret->m_codeBitsSum = ret->m_codeBits;
+      ret->m_mapSizeSum = map.size ();
+    }
+  else
     {
-      SINR = ComputeSINR (sinr, map, mcs, sizeBit, sinrHistory);
+      // it sums over previous tx (recursively)
+      Ptr<NrEesmErrorModelOutput> previous = DynamicCast<NrEesmErrorModelOutput> (sinrHistory.back ());
+      NS_ASSERT (previous != nullptr);
+      ret->m_sinrExp = previous->m_sinrExp + sinrExpSum;
+      ret->m_codeBitsSum = previous->m_codeBitsSum + ret->m_codeBits;
+      ret->m_mapSizeSum = previous->m_mapSizeSum + map.size ();
+
+      SINR = ComputeSINR (sinr, map, mcs, sizeBit, sinrHistory, ret);
     }
 
   NS_LOG_DEBUG (" SINR after processing all retx (if any): " << SINR << " SINR last tx" << tbSinr);
@@ -340,23 +371,9 @@ NrEesmErrorModel::GetTbBitDecodificationStats (const SpectrumValue& sinr,
     }
 
   NS_LOG_DEBUG ("Calculated Error rate " << errorRate);
-  NS_ASSERT (GetMcsEcrTable () != nullptr);
 
-  Ptr<NrEesmErrorModelOutput> ret = Create<NrEesmErrorModelOutput> (errorRate);
+  ret->m_tbler = errorRate;
   ret->m_sinrEff = SINR;
-  ret->m_sinr = sinr;
-  ret->m_map = map;
-  if (sinrHistory.size () == 0)
-    {
-      ret->m_sinrExp =  sinrExpSum;  // it is first tx!
-    }
-  else
-    {
-      double m_sinrExpPrevious = DynamicCast<NrEesmErrorModelOutput> (sinrHistory.back ())->m_sinrExp;
-      ret->m_sinrExp = m_sinrExpPrevious + sinrExpSum;  // it sums over previous tx (recursively)
-    }
-  ret->m_infoBits = sizeBit;
-  ret->m_codeBits = sizeBit / GetMcsEcrTable ()->at (mcs);
 
   return ret;
 }
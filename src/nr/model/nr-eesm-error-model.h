@@ -53,6 +53,9 @@ struct NrEesmErrorModelOutput : public NrErrorModelOutput
   std::vector<int> m_map;   //!< map of the active RBs
   uint32_t m_infoBits {0};  //!< number of info bits
   uint32_t m_codeBits {0};  //!< number of code bits
+  uint32_t m_codeBitsSum {0};    //!< number of code bits of this and the previous tx (needed for HARQ-IR)
+  double m_mapSizeSum {0.0};     //!< number of active RBs of this and the previous tx (needed for HARQ-IR)
+  std::vector<double> m_sinrSum; //!< SINRs of this and the previous tx, combined per RB (needed for HARQ-CC)
 };
 
 /**
@@ -160,9 +163,32 @@ public:
   */
   virtual uint8_t GetMaxMcs () const override;
 
-  typedef std::vector<double> DoubleVector;
-  typedef std::tuple<DoubleVector, DoubleVector> DoubleTuple;
-  typedef std::vector<std::vector<std::map<uint32_t, DoubleTuple> > > SimulatedBlerFromSINR;
+  /**
+   * \brief A simulated SINR to BLER curve, for a CB size
+   */
+  struct BlerCurve
+  {
+    uint32_t m_cbSize;  //!< CB size (bits) of the curve
+    uint32_t m_begin;   //!< Index of the first point of the curve
+    uint32_t m_end;     //!< Index past the last point of the curve
+  };
+
+  /**
+   * \brief Table of the simulated SINR to BLER curves of an MCS table
+   *
+   * The table is made of constant arrays, so that it is built at compile
+   * time. The curves of each base graph type and MCS are contiguous in
+   * m_curves and sorted by CB size, and the points of each curve are sorted by
+   * SINR in m_sinrDb and m_bler.
+   */
+  struct SimulatedBlerFromSINR
+  {
+    const double *m_sinrDb;       //!< SINR (dB) of the points of the curves
+    const double *m_bler;         //!< BLER of the points of the curves
+    const BlerCurve *m_curves;    //!< Curves, by base graph type, MCS and CB size
+    const uint32_t *m_firstCurve; //!< Index of the first curve of each base graph type and MCS, followed by the number of curves
+    uint8_t m_numMcs;             //!< Number of MCSs
+  };
 
 protected:
   /**
@@ -193,6 +219,18 @@ protected:
    */
   double SinrEff (const SpectrumValue& sinr, const std::vector<int>& map, uint8_t mcs, double a, double b) const;
 
+  /**
+   * \brief compute the effective SINR for the specified MCS from the sum of
+   * exponential SINRs, according to the EESM method:
+   * SINReff = - beta * ln [1/b * sinrExpSum]
+   *
+   * \param sinrExpSum the sum of exponential SINRs, including the term "a"
+   * \param mcs the MCS of the TB
+   * \param b the denominator for the exponentials sum
+   * \return the effective SINR
+   */
+  double SinrEff (double sinrExpSum, uint8_t mcs, double b) const;
+
   /**
    * \brief compute the sum of exponential SINRs for the specified MCS and SINR, according
    * to the EESM method, used in HARQ-IR
@@ -204,6 +242,16 @@ protected:
    */
   double SinrExp (const SpectrumValue& sinr, const std::vector<int>& map, uint8_t mcs) const;
 
+  /**
+   * \brief compute the sum of exponential SINRs for the specified MCS and SINR,
+   * according to the EESM method, used in HARQ-CC
+   *
+   * \param sinr the SINRs of the REGs to combine
+   * \param mcs the MCS of the TB
+   * \return the sum of exponential SINR
+   */
+  double SinrExp (const std::vector<double>& sinr, uint8_t mcs) const;
+
   /**
    * \brief Compute the effective SINR after retransmission combining
    * \param sinr SINR of the new transmission
@@ -211,17 +259,22 @@ protected:
    * \param mcs MCS of the transmission
    * \param sizeBit size (in bit) of the transmission
    * \param sinrHistory history of the SINR of the previous transmission
+   * \param output the output of the new transmission, whose m_sinrExp,
+   * m_codeBitsSum and m_mapSizeSum already include the new transmission
    * \return the single SINR value
    *
    * Called in GetTbBitDecodificationStats(). Please implement this function
    * in a way that calculating the SINR of the new transmission
-   * takes in consideration the sinr history.
+   * takes in consideration the sinr history. The implementation can store
+   * in the output what the next retransmission needs, so that its cost does
+   * not grow with the number of retransmissions.
    *
    * \see NrEesmIr
    * \see NrEesmCc
    */
   virtual double ComputeSINR (const SpectrumValue& sinr, const std::vector<int>& map, uint8_t mcs,
-                              uint32_t sizeBit, const NrErrorModel::NrErrorModelHistory &sinrHistory) const = 0;
+                              uint32_t sizeBit, const NrErrorModel::NrErrorModelHistory &sinrHistory,
+                              const Ptr<NrEesmErrorModelOutput> &output) const = 0;
 
   /**
    * \brief Get the "Equivalent MCS" after retransmission combining
@@ -321,23 +374,6 @@ private:
    */
   std::pair<uint32_t, uint32_t>
   CodeBlockSegmentation (uint32_t B, GraphType bg_type) const;
-
-  /**
-   * \brief Get SinrDb Vector From Simulated Values
-   * \param graphType
-   * \param mcs
-   * \param cbSizeIndex
-   * \return
-   */
-  const std::vector<double> & GetSinrDbVectorFromSimulatedValues (GraphType graphType, uint8_t mcs, uint32_t cbSizeIndex) const;
-  /**
-   * \brief Get BLER Vector From Simulated Values
-   * \param graphType
-   * \param mcs
-   * \param cbSizeIndex
-   * \return
-   */
-  const std::vector<double> & GetBLERVectorFromSimulatedValues (GraphType graphType, uint8_t mcs, uint32_t cbSizeIndex) const;
 };
 
 
@@ -45,40 +45,28 @@ NrEesmIr::GetTypeId (void)
 }
 
 double
-NrEesmIr::ComputeSINR (const SpectrumValue &sinr, const std::vector<int> &map,
-                         uint8_t mcs, uint32_t sizeBit,
-                         const NrErrorModel::NrErrorModelHistory &sinrHistory) const
+NrEesmIr::ComputeSINR ([[maybe_unused]] const SpectrumValue &sinr,
+                       [[maybe_unused]] const std::vector<int> &map,
+                       uint8_t mcs, [[maybe_unused]] uint32_t sizeBit,
+                       const NrErrorModel::NrErrorModelHistory &sinrHistory,
+                       const Ptr<NrEesmErrorModelOutput> &output) const
 {
   NS_LOG_FUNCTION (this);
   // HARQ INCREMENTAL REDUNDANCY: update SINReff and ECR after retx, assuming
   // no repetition of coded bits.
 
-  // compute equivalent effective code rate after retransmissions and total map size
-  uint32_t codeBitsSum = 0;
+  // compute equivalent effective code rate after retransmissions: the output
+  // of this tx already sums the code bits and the map sizes over the previous tx
   uint32_t infoBits = DynamicCast<NrEesmErrorModelOutput> (sinrHistory.front ())->m_infoBits;  // information bits of the first TB
-  double mapSumSize = 0.0;
+  const_cast<NrEesmIr*> (this)->m_Reff = infoBits / static_cast<double> (output->m_codeBitsSum);
 
-  for (const Ptr<NrErrorModelOutput> & output : sinrHistory)
-    {
-      Ptr<NrEesmErrorModelOutput> sinrHistorytemp = DynamicCast<NrEesmErrorModelOutput> (output);
-      NS_ASSERT (sinrHistorytemp != nullptr);
-
-      NS_LOG_DEBUG (" Exponential SINR sum " << sinrHistorytemp->m_sinrExp <<
-                    " codeBits " << sinrHistorytemp->m_codeBits <<
-                    " infoBits: " << sinrHistorytemp->m_infoBits);
-
-      codeBitsSum += sinrHistorytemp->m_codeBits;
-      mapSumSize += sinrHistorytemp->m_map.size();
-    }
-  mapSumSize += map.size();
-  codeBitsSum += sizeBit / GetMcsEcrTable()->at (mcs);;
-  const_cast<NrEesmIr*> (this)->m_Reff = infoBits / static_cast<double> (codeBitsSum);
-
-  NS_LOG_INFO (" Reff " << m_Reff << " HARQ history (previous) " << sinrHistory.size ());
+  NS_LOG_INFO (" Reff " << m_Reff << " HARQ history (previous) " << sinrHistory.size () <<
+               " Exponential SINR sum " << output->m_sinrExp <<
+               " codeBits " << output->m_codeBitsSum <<
+               " map size " << output->m_mapSizeSum);
 
-  // compute effective SINR with expSINR_previousTx and mapSumSize
-  double expSINR_previousTx = DynamicCast<NrEesmErrorModelOutput> (sinrHistory.back ())->m_sinrExp;
-  return SinrEff (sinr, map, mcs, expSINR_previousTx, mapSumSize);
+  // compute effective SINR with the exponential SINR sum and map size of all the tx
+  return SinrEff (output->m_sinrExp, mcs, output->m_mapSizeSum);
 }
 
 double
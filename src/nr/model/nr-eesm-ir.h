@@ -35,6 +35,8 @@ namespace ns3 {
  * In HARQ-IR, the HARQ history contains the last computed effective SINR and
  * number of coded bits of each of the previous retransmissions. Given the current
  * SINR vector and the HARQ history, the effective SINR is computed according to EESM.
+ * As each output of the history accumulates the exponential SINRs, coded bits
+ * and RBs of the previous ones, only the last one is read.
  *
  * NOTE: The method GetMcsEq() must be called after ComputeSINR(), as it uses
  * the value m_Reff.
@@ -71,10 +73,12 @@ protected:
    * \param sizeBit the Transport block size in bits
    * \param mcs the MCS
    * \param sinrHistory the History of the previous transmissions of the same block
+   * \param output the output of current transmission
    * \return The effective SINR
    */
   double ComputeSINR (const SpectrumValue& sinr, const std::vector<int>& map, uint8_t mcs,
-                      uint32_t sizeBit, const NrErrorModel::NrErrorModelHistory &sinrHistory) const override;
+                      uint32_t sizeBit, const NrErrorModel::NrErrorModelHistory &sinrHistory,
+                      const Ptr<NrEesmErrorModelOutput> &output) const override;
 
   /**
    * \brief Returns the MCS corresponding to the ECR after retransmissions. In case of
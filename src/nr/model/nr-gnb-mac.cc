@@ -35,8 +35,10 @@
 #include "nr-mac-header-fs-ul.h"
 #include "nr-mac-short-bsr-ce.h"
 
+#include <ns3/lte-common.h>
 #include <ns3/lte-radio-bearer-tag.h>
 #include <ns3/log.h>
+#include <ns3/uinteger.h>
 #include <ns3/spectrum-model.h>
 #include <algorithm>
 #include "beam-id.h"
@@ -1381,7 +1383,7 @@ NrGnbMac::DoAddLc (LteEnbCmacSapProvider::LcInfo lcinfo, LteMacSapUser* msu)
       lccle.m_logicalChannelIdentity = lcinfo.lcId;
       lccle.m_logicalChannelGroup = lcinfo.lcGroup;
       lccle.m_direction = LogicalChannelConfigListElement_s::DIR_BOTH;
-      lccle.m_qosBearerType = lcinfo.isGbr ? LogicalChannelConfigListElement_s::QBT_GBR : LogicalChannelConfigListElement_s::QBT_NON_GBR;
+      lccle.m_qosBearerType = static_cast<LogicalChannelConfigListElement_s::QosBearerType_e> (lcinfo.resourceType);
       lccle.m_qci = lcinfo.qci;
       lccle.m_eRabMaximulBitrateUl = lcinfo.mbrUl;
       lccle.m_eRabMaximulBitrateDl = lcinfo.mbrDl;
@@ -45,6 +45,7 @@
 #include <ns3/pointer.h>
 #include <ns3/double.h>
 #include <ns3/boolean.h>
+#include <ns3/uinteger.h>
 #include "beam-manager.h"
 #include <ns3/object-vector.h>
 
@@ -112,7 +113,7 @@ NrGnbPhy::GetTypeId (void)
                    "power allocation over used (active) RBs. By default is set a uniform power "
                    "allocation over used RBs .",
                    EnumValue (NrSpectrumValueHelper::UNIFORM_POWER_ALLOCATION_USED),
-                   MakeEnumAccessor (&NrPhy::SetPowerAllocationType,
+                   MakeEnumAccessor<NrSpectrumValueHelper::PowerAllocationType> (&NrPhy::SetPowerAllocationType,
                                      &NrPhy::GetPowerAllocationType),
                    MakeEnumChecker ( NrSpectrumValueHelper::UNIFORM_POWER_ALLOCATION_BW, "UniformPowerAllocBw",
                                      NrSpectrumValueHelper::UNIFORM_POWER_ALLOCATION_USED, "UniformPowerAllocUsed"
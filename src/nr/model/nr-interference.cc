@@ -20,6 +20,7 @@
 #include "nr-interference.h"
 #include <ns3/simulator.h>
 #include <ns3/log.h>
+#include <ns3/abort.h>
 #include <ns3/lte-chunk-processor.h>
 #include <stdio.h>
 #include <algorithm>
@@ -71,6 +72,13 @@ NrInterference::AddSignal (Ptr<const SpectrumValue> spd, Time duration)
 {
   NS_LOG_FUNCTION (this << *spd << duration);
 
+  // The lazy chunk evaluation of LteInterference processes the end of the
+  // signals outside of EndRx and ConditionallyEvaluateChunk, which are
+  // overridden here, and would leave ended signals in m_allSignals, which
+  // is read by IsChannelBusyNow
+  NS_ABORT_MSG_IF (m_lazyChunkEvaluation,
+                   "LazyChunkEvaluation is not supported by NrInterference");
+
   // Integrate over our receive bandwidth.
   // Note that differently from wifi, we do not need to pass the
   // signal through the filter. This is because
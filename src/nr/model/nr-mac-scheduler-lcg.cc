@@ -32,7 +32,7 @@ NrMacSchedulerLC::NrMacSchedulerLC (const LogicalChannelConfigListElement_s &con
   EpsBearer bearer (static_cast<EpsBearer::Qci> (conf.m_qci));
 
   m_delayBudget = MilliSeconds (bearer.GetPacketDelayBudgetMs ());
-  m_isGbr = bearer.IsGbr ();
+  m_isGbr = bearer.GetResourceType () > 0; // 1, 2 for GBR and DC-GBR
   m_PER = bearer.GetPacketErrorLossRate ();
 }
 
@@ -29,6 +29,7 @@
 #include "nr-mac-scheduler-harq-rr.h"
 #include "nr-mac-short-bsr-ce.h"
 #include "nr-mac-scheduler-srs-default.h"
+#include "nr-mac-scheduler-parallel.h"
 
 #include <ns3/boolean.h>
 #include <ns3/uinteger.h>
@@ -196,6 +197,13 @@ NrMacSchedulerNs3::GetTypeId (void)
                    MakeBooleanAccessor (&NrMacSchedulerNs3::EnableHarqReTx,
                                         &NrMacSchedulerNs3::IsHarqReTxEnable),
                                         MakeBooleanChecker ())
+    .AddAttribute ("ParallelScheduling",
+                   "If true, the slot decisions are computed at the end of the time "
+                   "stamp of the trigger, in parallel with the ones of the other "
+                   "schedulers with this attribute set (see NrMacSchedulerParallel)",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&NrMacSchedulerNs3::m_parallelScheduling),
+                   MakeBooleanChecker ())
   ;
 
   return tid;
@@ -1879,7 +1887,7 @@ NrMacSchedulerNs3::ScheduleDl (const NrMacSchedSapProvider::SchedDlTriggerReqPar
 
   NS_LOG_INFO ("Total DCI for DL : " << dlSlot.m_slotAllocInfo.m_varTtiAllocInfo.size () <<
                " including DL CTRL");
-  m_macSchedSapUser->SchedConfigInd (dlSlot);
+  IndicateSchedConfig (dlSlot);
 }
 
 /**
@@ -1941,7 +1949,7 @@ NrMacSchedulerNs3::ScheduleUl (const NrMacSchedSapProvider::SchedUlTriggerReqPar
 
   NS_LOG_INFO ("Total DCI for UL : " << ulSlot.m_slotAllocInfo.m_varTtiAllocInfo.size () <<
                " including UL CTRL");
-  m_macSchedSapUser->SchedConfigInd (ulSlot);
+  IndicateSchedConfig (ulSlot);
 }
 
 /**
@@ -2319,6 +2327,31 @@ NrMacSchedulerNs3::DoScheduleDl (const std::vector <DlHarqInfo> &dlHarqFeedback,
   return (dataSymPerSlot - ulAllocations.m_totUlSym) - dlSymAvail;
 }
 
+/**
+ * \brief Decide how to fill the frequency/time of a DL slot
+ * \param params parameters for the scheduler
+ *
+ * If the attribute ParallelScheduling is false, the decision is taken
+ * immediately by ProcessDlTriggerReq(). Otherwise, ProcessDlTriggerReq() is
+ * submitted to NrMacSchedulerParallel, which calls it at the end of the
+ * current time stamp, together with the work of the other schedulers.
+ */
+void
+NrMacSchedulerNs3::DoSchedDlTriggerReq (const NrMacSchedSapProvider::SchedDlTriggerReqParameters& params)
+{
+  NS_LOG_FUNCTION (this);
+
+  if (m_parallelScheduling)
+    {
+      NrMacSchedulerParallel::Get ()->Submit (this, [this, params] ()
+                                              { ProcessDlTriggerReq (params); });
+    }
+  else
+    {
+      ProcessDlTriggerReq (params);
+    }
+}
+
 /**
  * \brief Decide how to fill the frequency/time of a DL slot
  * \param params parameters for the scheduler
@@ -2330,7 +2363,7 @@ NrMacSchedulerNs3::DoScheduleDl (const std::vector <DlHarqInfo> &dlHarqFeedback,
  * \see ScheduleDl
  */
 void
-NrMacSchedulerNs3::DoSchedDlTriggerReq (const NrMacSchedSapProvider::SchedDlTriggerReqParameters& params)
+NrMacSchedulerNs3::ProcessDlTriggerReq (const NrMacSchedSapProvider::SchedDlTriggerReqParameters& params)
 {
   NS_LOG_FUNCTION (this);
 
@@ -2413,6 +2446,31 @@ NrMacSchedulerNs3::DoSchedDlTriggerReq (const NrMacSchedSapProvider::SchedDlTrig
   ScheduleDl (params, dlHarqFeedback);
 }
 
+/**
+ * \brief Decide how to fill the frequency/time of a UL slot
+ * \param params parameters for the scheduler
+ *
+ * If the attribute ParallelScheduling is false, the decision is taken
+ * immediately by ProcessUlTriggerReq(). Otherwise, ProcessUlTriggerReq() is
+ * submitted to NrMacSchedulerParallel, which calls it at the end of the
+ * current time stamp, together with the work of the other schedulers.
+ */
+void
+NrMacSchedulerNs3::DoSchedUlTriggerReq (const NrMacSchedSapProvider::SchedUlTriggerReqParameters& params)
+{
+  NS_LOG_FUNCTION (this);
+
+  if (m_parallelScheduling)
+    {
+      NrMacSchedulerParallel::Get ()->Submit (this, [this, params] ()
+                                              { ProcessUlTriggerReq (params); });
+    }
+  else
+    {
+      ProcessUlTriggerReq (params);
+    }
+}
+
 /**
  * \brief Decide how to fill the frequency/time of a UL slot
  * \param params parameters for the scheduler
@@ -2424,7 +2482,7 @@ NrMacSchedulerNs3::DoSchedDlTriggerReq (const NrMacSchedSapProvider::SchedDlTrig
  * \see ScheduleUl
  */
 void
-NrMacSchedulerNs3::DoSchedUlTriggerReq (const NrMacSchedSapProvider::SchedUlTriggerReqParameters& params)
+NrMacSchedulerNs3::ProcessUlTriggerReq (const NrMacSchedSapProvider::SchedUlTriggerReqParameters& params)
 {
   NS_LOG_FUNCTION (this);
 
@@ -2477,6 +2535,42 @@ NrMacSchedulerNs3::DoSchedUlTriggerReq (const NrMacSchedSapProvider::SchedUlTrig
   ScheduleUl (params, ulHarqFeedback);
 }
 
+/**
+ * \brief Pass a slot decision to the MAC
+ * \param params the decision
+ *
+ * With ParallelScheduling, the decision is kept until CommitSchedConfig(),
+ * because it is taken outside the simulator thread.
+ */
+void
+NrMacSchedulerNs3::IndicateSchedConfig (const NrMacSchedSapUser::SchedConfigIndParameters &params)
+{
+  if (m_parallelScheduling)
+    {
+      m_pendingSchedConfig.push_back (params);
+    }
+  else
+    {
+      m_macSchedSapUser->SchedConfigInd (params);
+    }
+}
+
+/**
+ * \brief Pass to the MAC the decisions taken by NrMacSchedulerParallel
+ */
+void
+NrMacSchedulerNs3::CommitSchedConfig ()
+{
+  NS_LOG_FUNCTION (this);
+
+  std::vector<NrMacSchedSapUser::SchedConfigIndParameters> pending;
+  pending.swap (m_pendingSchedConfig);
+  for (const auto &params : pending)
+    {
+      m_macSchedSapUser->SchedConfigInd (params);
+    }
+}
+
 /**
  * \brief Save the SR list into m_srList
  * \param params SR list
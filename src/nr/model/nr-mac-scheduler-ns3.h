@@ -33,6 +33,7 @@ namespace ns3 {
 
 class NrSchedGeneralTestCase;
 class NrMacSchedulerHarqRr;
+class NrMacSchedulerParallel;
 class NrMacSchedulerSrsDefault;
 
 /**
@@ -824,6 +825,12 @@ private:
                              const NrMacSchedulerUeInfo::GetHarqVectorFn &GetHarqVectorFn,
                              const std::string &direction) const;
 
+  void ProcessDlTriggerReq (const NrMacSchedSapProvider::SchedDlTriggerReqParameters& params);
+  void ProcessUlTriggerReq (const NrMacSchedSapProvider::SchedUlTriggerReqParameters& params);
+
+  void IndicateSchedConfig (const NrMacSchedSapUser::SchedConfigIndParameters &params);
+  void CommitSchedConfig ();
+
   void
   ScheduleDl (const NrMacSchedSapProvider::SchedDlTriggerReqParameters& params,
               const std::vector <DlHarqInfo> &dlHarqInfo);
@@ -924,6 +931,10 @@ private:
   friend NrSchedGeneralTestCase;
 
   bool m_enableHarqReTx  {true}; //!< Flag to enable or disable HARQ ReTx (attribute)
+
+  bool m_parallelScheduling {false}; //!< Compute the slot decisions with NrMacSchedulerParallel (attribute)
+  std::vector<NrMacSchedSapUser::SchedConfigIndParameters> m_pendingSchedConfig; //!< Decisions not yet passed to the MAC
+  friend NrMacSchedulerParallel;
 };
 
 } //namespace ns3
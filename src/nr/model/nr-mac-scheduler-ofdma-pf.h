@@ -171,6 +171,20 @@ protected:
                                        const FTResources &notAssigned,
                                        const FTResources &totalAssigned) const override;
 
+  /**
+   * \brief Tell if the UEs can be kept in a heap while assigning the RBG
+   * \return true
+   *
+   * The PF metric computed by NotAssignedDlResources() and
+   * NotAssignedUlResources() only depends on the UE and on the symbols of
+   * the beam, so calling them again on an unchanged UE does nothing.
+   */
+  virtual bool
+  IsNotAssignedIdempotent () const override
+  {
+    return true;
+  }
+
   /**
    * \brief Calculate the potential throughput for the DL based on the available resources
    * \param ue UE to which a rgb has been assigned
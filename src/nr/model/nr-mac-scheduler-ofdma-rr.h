@@ -134,6 +134,13 @@ protected:
                  const FTResources &assignableInIteration) const override
   {
   }
+
+  // NotAssignedDlResources and NotAssignedUlResources do nothing
+  virtual bool
+  IsNotAssignedIdempotent () const override
+  {
+    return true;
+  }
 };
 
 } // namespace ns3
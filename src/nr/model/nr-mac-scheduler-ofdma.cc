@@ -28,6 +28,8 @@
 #include "nr-mac-scheduler-ofdma.h"
 #include <ns3/log.h>
 #include <algorithm>
+#include <functional>
+#include <numeric>
 
 namespace ns3 {
 NS_LOG_COMPONENT_DEFINE ("NrMacSchedulerOfdma");
@@ -132,6 +134,288 @@ NrMacSchedulerOfdma::GetSymPerBeam (uint32_t symAvail,
   return ret;
 }
 
+namespace {
+
+/**
+ * \brief Order of the UEs of a beam, by their position in the beam UE vector
+ *
+ * The UEs are ordered by the scheduler comparison function, and the ties
+ * by their position in the beam UE vector, so that the order of the heap
+ * does not depend on the order in which the UEs were moved inside it. It is
+ * only used by the heap path; the sorting path keeps the comparison function
+ * of the scheduler as it is.
+ */
+class NrOfdmaUeOrder
+{
+public:
+  /// Comparison function of the scheduler
+  typedef std::function<bool (const NrMacSchedulerNs3::UePtrAndBufferReq &,
+                              const NrMacSchedulerNs3::UePtrAndBufferReq &)> CompareFn;
+
+  /**
+   * \brief NrOfdmaUeOrder constructor
+   * \param ues the UEs of the beam
+   * \param cmp the comparison function
+   */
+  NrOfdmaUeOrder (const std::vector<NrMacSchedulerNs3::UePtrAndBufferReq> &ues,
+                  const CompareFn &cmp)
+    : m_ues (ues),
+      m_cmp (cmp)
+  {
+  }
+
+  /**
+   * \param a position of the first UE
+   * \param b position of the second UE
+   * \return true if the first UE is ordered before the second one
+   */
+  bool operator() (uint32_t a, uint32_t b) const
+  {
+    if (m_cmp (m_ues[a], m_ues[b]))
+      {
+        return true;
+      }
+    if (m_cmp (m_ues[b], m_ues[a]))
+      {
+        return false;
+      }
+    return a < b;
+  }
+
+private:
+  const std::vector<NrMacSchedulerNs3::UePtrAndBufferReq> &m_ues; //!< UEs of the beam
+  CompareFn m_cmp;                                                 //!< Comparison function
+};
+
+/**
+ * \brief Indexed binary heap of the UEs of a beam
+ *
+ * The first UE is the first one in NrOfdmaUeOrder. The position of each UE
+ * inside the heap is tracked, so that a UE whose metric changed can be
+ * moved to its new place in O(log N).
+ */
+class NrOfdmaUeHeap
+{
+public:
+  /**
+   * \brief NrOfdmaUeHeap constructor
+   * \param order the order of the UEs
+   * \param n the number of UEs of the beam
+   */
+  NrOfdmaUeHeap (const NrOfdmaUeOrder &order, uint32_t n)
+    : m_order (order),
+      m_pos (n, NONE)
+  {
+    m_heap.reserve (n);
+  }
+
+  /**
+   * \brief Add a UE, without restoring the heap order
+   * \param ue position of the UE
+   *
+   * Build() must be called before using the heap.
+   */
+  void Add (uint32_t ue)
+  {
+    m_pos[ue] = m_heap.size ();
+    m_heap.push_back (ue);
+  }
+
+  /**
+   * \brief Add a UE, restoring the heap order
+   * \param ue position of the UE
+   */
+  void Insert (uint32_t ue)
+  {
+    Add (ue);
+    SiftUp (m_pos[ue]);
+  }
+
+  /**
+   * \brief Restore the heap order after Add() or after changing many UEs
+   */
+  void Build ()
+  {
+    for (uint32_t i = m_heap.size () / 2; i-- > 0; )
+      {
+        SiftDown (i);
+      }
+  }
+
+  /// \return true if there are no UEs in the heap
+  bool IsEmpty () const
+  {
+    return m_heap.empty ();
+  }
+
+  /// \return the position of the first UE
+  uint32_t Top () const
+  {
+    return m_heap.front ();
+  }
+
+  /**
+   * \param ue position of the UE
+   * \return true if the UE is in the heap
+   */
+  bool Contains (uint32_t ue) const
+  {
+    return m_pos[ue] != NONE;
+  }
+
+  /**
+   * \brief Move a UE whose metric changed to its new place
+   * \param ue position of the UE
+   */
+  void Update (uint32_t ue)
+  {
+    SiftDown (SiftUp (m_pos[ue]));
+  }
+
+  /**
+   * \brief Remove a UE from the heap
+   * \param ue position of the UE
+   */
+  void Remove (uint32_t ue)
+  {
+    uint32_t i = m_pos[ue];
+    uint32_t last = m_heap.back ();
+    m_heap.pop_back ();
+    m_pos[ue] = NONE;
+    if (i < m_heap.size ())
+      {
+        m_heap[i] = last;
+        m_pos[last] = i;
+        SiftDown (SiftUp (i));
+      }
+  }
+
+private:
+  static constexpr uint32_t NONE = UINT32_MAX; //!< Position of a UE not in the heap
+
+  /**
+   * \brief Swap two heap entries
+   * \param i first entry
+   * \param j second entry
+   */
+  void Swap (uint32_t i, uint32_t j)
+  {
+    std::swap (m_heap[i], m_heap[j]);
+    m_pos[m_heap[i]] = i;
+    m_pos[m_heap[j]] = j;
+  }
+
+  /**
+   * \brief Move an entry towards the root
+   * \param i the entry
+   * \return the new index of the entry
+   */
+  uint32_t SiftUp (uint32_t i)
+  {
+    while (i > 0 && m_order (m_heap[i], m_heap[(i - 1) / 2]))
+      {
+        Swap (i, (i - 1) / 2);
+        i = (i - 1) / 2;
+      }
+    return i;
+  }
+
+  /**
+   * \brief Move an entry towards the leaves
+   * \param i the entry
+   */
+  void SiftDown (uint32_t i)
+  {
+    while (true)
+      {
+        uint32_t first = i;
+        uint32_t left = 2 * i + 1;
+        uint32_t right = left + 1;
+        if (left < m_heap.size () && m_order (m_heap[left], m_heap[first]))
+          {
+            first = left;
+          }
+        if (right < m_heap.size () && m_order (m_heap[right], m_heap[first]))
+          {
+            first = right;
+          }
+        if (first == i)
+          {
+            return;
+          }
+        Swap (i, first);
+        i = first;
+      }
+  }
+
+  const NrOfdmaUeOrder &m_order;  //!< Order of the UEs
+  std::vector<uint32_t> m_heap;   //!< Positions of the UEs, in heap order
+  std::vector<uint32_t> m_pos;    //!< Index in m_heap of each UE, or NONE
+};
+
+} // unnamed namespace
+
+bool
+NrMacSchedulerOfdma::IsNotAssignedIdempotent () const
+{
+  return false;
+}
+
+bool
+NrMacSchedulerOfdma::IsDlBufferCovered (const UePtrAndBufferReq &ue) const
+{
+  //if there are two streams we add the TbSizes of the two
+  //streams to satisfy the bufQueueSize
+  uint32_t tbSize = 0;
+  for (const auto &it : ue.first->m_dlTbSize)
+    {
+      tbSize += it;
+    }
+  return tbSize >= std::max (ue.second, 7U);
+}
+
+void
+NrMacSchedulerOfdma::TrimDlStreams (const UePtrAndBufferReq &ue) const
+{
+  if (ue.first->m_dlTbSize.size () <= 1)
+    {
+      return;
+    }
+
+  // This is purely for MIMO. In MIMO, for example, if the
+  // first TB size is big enough to empty the buffer then we
+  // should not allocate anything to the second stream. In this
+  // case, if we allocate bytes to the second stream, the UE
+  // would expect the TB but the gNB would not be able to transmit
+  // it. This would break HARQ TX state machine at UE PHY.
+  uint8_t streamCounter = 0;
+  uint32_t copyBufQueueSize = ue.second;
+  for (auto &dlTbSize : ue.first->m_dlTbSize)
+    {
+      if (copyBufQueueSize != 0)
+        {
+          NS_LOG_DEBUG ("Stream " << +streamCounter << " with TB size " << dlTbSize << " needed to TX MIMO TB");
+          if (dlTbSize >= copyBufQueueSize)
+            {
+              copyBufQueueSize = 0;
+            }
+          else
+            {
+              copyBufQueueSize = copyBufQueueSize - dlTbSize;
+            }
+        }
+      else
+        {
+          // if we are here, that means previously iterated
+          // streams were enough to empty the buffer. We do
+          // not need this stream. Make its TB size zero.
+          NS_LOG_DEBUG ("Stream " << +streamCounter << " with TB size " << dlTbSize << " not needed to TX MIMO TB");
+          dlTbSize = 0;
+        }
+      streamCounter++;
+    }
+}
+
 /**
  * \brief Assign the available DL RBG to the UEs
  * \param symAvail Available symbols
@@ -156,6 +440,13 @@ NrMacSchedulerOfdma::GetSymPerBeam (uint32_t symAvail,
  * to assign resources to UEs that already have their buffer requirement covered,
  * and the other one is avoid to assign symbols when all the UEs have their
  * requirements covered.
+ *
+ * If IsNotAssignedIdempotent() returns true, the UEs are not sorted for
+ * each RBG: AssignDlRbgWithHeap() keeps them in a heap, in which only the UEs
+ * whose metric changed are moved. The heap breaks the ties of the comparison
+ * function by the order of the UEs in the beam, while the sort keeps them in
+ * the order left by the previous RBG, so the two may assign the RBG
+ * differently to UEs with the same metric.
  */
 NrMacSchedulerNs3::BeamSymbolMap
 NrMacSchedulerOfdma::AssignDLRBG (uint32_t symAvail, const ActiveUeMap &activeDl) const
@@ -192,6 +483,12 @@ NrMacSchedulerOfdma::AssignDLRBG (uint32_t symAvail, const ActiveUeMap &activeDl
           BeforeDlSched (ue, FTResources (rbgAssignable * beamSym, beamSym));
         }
 
+      if (IsNotAssignedIdempotent ())
+        {
+          AssignDlRbgWithHeap (ueVector, resources, beamSym);
+          continue;
+        }
+
       while (resources > 0)
         {
           GetFirst GetUe;
@@ -305,6 +602,137 @@ NrMacSchedulerOfdma::AssignDLRBG (uint32_t symAvail, const ActiveUeMap &activeDl
   return symPerBeam;
 }
 
+void
+NrMacSchedulerOfdma::AssignDlRbgTo (const UePtrAndBufferReq &ue, uint32_t beamSym,
+                                    FTResources *assigned) const
+{
+  // Assign 1 RBG for each available symbols for the beam
+  uint32_t rbgAssignable = 1 * beamSym;
+  GetFirst GetUe;
+  GetUe (ue)->m_dlRBG += rbgAssignable;
+  assigned->m_rbg += rbgAssignable;
+
+  GetUe (ue)->m_dlSym = beamSym;
+  assigned->m_sym = beamSym;
+
+  // Update metrics
+  NS_LOG_DEBUG ("Assigned " << rbgAssignable <<
+                " DL RBG, spanned over " << beamSym << " SYM, to UE " <<
+                GetUe (ue)->m_rnti);
+  //Following call to AssignedDlResources would update the
+  //TB size in the NrMacSchedulerUeInfo of this particular UE
+  //according the Rank Indicator reported by it. Only one call
+  //to this method is enough even if the UE reported rank indicator 2,
+  //since the number of RBG assigned to both the streams are the same.
+  AssignedDlResources (ue, FTResources (rbgAssignable, beamSym), *assigned);
+}
+
+void
+NrMacSchedulerOfdma::AssignDlRbgWithHeap (const std::vector<UePtrAndBufferReq> &ueVector,
+                                          uint32_t resources, uint32_t beamSym) const
+{
+  NrOfdmaUeOrder order (ueVector, GetUeCompareDlFn ());
+  NrOfdmaUeHeap heap (order, ueVector.size ());
+  // UEs with their buffer covered and more than one stream, which may
+  // need their streams trimmed when passed over
+  std::vector<uint32_t> coveredMimo;
+  // UEs never updated in this beam, which need NotAssignedDlResources
+  std::vector<uint32_t> notUpdated (ueVector.size ());
+  std::iota (notUpdated.begin (), notUpdated.end (), 0);
+  std::vector<uint32_t> trimmed;
+  FTResources assigned (0,0);
+
+  for (uint32_t i = 0; i < ueVector.size (); ++i)
+    {
+      if (!IsDlBufferCovered (ueVector[i]))
+        {
+          heap.Add (i);
+        }
+      else if (ueVector[i].first->m_dlTbSize.size () > 1)
+        {
+          coveredMimo.push_back (i);
+        }
+    }
+  heap.Build ();
+
+  while (resources > 0)
+    {
+      // In the case that all the UE already have their requirements fullfilled,
+      // then stop the beam processing and pass to the next. All of them
+      // have been passed over.
+      if (heap.IsEmpty ())
+        {
+          for (const auto &i : coveredMimo)
+            {
+              TrimDlStreams (ueVector[i]);
+            }
+          break;
+        }
+
+      uint32_t winner = heap.Top ();
+
+      // Ensure fairness: pass over UEs which already has enough resources to transmit
+      trimmed.clear ();
+      for (const auto &i : coveredMimo)
+        {
+          if (order (i, winner))
+            {
+              TrimDlStreams (ueVector[i]);
+              trimmed.push_back (i);
+            }
+        }
+
+      AssignDlRbgTo (ueVector[winner], beamSym, &assigned);
+      resources -= 1; // Resources are RBG, so they do not consider the beamSym
+
+      if (IsDlBufferCovered (ueVector[winner]))
+        {
+          heap.Remove (winner);
+          if (ueVector[winner].first->m_dlTbSize.size () > 1)
+            {
+              coveredMimo.push_back (winner);
+            }
+        }
+      else
+        {
+          heap.Update (winner);
+        }
+
+      // Update metrics for the unsuccessfull UEs. Calling NotAssignedDlResources
+      // again on an unchanged UE does nothing, so only the UEs never updated
+      // and the ones just trimmed are updated.
+      bool rebuild = false;
+      for (const auto &i : notUpdated)
+        {
+          if (i != winner)
+            {
+              NotAssignedDlResources (ueVector[i], FTResources (beamSym, beamSym), assigned);
+              rebuild = true;
+            }
+        }
+      notUpdated.clear ();
+      for (const auto &i : trimmed)
+        {
+          NotAssignedDlResources (ueVector[i], FTResources (beamSym, beamSym), assigned);
+        }
+      if (rebuild)
+        {
+          heap.Build ();
+        }
+
+      // Trimming the streams may uncover the buffer of a UE with a small
+      // buffer, which then competes again for the resources
+      for (const auto &i : trimmed)
+        {
+          if (!IsDlBufferCovered (ueVector[i]))
+            {
+              coveredMimo.erase (std::find (coveredMimo.begin (), coveredMimo.end (), i));
+              heap.Insert (i);
+            }
+        }
+    }
+}
+
 NrMacSchedulerNs3::BeamSymbolMap
 NrMacSchedulerOfdma::AssignULRBG (uint32_t symAvail, const ActiveUeMap &activeUl) const
 {
@@ -340,6 +768,12 @@ NrMacSchedulerOfdma::AssignULRBG (uint32_t symAvail, const ActiveUeMap &activeUl
           BeforeUlSched (ue, FTResources (rbgAssignable * beamSym, beamSym));
         }
 
+      if (IsNotAssignedIdempotent ())
+        {
+          AssignUlRbgWithHeap (ueVector, resources, beamSym);
+          continue;
+        }
+
       while (resources > 0)
         {
           GetFirst GetUe;
@@ -399,6 +833,88 @@ NrMacSchedulerOfdma::AssignULRBG (uint32_t symAvail, const ActiveUeMap &activeUl
   return symPerBeam;
 }
 
+void
+NrMacSchedulerOfdma::AssignUlRbgTo (const UePtrAndBufferReq &ue, uint32_t beamSym,
+                                    FTResources *assigned) const
+{
+  // Assign 1 RBG for each available symbols for the beam
+  uint32_t rbgAssignable = 1 * beamSym;
+  GetFirst GetUe;
+  GetUe (ue)->m_ulRBG += rbgAssignable;
+  assigned->m_rbg += rbgAssignable;
+
+  GetUe (ue)->m_ulSym = beamSym;
+  assigned->m_sym = beamSym;
+
+  // Update metrics
+  NS_LOG_DEBUG ("Assigned " << rbgAssignable <<
+                " UL RBG, spanned over " << beamSym << " SYM, to UE " <<
+                GetUe (ue)->m_rnti);
+  AssignedUlResources (ue, FTResources (rbgAssignable, beamSym), *assigned);
+}
+
+void
+NrMacSchedulerOfdma::AssignUlRbgWithHeap (const std::vector<UePtrAndBufferReq> &ueVector,
+                                          uint32_t resources, uint32_t beamSym) const
+{
+  NrOfdmaUeOrder order (ueVector, GetUeCompareUlFn ());
+  NrOfdmaUeHeap heap (order, ueVector.size ());
+  // UEs never updated in this beam, which need NotAssignedUlResources
+  std::vector<uint32_t> notUpdated (ueVector.size ());
+  std::iota (notUpdated.begin (), notUpdated.end (), 0);
+  FTResources assigned (0,0);
+
+  for (uint32_t i = 0; i < ueVector.size (); ++i)
+    {
+      if (!IsUlBufferCovered (ueVector[i]))
+        {
+          heap.Add (i);
+        }
+    }
+  heap.Build ();
+
+  // In the case that all the UE already have their requirements fullfilled,
+  // then stop the beam processing and pass to the next
+  while (resources > 0 && !heap.IsEmpty ())
+    {
+      uint32_t winner = heap.Top ();
+      AssignUlRbgTo (ueVector[winner], beamSym, &assigned);
+      resources -= 1; // Resources are RBG, so they do not consider the beamSym
+
+      if (IsUlBufferCovered (ueVector[winner]))
+        {
+          heap.Remove (winner);
+        }
+      else
+        {
+          heap.Update (winner);
+        }
+
+      // Update metrics for the unsuccessfull UEs. Calling NotAssignedUlResources
+      // again on an unchanged UE does nothing, so only the UEs never updated are.
+      bool rebuild = false;
+      for (const auto &i : notUpdated)
+        {
+          if (i != winner)
+            {
+              NotAssignedUlResources (ueVector[i], FTResources (beamSym, beamSym), assigned);
+              rebuild = true;
+            }
+        }
+      notUpdated.clear ();
+      if (rebuild)
+        {
+          heap.Build ();
+        }
+    }
+}
+
+bool
+NrMacSchedulerOfdma::IsUlBufferCovered (const UePtrAndBufferReq &ue) const
+{
+  return ue.first->m_ulTbSize >= std::max (ue.second, 7U);
+}
+
 /**
  * \brief Create the DL DCI in OFDMA mode
  * \param spoint Starting point
@@ -110,7 +110,82 @@ protected:
 
   virtual uint8_t GetTpc () const override;
 
+  /**
+   * \brief Tell if the UEs can be kept in a heap while assigning the RBG
+   * \return true if a second call to NotAssignedDlResources() or
+   * NotAssignedUlResources() does not change a UE which did not change
+   * since the previous call, or since AssignedDlResources() or
+   * AssignedUlResources(), in the same beam
+   *
+   * When true, AssignDLRBG() and AssignULRBG() keep the UEs in a heap
+   * ordered by the comparison functions, and only move the UEs whose metric
+   * changed, instead of sorting all the UEs for each RBG. It takes O(log N)
+   * instead of O(N log N) comparisons per RBG. The assignment is the same,
+   * except among UEs with the same metric, whose ties are broken by their
+   * order in the beam instead of by the previous sort.
+   *
+   * The default implementation returns false.
+   */
+  virtual bool IsNotAssignedIdempotent () const;
+
 private:
+  /**
+   * \brief Check if the DL TB size of a UE covers its buffer
+   * \param ue the UE
+   * \return true if the UE does not need more DL resources
+   */
+  bool IsDlBufferCovered (const UePtrAndBufferReq &ue) const;
+  /**
+   * \brief Check if the UL TB size of a UE covers its buffer
+   * \param ue the UE
+   * \return true if the UE does not need more UL resources
+   */
+  bool IsUlBufferCovered (const UePtrAndBufferReq &ue) const;
+  /**
+   * \brief Zero the TB size of the MIMO streams not needed to empty the buffer
+   * \param ue the UE, whose buffer is covered
+   */
+  void TrimDlStreams (const UePtrAndBufferReq &ue) const;
+  /**
+   * \brief Assign the RBG of one frequency to a UE in DL
+   * \param ue the UE
+   * \param beamSym the symbols of the beam
+   * \param assigned the resources assigned in the beam, updated
+   */
+  void AssignDlRbgTo (const UePtrAndBufferReq &ue, uint32_t beamSym,
+                      FTResources *assigned) const;
+  /**
+   * \brief Assign the RBG of one frequency to a UE in UL
+   * \param ue the UE
+   * \param beamSym the symbols of the beam
+   * \param assigned the resources assigned in the beam, updated
+   */
+  void AssignUlRbgTo (const UePtrAndBufferReq &ue, uint32_t beamSym,
+                      FTResources *assigned) const;
+  /**
+   * \brief Assign the DL RBG of a beam, keeping the UEs in a heap
+   *
+   * The ties of the comparison function are broken by the position of the
+   * UEs in ueVector.
+   *
+   * \param ueVector the UEs of the beam
+   * \param resources the RBG available
+   * \param beamSym the symbols of the beam
+   */
+  void AssignDlRbgWithHeap (const std::vector<UePtrAndBufferReq> &ueVector,
+                            uint32_t resources, uint32_t beamSym) const;
+  /**
+   * \brief Assign the UL RBG of a beam, keeping the UEs in a heap
+   *
+   * The ties of the comparison function are broken by the position of the
+   * UEs in ueVector.
+   *
+   * \param ueVector the UEs of the beam
+   * \param resources the RBG available
+   * \param beamSym the symbols of the beam
+   */
+  void AssignUlRbgWithHeap (const std::vector<UePtrAndBufferReq> &ueVector,
+                            uint32_t resources, uint32_t beamSym) const;
 
   TracedValue<uint32_t> m_tracedValueSymPerBeam;
 };
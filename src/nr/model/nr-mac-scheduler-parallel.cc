@@ -0,0 +1,253 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License version 2 as
+ *   published by the Free Software Foundation;
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "nr-mac-scheduler-parallel.h"
+#include "nr-mac-scheduler-ns3.h"
+
+#include <ns3/log.h>
+#include <ns3/simulator.h>
+#include <ns3/uinteger.h>
+#include <algorithm>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("NrMacSchedulerParallel");
+NS_OBJECT_ENSURE_REGISTERED (NrMacSchedulerParallel);
+
+Ptr<NrMacSchedulerParallel> NrMacSchedulerParallel::m_instance = nullptr;
+
+TypeId
+NrMacSchedulerParallel::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::NrMacSchedulerParallel")
+    .SetParent<Object> ()
+    .AddConstructor<NrMacSchedulerParallel> ()
+    .AddAttribute ("NumThreads",
+                   "Number of threads that compute the decisions of the schedulers "
+                   "with ParallelScheduling enabled, including the simulator thread. "
+                   "0 means one thread per hardware thread.",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&NrMacSchedulerParallel::SetNumThreads,
+                                         &NrMacSchedulerParallel::GetNumThreads),
+                   MakeUintegerChecker<uint32_t> ())
+  ;
+  return tid;
+}
+
+NrMacSchedulerParallel::NrMacSchedulerParallel ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+NrMacSchedulerParallel::~NrMacSchedulerParallel ()
+{
+  NS_LOG_FUNCTION (this);
+  StopWorkers ();
+}
+
+void
+NrMacSchedulerParallel::DoDispose ()
+{
+  NS_LOG_FUNCTION (this);
+  m_runEvent.Cancel ();
+  m_batches.clear ();
+  m_batchIndex.clear ();
+  StopWorkers ();
+  Object::DoDispose ();
+}
+
+Ptr<NrMacSchedulerParallel>
+NrMacSchedulerParallel::Get ()
+{
+  if (m_instance == nullptr)
+    {
+      m_instance = CreateObject<NrMacSchedulerParallel> ();
+      Simulator::ScheduleDestroy (&NrMacSchedulerParallel::Release);
+    }
+  return m_instance;
+}
+
+void
+NrMacSchedulerParallel::Release ()
+{
+  NS_LOG_FUNCTION_NOARGS ();
+  if (m_instance != nullptr)
+    {
+      m_instance->Dispose ();
+      m_instance = nullptr;
+    }
+}
+
+void
+NrMacSchedulerParallel::SetNumThreads (uint32_t n)
+{
+  NS_LOG_FUNCTION (this << n);
+  if (n == 0)
+    {
+      n = std::max (std::thread::hardware_concurrency (), 1U);
+    }
+  if (n != m_numThreads)
+    {
+      StopWorkers ();
+      m_numThreads = n;
+    }
+}
+
+uint32_t
+NrMacSchedulerParallel::GetNumThreads () const
+{
+  return m_numThreads;
+}
+
+void
+NrMacSchedulerParallel::Submit (const Ptr<NrMacSchedulerNs3> &scheduler,
+                                const std::function<void ()> &work)
+{
+  NS_LOG_FUNCTION (this << scheduler);
+
+  if (m_batches.empty ())
+    {
+      // Run after all the events already scheduled for this time stamp,
+      // i.e., after the slot starts of all the gNBs
+      m_runEvent = Simulator::ScheduleNow (&NrMacSchedulerParallel::Run, this);
+    }
+
+  auto it = m_batchIndex.find (PeekPointer (scheduler));
+  if (it == m_batchIndex.end ())
+    {
+      it = m_batchIndex.emplace (PeekPointer (scheduler), m_batches.size ()).first;
+      m_batches.emplace_back ();
+      m_batches.back ().m_scheduler = scheduler;
+      m_batches.back ().m_context = Simulator::GetContext ();
+    }
+  m_batches.at (it->second).m_work.push_back (work);
+}
+
+void
+NrMacSchedulerParallel::RunBatches ()
+{
+  for (size_t i = m_nextBatch++; i < m_batches.size (); i = m_nextBatch++)
+    {
+      for (const auto &work : m_batches[i].m_work)
+        {
+          work ();
+        }
+    }
+}
+
+void
+NrMacSchedulerParallel::WorkerLoop ()
+{
+  uint64_t round = 0;
+  std::unique_lock<std::mutex> lock (m_mutex);
+  while (true)
+    {
+      m_wakeUp.wait (lock, [this, round] () { return m_stop || m_round != round; });
+      if (m_stop)
+        {
+          return;
+        }
+      round = m_round;
+      lock.unlock ();
+      RunBatches ();
+      lock.lock ();
+      if (--m_busyWorkers == 0)
+        {
+          m_allDone.notify_one ();
+        }
+    }
+}
+
+void
+NrMacSchedulerParallel::StartWorkers ()
+{
+  if (!m_workers.empty ())
+    {
+      return;
+    }
+  NS_LOG_INFO ("Starting " << m_numThreads - 1 << " worker threads");
+  std::unique_lock<std::mutex> lock (m_mutex);
+  m_stop = false;
+  m_round = 0;
+  for (uint32_t i = 1; i < m_numThreads; ++i)
+    {
+      m_workers.emplace_back (&NrMacSchedulerParallel::WorkerLoop, this);
+    }
+}
+
+void
+NrMacSchedulerParallel::StopWorkers ()
+{
+  if (m_workers.empty ())
+    {
+      return;
+    }
+  {
+    std::unique_lock<std::mutex> lock (m_mutex);
+    m_stop = true;
+  }
+  m_wakeUp.notify_all ();
+  for (auto &worker : m_workers)
+    {
+      worker.join ();
+    }
+  m_workers.clear ();
+}
+
+void
+NrMacSchedulerParallel::Run ()
+{
+  NS_LOG_FUNCTION (this);
+
+  NS_LOG_INFO ("Scheduling " << m_batches.size () << " schedulers at " <<
+               Simulator::Now ().As (Time::S));
+
+  m_nextBatch = 0;
+  if (m_batches.size () > 1 && m_numThreads > 1)
+    {
+      StartWorkers ();
+      {
+        std::unique_lock<std::mutex> lock (m_mutex);
+        m_busyWorkers = m_workers.size ();
+        ++m_round;
+      }
+      m_wakeUp.notify_all ();
+      RunBatches ();
+      std::unique_lock<std::mutex> lock (m_mutex);
+      m_allDone.wait (lock, [this] () { return m_busyWorkers == 0; });
+    }
+  else
+    {
+      RunBatches ();
+    }
+
+  // The commits run later, and their MACs may submit work for a new batch
+  std::vector<Batch> batches;
+  batches.swap (m_batches);
+  m_batchIndex.clear ();
+
+  std::stable_sort (batches.begin (), batches.end (),
+                    [] (const Batch &a, const Batch &b) { return a.m_context < b.m_context; });
+  for (const auto &batch : batches)
+    {
+      Simulator::ScheduleWithContext (batch.m_context, Seconds (0),
+                                      &NrMacSchedulerNs3::CommitSchedConfig,
+                                      batch.m_scheduler);
+    }
+}
+
+} // namespace ns3
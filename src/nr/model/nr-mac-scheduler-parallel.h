@@ -0,0 +1,173 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License version 2 as
+ *   published by the Free Software Foundation;
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+#pragma once
+
+#include <ns3/object.h>
+#include <ns3/event-id.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace ns3 {
+
+class NrMacSchedulerNs3;
+
+/**
+ * \ingroup scheduler
+ * \brief Computes the slot decisions of many schedulers in parallel
+ *
+ * A NrMacSchedulerNs3 with the attribute ParallelScheduling set to true does
+ * not compute its decision when the MAC triggers it, but submits the work to
+ * the instance returned by Get(). The work submitted by all the schedulers
+ * at the same time stamp (all the gNBs and all their bandwidth parts whose
+ * slot starts at that time) is collected until the end of the time stamp,
+ * and then it is run on a pool of threads: the work of different schedulers
+ * runs in parallel, the work of the same scheduler runs in order, on the same
+ * thread.
+ *
+ * When all the work is done, the decisions are committed to the MAC of each
+ * scheduler, in the order of the node id (the simulator context of the
+ * submission) and, for the same node, in the order of the submission. The
+ * commit happens in an event with the context of the node, so logs and traces
+ * fired by the MAC are the same as in the sequential mode.
+ *
+ * The decisions do not depend on the number of threads. They may differ from
+ * the sequential mode, because the events that reach a scheduler after its
+ * slot trigger, but at the same time stamp, are now processed before its
+ * decision instead of after.
+ *
+ * The scheduler state is only touched by one thread at a time, but the
+ * objects shared between schedulers must not be modified while scheduling:
+ * the trace sinks connected to the schedulers are called from the worker
+ * threads, and NS_LOG output of different schedulers can be interleaved.
+ */
+class NrMacSchedulerParallel : public Object
+{
+public:
+  /**
+   * \brief GetTypeId
+   * \return The TypeId of the class
+   */
+  static TypeId GetTypeId (void);
+
+  /**
+   * \brief NrMacSchedulerParallel constructor
+   */
+  NrMacSchedulerParallel ();
+
+  /**
+   * \brief ~NrMacSchedulerParallel
+   */
+  ~NrMacSchedulerParallel () override;
+
+  /**
+   * \brief Get the instance of the simulation
+   * \return the instance, created with the attribute default values at the
+   * first call and released by Simulator::Destroy ()
+   */
+  static Ptr<NrMacSchedulerParallel> Get ();
+
+  /**
+   * \brief Submit the work of a scheduler for the current time stamp
+   * \param scheduler the scheduler
+   * \param work the work, which must only touch the scheduler state
+   *
+   * After all the work of the batch is done, the scheduler commits its
+   * decisions with NrMacSchedulerNs3::CommitSchedConfig().
+   */
+  void Submit (const Ptr<NrMacSchedulerNs3> &scheduler, const std::function<void ()> &work);
+
+  /**
+   * \brief Set the number of threads
+   * \param n the number of threads, including the simulator one; 0 means one
+   * per hardware thread
+   */
+  void SetNumThreads (uint32_t n);
+
+  /**
+   * \brief Get the number of threads
+   * \return the number of threads, including the simulator one
+   */
+  uint32_t GetNumThreads () const;
+
+protected:
+  void DoDispose () override;
+
+private:
+  /**
+   * \brief The work submitted by a scheduler in the current time stamp
+   */
+  struct Batch
+  {
+    Ptr<NrMacSchedulerNs3> m_scheduler;       //!< The scheduler
+    uint32_t m_context {0};                   //!< Simulator context of the submission
+    std::vector<std::function<void ()>> m_work; //!< Work, in submission order
+  };
+
+  /**
+   * \brief Run the work of the batches, then schedule the commits
+   */
+  void Run ();
+
+  /**
+   * \brief Take batches and run their work, until none is left
+   */
+  void RunBatches ();
+
+  /**
+   * \brief Loop of a worker thread
+   */
+  void WorkerLoop ();
+
+  /**
+   * \brief Start the worker threads, if they are not running
+   */
+  void StartWorkers ();
+
+  /**
+   * \brief Stop and join the worker threads
+   */
+  void StopWorkers ();
+
+  /**
+   * \brief Release the instance of the simulation
+   */
+  static void Release ();
+
+  static Ptr<NrMacSchedulerParallel> m_instance; //!< Instance of the simulation
+
+  uint32_t m_numThreads {0};   //!< Number of threads, including the simulator one (attribute)
+  std::vector<Batch> m_batches; //!< Batches of the current time stamp
+  std::unordered_map<const NrMacSchedulerNs3*, size_t> m_batchIndex; //!< Index of the batch of each scheduler
+  EventId m_runEvent;           //!< Event that runs the batches
+
+  std::vector<std::thread> m_workers; //!< Worker threads
+  std::mutex m_mutex;                 //!< Protects the fields below
+  std::condition_variable m_wakeUp;   //!< Wakes up the workers
+  std::condition_variable m_allDone;  //!< Wakes up the simulator thread
+  uint64_t m_round {0};               //!< Incremented for each run of the batches
+  uint32_t m_busyWorkers {0};         //!< Workers that did not finish the current round
+  bool m_stop {false};                //!< The workers must exit
+  std::atomic<size_t> m_nextBatch {0}; //!< Next batch to take in the current round
+};
+
+} // namespace ns3
@@ -43,6 +43,12 @@ NrMacSchedulerSrsDefault::AssignStreams (int64_t stream)
 {
   NS_LOG_FUNCTION (this << stream);
   m_random->SetStream (stream);
+  // The offsets were shuffled with the previous stream when the periodicity
+  // attribute was set: shuffle them again, if no UE got one yet
+  if (m_periodicity > 0 && m_availableOffsetValues.size () == m_periodicity)
+    {
+      ShuffleOffsetValues ();
+    }
   return 1;
 }
 
@@ -146,6 +152,12 @@ NrMacSchedulerSrsDefault::SetStartingPeriodicity (uint32_t start)
     }
 
   m_periodicity = start;
+  ShuffleOffsetValues ();
+}
+
+void
+NrMacSchedulerSrsDefault::ShuffleOffsetValues ()
+{
   m_availableOffsetValues.resize (m_periodicity);
 
   // Fill the available values
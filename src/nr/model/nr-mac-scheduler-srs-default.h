@@ -88,6 +88,10 @@ private:
    * \param ueMap the UE map of the scheduler
    */
   void ReassignSrsValue (std::unordered_map<uint16_t, std::shared_ptr<NrMacSchedulerUeInfo> > *ueMap);
+  /**
+   * \brief Fill the available offset values for the periodicity, in a random order
+   */
+  void ShuffleOffsetValues ();
   static std::vector<uint32_t> StandardPeriodicity; //!< Standard periodicity of SRS
 
 private:
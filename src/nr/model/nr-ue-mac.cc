@@ -28,6 +28,7 @@
 #include "nr-ue-mac.h"
 #include <ns3/log.h>
 #include <ns3/boolean.h>
+#include <ns3/uinteger.h>
 #include <ns3/lte-radio-bearer-tag.h>
 #include <ns3/random-variable-stream.h>
 #include "nr-phy-sap.h"
@@ -36,6 +36,7 @@
 #include <algorithm>
 #include <cfloat>
 #include <ns3/boolean.h>
+#include <ns3/uinteger.h>
 #include <ns3/pointer.h>
 #include "beam-manager.h"
 #include "nr-ue-net-device.h"
@@ -100,7 +101,7 @@ NrUePhy::GetTypeId (void)
                     "power allocation over used (active) RBs. By default is set a uniform power "
                     "allocation over used RBs .",
                     EnumValue (NrSpectrumValueHelper::UNIFORM_POWER_ALLOCATION_USED),
-                    MakeEnumAccessor (&NrPhy::SetPowerAllocationType,
+                    MakeEnumAccessor<NrSpectrumValueHelper::PowerAllocationType> (&NrPhy::SetPowerAllocationType,
                                       &NrPhy::GetPowerAllocationType),
                     MakeEnumChecker ( NrSpectrumValueHelper::UNIFORM_POWER_ALLOCATION_BW, "UniformPowerAllocBw",
                                       NrSpectrumValueHelper::UNIFORM_POWER_ALLOCATION_USED, "UniformPowerAllocUsed"
@@ -1535,7 +1536,7 @@ NrUePhy::DoResetRlfParams ()
 }
 
 void
-NrUePhy::DoStartInSnycDetection ()
+NrUePhy::DoStartInSyncDetection ()
 {
   NS_LOG_FUNCTION (this);
   NS_FATAL_ERROR ("NrUePhy does not have RLF functionality yet");
@@ -741,7 +741,7 @@ private:
    * consecutive times.
    *
    */
-  void DoStartInSnycDetection ();
+  void DoStartInSyncDetection ();
 
   /**
    * \brief Set IMSI
@@ -320,7 +320,7 @@ RealisticBeamformingAlgorithm::GetBeamformingVectors ()
                   m_ueSpectrumPhy->GetBeamManager ()->SetSector (ueSector, ueTheta);
                   complexVector_t ueW = m_ueSpectrumPhy->GetBeamManager ()->GetCurrentBeamformingVector ();
 
-                  NS_ABORT_MSG_IF (gnbW.size()==0 || ueW.size()==0,
+                  NS_ABORT_MSG_IF (gnbW.GetSize ()==0 || ueW.GetSize ()==0,
                                    "Beamforming vectors must be initialized in order to calculate the long term matrix.");
 
                   const UniformPlanarArray::ComplexVector estimatedLongTermComponent = GetEstimatedLongTermComponent (channelMatrix, gnbW, ueW,
@@ -372,9 +372,9 @@ RealisticBeamformingAlgorithm::CalculateTheEstimatedLongTermMetric (const Unifor
   NS_LOG_FUNCTION (this);
 
   double totalSum = 0;
-  for (std::complex<double> c:longTermComponent)
+  for (size_t i = 0; i < longTermComponent.GetSize (); i++)
     {
-      totalSum += c.imag () * c.imag () + c.real () * c.real ();
+      totalSum += std::norm (longTermComponent[i]);
     }
   return totalSum;
 }
@@ -407,16 +407,15 @@ RealisticBeamformingAlgorithm::GetEstimatedLongTermComponent (const Ptr<const Ma
       uW = aW;
     }
 
-  uint16_t sAntenna = static_cast<uint16_t> (sW.size ());
-  uint16_t uAntenna = static_cast<uint16_t> (uW.size ());
+  uint16_t sAntenna = static_cast<uint16_t> (sW.GetSize ());
+  uint16_t uAntenna = static_cast<uint16_t> (uW.GetSize ());
 
   NS_LOG_DEBUG ("Calculate the estimation of the long term component with sAntenna: " << sAntenna << " uAntenna: " << uAntenna);
-  UniformPlanarArray::ComplexVector estimatedlongTerm;
-
   NS_ABORT_IF (srsSinr == 0);
 
   double varError = 1 / (srsSinr); // SINR the SINR from UL SRS reception
-  uint8_t numCluster = static_cast<uint8_t> (channelMatrix->m_channel[0][0].size ());
+  uint8_t numCluster = static_cast<uint8_t> (channelMatrix->m_channel.GetNumPages ());
+  UniformPlanarArray::ComplexVector estimatedlongTerm (numCluster);
 
   for (uint8_t cIndex = 0; cIndex < numCluster; cIndex++)
     {
@@ -429,12 +428,12 @@ RealisticBeamformingAlgorithm::GetEstimatedLongTermComponent (const Ptr<const Ma
               //error is generated from the normal random variable with mean 0 and  variance varError*sqrt(1/2) for real/imaginary parts
               std::complex<double> error = std::complex <double> (m_normalRandomVariable->GetValue (0, sqrt (0.5) * varError),
                                                                   m_normalRandomVariable->GetValue (0, sqrt (0.5) * varError)) ;
-              std::complex<double> hEstimate = channelMatrix->m_channel [uIndex][sIndex][cIndex] + error;
+              std::complex<double> hEstimate = channelMatrix->m_channel (uIndex, sIndex, cIndex) + error;
               rxSum += uW[uIndex] * (hEstimate);
             }
           txSum = txSum + sW[sIndex] * rxSum;
         }
-      estimatedlongTerm.push_back (txSum);
+      estimatedlongTerm[cIndex] = txSum;
     }
   return estimatedlongTerm;
 }
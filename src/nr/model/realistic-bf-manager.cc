@@ -43,7 +43,7 @@ RealisticBfManager::GetTypeId (void)
                      .AddAttribute ("TriggerEvent",
                                     "Defines a beamforming trigger event",
                                     EnumValue (RealisticBfManager::SRS_COUNT),
-                                    MakeEnumAccessor (&RealisticBfManager::SetTriggerEvent,
+                                    MakeEnumAccessor<TriggerEvent> (&RealisticBfManager::SetTriggerEvent,
                                                       &RealisticBfManager::GetTriggerEvent),
                                     MakeEnumChecker (RealisticBfManager::SRS_COUNT, "SrsCount",
                                                      RealisticBfManager::DELAYED_UPDATE, "DelayedUpdate"))
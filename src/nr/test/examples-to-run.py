@@ -47,6 +47,8 @@ cpp_examples = [
     ("cttc-channel-randomness", "True", "True"),
     ("rem-beam-example", "True", "True"),
     ("rem-example", "True", "True"),
+    ("cttc-ofdma-rbg-assignment --slots=50", "True", "True"),
+    ("cttc-error-model-decodification --tbs=1000", "True", "True"),
     ("cttc-nr-demo --ueNumPergNb=9", "True", "True"),
     ("cttc-nr-mimo-demo", "True", "True"),
     ("cttc-nr-mimo-demo --useFixedRi=0", "True", "True"),
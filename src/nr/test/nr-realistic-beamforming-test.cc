@@ -62,13 +62,13 @@ public:
 class NrRealisticBeamformingTestCase : public TestCase
 {
 public:
-  NrRealisticBeamformingTestCase (std::string name, enum TestDuration duration);
+  NrRealisticBeamformingTestCase (std::string name, TestCase::Duration duration);
   virtual ~NrRealisticBeamformingTestCase ();
 
 private:
 
   virtual void DoRun (void);
-  enum TestDuration m_duration {TestCase::QUICK}; //!< the test execution mode type
+  TestCase::Duration m_duration {TestCase::Duration::QUICK}; //!< the test execution mode type
 };
 
 
@@ -81,8 +81,8 @@ NrRealisticBeamformingTestSuite::NrRealisticBeamformingTestSuite ()
   NS_LOG_INFO ("Creating NrRealisticBeamformingTestSuite");
 
 
-  enum TestDuration durationQuick = TestCase::QUICK;
-  enum TestDuration durationExtensive = TestCase::EXTENSIVE;
+  TestCase::Duration durationQuick = TestCase::Duration::QUICK;
+  TestCase::Duration durationExtensive = TestCase::Duration::EXTENSIVE;
 
   AddTestCase (new NrRealisticBeamformingTestCase ("RealisticBeamforming basic test case", durationQuick), durationQuick);
   AddTestCase (new NrRealisticBeamformingTestCase ("RealisticBeamforming basic test case", durationExtensive), durationExtensive);
@@ -94,7 +94,7 @@ NrRealisticBeamformingTestSuite::NrRealisticBeamformingTestSuite ()
  * TestCase
  */
 
-NrRealisticBeamformingTestCase::NrRealisticBeamformingTestCase (std::string name, enum TestDuration duration) : TestCase (name)
+NrRealisticBeamformingTestCase::NrRealisticBeamformingTestCase (std::string name, TestCase::Duration duration) : TestCase (name)
 {
   m_duration = duration;
 }
@@ -114,12 +114,12 @@ NrRealisticBeamformingTestCase::DoRun (void)
 
   uint16_t totalCounter = 0, highSinrCounter = 0, lowSinrCounter = 0;
 
-  std::list <uint16_t> rngList = (m_duration == TestCase::EXTENSIVE) ? std::list<uint16_t> ({2,3}) : std::list<uint16_t> ({1});
+  std::list <uint16_t> rngList = (m_duration == TestCase::Duration::EXTENSIVE) ? std::list<uint16_t> ({2,3}) : std::list<uint16_t> ({1});
 
-  std::list <Vector> uePositions = (m_duration == TestCase::EXTENSIVE) ? uePositionsExtensive : std::list<Vector> ( { Vector ( 10, 10, 1.5),
+  std::list <Vector> uePositions = (m_duration == TestCase::Duration::EXTENSIVE) ? uePositionsExtensive : std::list<Vector> ( { Vector ( 10, 10, 1.5),
                                                                                                                       Vector (-10, 10, 1.5)});
 
-  std::list<uint16_t> antennaConfList = (m_duration == TestCase::EXTENSIVE) ? std::list<uint16_t> ({3, 4}) : std::list<uint16_t> ({2});
+  std::list<uint16_t> antennaConfList = (m_duration == TestCase::Duration::EXTENSIVE) ? std::list<uint16_t> ({3, 4}) : std::list<uint16_t> ({2});
 
   for (auto rng:rngList)
     {
@@ -252,7 +252,7 @@ NrRealisticBeamformingTestCase::DoRun (void)
     }
 
   double tolerance = 0.2;
-  if (m_duration == TestCase::EXTENSIVE)
+  if (m_duration == TestCase::Duration::EXTENSIVE)
     {
       tolerance = 0.2;
     }
@@ -20,6 +20,7 @@
 #include "nr-spectrum-phy-test.h"
 #include "ns3/nr-spectrum-phy.h"
 #include "ns3/multi-model-spectrum-channel.h"
+#include "ns3/spectrum-signal-parameters.h"
 #include "ns3/nr-spectrum-value-helper.h"
 #include "ns3/nr-interference.h"
 #include "ns3/constant-position-mobility-model.h"
@@ -43,11 +44,17 @@ NoLossSpectrumPropagationLossModel::GetTypeId (void)
 }
 
 Ptr<SpectrumValue>
-NoLossSpectrumPropagationLossModel::DoCalcRxPowerSpectralDensity (Ptr<const SpectrumValue> txPsd,
+NoLossSpectrumPropagationLossModel::DoCalcRxPowerSpectralDensity (Ptr<const SpectrumSignalParameters> params,
                                                                   Ptr<const MobilityModel> a,
                                                                   Ptr<const MobilityModel> b) const
 {
-  return Copy (txPsd);
+  return Copy (params->psd);
+}
+
+int64_t
+NoLossSpectrumPropagationLossModel::DoAssignStreams (int64_t stream)
+{
+  return 0;
 }
 
 
@@ -54,9 +54,10 @@ public:
 
 private:
 
-  virtual Ptr<SpectrumValue> DoCalcRxPowerSpectralDensity (Ptr<const SpectrumValue> txPsd,
+  virtual Ptr<SpectrumValue> DoCalcRxPowerSpectralDensity (Ptr<const SpectrumSignalParameters> params,
                                                            Ptr<const MobilityModel> a,
                                                            Ptr<const MobilityModel> b) const override;
+  virtual int64_t DoAssignStreams (int64_t stream) override;
 };
 
 class SetNoisePsdTestCase : public TestCase
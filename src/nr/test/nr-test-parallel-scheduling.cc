@@ -0,0 +1,278 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License version 2 as
+ *   published by the Free Software Foundation;
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <ns3/test.h>
+#include <ns3/simulator.h>
+#include <ns3/pointer.h>
+#include <ns3/nr-helper.h>
+#include <ns3/nr-point-to-point-epc-helper.h>
+#include <ns3/ideal-beamforming-helper.h>
+#include <ns3/ideal-beamforming-algorithm.h>
+#include <ns3/cc-bwp-helper.h>
+#include <ns3/nr-gnb-net-device.h>
+#include <ns3/nr-ue-net-device.h>
+#include <ns3/nr-mac-scheduler-parallel.h>
+#include <ns3/internet-module.h>
+#include <ns3/applications-module.h>
+#include <ns3/mobility-module.h>
+#include <ns3/point-to-point-helper.h>
+#include <ns3/antenna-module.h>
+
+/**
+ * \file nr-test-parallel-scheduling.cc
+ * \ingroup test
+ *
+ * \brief Check that the schedulers with ParallelScheduling enabled serve all
+ * the traffic, and that the results do not depend on the number of threads
+ * used to compute the slot decisions.
+ *
+ * The scenario has three gNBs, with two UEs each, and saturates the DL for
+ * a short time. The reception time of every packet is recorded, and the
+ * runs with one and with several threads must give exactly the same ones.
+ *
+ * The parallel runs are also compared with a run with ParallelScheduling
+ * disabled. The times are not the same, because a parallel decision sees the
+ * events that reach its scheduler later in the same time stamp, but each
+ * packet must be received within a few slots of the sequential run.
+ */
+namespace ns3 {
+
+class NrParallelSchedulingTestCase : public TestCase
+{
+public:
+  NrParallelSchedulingTestCase (const std::string &schedulerType)
+    : TestCase ("Parallel scheduling with " + schedulerType),
+      m_schedulerType (schedulerType)
+  {}
+
+private:
+  virtual void DoRun (void) override;
+
+  /**
+   * \brief Run the scenario
+   * \param parallel the value of the ParallelScheduling attribute
+   * \param numThreads the number of threads that compute the decisions
+   * \return the reception times, in ns, of the packets of each UE
+   */
+  std::vector<std::vector<int64_t> > RunScenario (bool parallel, uint32_t numThreads);
+
+  /**
+   * \brief Record the reception of a packet
+   * \param ue the index of the UE
+   * \param pkt the packet
+   */
+  void Rx (uint32_t ue, Ptr<const Packet> pkt);
+
+  std::string m_schedulerType; //!< Scheduler type
+  std::vector<std::vector<int64_t> > m_rxTimes; //!< Reception times of the packets of each UE
+  const uint32_t m_maxPackets {50}; //!< Packets sent to each UE
+  /// Max difference, in ns, of a reception time from the one without parallel scheduling
+  const int64_t m_maxSequentialDiff {MilliSeconds (2).GetNanoSeconds ()};
+};
+
+void
+NrParallelSchedulingTestCase::Rx (uint32_t ue, [[maybe_unused]] Ptr<const Packet> pkt)
+{
+  m_rxTimes.at (ue).push_back (Simulator::Now ().GetNanoSeconds ());
+}
+
+std::vector<std::vector<int64_t> >
+NrParallelSchedulingTestCase::RunScenario (bool parallel, uint32_t numThreads)
+{
+  const uint16_t gNbNum = 3;
+  const uint16_t uePerGnbNum = 2;
+
+  Config::SetDefault ("ns3::LteRlcUm::MaxTxBufferSize", UintegerValue (999999999));
+  Config::SetDefault ("ns3::EpsBearer::Release", UintegerValue (15));
+  Config::SetDefault ("ns3::ThreeGppChannelModel::UpdatePeriod", TimeValue (MilliSeconds (0)));
+
+  NodeContainer gNbNodes;
+  NodeContainer ueNodes;
+  gNbNodes.Create (gNbNum);
+  ueNodes.Create (gNbNum * uePerGnbNum);
+
+  // gNBs 100 m apart, each one with its UEs at 10 m
+  Ptr<ListPositionAllocator> gNbPositionAlloc = CreateObject<ListPositionAllocator> ();
+  Ptr<ListPositionAllocator> uePositionAlloc = CreateObject<ListPositionAllocator> ();
+  for (uint16_t gNb = 0; gNb < gNbNum; ++gNb)
+    {
+      gNbPositionAlloc->Add (Vector (gNb * 100.0, 0.0, 10.0));
+      for (uint16_t ue = 0; ue < uePerGnbNum; ++ue)
+        {
+          uePositionAlloc->Add (Vector (gNb * 100.0 + ue * 2.0, 10.0, 1.5));
+        }
+    }
+  MobilityHelper mobility;
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  mobility.SetPositionAllocator (gNbPositionAlloc);
+  mobility.Install (gNbNodes);
+  mobility.SetPositionAllocator (uePositionAlloc);
+  mobility.Install (ueNodes);
+
+  Ptr<NrPointToPointEpcHelper> epcHelper = CreateObject<NrPointToPointEpcHelper> ();
+  Ptr<IdealBeamformingHelper> idealBeamformingHelper = CreateObject<IdealBeamformingHelper> ();
+  idealBeamformingHelper->SetAttribute ("BeamformingMethod",
+                                        TypeIdValue (DirectPathBeamforming::GetTypeId ()));
+  Ptr<NrHelper> nrHelper = CreateObject<NrHelper> ();
+  nrHelper->SetBeamformingHelper (idealBeamformingHelper);
+  nrHelper->SetEpcHelper (epcHelper);
+
+  nrHelper->SetUeAntennaAttribute ("NumRows", UintegerValue (1));
+  nrHelper->SetUeAntennaAttribute ("NumColumns", UintegerValue (2));
+  nrHelper->SetUeAntennaAttribute ("AntennaElement",
+                                   PointerValue (CreateObject<IsotropicAntennaModel> ()));
+  nrHelper->SetGnbAntennaAttribute ("NumRows", UintegerValue (2));
+  nrHelper->SetGnbAntennaAttribute ("NumColumns", UintegerValue (4));
+  nrHelper->SetGnbAntennaAttribute ("AntennaElement",
+                                    PointerValue (CreateObject<IsotropicAntennaModel> ()));
+  nrHelper->SetGnbPhyAttribute ("Numerology", UintegerValue (1));
+
+  nrHelper->SetSchedulerTypeId (TypeId::LookupByName (m_schedulerType));
+  nrHelper->SetSchedulerAttribute ("ParallelScheduling", BooleanValue (parallel));
+  nrHelper->SetPathlossAttribute ("ShadowingEnabled", BooleanValue (false));
+
+  CcBwpCreator ccBwpCreator;
+  CcBwpCreator::SimpleOperationBandConf bandConf (3.5e9, 20e6, 1,
+                                                  BandwidthPartInfo::UMi_StreetCanyon_LoS);
+  OperationBandInfo band = ccBwpCreator.CreateOperationBandContiguousCc (bandConf);
+  nrHelper->InitializeOperationBand (&band);
+  BandwidthPartInfoPtrVector allBwps = CcBwpCreator::GetAllBwps ({band});
+
+  NetDeviceContainer gNbNetDevs = nrHelper->InstallGnbDevice (gNbNodes, allBwps);
+  NetDeviceContainer ueNetDevs = nrHelper->InstallUeDevice (ueNodes, allBwps);
+
+  int64_t randomStream = 1;
+  randomStream += nrHelper->AssignStreams (gNbNetDevs, randomStream);
+  randomStream += nrHelper->AssignStreams (ueNetDevs, randomStream);
+
+  for (auto it = gNbNetDevs.Begin (); it != gNbNetDevs.End (); ++it)
+    {
+      DynamicCast<NrGnbNetDevice> (*it)->UpdateConfig ();
+    }
+  for (auto it = ueNetDevs.Begin (); it != ueNetDevs.End (); ++it)
+    {
+      DynamicCast<NrUeNetDevice> (*it)->UpdateConfig ();
+    }
+
+  Ptr<Node> pgw = epcHelper->GetPgwNode ();
+  NodeContainer remoteHostContainer;
+  remoteHostContainer.Create (1);
+  Ptr<Node> remoteHost = remoteHostContainer.Get (0);
+  InternetStackHelper internet;
+  internet.Install (remoteHostContainer);
+  PointToPointHelper p2ph;
+  p2ph.SetDeviceAttribute ("DataRate", DataRateValue (DataRate ("100Gb/s")));
+  p2ph.SetDeviceAttribute ("Mtu", UintegerValue (2500));
+  p2ph.SetChannelAttribute ("Delay", TimeValue (Seconds (0.0)));
+  NetDeviceContainer internetDevices = p2ph.Install (pgw, remoteHost);
+  Ipv4AddressHelper ipv4h;
+  ipv4h.SetBase ("1.0.0.0", "255.0.0.0");
+  ipv4h.Assign (internetDevices);
+
+  Ipv4StaticRoutingHelper ipv4RoutingHelper;
+  Ptr<Ipv4StaticRouting> remoteHostStaticRouting =
+    ipv4RoutingHelper.GetStaticRouting (remoteHost->GetObject<Ipv4> ());
+  remoteHostStaticRouting->AddNetworkRouteTo (Ipv4Address ("7.0.0.0"), Ipv4Mask ("255.0.0.0"), 1);
+  internet.Install (ueNodes);
+  Ipv4InterfaceContainer ueIpIface = epcHelper->AssignUeIpv4Address (NetDeviceContainer (ueNetDevs));
+  for (uint32_t j = 0; j < ueNodes.GetN (); ++j)
+    {
+      Ptr<Ipv4StaticRouting> ueStaticRouting =
+        ipv4RoutingHelper.GetStaticRouting (ueNodes.Get (j)->GetObject<Ipv4> ());
+      ueStaticRouting->SetDefaultRoute (epcHelper->GetUeDefaultGatewayAddress (), 1);
+    }
+
+  nrHelper->AttachToClosestEnb (ueNetDevs, gNbNetDevs);
+
+  // Saturate the DL of all the UEs at the same time
+  uint16_t dlPort = 1234;
+  ApplicationContainer serverApps;
+  ApplicationContainer clientApps;
+  UdpServerHelper dlPacketSinkHelper (dlPort);
+  serverApps.Add (dlPacketSinkHelper.Install (ueNodes));
+  for (uint32_t j = 0; j < ueNodes.GetN (); ++j)
+    {
+      UdpClientHelper dlClient (ueIpIface.GetAddress (j), dlPort);
+      dlClient.SetAttribute ("MaxPackets", UintegerValue (m_maxPackets));
+      dlClient.SetAttribute ("PacketSize", UintegerValue (500));
+      dlClient.SetAttribute ("Interval", TimeValue (MicroSeconds (100)));
+      clientApps.Add (dlClient.Install (remoteHost));
+    }
+  serverApps.Start (MilliSeconds (400));
+  clientApps.Start (MilliSeconds (400));
+
+  m_rxTimes.assign (ueNodes.GetN (), std::vector<int64_t> ());
+  for (uint32_t j = 0; j < serverApps.GetN (); ++j)
+    {
+      serverApps.Get (j)->TraceConnectWithoutContext ("Rx",
+                                                      MakeCallback (&NrParallelSchedulingTestCase::Rx,
+                                                                    this).Bind (j));
+    }
+
+  if (parallel)
+    {
+      NrMacSchedulerParallel::Get ()->SetNumThreads (numThreads);
+    }
+
+  Simulator::Stop (MilliSeconds (600));
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  return m_rxTimes;
+}
+
+void
+NrParallelSchedulingTestCase::DoRun (void)
+{
+  auto sequential = RunScenario (false, 1);
+  auto single = RunScenario (true, 1);
+  auto multi = RunScenario (true, 3);
+
+  for (uint32_t ue = 0; ue < single.size (); ++ue)
+    {
+      NS_TEST_ASSERT_MSG_EQ (single.at (ue).size (), m_maxPackets,
+                             "UE " << ue << " did not receive all the packets");
+      NS_TEST_ASSERT_MSG_EQ (multi.at (ue).size (), single.at (ue).size (),
+                             "UE " << ue << " received a different number of packets with 3 threads");
+      NS_TEST_ASSERT_MSG_EQ ((multi.at (ue) == single.at (ue)), true,
+                             "UE " << ue << " received the packets at different times with 3 threads");
+
+      NS_TEST_ASSERT_MSG_EQ (sequential.at (ue).size (), single.at (ue).size (),
+                             "UE " << ue << " received a different number of packets without parallel scheduling");
+      for (uint32_t i = 0; i < sequential.at (ue).size (); ++i)
+        {
+          NS_TEST_ASSERT_MSG_EQ_TOL (single.at (ue).at (i), sequential.at (ue).at (i),
+                                     m_maxSequentialDiff,
+                                     "UE " << ue << " received packet " << i <<
+                                     " too far from the time without parallel scheduling");
+        }
+    }
+}
+
+class NrParallelSchedulingTestSuite : public TestSuite
+{
+public:
+  NrParallelSchedulingTestSuite () : TestSuite ("nr-test-parallel-scheduling", Type::SYSTEM)
+  {
+    AddTestCase (new NrParallelSchedulingTestCase ("ns3::NrMacSchedulerOfdmaPF"), Duration::QUICK);
+    AddTestCase (new NrParallelSchedulingTestCase ("ns3::NrMacSchedulerTdmaRR"), Duration::QUICK);
+  }
+};
+
+static NrParallelSchedulingTestSuite nrParallelSchedulingTestSuite; //!< Parallel scheduling test suite
+
+} // namespace ns3
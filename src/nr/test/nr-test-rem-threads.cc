@@ -0,0 +1,195 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License version 2 as
+ *   published by the Free Software Foundation;
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <ns3/test.h>
+#include <ns3/simulator.h>
+#include <ns3/pointer.h>
+#include <ns3/boolean.h>
+#include <ns3/rng-seed-manager.h>
+#include <ns3/nr-helper.h>
+#include <ns3/epc-helper.h>
+#include <ns3/ideal-beamforming-helper.h>
+#include <ns3/ideal-beamforming-algorithm.h>
+#include <ns3/cc-bwp-helper.h>
+#include <ns3/nr-gnb-net-device.h>
+#include <ns3/nr-ue-net-device.h>
+#include <ns3/nr-radio-environment-map-helper.h>
+#include <ns3/mobility-module.h>
+#include <ns3/antenna-module.h>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+/**
+ * \file nr-test-rem-threads.cc
+ * \ingroup test
+ *
+ * \brief Check that the REM does not depend on the number of threads that
+ * compute it.
+ *
+ * The scenario has two gNBs and one UE, with the 3GPP channel model. The
+ * COVERAGE_AREA map is created once with a single thread and once with
+ * several, with tiles smaller than the map, and the two output files must
+ * be identical. The REM streams are fixed with the Stream attribute, as the
+ * two maps are created in the same process.
+ */
+namespace ns3 {
+
+class NrRemThreadsTestCase : public TestCase
+{
+public:
+  NrRemThreadsTestCase (uint32_t numThreads)
+    : TestCase ("REM with " + std::to_string (numThreads) + " threads"),
+      m_numThreads (numThreads)
+  {}
+
+private:
+  virtual void DoRun (void) override;
+
+  /**
+   * \brief Create the REM of the scenario
+   * \param numThreads the number of threads that compute the map
+   * \return the content of the REM output file
+   */
+  std::string CreateRem (uint32_t numThreads);
+
+  uint32_t m_numThreads; //!< Number of threads of the multi-threaded map
+};
+
+std::string
+NrRemThreadsTestCase::CreateRem (uint32_t numThreads)
+{
+  RngSeedManager::SetSeed (1);
+  RngSeedManager::SetRun (1);
+
+  NodeContainer gNbNodes;
+  NodeContainer ueNodes;
+  gNbNodes.Create (2);
+  ueNodes.Create (1);
+
+  Ptr<ListPositionAllocator> gNbPositionAlloc = CreateObject<ListPositionAllocator> ();
+  gNbPositionAlloc->Add (Vector (0.0, 0.0, 10.0));
+  gNbPositionAlloc->Add (Vector (60.0, 20.0, 10.0));
+  Ptr<ListPositionAllocator> uePositionAlloc = CreateObject<ListPositionAllocator> ();
+  uePositionAlloc->Add (Vector (20.0, 10.0, 1.5));
+  MobilityHelper mobility;
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  mobility.SetPositionAllocator (gNbPositionAlloc);
+  mobility.Install (gNbNodes);
+  mobility.SetPositionAllocator (uePositionAlloc);
+  mobility.Install (ueNodes);
+
+  Ptr<IdealBeamformingHelper> idealBeamformingHelper = CreateObject<IdealBeamformingHelper> ();
+  idealBeamformingHelper->SetAttribute ("BeamformingMethod",
+                                        TypeIdValue (DirectPathBeamforming::GetTypeId ()));
+  Ptr<NrHelper> nrHelper = CreateObject<NrHelper> ();
+  nrHelper->SetBeamformingHelper (idealBeamformingHelper);
+
+  nrHelper->SetUeAntennaAttribute ("NumRows", UintegerValue (1));
+  nrHelper->SetUeAntennaAttribute ("NumColumns", UintegerValue (1));
+  nrHelper->SetUeAntennaAttribute ("AntennaElement",
+                                   PointerValue (CreateObject<IsotropicAntennaModel> ()));
+  nrHelper->SetGnbAntennaAttribute ("NumRows", UintegerValue (2));
+  nrHelper->SetGnbAntennaAttribute ("NumColumns", UintegerValue (2));
+  nrHelper->SetGnbAntennaAttribute ("AntennaElement",
+                                    PointerValue (CreateObject<ThreeGppAntennaModel> ()));
+  nrHelper->SetPathlossAttribute ("ShadowingEnabled", BooleanValue (false));
+
+  CcBwpCreator ccBwpCreator;
+  CcBwpCreator::SimpleOperationBandConf bandConf (28e9, 100e6, 1,
+                                                  BandwidthPartInfo::UMi_StreetCanyon);
+  OperationBandInfo band = ccBwpCreator.CreateOperationBandContiguousCc (bandConf);
+  nrHelper->InitializeOperationBand (&band);
+  BandwidthPartInfoPtrVector allBwps = CcBwpCreator::GetAllBwps ({band});
+
+  NetDeviceContainer gNbNetDevs = nrHelper->InstallGnbDevice (gNbNodes, allBwps);
+  NetDeviceContainer ueNetDevs = nrHelper->InstallUeDevice (ueNodes, allBwps);
+
+  int64_t randomStream = 1;
+  randomStream += nrHelper->AssignStreams (gNbNetDevs, randomStream);
+  randomStream += nrHelper->AssignStreams (ueNetDevs, randomStream);
+
+  for (auto it = gNbNetDevs.Begin (); it != gNbNetDevs.End (); ++it)
+    {
+      DynamicCast<NrGnbNetDevice> (*it)->UpdateConfig ();
+    }
+  for (auto it = ueNetDevs.Begin (); it != ueNetDevs.End (); ++it)
+    {
+      DynamicCast<NrUeNetDevice> (*it)->UpdateConfig ();
+    }
+
+  nrHelper->AttachToEnb (ueNetDevs.Get (0), gNbNetDevs.Get (0));
+
+  std::string simTag = "rem-threads-" + std::to_string (numThreads);
+  Ptr<NrRadioEnvironmentMapHelper> remHelper = CreateObject<NrRadioEnvironmentMapHelper> ();
+  remHelper->SetMinX (-20.0);
+  remHelper->SetMaxX (80.0);
+  remHelper->SetResX (10);
+  remHelper->SetMinY (-20.0);
+  remHelper->SetMaxY (40.0);
+  remHelper->SetResY (6);
+  remHelper->SetZ (1.5);
+  remHelper->SetSimTag (simTag);
+  remHelper->SetRemMode (NrRadioEnvironmentMapHelper::COVERAGE_AREA);
+  remHelper->SetNumThreads (numThreads);
+  remHelper->SetTileSize (5);
+  remHelper->SetStream (randomStream);
+  remHelper->CreateRem (gNbNetDevs, ueNetDevs.Get (0), 0);
+
+  Simulator::Stop (Seconds (1));
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  std::string prefix = "nr-rem-" + simTag;
+  std::ifstream remFile (prefix + ".out");
+  NS_TEST_EXPECT_MSG_EQ (remFile.is_open (), true, "Can't open " << prefix << ".out");
+  std::ostringstream rem;
+  rem << remFile.rdbuf ();
+  remFile.close ();
+
+  for (const char *suffix : {".out", "-gnbs.txt", "-ues.txt", "-buildings.txt", "-plot-rem.gnuplot"})
+    {
+      std::remove ((prefix + suffix).c_str ());
+    }
+
+  return rem.str ();
+}
+
+void
+NrRemThreadsTestCase::DoRun (void)
+{
+  std::string single = CreateRem (1);
+  std::string multi = CreateRem (m_numThreads);
+
+  NS_TEST_ASSERT_MSG_EQ (single.empty (), false, "The REM with 1 thread is empty");
+  NS_TEST_ASSERT_MSG_EQ ((multi == single), true,
+                         "The REM with " << m_numThreads << " threads differs from the one with 1 thread");
+}
+
+class NrRemThreadsTestSuite : public TestSuite
+{
+public:
+  NrRemThreadsTestSuite () : TestSuite ("nr-test-rem-threads", Type::SYSTEM)
+  {
+    AddTestCase (new NrRemThreadsTestCase (2), Duration::QUICK);
+    AddTestCase (new NrRemThreadsTestCase (4), Duration::QUICK);
+  }
+};
+
+static NrRemThreadsTestSuite nrRemThreadsTestSuite; //!< REM threads test suite
+
+} // namespace ns3
@@ -23,6 +23,7 @@
 #include "ns3/string.h"
 #include "ns3/simulator.h"
 #include "ns3/pointer.h"
+#include "ns3/spectrum-signal-parameters.h"
 
 namespace ns3 {
 
@@ -70,8 +71,8 @@ DistanceBasedThreeGppSpectrumPropagationLossModel::GetMaxDistance () const
 }
 
 
-Ptr<SpectrumValue>
-DistanceBasedThreeGppSpectrumPropagationLossModel::DoCalcRxPowerSpectralDensity (Ptr<const SpectrumValue> txPsd,
+Ptr<SpectrumSignalParameters>
+DistanceBasedThreeGppSpectrumPropagationLossModel::DoCalcRxPowerSpectralDensity (Ptr<const SpectrumSignalParameters> spectrumSignalParams,
                                                                                  Ptr<const MobilityModel> a,
                                                                                  Ptr<const MobilityModel> b,
                                                                                  Ptr<const PhasedArrayModel> aPhasedArrayModel,
@@ -81,19 +82,17 @@ DistanceBasedThreeGppSpectrumPropagationLossModel::DoCalcRxPowerSpectralDensity
   uint32_t aId = a->GetObject<Node> ()->GetId (); // id of the node a
   uint32_t bId = b->GetObject<Node> ()->GetId (); // id of the node b
 
-  Ptr<SpectrumValue> rxPsd = Copy<SpectrumValue> (txPsd);
   if (a->GetDistanceFrom (b) > m_maxDistance)
     {
       NS_LOG_LOGIC ("Distance between a: " << aId << "and  node b: "<<bId << " is higher than max allowed distance. Return 0 PSD.");
-      *rxPsd = 0.0;
-      return rxPsd;
+      Ptr<SpectrumSignalParameters> rxParams = spectrumSignalParams->Copy ();
+      *(rxParams->psd) = 0.0;
+      return rxParams;
     }
   else
     {
-      return ThreeGppSpectrumPropagationLossModel::DoCalcRxPowerSpectralDensity (txPsd, a, b, aPhasedArrayModel, bPhasedArrayModel);
+      return ThreeGppSpectrumPropagationLossModel::DoCalcRxPowerSpectralDensity (spectrumSignalParams, a, b, aPhasedArrayModel, bPhasedArrayModel);
     }
-
-  return rxPsd;
 }
 
 
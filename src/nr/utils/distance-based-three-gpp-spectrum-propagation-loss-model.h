@@ -71,18 +71,18 @@ public:
    * model and the beamforming gain. However, if the distance between a and b
    * is higher than allowe this class will return 0 PSD.
    *
-   * \param txPsd tx PSD
+   * \param spectrumSignalParams spectrum signal tx parameters
    * \param a first node mobility model
    * \param b second node mobility model
    * \param aPhasedArrayModel the antenna array of the first node
    * \param bPhasedArrayModel the antenna array of the second node
-   * \return the received PSD
+   * \return the received signal parameters
    */
-  virtual Ptr<SpectrumValue> DoCalcRxPowerSpectralDensity (Ptr<const SpectrumValue> txPsd,
-                                                           Ptr<const MobilityModel> a,
-                                                           Ptr<const MobilityModel> b,
-                                                           Ptr<const PhasedArrayModel> aPhasedArrayModel,
-                                                           Ptr<const PhasedArrayModel> bPhasedArrayModel) const override;
+  virtual Ptr<SpectrumSignalParameters> DoCalcRxPowerSpectralDensity (Ptr<const SpectrumSignalParameters> spectrumSignalParams,
+                                                                      Ptr<const MobilityModel> a,
+                                                                      Ptr<const MobilityModel> b,
+                                                                      Ptr<const PhasedArrayModel> aPhasedArrayModel,
+                                                                      Ptr<const PhasedArrayModel> bPhasedArrayModel) const override;
 
 private:
 
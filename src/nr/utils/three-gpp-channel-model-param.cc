@@ -139,24 +139,16 @@ ThreeGppChannelModelParam::GetNewChannel (Ptr<const ThreeGppChannelParams> chann
   //Step 11: Generate channel coefficients for each cluster n and each receiver
   // and transmitter element pair u,s.
 
-  Complex3DVector H_NLOS; // channel coefficients H_NLOS [u][s][n],
-  // where u and s are receive and transmit antenna element, n is cluster index.
-  uint64_t uSize = uAntenna->GetNumberOfElements ();
-  uint64_t sSize = sAntenna->GetNumberOfElements ();
+  uint64_t uSize = uAntenna->GetNumElems ();
+  uint64_t sSize = sAntenna->GetNumElems ();
 
-  Complex3DVector H_usn;  //channel coffecient H_usn[u][s][n];
   // NOTE Since each of the strongest 2 clusters are divided into 3 sub-clusters,
-  // the total cluster will be numReducedCLuster + 4.
-
-  H_usn.resize (uSize);
-  for (uint64_t uIndex = 0; uIndex < uSize; uIndex++)
-    {
-      H_usn[uIndex].resize (sSize);
-      for (uint64_t sIndex = 0; sIndex < sSize; sIndex++)
-        {
-          H_usn[uIndex][sIndex].resize (channelParams->m_reducedClusterNumber);
-        }
-    }
+  // the total cluster will be numReducedCLuster + 4, or numReducedCLuster + 2
+  // if the two strongest clusters are the same one.
+  uint16_t numOverallCluster = (channelParams->m_cluster1st != channelParams->m_cluster2nd)
+                               ? channelParams->m_reducedClusterNumber + 4
+                               : channelParams->m_reducedClusterNumber + 2;
+  Complex3DVector H_usn (uSize, sSize, numOverallCluster); //channel coffecient H_usn (u, s, n);
 
   NS_ASSERT (channelParams->m_reducedClusterNumber <= channelParams->m_clusterPhase.size ());
   NS_ASSERT (channelParams->m_reducedClusterNumber <= channelParams->m_clusterPower.size ());
@@ -194,6 +186,9 @@ ThreeGppChannelModelParam::GetNewChannel (Ptr<const ThreeGppChannelParams> chann
         {
 
           Vector sLoc = sAntenna->GetElementLocation (sIndex);
+          // the sub-clusters of the strongest clusters are stored after the
+          // reduced clusters, in the order of the clusters
+          uint16_t numSubClustersAdded = 0;
 
           for (uint8_t nIndex = 0; nIndex < channelParams->m_reducedClusterNumber; nIndex++)
             {
@@ -239,7 +234,7 @@ ThreeGppChannelModelParam::GetNewChannel (Ptr<const ThreeGppChannelParams> chann
                         * exp (std::complex<double> (0, txPhaseDiff));
                     }
                   rays *= sqrt (channelParams->m_clusterPower[nIndex] / table3gpp->m_raysPerCluster);
-                  H_usn[uIndex][sIndex][nIndex] = rays;
+                  H_usn (uIndex, sIndex, nIndex) = rays;
                 }
               else  //(7.5-28)
                 {
@@ -313,11 +308,12 @@ ThreeGppChannelModelParam::GetNewChannel (Ptr<const ThreeGppChannelParams> chann
                   raysSub1 *= sqrt (channelParams->m_clusterPower[nIndex] / table3gpp->m_raysPerCluster);
                   raysSub2 *= sqrt (channelParams->m_clusterPower[nIndex] / table3gpp->m_raysPerCluster);
                   raysSub3 *= sqrt (channelParams->m_clusterPower[nIndex] / table3gpp->m_raysPerCluster);
-                  H_usn[uIndex][sIndex][nIndex] = raysSub1;
-                  H_usn[uIndex][sIndex].push_back (raysSub2);
-                  H_usn[uIndex][sIndex].push_back (raysSub3);
+                  H_usn (uIndex, sIndex, nIndex) = raysSub1;
+                  H_usn (uIndex, sIndex, channelParams->m_reducedClusterNumber + numSubClustersAdded) = raysSub2;
+                  H_usn (uIndex, sIndex, channelParams->m_reducedClusterNumber + numSubClustersAdded + 1) = raysSub3;
+                  numSubClustersAdded += 2;
 
-                  NS_LOG_DEBUG ("H_usn[uIndex][sIndex][nIndex]:"<< H_usn[uIndex][sIndex][nIndex]<< " uIndex:"<<uIndex<<", sIndex:"<<sIndex<<"nIndex:"<< +nIndex);
+                  NS_LOG_DEBUG ("H_usn (uIndex, sIndex, nIndex):"<< H_usn (uIndex, sIndex, nIndex)<< " uIndex:"<<uIndex<<", sIndex:"<<sIndex<<"nIndex:"<< +nIndex);
                 }
             }
           if (channelParams->m_losCondition == ChannelCondition::LOS) //(7.5-29) && (7.5-30)
@@ -343,12 +339,12 @@ ThreeGppChannelModelParam::GetNewChannel (Ptr<const ThreeGppChannelParams> chann
 
               double K_linear = pow (10, channelParams->m_K_factor / 10);
               // the LOS path should be attenuated if blockage is enabled.
-              H_usn[uIndex][sIndex][0] = sqrt (1 / (K_linear + 1)) * H_usn[uIndex][sIndex][0] + sqrt (K_linear / (1 + K_linear)) * ray / pow (10, channelParams->m_attenuation_dB[0] / 10);           //(7.5-30) for tau = tau1
-              double tempSize = H_usn[uIndex][sIndex].size ();
+              H_usn (uIndex, sIndex, 0) = sqrt (1 / (K_linear + 1)) * H_usn (uIndex, sIndex, 0) + sqrt (K_linear / (1 + K_linear)) * ray / pow (10, channelParams->m_attenuation_dB[0] / 10);           //(7.5-30) for tau = tau1
+              double tempSize = H_usn.GetNumPages ();
               for (uint8_t nIndex = 1; nIndex < tempSize; nIndex++)
                 {
-                  H_usn[uIndex][sIndex][nIndex] *= sqrt (1 / (K_linear + 1)); //(7.5-30) for tau = tau2...taunN
-                  NS_LOG_DEBUG ("LOS H_usn[uIndex][sIndex][nIndex]:"<< H_usn[uIndex][sIndex][nIndex]<< " uIndex:"<<uIndex<<", sIndex:"<<sIndex<<"nIndex:"<< +nIndex);
+                  H_usn (uIndex, sIndex, nIndex) *= sqrt (1 / (K_linear + 1)); //(7.5-30) for tau = tau2...taunN
+                  NS_LOG_DEBUG ("LOS H_usn (uIndex, sIndex, nIndex):"<< H_usn (uIndex, sIndex, nIndex)<< " uIndex:"<<uIndex<<", sIndex:"<<sIndex<<"nIndex:"<< +nIndex);
                 }
 
             }
@@ -356,17 +352,17 @@ ThreeGppChannelModelParam::GetNewChannel (Ptr<const ThreeGppChannelParams> chann
     }
 
   NS_LOG_DEBUG ("Husn (sAntenna, uAntenna):" << sAntenna->GetId () << ", " << uAntenna->GetId ());
-  for (auto& i:H_usn)
+  for (size_t uIndex = 0; uIndex < H_usn.GetNumRows (); uIndex++)
     {
-      for (auto& j:i)
+      for (size_t sIndex = 0; sIndex < H_usn.GetNumCols (); sIndex++)
         {
-          for (auto& k:j)
+          for (size_t nIndex = 0; nIndex < H_usn.GetNumPages (); nIndex++)
             {
-              NS_LOG_DEBUG (" " << k << ",");
+              NS_LOG_DEBUG (" " << H_usn (uIndex, sIndex, nIndex) << ",");
             }
         }
     }
-  NS_LOG_INFO ("size of coefficient matrix =[" << H_usn.size () << "][" << H_usn[0].size () << "][" << H_usn[0][0].size () << "]");
+  NS_LOG_INFO ("size of coefficient matrix =[" << H_usn.GetNumRows () << "][" << H_usn.GetNumCols () << "][" << H_usn.GetNumPages () << "]");
   channelMatrix->m_channel = H_usn;
   return channelMatrix;
 }
@@ -172,7 +172,8 @@ class MatrixBasedChannelModel : public Object
         mutable double m_cachedRbWidth = 0.0;
 
         /**
-         * Matrix array that holds the precomputed delay sincos
+         * Matrix array that holds the precomputed delay sincos, with dimensions
+         * numCluster, numRb
          */
         mutable ComplexMatrixArray m_cachedDelaySincos;
 
@@ -39,7 +39,9 @@
 #include <ns3/simulator.h>
 
 #include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <tuple>
 #include <utility>
 
 namespace ns3
@@ -81,7 +83,11 @@ RxSpectrumModelInfo::RxSpectrumModelInfo(Ptr<const SpectrumModel> rxSpectrumMode
 }
 
 MultiModelSpectrumChannel::MultiModelSpectrumChannel()
-    : m_numDevices{0}
+    : m_numDevices{0},
+      m_maxRange{0},
+      m_nextOrder{0},
+      m_rxGridValid{false},
+      m_rxGridCellSize{0}
 {
     NS_LOG_FUNCTION(this);
 }
@@ -90,6 +96,8 @@ void
 MultiModelSpectrumChannel::DoDispose()
 {
     NS_LOG_FUNCTION(this);
+    ClearRxGrid();
+    m_rxOrders.clear();
     m_txSpectrumModelInfoMap.clear();
     m_rxSpectrumModelInfoMap.clear();
     SpectrumChannel::DoDispose();
@@ -98,12 +106,23 @@ MultiModelSpectrumChannel::DoDispose()
 TypeId
 MultiModelSpectrumChannel::GetTypeId()
 {
-    static TypeId tid = TypeId("ns3::MultiModelSpectrumChannel")
-                            .SetParent<SpectrumChannel>()
-                            .SetGroupName("Spectrum")
-                            .AddConstructor<MultiModelSpectrumChannel>()
-
-        ;
+    static TypeId tid =
+        TypeId("ns3::MultiModelSpectrumChannel")
+            .SetParent<SpectrumChannel>()
+            .SetGroupName("Spectrum")
+            .AddConstructor<MultiModelSpectrumChannel>()
+            .AddAttribute("MaxRange",
+                          "If positive, the receivers farther than this distance (in m) "
+                          "from the transmitter are skipped before any loss is computed, "
+                          "without firing the Gain and PathLoss traces. This parameter "
+                          "is to be used to reduce the computational load of large "
+                          "deployments, where most receivers are far beyond the "
+                          "interference range. Note that the propagation loss models "
+                          "that draw random numbers draw them only for the receivers "
+                          "in range. The default value disables it.",
+                          DoubleValue(0),
+                          MakeDoubleAccessor(&MultiModelSpectrumChannel::m_maxRange),
+                          MakeDoubleChecker<double>(0));
     return tid;
 }
 
@@ -127,6 +146,8 @@ MultiModelSpectrumChannel::RemoveRx(Ptr<SpectrumPhy> phy)
         {
             rxInfoIterator->second.m_rxPhys.erase(phyIt);
             --m_numDevices;
+            m_rxOrders.erase(phy);
+            ClearRxGrid();
             break; // there should be at most one entry
         }
     }
@@ -155,6 +176,8 @@ MultiModelSpectrumChannel::AddRx(Ptr<SpectrumPhy> phy)
     // rxInfoIterator points either to the newly inserted element or to the element that
     // prevented insertion. In both cases, add the phy to the element pointed to by rxInfoIterator
     rxInfoIterator->second.m_rxPhys.push_back(phy);
+    m_rxOrders[phy] = m_nextOrder++;
+    ClearRxGrid();
 
     if (inserted)
     {
@@ -240,6 +263,64 @@ MultiModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
     auto txSpectrumModelUid = txParams->psd->GetSpectrumModelUid();
     NS_LOG_LOGIC("txSpectrumModelUid " << txSpectrumModelUid);
 
+    if (m_maxRange > 0 && txMobility)
+    {
+        if (!m_rxGridValid || m_rxGridCellSize != m_maxRange)
+        {
+            ClearRxGrid();
+            BuildRxGrid();
+        }
+
+        // look for the receivers in range in the cells around the transmitter, and
+        // among the receivers that are not in the grid
+        std::vector<std::tuple<SpectrumModelUid_t, uint64_t, SpectrumPhy*>> receivers;
+        auto txPosition = txMobility->GetPosition();
+        auto x = GetCellCoordinate(txPosition.x);
+        auto y = GetCellCoordinate(txPosition.y);
+        auto z = GetCellCoordinate(txPosition.z);
+        for (int64_t dx = -1; dx <= 1; ++dx)
+        {
+            for (int64_t dy = -1; dy <= 1; ++dy)
+            {
+                for (int64_t dz = -1; dz <= 1; ++dz)
+                {
+                    auto cellIt = m_rxGrid.find(GetCellKey(x + dx, y + dy, z + dz));
+                    if (cellIt == m_rxGrid.end())
+                    {
+                        continue;
+                    }
+                    for (auto phy : cellIt->second)
+                    {
+                        const auto& info = m_rxPhyInfos.at(phy);
+                        if (CalculateDistance(txPosition, info.m_position) <= m_maxRange)
+                        {
+                            receivers.emplace_back(info.m_rxSpectrumModelUid, info.m_order, phy);
+                        }
+                    }
+                }
+            }
+        }
+        for (auto phy : m_rxUngridded)
+        {
+            const auto& info = m_rxPhyInfos.at(phy);
+            if (!info.m_mobility ||
+                CalculateDistance(txPosition, info.m_mobility->GetPosition()) <= m_maxRange)
+            {
+                receivers.emplace_back(info.m_rxSpectrumModelUid, info.m_order, phy);
+            }
+        }
+        NS_LOG_LOGIC(receivers.size() << " receivers in range out of " << m_numDevices);
+
+        // keep the order of the receivers of m_rxSpectrumModelInfoMap, so that the
+        // receptions are scheduled in the same order as without the grid
+        std::sort(receivers.begin(), receivers.end());
+        for (const auto& [rxSpectrumModelUid, order, phy] : receivers)
+        {
+            StartTxToRx(txParams, txMobility, phy, rxSpectrumModelUid);
+        }
+        return;
+    }
+
     for (auto rxInfoIterator = m_rxSpectrumModelInfoMap.begin();
          rxInfoIterator != m_rxSpectrumModelInfoMap.end();
          ++rxInfoIterator)
@@ -247,119 +328,249 @@ MultiModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
         SpectrumModelUid_t rxSpectrumModelUid = rxInfoIterator->second.m_rxSpectrumModel->GetUid();
         NS_LOG_LOGIC("rxSpectrumModelUids " << rxSpectrumModelUid);
 
-        for (auto rxPhyIterator = rxInfoIterator->second.m_rxPhys.begin();
-             rxPhyIterator != rxInfoIterator->second.m_rxPhys.end();
-             ++rxPhyIterator)
+        for (const auto& rxPhy : rxInfoIterator->second.m_rxPhys)
         {
-            NS_ASSERT_MSG((*rxPhyIterator)->GetRxSpectrumModel()->GetUid() == rxSpectrumModelUid,
-                          "SpectrumModel change was not notified to MultiModelSpectrumChannel "
-                          "(i.e., AddRx should be called again after model is changed)");
+            StartTxToRx(txParams, txMobility, rxPhy, rxSpectrumModelUid);
+        }
+    }
+}
 
-            if ((*rxPhyIterator) != txParams->txPhy)
-            {
-                auto rxNetDevice = (*rxPhyIterator)->GetDevice();
-                auto txNetDevice = txParams->txPhy->GetDevice();
+void
+MultiModelSpectrumChannel::StartTxToRx(Ptr<SpectrumSignalParameters> txParams,
+                                       Ptr<MobilityModel> txMobility,
+                                       Ptr<SpectrumPhy> receiver,
+                                       SpectrumModelUid_t rxSpectrumModelUid)
+{
+    NS_ASSERT_MSG(receiver->GetRxSpectrumModel()->GetUid() == rxSpectrumModelUid,
+                  "SpectrumModel change was not notified to MultiModelSpectrumChannel "
+                  "(i.e., AddRx should be called again after model is changed)");
 
-                if (rxNetDevice && txNetDevice)
-                {
-                    // we assume that devices are attached to a node
-                    if (rxNetDevice->GetNode()->GetId() == txNetDevice->GetNode()->GetId())
-                    {
-                        NS_LOG_DEBUG(
-                            "Skipping the pathloss calculation among different antennas of the "
-                            "same node, not supported yet by any pathloss model in ns-3.");
-                        continue;
-                    }
-                }
+    if (receiver == txParams->txPhy)
+    {
+        return;
+    }
 
-                if (m_filter && m_filter->Filter(txParams, *rxPhyIterator))
-                {
-                    continue;
-                }
+    auto rxNetDevice = receiver->GetDevice();
+    auto txNetDevice = txParams->txPhy->GetDevice();
 
-                NS_LOG_LOGIC("copying signal parameters " << txParams);
-                auto rxParams = txParams->Copy();
-                rxParams->psd = Copy<SpectrumValue>(txParams->psd);
-                Time delay{0};
+    if (rxNetDevice && txNetDevice)
+    {
+        // we assume that devices are attached to a node
+        if (rxNetDevice->GetNode()->GetId() == txNetDevice->GetNode()->GetId())
+        {
+            NS_LOG_DEBUG("Skipping the pathloss calculation among different antennas of the "
+                         "same node, not supported yet by any pathloss model in ns-3.");
+            return;
+        }
+    }
 
-                auto receiverMobility = (*rxPhyIterator)->GetMobility();
+    if (m_filter && m_filter->Filter(txParams, receiver))
+    {
+        return;
+    }
 
-                if (txMobility && receiverMobility)
-                {
-                    auto txAntennaGain{0.0};
-                    auto rxAntennaGain{0.0};
-                    auto propagationGainDb{0.0};
-                    auto pathLossDb{0.0};
-                    if (rxParams->txAntenna)
-                    {
-                        Angles txAngles(receiverMobility->GetPosition(), txMobility->GetPosition());
-                        txAntennaGain = rxParams->txAntenna->GetGainDb(txAngles);
-                        NS_LOG_LOGIC("txAntennaGain = " << txAntennaGain << " dB");
-                        pathLossDb -= txAntennaGain;
-                    }
-                    auto rxAntenna = DynamicCast<AntennaModel>((*rxPhyIterator)->GetAntenna());
-                    if (rxAntenna)
-                    {
-                        Angles rxAngles(txMobility->GetPosition(), receiverMobility->GetPosition());
-                        rxAntennaGain = rxAntenna->GetGainDb(rxAngles);
-                        NS_LOG_LOGIC("rxAntennaGain = " << rxAntennaGain << " dB");
-                        pathLossDb -= rxAntennaGain;
-                    }
-                    if (m_propagationLoss)
-                    {
-                        propagationGainDb =
-                            m_propagationLoss->CalcRxPower(0, txMobility, receiverMobility);
-                        NS_LOG_LOGIC("propagationGainDb = " << propagationGainDb << " dB");
-                        pathLossDb -= propagationGainDb;
-                    }
-                    NS_LOG_LOGIC("total pathLoss = " << pathLossDb << " dB");
-                    // Gain trace
-                    m_gainTrace(txMobility,
-                                receiverMobility,
-                                txAntennaGain,
-                                rxAntennaGain,
-                                propagationGainDb,
-                                pathLossDb);
-                    // Pathloss trace
-                    m_pathLossTrace(txParams->txPhy, *rxPhyIterator, pathLossDb);
-                    if (pathLossDb > m_maxLossDb)
-                    {
-                        // beyond range
-                        continue;
-                    }
-                    auto pathGainLinear = std::pow(10.0, (-pathLossDb) / 10.0);
-                    *(rxParams->psd) *= pathGainLinear;
+    NS_LOG_LOGIC("copying signal parameters " << txParams);
+    auto rxParams = txParams->Copy();
+    rxParams->psd = Copy<SpectrumValue>(txParams->psd);
+    Time delay{0};
 
-                    if (m_propagationDelay)
-                    {
-                        delay = m_propagationDelay->GetDelay(txMobility, receiverMobility);
-                    }
-                }
+    auto receiverMobility = receiver->GetMobility();
 
-                if (rxNetDevice)
-                {
-                    // the receiver has a NetDevice, so we expect that it is attached to a Node
-                    auto dstNode = rxNetDevice->GetNode()->GetId();
-                    Simulator::ScheduleWithContext(dstNode,
-                                                   delay,
-                                                   &MultiModelSpectrumChannel::StartRx,
-                                                   this,
-                                                   rxParams,
-                                                   *rxPhyIterator);
-                }
-                else
+    if (txMobility && receiverMobility)
+    {
+        auto txAntennaGain{0.0};
+        auto rxAntennaGain{0.0};
+        auto propagationGainDb{0.0};
+        auto pathLossDb{0.0};
+        if (rxParams->txAntenna)
+        {
+            Angles txAngles(receiverMobility->GetPosition(), txMobility->GetPosition());
+            txAntennaGain = rxParams->txAntenna->GetGainDb(txAngles);
+            NS_LOG_LOGIC("txAntennaGain = " << txAntennaGain << " dB");
+            pathLossDb -= txAntennaGain;
+        }
+        auto rxAntenna = DynamicCast<AntennaModel>(receiver->GetAntenna());
+        if (rxAntenna)
+        {
+            Angles rxAngles(txMobility->GetPosition(), receiverMobility->GetPosition());
+            rxAntennaGain = rxAntenna->GetGainDb(rxAngles);
+            NS_LOG_LOGIC("rxAntennaGain = " << rxAntennaGain << " dB");
+            pathLossDb -= rxAntennaGain;
+        }
+        if (m_propagationLoss)
+        {
+            propagationGainDb = m_propagationLoss->CalcRxPower(0, txMobility, receiverMobility);
+            NS_LOG_LOGIC("propagationGainDb = " << propagationGainDb << " dB");
+            pathLossDb -= propagationGainDb;
+        }
+        NS_LOG_LOGIC("total pathLoss = " << pathLossDb << " dB");
+        // Gain trace
+        m_gainTrace(txMobility,
+                    receiverMobility,
+                    txAntennaGain,
+                    rxAntennaGain,
+                    propagationGainDb,
+                    pathLossDb);
+        // Pathloss trace
+        m_pathLossTrace(txParams->txPhy, receiver, pathLossDb);
+        if (pathLossDb > m_maxLossDb)
+        {
+            // beyond range
+            return;
+        }
+        auto pathGainLinear = std::pow(10.0, (-pathLossDb) / 10.0);
+        *(rxParams->psd) *= pathGainLinear;
+
+        if (m_propagationDelay)
+        {
+            delay = m_propagationDelay->GetDelay(txMobility, receiverMobility);
+        }
+    }
+
+    if (rxNetDevice)
+    {
+        // the receiver has a NetDevice, so we expect that it is attached to a Node
+        auto dstNode = rxNetDevice->GetNode()->GetId();
+        Simulator::ScheduleWithContext(dstNode,
+                                       delay,
+                                       &MultiModelSpectrumChannel::StartRx,
+                                       this,
+                                       rxParams,
+                                       receiver);
+    }
+    else
+    {
+        // the receiver is not attached to a NetDevice, so we cannot assume that it is
+        // attached to a node
+        Simulator::Schedule(delay, &MultiModelSpectrumChannel::StartRx, this, rxParams, receiver);
+    }
+}
+
+void
+MultiModelSpectrumChannel::BuildRxGrid()
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT(!m_rxGridValid);
+
+    m_rxGridCellSize = m_maxRange;
+    for (const auto& [rxSpectrumModelUid, rxInfo] : m_rxSpectrumModelInfoMap)
+    {
+        for (const auto& rxPhy : rxInfo.m_rxPhys)
+        {
+            auto phy = PeekPointer(rxPhy);
+            auto& info = m_rxPhyInfos[phy];
+            info.m_rxSpectrumModelUid = rxSpectrumModelUid;
+            info.m_order = m_rxOrders.at(rxPhy);
+            info.m_mobility = rxPhy->GetMobility();
+            if (info.m_mobility)
+            {
+                auto& phys = m_rxByMobility[PeekPointer(info.m_mobility)];
+                if (phys.empty())
                 {
-                    // the receiver is not attached to a NetDevice, so we cannot assume that it is
-                    // attached to a node
-                    Simulator::Schedule(delay,
-                                        &MultiModelSpectrumChannel::StartRx,
-                                        this,
-                                        rxParams,
-                                        *rxPhyIterator);
+                    info.m_mobility->TraceConnectWithoutContext(
+                        "CourseChange",
+                        MakeCallback(&MultiModelSpectrumChannel::NotifyCourseChange, this));
                 }
+                phys.push_back(phy);
             }
+            IndexRx(phy, info);
         }
     }
+    m_rxGridValid = true;
+    NS_LOG_DEBUG("Grid of " << m_rxGrid.size() << " cells, " << m_rxUngridded.size()
+                            << " receivers out of the grid");
+}
+
+void
+MultiModelSpectrumChannel::ClearRxGrid()
+{
+    NS_LOG_FUNCTION(this);
+    if (!m_rxGridValid)
+    {
+        return;
+    }
+    for (const auto& [mobility, phys] : m_rxByMobility)
+    {
+        m_rxPhyInfos.at(phys.front())
+            .m_mobility->TraceDisconnectWithoutContext(
+                "CourseChange",
+                MakeCallback(&MultiModelSpectrumChannel::NotifyCourseChange, this));
+    }
+    m_rxByMobility.clear();
+    m_rxPhyInfos.clear();
+    m_rxGrid.clear();
+    m_rxUngridded.clear();
+    m_rxGridValid = false;
+}
+
+void
+MultiModelSpectrumChannel::IndexRx(SpectrumPhy* phy, RxPhyInfo& info)
+{
+    if (info.m_mobility && info.m_mobility->GetVelocity() == Vector(0, 0, 0))
+    {
+        info.m_position = info.m_mobility->GetPosition();
+        info.m_cell = GetCellKey(GetCellCoordinate(info.m_position.x),
+                                 GetCellCoordinate(info.m_position.y),
+                                 GetCellCoordinate(info.m_position.z));
+        info.m_inGrid = true;
+        m_rxGrid[info.m_cell].push_back(phy);
+    }
+    else
+    {
+        info.m_inGrid = false;
+        m_rxUngridded.push_back(phy);
+    }
+}
+
+void
+MultiModelSpectrumChannel::UnindexRx(SpectrumPhy* phy, const RxPhyInfo& info)
+{
+    if (info.m_inGrid)
+    {
+        auto cellIt = m_rxGrid.find(info.m_cell);
+        NS_ASSERT(cellIt != m_rxGrid.end());
+        cellIt->second.erase(std::find(cellIt->second.begin(), cellIt->second.end(), phy));
+        if (cellIt->second.empty())
+        {
+            m_rxGrid.erase(cellIt);
+        }
+    }
+    else
+    {
+        m_rxUngridded.erase(std::find(m_rxUngridded.begin(), m_rxUngridded.end(), phy));
+    }
+}
+
+uint64_t
+MultiModelSpectrumChannel::GetCellKey(int64_t x, int64_t y, int64_t z)
+{
+    // 21 bits per coordinate: cells that share a key are only looked at together
+    const uint64_t mask = (uint64_t{1} << 21) - 1;
+    return ((static_cast<uint64_t>(x) & mask) << 42) | ((static_cast<uint64_t>(y) & mask) << 21) |
+           (static_cast<uint64_t>(z) & mask);
+}
+
+int64_t
+MultiModelSpectrumChannel::GetCellCoordinate(double coordinate) const
+{
+    return static_cast<int64_t>(std::floor(coordinate / m_rxGridCellSize));
+}
+
+void
+MultiModelSpectrumChannel::NotifyCourseChange(Ptr<const MobilityModel> mobility)
+{
+    NS_LOG_FUNCTION(this << mobility);
+    auto it = m_rxByMobility.find(PeekPointer(mobility));
+    if (it == m_rxByMobility.end())
+    {
+        return;
+    }
+    for (auto phy : it->second)
+    {
+        auto& info = m_rxPhyInfos.at(phy);
+        UnindexRx(phy, info);
+        IndexRx(phy, info);
+    }
 }
 
 void
@@ -25,10 +25,13 @@
 #include "spectrum-propagation-loss-model.h"
 #include "spectrum-value.h"
 
+#include <ns3/mobility-model.h>
 #include <ns3/propagation-delay-model.h>
 
 #include <map>
 #include <set>
+#include <unordered_map>
+#include <vector>
 
 namespace ns3
 {
@@ -99,6 +102,15 @@ typedef std::map<SpectrumModelUid_t, RxSpectrumModelInfo> RxSpectrumModelInfoMap
  * for this to work is that, after the SpectrumPhy switched its
  * SpectrumModel,  MultiModelSpectrumChannel::AddRx () is
  * called again passing the pointer to that SpectrumPhy.
+ *
+ * If the MaxRange attribute is set, the receivers farther than that distance
+ * from the transmitter are skipped before any loss is computed. The
+ * receivers that do not move are kept in a grid of cells as large as the
+ * range, so that a transmission only looks at the receivers of the cells
+ * around the transmitter; the grid is updated when a receiver notifies a
+ * course change. A receiver is assumed not to move until its next course
+ * change if its velocity is zero; the receivers that move, and those without
+ * a mobility model, are checked at each transmission.
  */
 class MultiModelSpectrumChannel : public SpectrumChannel
 {
@@ -145,6 +157,86 @@ class MultiModelSpectrumChannel : public SpectrumChannel
      */
     virtual void StartRx(Ptr<SpectrumSignalParameters> params, Ptr<SpectrumPhy> receiver);
 
+    /**
+     * Compute the loss towards a receiver, and schedule the reception if the
+     * receiver is in range.
+     *
+     * \param txParams The signal parameters.
+     * \param txMobility The mobility model of the transmitter.
+     * \param receiver A pointer to the receiver SpectrumPhy.
+     * \param rxSpectrumModelUid The UID of the RX SpectrumModel of the receiver.
+     */
+    void StartTxToRx(Ptr<SpectrumSignalParameters> txParams,
+                     Ptr<MobilityModel> txMobility,
+                     Ptr<SpectrumPhy> receiver,
+                     SpectrumModelUid_t rxSpectrumModelUid);
+
+    /**
+     * Information about a receiver, used to cull the receivers out of range
+     */
+    struct RxPhyInfo
+    {
+        SpectrumModelUid_t m_rxSpectrumModelUid; //!< UID of the RX SpectrumModel
+        uint64_t m_order;                        //!< Order in which the receiver was added
+        Ptr<MobilityModel> m_mobility;           //!< Mobility model, if any
+        bool m_inGrid;                           //!< Whether the receiver is in the grid
+        uint64_t m_cell;                         //!< Cell of the grid, if m_inGrid is true
+        Vector m_position;                       //!< Position, if m_inGrid is true
+    };
+
+    /**
+     * Build the grid of the receivers and connect to their course changes.
+     */
+    void BuildRxGrid();
+
+    /**
+     * Disconnect from the course changes of the receivers and clear the grid.
+     */
+    void ClearRxGrid();
+
+    /**
+     * Put a receiver in the cell of its position if it does not move, or in
+     * the list of the receivers to check at each transmission otherwise.
+     *
+     * \param phy The receiver.
+     * \param info The information about the receiver.
+     */
+    void IndexRx(SpectrumPhy* phy, RxPhyInfo& info);
+
+    /**
+     * Remove a receiver from its cell or from the list of the receivers to
+     * check at each transmission.
+     *
+     * \param phy The receiver.
+     * \param info The information about the receiver.
+     */
+    void UnindexRx(SpectrumPhy* phy, const RxPhyInfo& info);
+
+    /**
+     * Get the key of a cell of the grid.
+     *
+     * \param x The cell coordinate along x.
+     * \param y The cell coordinate along y.
+     * \param z The cell coordinate along z.
+     * \return The key of the cell.
+     */
+    static uint64_t GetCellKey(int64_t x, int64_t y, int64_t z);
+
+    /**
+     * Get the cell coordinate of a position coordinate.
+     *
+     * \param coordinate The position coordinate.
+     * \return The cell coordinate.
+     */
+    int64_t GetCellCoordinate(double coordinate) const;
+
+    /**
+     * Callback connected to the CourseChange trace of the receivers.
+     *
+     * \param mobility The mobility model whose course changed.
+     */
+    void NotifyCourseChange(Ptr<const MobilityModel> mobility);
+
     /**
      * Data structure holding, for each TX SpectrumModel,  all the
      * converters to any RX SpectrumModel, and all the corresponding
@@ -163,6 +255,52 @@ class MultiModelSpectrumChannel : public SpectrumChannel
      * Number of devices connected to the channel.
      */
     std::size_t m_numDevices;
+
+    /**
+     * Range beyond which the receivers are skipped, 0 to disable.
+     */
+    double m_maxRange;
+
+    /**
+     * Order in which the next receiver is added.
+     */
+    uint64_t m_nextOrder;
+
+    /**
+     * Order in which each receiver was added, to keep the order of the
+     * receivers of m_rxSpectrumModelInfoMap when looking for them in the grid.
+     */
+    std::unordered_map<Ptr<SpectrumPhy>, uint64_t> m_rxOrders;
+
+    /**
+     * Whether the grid holds the current receivers.
+     */
+    bool m_rxGridValid;
+
+    /**
+     * Size of the cells of the grid.
+     */
+    double m_rxGridCellSize;
+
+    /**
+     * Information about the receivers, when the grid is valid.
+     */
+    std::unordered_map<SpectrumPhy*, RxPhyInfo> m_rxPhyInfos;
+
+    /**
+     * Receivers that do not move, by cell of the grid.
+     */
+    std::unordered_map<uint64_t, std::vector<SpectrumPhy*>> m_rxGrid;
+
+    /**
+     * Receivers that move or have no mobility model, checked at each transmission.
+     */
+    std::vector<SpectrumPhy*> m_rxUngridded;
+
+    /**
+     * Receivers of each mobility model connected to the CourseChange trace.
+     */
+    std::unordered_map<const MobilityModel*, std::vector<SpectrumPhy*>> m_rxByMobility;
 };
 
 } // namespace ns3
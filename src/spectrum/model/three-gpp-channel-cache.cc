@@ -0,0 +1,273 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "three-gpp-channel-cache.h"
+
+#include <ns3/abort.h>
+#include <ns3/log.h>
+
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+
+#ifndef __WIN32__
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("ThreeGppChannelCache");
+
+/// Magic string at the start of a channel cache file
+static const char CACHE_MAGIC[16] = {
+    'n', 's', '3', '-', '3', 'g', 'p', 'p', '-', 'c', 'h', 'a', 'n', 'n', 'e', 'l'};
+/// Version of the format of the channel cache file
+static const uint32_t CACHE_VERSION = 2;
+/// Written in the byte order of the host, to detect files of other hosts
+static const uint32_t CACHE_BYTE_ORDER = 0x01020304;
+/// Size of the header of the file
+static const size_t CACHE_HEADER_SIZE = sizeof(CACHE_MAGIC) + 2 * sizeof(uint32_t);
+
+std::unordered_map<std::string, ThreeGppChannelCache*> ThreeGppChannelCache::m_instances;
+
+Ptr<ThreeGppChannelCache>
+ThreeGppChannelCache::Open(const std::string& fileName)
+{
+    NS_LOG_FUNCTION(fileName);
+    auto it = m_instances.find(fileName);
+    if (it != m_instances.end())
+    {
+        return Ptr<ThreeGppChannelCache>(it->second);
+    }
+    return Ptr<ThreeGppChannelCache>(new ThreeGppChannelCache(fileName), false);
+}
+
+ThreeGppChannelCache::ThreeGppChannelCache(const std::string& fileName)
+    : m_fileName(fileName),
+      m_data(nullptr),
+      m_size(0)
+{
+    NS_LOG_FUNCTION(this << fileName);
+
+#ifndef __WIN32__
+    m_fd = open(m_fileName.c_str(), O_RDWR | O_CREAT | O_APPEND, 0644);
+    NS_ABORT_MSG_IF(m_fd < 0,
+                    "Cannot open the channel cache file " << m_fileName << ": "
+                                                          << std::strerror(errno));
+    // the runs sharing the file append their records under the lock, so the
+    // file cannot grow while it is indexed and repaired
+    NS_ABORT_MSG_IF(flock(m_fd, LOCK_EX) != 0,
+                    "Cannot lock the channel cache file " << m_fileName);
+    size_t validSize = MapFile();
+    if (validSize < m_size)
+    {
+        NS_LOG_WARN("Truncating the incomplete record at the end of the channel cache file "
+                    << m_fileName);
+        NS_ABORT_MSG_IF(ftruncate(m_fd, validSize) != 0,
+                        "Cannot truncate the channel cache file " << m_fileName);
+    }
+#else
+    size_t validSize = MapFile();
+    if (validSize < m_size)
+    {
+        NS_LOG_WARN("Truncating the incomplete record at the end of the channel cache file "
+                    << m_fileName);
+        std::filesystem::resize_file(m_fileName, validSize);
+    }
+    m_appender.open(m_fileName, std::ios::binary | std::ios::app);
+    if (!m_appender)
+    {
+        NS_FATAL_ERROR("Cannot open the channel cache file " << m_fileName);
+    }
+#endif
+    if (validSize == 0)
+    {
+        std::string header(CACHE_MAGIC, sizeof(CACHE_MAGIC));
+        header.append(reinterpret_cast<const char*>(&CACHE_VERSION), sizeof(CACHE_VERSION));
+        header.append(reinterpret_cast<const char*>(&CACHE_BYTE_ORDER), sizeof(CACHE_BYTE_ORDER));
+        Append(header);
+    }
+#ifndef __WIN32__
+    flock(m_fd, LOCK_UN);
+#endif
+    m_instances[m_fileName] = this;
+
+    NS_LOG_INFO("Channel cache file " << m_fileName << " has " << m_records.size()
+                                      << " records");
+}
+
+ThreeGppChannelCache::~ThreeGppChannelCache()
+{
+    NS_LOG_FUNCTION(this);
+    m_instances.erase(m_fileName);
+#ifndef __WIN32__
+    close(m_fd);
+    if (m_data != nullptr)
+    {
+        munmap(const_cast<char*>(m_data), m_size);
+    }
+#else
+    m_appender.close();
+#endif
+}
+
+size_t
+ThreeGppChannelCache::MapFile()
+{
+    NS_LOG_FUNCTION(this);
+
+#ifndef __WIN32__
+    struct stat st;
+    NS_ABORT_MSG_IF(fstat(m_fd, &st) != 0, "Cannot stat the channel cache file " << m_fileName);
+    m_size = st.st_size;
+    if (m_size > 0)
+    {
+        void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, m_fd, 0);
+        NS_ABORT_MSG_IF(data == MAP_FAILED,
+                        "Cannot map the channel cache file " << m_fileName << ": "
+                                                             << std::strerror(errno));
+        m_data = static_cast<const char*>(data);
+    }
+#else
+    std::ifstream file(m_fileName, std::ios::binary);
+    if (!file)
+    {
+        return 0;
+    }
+    m_contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    m_data = m_contents.data();
+    m_size = m_contents.size();
+#endif
+
+    if (m_size == 0)
+    {
+        return 0;
+    }
+
+    uint32_t version;
+    uint32_t byteOrder;
+    NS_ABORT_MSG_IF(m_size < CACHE_HEADER_SIZE ||
+                        std::memcmp(m_data, CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0,
+                    m_fileName << " is not a channel cache file");
+    std::memcpy(&version, m_data + sizeof(CACHE_MAGIC), sizeof(version));
+    std::memcpy(&byteOrder, m_data + sizeof(CACHE_MAGIC) + sizeof(version), sizeof(byteOrder));
+    NS_ABORT_MSG_IF(version != CACHE_VERSION || byteOrder != CACHE_BYTE_ORDER,
+                    "The channel cache file " << m_fileName
+                                              << " was written by another version of ns-3 or "
+                                                 "on a host with another byte order");
+
+    // Index the records: a record is the size of the key (uint32_t), the size of the
+    // data (uint64_t), the key and the data
+    size_t offset = CACHE_HEADER_SIZE;
+    while (m_size - offset >= sizeof(uint32_t) + sizeof(uint64_t))
+    {
+        uint32_t keySize;
+        uint64_t dataSize;
+        std::memcpy(&keySize, m_data + offset, sizeof(keySize));
+        std::memcpy(&dataSize, m_data + offset + sizeof(keySize), sizeof(dataSize));
+        size_t start = offset + sizeof(keySize) + sizeof(dataSize);
+        if (m_size - start < keySize || m_size - start - keySize < dataSize)
+        {
+            break;
+        }
+        // the first record with a key wins
+        m_records.emplace(std::string_view(m_data + start, keySize),
+                          std::string_view(m_data + start + keySize, dataSize));
+        offset = start + keySize + dataSize;
+    }
+    return offset;
+}
+
+bool
+ThreeGppChannelCache::Find(const std::string& key, std::string_view& data) const
+{
+    auto it = m_records.find(key);
+    if (it == m_records.end())
+    {
+        return false;
+    }
+    data = it->second;
+    return true;
+}
+
+void
+ThreeGppChannelCache::Add(const std::string& key, const std::string& data)
+{
+    if (m_records.find(key) != m_records.end() || !m_added.insert(key).second)
+    {
+        return;
+    }
+    uint32_t keySize = key.size();
+    uint64_t dataSize = data.size();
+    std::string record;
+    record.reserve(sizeof(keySize) + sizeof(dataSize) + keySize + dataSize);
+    record.append(reinterpret_cast<const char*>(&keySize), sizeof(keySize));
+    record.append(reinterpret_cast<const char*>(&dataSize), sizeof(dataSize));
+    record.append(key);
+    record.append(data);
+#ifndef __WIN32__
+    NS_ABORT_MSG_IF(flock(m_fd, LOCK_EX) != 0,
+                    "Cannot lock the channel cache file " << m_fileName);
+    Append(record);
+    flock(m_fd, LOCK_UN);
+#else
+    Append(record);
+#endif
+}
+
+void
+ThreeGppChannelCache::Append(const std::string& buffer)
+{
+#ifndef __WIN32__
+    // O_APPEND moves to the end of the file before each write; a write is only
+    // split if it is interrupted, and the lock keeps the other runs out meanwhile
+    size_t written = 0;
+    while (written < buffer.size())
+    {
+        ssize_t ret = write(m_fd, buffer.data() + written, buffer.size() - written);
+        if (ret < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        NS_ABORT_MSG_IF(ret < 0,
+                        "Cannot write the channel cache file " << m_fileName << ": "
+                                                               << std::strerror(errno));
+        written += ret;
+    }
+#else
+    m_appender.write(buffer.data(), buffer.size());
+    m_appender.flush();
+    NS_ABORT_MSG_IF(!m_appender, "Cannot write the channel cache file " << m_fileName);
+#endif
+}
+
+const std::string&
+ThreeGppChannelCache::GetFileName() const
+{
+    return m_fileName;
+}
+
+size_t
+ThreeGppChannelCache::GetNumRecords() const
+{
+    return m_records.size();
+}
+
+} // namespace ns3
@@ -0,0 +1,130 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef THREE_GPP_CHANNEL_CACHE_H
+#define THREE_GPP_CHANNEL_CACHE_H
+
+#include <ns3/ptr.h>
+#include <ns3/simple-ref-count.h>
+
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace ns3
+{
+
+/**
+ * \ingroup spectrum
+ * \brief File of channel realizations shared by the simulation runs
+ *
+ * The file is a sequence of records, each one made of a key and of the
+ * serialized data of a realization. When the file is opened, it is mapped in
+ * memory and its records are indexed by key, so the data of a record is only
+ * read from disk when Find returns it. The records added with Add are
+ * appended to the file, and they are found by the runs that open the file
+ * afterwards.
+ *
+ * The file is in the byte order of the host. Each record is appended with a
+ * single write, under an exclusive lock of the file, so several runs can add
+ * records to the same file at the same time. A file that ends with an
+ * incomplete record, e.g. because the run that was writing it crashed, is
+ * truncated to its last complete record.
+ *
+ * \see ThreeGppChannelModel
+ */
+class ThreeGppChannelCache : public SimpleRefCount<ThreeGppChannelCache>
+{
+  public:
+    /**
+     * Open a channel cache file, creating it if it does not exist. The models
+     * that open the same file share the same instance.
+     * \param fileName the name of the file
+     * \return the channel cache
+     */
+    static Ptr<ThreeGppChannelCache> Open(const std::string& fileName);
+
+    /**
+     * Destructor. It closes and unmaps the file.
+     */
+    ~ThreeGppChannelCache();
+
+    /**
+     * Look for a record
+     * \param key the key of the record
+     * \param [out] data the data of the record, if found; it is valid as long
+     * as this instance exists
+     * \return true if the record was found in the file
+     */
+    bool Find(const std::string& key, std::string_view& data) const;
+
+    /**
+     * Append a record to the file, unless a record with the same key exists
+     * \param key the key of the record
+     * \param data the data of the record
+     */
+    void Add(const std::string& key, const std::string& data);
+
+    /**
+     * \return the name of the file
+     */
+    const std::string& GetFileName() const;
+
+    /**
+     * \return the number of records found in the file when it was opened
+     */
+    size_t GetNumRecords() const;
+
+  private:
+    /**
+     * Open and index a channel cache file
+     * \param fileName the name of the file
+     */
+    ThreeGppChannelCache(const std::string& fileName);
+
+    /**
+     * Map the file in memory and index its records
+     * \return the size of the complete records of the file, including the header
+     */
+    size_t MapFile();
+
+    /**
+     * Append a buffer to the file
+     * \param buffer the buffer
+     */
+    void Append(const std::string& buffer);
+
+    std::string m_fileName;   //!< Name of the file
+    const char* m_data;       //!< Contents of the file
+    size_t m_size;            //!< Size of the contents of the file
+    std::string m_contents;   //!< Contents of the file, where it is not mapped in memory
+#ifndef __WIN32__
+    int m_fd; //!< Descriptor of the file, opened in append mode
+#else
+    std::ofstream m_appender; //!< Stream appending the new records
+#endif
+    std::unordered_map<std::string_view, std::string_view>
+        m_records;                           //!< Data of the records in the file, by key
+    std::unordered_set<std::string> m_added; //!< Keys of the records added by this run
+
+    /// Instances by file name
+    static std::unordered_map<std::string, ThreeGppChannelCache*> m_instances;
+};
+
+} // namespace ns3
+
+#endif /* THREE_GPP_CHANNEL_CACHE_H */
@@ -22,18 +22,27 @@
 #include "three-gpp-channel-model.h"
 
 #include "ns3/double.h"
+#include "ns3/hash.h"
 #include "ns3/integer.h"
 #include "ns3/log.h"
 #include "ns3/mobility-model.h"
 #include "ns3/node.h"
 #include "ns3/phased-array-model.h"
 #include "ns3/pointer.h"
+#include "ns3/rng-seed-manager.h"
 #include "ns3/string.h"
+#include "ns3/uinteger.h"
 #include <ns3/simulator.h>
 
 #include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <map>
 #include <random>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
 
 namespace ns3
 {
@@ -273,6 +282,9 @@ ThreeGppChannelModel::DoDispose()
     {
         m_channelConditionModel->Dispose();
     }
+    m_bulkUpdateEvent.Cancel();
+    m_channelPairs.clear();
+    m_cache = nullptr;
     m_channelMatrixMap.clear();
     m_channelParamsMap.clear();
     m_channelConditionModel = nullptr;
@@ -339,6 +351,30 @@ ThreeGppChannelModel::GetTypeId()
                           DoubleValue(0.0),
                           MakeDoubleAccessor(&ThreeGppChannelModel::m_vScatt),
                           MakeDoubleChecker<double>(0.0))
+            // attributes for the bulk update of the channels
+            .AddAttribute("BulkUpdate",
+                          "If true, all the channels requested so far are regenerated together "
+                          "at the multiples of UpdatePeriod, instead of when they are requested "
+                          "after UpdatePeriod. It has no effect if UpdatePeriod is 0",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&ThreeGppChannelModel::m_bulkUpdate),
+                          MakeBooleanChecker())
+            .AddAttribute("BulkUpdateThreads",
+                          "Number of threads that compute the channel matrices in a bulk "
+                          "update, including the simulator thread. 0 means one thread per "
+                          "hardware thread",
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&ThreeGppChannelModel::m_bulkUpdateThreads),
+                          MakeUintegerChecker<uint32_t>())
+            .AddAttribute("CacheFile",
+                          "The file that caches the channel realizations across the runs. "
+                          "The realizations found in the file are read from it instead of "
+                          "being generated, and the others are added to it. Empty to "
+                          "disable the cache",
+                          StringValue(""),
+                          MakeStringAccessor(&ThreeGppChannelModel::SetCacheFile,
+                                             &ThreeGppChannelModel::GetCacheFile),
+                          MakeStringChecker())
 
         ;
     return tid;
@@ -365,6 +401,7 @@ ThreeGppChannelModel::SetFrequency(double f)
     NS_ASSERT_MSG(f >= 500.0e6 && f <= 100.0e9,
                   "Frequency should be between 0.5 and 100 GHz but is " << f);
     m_frequency = f;
+    m_configurationHash.reset();
 }
 
 double
@@ -384,6 +421,7 @@ ThreeGppChannelModel::SetScenario(const std::string& scenario)
                   "Unknown scenario, choose between: RMa, UMa, UMi-StreetCanyon, "
                   "InH-OfficeOpen, InH-OfficeMixed, V2V-Urban or V2V-Highway");
     m_scenario = scenario;
+    m_configurationHash.reset();
 }
 
 std::string
@@ -393,6 +431,21 @@ ThreeGppChannelModel::GetScenario() const
     return m_scenario;
 }
 
+void
+ThreeGppChannelModel::SetCacheFile(const std::string& fileName)
+{
+    NS_LOG_FUNCTION(this << fileName);
+    m_cache = fileName.empty() ? nullptr : ThreeGppChannelCache::Open(fileName);
+    m_configurationHash.reset();
+}
+
+std::string
+ThreeGppChannelModel::GetCacheFile() const
+{
+    NS_LOG_FUNCTION(this);
+    return m_cache ? m_cache->GetFileName() : "";
+}
+
 Ptr<const ThreeGppChannelModel::ParamsTable>
 ThreeGppChannelModel::GetThreeGppTable(Ptr<const ChannelCondition> channelCondition,
                                        double hBS,
@@ -1119,6 +1172,17 @@ ThreeGppChannelModel::GetChannel(Ptr<const MobilityModel> aMob,
     // Compute the channel matrix key. The key is reciprocal, i.e., key (a, b) = key (b, a)
     uint64_t channelMatrixKey = GetKey(aAntenna->GetId(), bAntenna->GetId());
 
+    if (m_bulkUpdate && !m_updatePeriod.IsZero())
+    {
+        // keep track of the channel, to regenerate it in the next bulk update
+        m_channelPairs[channelMatrixKey] = {aMob, bMob, aAntenna, bAntenna};
+        m_channelRequested = true;
+        if (!m_bulkUpdateEvent.IsPending())
+        {
+            ScheduleBulkUpdate();
+        }
+    }
+
     // retrieve the channel condition
     Ptr<const ChannelCondition> condition =
         m_channelConditionModel->GetChannelCondition(aMob, bMob);
@@ -1166,7 +1230,8 @@ ThreeGppChannelModel::GetChannel(Ptr<const MobilityModel> aMob,
         // shuffle all the arrays to perform random coupling
         // Step 9: Generate the cross polarization power ratios
         // Step 10: Draw initial phases
-        channelParams = GenerateChannelParameters(condition, table3gpp, aMob, bMob);
+        channelParams =
+            LoadOrGenerateChannelParameters(condition, table3gpp, aMob, bMob, channelParams);
         // store or replace the channel parameters
         m_channelParamsMap[channelParamsKey] = channelParams;
     }
@@ -1189,8 +1254,28 @@ ThreeGppChannelModel::GetChannel(Ptr<const MobilityModel> aMob,
     // generate a new realization
     if (notFoundMatrix || updateMatrix)
     {
-        // channel matrix not found or has to be updated, generate a new one
-        channelMatrix = GetNewChannel(channelParams, table3gpp, aMob, bMob, aAntenna, bAntenna);
+        // channel matrix not found or has to be updated, read it from the cache
+        // file or generate a new one
+        auto nodeIds =
+            std::make_pair(aMob->GetObject<Node>()->GetId(), bMob->GetObject<Node>()->GetId());
+        channelMatrix = LoadChannelMatrix(*channelParams,
+                                          aMob->GetPosition(),
+                                          bMob->GetPosition(),
+                                          nodeIds,
+                                          *aAntenna,
+                                          *bAntenna);
+        if (!channelMatrix)
+        {
+            channelMatrix =
+                GetNewChannel(channelParams, table3gpp, aMob, bMob, aAntenna, bAntenna);
+            SaveChannelMatrix(*channelParams,
+                              aMob->GetPosition(),
+                              bMob->GetPosition(),
+                              nodeIds,
+                              *aAntenna,
+                              *bAntenna,
+                              *channelMatrix);
+        }
         channelMatrix->m_antennaPair =
             std::make_pair(aAntenna->GetId(),
                            bAntenna->GetId()); // save antenna pair, with the exact order of s and u
@@ -1203,6 +1288,163 @@ ThreeGppChannelModel::GetChannel(Ptr<const MobilityModel> aMob,
     return channelMatrix;
 }
 
+void
+ThreeGppChannelModel::ScheduleBulkUpdate()
+{
+    NS_LOG_FUNCTION(this);
+
+    int64_t periods = Simulator::Now().GetTimeStep() / m_updatePeriod.GetTimeStep() + 1;
+    Time delay = m_updatePeriod * periods - Simulator::Now();
+    m_bulkUpdateEvent =
+        Simulator::Schedule(delay, &ThreeGppChannelModel::UpdateAllChannels, this);
+}
+
+void
+ThreeGppChannelModel::UpdateAllChannels()
+{
+    NS_LOG_FUNCTION(this);
+
+    /// A channel matrix to compute
+    struct Job
+    {
+        uint64_t m_key;                            //!< the channel matrix key
+        const ChannelPair* m_pair;                 //!< the nodes and the antenna arrays
+        Ptr<const ThreeGppChannelParams> m_params; //!< the channel parameters
+        Ptr<const ParamsTable> m_table3gpp;        //!< the 3gpp parameters table
+        Vector m_aPos;                             //!< the position of node a
+        Vector m_bPos;                             //!< the position of node b
+        std::pair<uint32_t, uint32_t> m_nodeIds;   //!< the ids of nodes a and b
+        Ptr<ChannelMatrix> m_channelMatrix;        //!< the computed channel matrix
+        bool m_loaded;                             //!< the matrix was read from the cache file
+    };
+
+    // Everything that draws random numbers or touches shared objects runs
+    // here, in the order of the keys
+    std::vector<Job> jobs;
+    for (const auto& [key, pair] : m_channelPairs)
+    {
+        Job job;
+        job.m_key = key;
+        job.m_pair = &pair;
+        job.m_aPos = pair.m_aMob->GetPosition();
+        job.m_bPos = pair.m_bMob->GetPosition();
+        job.m_nodeIds = std::make_pair(pair.m_aMob->GetObject<Node>()->GetId(),
+                                       pair.m_bMob->GetObject<Node>()->GetId());
+        uint64_t channelParamsKey = GetKey(job.m_nodeIds.first, job.m_nodeIds.second);
+
+        Ptr<const ChannelCondition> condition =
+            m_channelConditionModel->GetChannelCondition(pair.m_aMob, pair.m_bMob);
+
+        double x = job.m_aPos.x - job.m_bPos.x;
+        double y = job.m_aPos.y - job.m_bPos.y;
+        double distance2D = sqrt(x * x + y * y);
+        double hUt = std::min(job.m_aPos.z, job.m_bPos.z);
+        double hBs = std::max(job.m_aPos.z, job.m_bPos.z);
+        job.m_table3gpp = GetThreeGppTable(condition, hBs, hUt, distance2D);
+
+        // the parameters of a pair of nodes are regenerated once per bulk update,
+        // even if the nodes have several pairs of antenna arrays
+        auto paramsIt = m_channelParamsMap.find(channelParamsKey);
+        if (paramsIt == m_channelParamsMap.end() ||
+            paramsIt->second->m_generatedTime < Simulator::Now() ||
+            ChannelParamsNeedsUpdate(paramsIt->second, condition))
+        {
+            m_channelParamsMap[channelParamsKey] = LoadOrGenerateChannelParameters(
+                condition,
+                job.m_table3gpp,
+                pair.m_aMob,
+                pair.m_bMob,
+                paramsIt == m_channelParamsMap.end() ? nullptr : paramsIt->second);
+        }
+        job.m_params = m_channelParamsMap[channelParamsKey];
+
+        auto matrixIt = m_channelMatrixMap.find(key);
+        if (matrixIt == m_channelMatrixMap.end() ||
+            ChannelMatrixNeedsUpdate(job.m_params, matrixIt->second) ||
+            AntennaSetupChanged(pair.m_aAntenna, pair.m_bAntenna, matrixIt->second))
+        {
+            job.m_channelMatrix = LoadChannelMatrix(*job.m_params,
+                                                    job.m_aPos,
+                                                    job.m_bPos,
+                                                    job.m_nodeIds,
+                                                    *pair.m_aAntenna,
+                                                    *pair.m_bAntenna);
+            job.m_loaded = (job.m_channelMatrix != nullptr);
+            jobs.push_back(job);
+        }
+    }
+
+    // Compute the channel matrices. The jobs only read the objects they
+    // point to, and each one writes its own result
+    Time now = Simulator::Now();
+    std::atomic<size_t> nextJob{0};
+    auto work = [this, &jobs, &nextJob, now]() {
+        for (size_t i = nextJob++; i < jobs.size(); i = nextJob++)
+        {
+            Job& job = jobs[i];
+            if (job.m_loaded)
+            {
+                continue;
+            }
+            job.m_channelMatrix = GenerateChannelMatrix(*job.m_params,
+                                                        *job.m_table3gpp,
+                                                        job.m_aPos,
+                                                        job.m_bPos,
+                                                        job.m_nodeIds,
+                                                        *job.m_pair->m_aAntenna,
+                                                        *job.m_pair->m_bAntenna,
+                                                        now);
+        }
+    };
+
+    size_t numThreads = m_bulkUpdateThreads;
+    if (numThreads == 0)
+    {
+        numThreads = std::max(std::thread::hardware_concurrency(), 1U);
+    }
+    numThreads = std::min(numThreads, jobs.size());
+    NS_LOG_DEBUG("Computing " << jobs.size() << " channel matrices on " << numThreads
+                              << " threads");
+
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < numThreads; ++i)
+    {
+        threads.emplace_back(work);
+    }
+    work();
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (auto& job : jobs)
+    {
+        if (!job.m_loaded)
+        {
+            SaveChannelMatrix(*job.m_params,
+                              job.m_aPos,
+                              job.m_bPos,
+                              job.m_nodeIds,
+                              *job.m_pair->m_aAntenna,
+                              *job.m_pair->m_bAntenna,
+                              *job.m_channelMatrix);
+        }
+        // save antenna pair, with the exact order of s and u antennas at the
+        // moment of the channel generation
+        job.m_channelMatrix->m_antennaPair =
+            std::make_pair(job.m_pair->m_aAntenna->GetId(), job.m_pair->m_bAntenna->GetId());
+        m_channelMatrixMap[job.m_key] = job.m_channelMatrix;
+    }
+
+    // Keep updating only while the channels are used, otherwise the simulation
+    // would never run out of events
+    if (m_channelRequested)
+    {
+        m_channelRequested = false;
+        ScheduleBulkUpdate();
+    }
+}
+
 Ptr<const MatrixBasedChannelModel::ChannelParams>
 ThreeGppChannelModel::GetParams(Ptr<const MobilityModel> aMob, Ptr<const MobilityModel> bMob) const
 {
@@ -1250,7 +1492,7 @@ ThreeGppChannelModel::GenerateChannelParameters(const Ptr<const ChannelCondition
     // Generate paramNum independent LSPs.
     for (uint8_t iter = 0; iter < paramNum; iter++)
     {
-        LSPsIndep.push_back(m_normalRv->GetValue());
+        LSPsIndep.push_back(DrawNormal());
     }
     for (uint8_t row = 0; row < paramNum; row++)
     {
@@ -1303,7 +1545,7 @@ ThreeGppChannelModel::GenerateChannelParameters(const Ptr<const ChannelCondition
     double minTau = 100.0;
     for (uint8_t cIndex = 0; cIndex < table3gpp->m_numOfCluster; cIndex++)
     {
-        double tau = -1 * table3gpp->m_rTau * DS * log(m_uniformRv->GetValue(0, 1)); //(7.5-1)
+        double tau = -1 * table3gpp->m_rTau * DS * log(DrawUniform(0, 1)); //(7.5-1)
         if (minTau > tau)
         {
             minTau = tau;
@@ -1328,7 +1570,7 @@ ThreeGppChannelModel::GenerateChannelParameters(const Ptr<const ChannelCondition
         double power =
             exp(-1 * clusterDelay[cIndex] * (table3gpp->m_rTau - 1) / table3gpp->m_rTau / DS) *
             pow(10,
-                -1 * m_normalRv->GetValue() * table3gpp->m_perClusterShadowingStd / 10.0); //(7.5-5)
+                -1 * DrawNormal() * table3gpp->m_perClusterShadowingStd / 10.0); //(7.5-5)
         powerSum += power;
         clusterPower.push_back(power);
     }
@@ -1512,25 +1754,25 @@ ThreeGppChannelModel::GenerateChannelParameters(const Ptr<const ChannelCondition
     for (uint8_t cIndex = 0; cIndex < channelParams->m_reducedClusterNumber; cIndex++)
     {
         int Xn = 1;
-        if (m_uniformRv->GetValue(0, 1) < 0.5)
+        if (DrawUniform(0, 1) < 0.5)
         {
             Xn = -1;
         }
-        clusterAoa[cIndex] = clusterAoa[cIndex] * Xn + (m_normalRv->GetValue() * ASA / 7.0) +
+        clusterAoa[cIndex] = clusterAoa[cIndex] * Xn + (DrawNormal() * ASA / 7.0) +
                              RadiansToDegrees(uAngle.GetAzimuth()); //(7.5-11)
-        clusterAod[cIndex] = clusterAod[cIndex] * Xn + (m_normalRv->GetValue() * ASD / 7.0) +
+        clusterAod[cIndex] = clusterAod[cIndex] * Xn + (DrawNormal() * ASD / 7.0) +
                              RadiansToDegrees(sAngle.GetAzimuth());
         if (channelCondition->IsO2i())
         {
             clusterZoa[cIndex] =
-                clusterZoa[cIndex] * Xn + (m_normalRv->GetValue() * ZSA / 7.0) + 90; //(7.5-16)
+                clusterZoa[cIndex] * Xn + (DrawNormal() * ZSA / 7.0) + 90; //(7.5-16)
         }
         else
         {
-            clusterZoa[cIndex] = clusterZoa[cIndex] * Xn + (m_normalRv->GetValue() * ZSA / 7.0) +
+            clusterZoa[cIndex] = clusterZoa[cIndex] * Xn + (DrawNormal() * ZSA / 7.0) +
                                  RadiansToDegrees(uAngle.GetInclination()); //(7.5-16)
         }
-        clusterZod[cIndex] = clusterZod[cIndex] * Xn + (m_normalRv->GetValue() * ZSD / 7.0) +
+        clusterZod[cIndex] = clusterZod[cIndex] * Xn + (DrawNormal() * ZSD / 7.0) +
                              RadiansToDegrees(sAngle.GetInclination()) +
                              table3gpp->m_offsetZOD; //(7.5-19)
     }
@@ -1704,11 +1946,11 @@ ThreeGppChannelModel::GenerateChannelParameters(const Ptr<const ChannelCondition
             clusterPhase[nInd][mInd].resize(4);
             // used to store the XPR values
             crossPolarizationPowerRatios[nInd][mInd] =
-                std::pow(10, (m_normalRv->GetValue() * sigXprLinear + uXprLinear) / 10.0);
+                std::pow(10, (DrawNormal() * sigXprLinear + uXprLinear) / 10.0);
             for (uint8_t pInd = 0; pInd < 4; pInd++)
             {
                 // used to store the PHI values
-                clusterPhase[nInd][mInd][pInd] = m_uniformRv->GetValue(-1 * M_PI, M_PI);
+                clusterPhase[nInd][mInd][pInd] = DrawUniform(-1 * M_PI, M_PI);
             }
         }
     }
@@ -1844,8 +2086,8 @@ ThreeGppChannelModel::GenerateChannelParameters(const Ptr<const ChannelCondition
         double D = 0;
         if (cIndex != 0)
         {
-            alpha = m_uniformRvDoppler->GetValue(-1, 1);
-            D = m_uniformRvDoppler->GetValue(-m_vScatt, m_vScatt);
+            alpha = DrawDoppler(-1, 1);
+            D = DrawDoppler(-m_vScatt, m_vScatt);
         }
         dopplerTermAlpha.push_back(alpha);
         dopplerTermD.push_back(D);
@@ -1866,144 +2108,140 @@ ThreeGppChannelModel::GetNewChannel(Ptr<const ThreeGppChannelParams> channelPara
 {
     NS_LOG_FUNCTION(this);
 
+    return GenerateChannelMatrix(
+        *channelParams,
+        *table3gpp,
+        sMob->GetPosition(),
+        uMob->GetPosition(),
+        std::make_pair(sMob->GetObject<Node>()->GetId(), uMob->GetObject<Node>()->GetId()),
+        *sAntenna,
+        *uAntenna,
+        Simulator::Now());
+}
+
+Ptr<MatrixBasedChannelModel::ChannelMatrix>
+ThreeGppChannelModel::GenerateChannelMatrix(const ThreeGppChannelParams& channelParams,
+                                            const ParamsTable& table3gpp,
+                                            const Vector& sPos,
+                                            const Vector& uPos,
+                                            std::pair<uint32_t, uint32_t> nodeIds,
+                                            const PhasedArrayModel& sAntenna,
+                                            const PhasedArrayModel& uAntenna,
+                                            Time generatedTime) const
+{
+    NS_LOG_FUNCTION(this);
+
     NS_ASSERT_MSG(m_frequency > 0.0, "Set the operating frequency first!");
 
     // create a channel matrix instance
     Ptr<ChannelMatrix> channelMatrix = Create<ChannelMatrix>();
-    channelMatrix->m_generatedTime = Simulator::Now();
+    channelMatrix->m_generatedTime = generatedTime;
     // save in which order is generated this matrix
-    channelMatrix->m_nodeIds =
-        std::make_pair(sMob->GetObject<Node>()->GetId(), uMob->GetObject<Node>()->GetId());
+    channelMatrix->m_nodeIds = nodeIds;
     // check if channelParams structure is generated in direction s-to-u or u-to-s
-    bool isSameDirection = (channelParams->m_nodeIds == channelMatrix->m_nodeIds);
-
-    MatrixBasedChannelModel::Double2DVector rayAodRadian;
-    MatrixBasedChannelModel::Double2DVector rayAoaRadian;
-    MatrixBasedChannelModel::Double2DVector rayZodRadian;
-    MatrixBasedChannelModel::Double2DVector rayZoaRadian;
+    bool isSameDirection = (channelParams.m_nodeIds == channelMatrix->m_nodeIds);
 
     // if channel params is generated in the same direction in which we
     // generate the channel matrix, angles and zenith od departure and arrival are ok,
-    // just set them to corresponding variable that will be used for the generation
-    // of channel matrix, otherwise we need to flip angles and zeniths of departure and arrival
-    if (isSameDirection)
-    {
-        rayAodRadian = channelParams->m_rayAodRadian;
-        rayAoaRadian = channelParams->m_rayAoaRadian;
-        rayZodRadian = channelParams->m_rayZodRadian;
-        rayZoaRadian = channelParams->m_rayZoaRadian;
-    }
-    else
-    {
-        rayAodRadian = channelParams->m_rayAoaRadian;
-        rayAoaRadian = channelParams->m_rayAodRadian;
-        rayZodRadian = channelParams->m_rayZoaRadian;
-        rayZoaRadian = channelParams->m_rayZodRadian;
-    }
+    // just use them for the generation of channel matrix, otherwise we need to flip
+    // angles and zeniths of departure and arrival
+    const MatrixBasedChannelModel::Double2DVector& rayAodRadian =
+        isSameDirection ? channelParams.m_rayAodRadian : channelParams.m_rayAoaRadian;
+    const MatrixBasedChannelModel::Double2DVector& rayAoaRadian =
+        isSameDirection ? channelParams.m_rayAoaRadian : channelParams.m_rayAodRadian;
+    const MatrixBasedChannelModel::Double2DVector& rayZodRadian =
+        isSameDirection ? channelParams.m_rayZodRadian : channelParams.m_rayZoaRadian;
+    const MatrixBasedChannelModel::Double2DVector& rayZoaRadian =
+        isSameDirection ? channelParams.m_rayZoaRadian : channelParams.m_rayZodRadian;
 
     // Step 11: Generate channel coefficients for each cluster n and each receiver
     //  and transmitter element pair u,s.
     // where n is cluster index, u and s are receive and transmit antenna element.
-    size_t uSize = uAntenna->GetNumElems();
-    size_t sSize = sAntenna->GetNumElems();
+    size_t uSize = uAntenna.GetNumElems();
+    size_t sSize = sAntenna.GetNumElems();
 
     // NOTE: Since each of the strongest 2 clusters are divided into 3 sub-clusters,
     // the total cluster will generally be numReducedCLuster + 4.
     // However, it might be that m_cluster1st = m_cluster2nd. In this case the
     // total number of clusters will be numReducedCLuster + 2.
-    uint16_t numOverallCluster = (channelParams->m_cluster1st != channelParams->m_cluster2nd)
-                                     ? channelParams->m_reducedClusterNumber + 4
-                                     : channelParams->m_reducedClusterNumber + 2;
+    uint16_t numOverallCluster = (channelParams.m_cluster1st != channelParams.m_cluster2nd)
+                                     ? channelParams.m_reducedClusterNumber + 4
+                                     : channelParams.m_reducedClusterNumber + 2;
     Complex3DVector hUsn(uSize, sSize, numOverallCluster); // channel coefficient hUsn (u, s, n);
-    NS_ASSERT(channelParams->m_reducedClusterNumber <= channelParams->m_clusterPhase.size());
-    NS_ASSERT(channelParams->m_reducedClusterNumber <= channelParams->m_clusterPower.size());
-    NS_ASSERT(channelParams->m_reducedClusterNumber <=
-              channelParams->m_crossPolarizationPowerRatios.size());
-    NS_ASSERT(channelParams->m_reducedClusterNumber <= rayZoaRadian.size());
-    NS_ASSERT(channelParams->m_reducedClusterNumber <= rayZodRadian.size());
-    NS_ASSERT(channelParams->m_reducedClusterNumber <= rayAoaRadian.size());
-    NS_ASSERT(channelParams->m_reducedClusterNumber <= rayAodRadian.size());
-    NS_ASSERT(table3gpp->m_raysPerCluster <= channelParams->m_clusterPhase[0].size());
-    NS_ASSERT(table3gpp->m_raysPerCluster <=
-              channelParams->m_crossPolarizationPowerRatios[0].size());
-    NS_ASSERT(table3gpp->m_raysPerCluster <= rayZoaRadian[0].size());
-    NS_ASSERT(table3gpp->m_raysPerCluster <= rayZodRadian[0].size());
-    NS_ASSERT(table3gpp->m_raysPerCluster <= rayAoaRadian[0].size());
-    NS_ASSERT(table3gpp->m_raysPerCluster <= rayAodRadian[0].size());
-
-    double x = sMob->GetPosition().x - uMob->GetPosition().x;
-    double y = sMob->GetPosition().y - uMob->GetPosition().y;
+    NS_ASSERT(channelParams.m_reducedClusterNumber <= channelParams.m_clusterPhase.size());
+    NS_ASSERT(channelParams.m_reducedClusterNumber <= channelParams.m_clusterPower.size());
+    NS_ASSERT(channelParams.m_reducedClusterNumber <=
+              channelParams.m_crossPolarizationPowerRatios.size());
+    NS_ASSERT(channelParams.m_reducedClusterNumber <= rayZoaRadian.size());
+    NS_ASSERT(channelParams.m_reducedClusterNumber <= rayZodRadian.size());
+    NS_ASSERT(channelParams.m_reducedClusterNumber <= rayAoaRadian.size());
+    NS_ASSERT(channelParams.m_reducedClusterNumber <= rayAodRadian.size());
+    NS_ASSERT(table3gpp.m_raysPerCluster <= channelParams.m_clusterPhase[0].size());
+    NS_ASSERT(table3gpp.m_raysPerCluster <= channelParams.m_crossPolarizationPowerRatios[0].size());
+    NS_ASSERT(table3gpp.m_raysPerCluster <= rayZoaRadian[0].size());
+    NS_ASSERT(table3gpp.m_raysPerCluster <= rayZodRadian[0].size());
+    NS_ASSERT(table3gpp.m_raysPerCluster <= rayAoaRadian[0].size());
+    NS_ASSERT(table3gpp.m_raysPerCluster <= rayAodRadian[0].size());
+
+    double x = sPos.x - uPos.x;
+    double y = sPos.y - uPos.y;
     double distance2D = sqrt(x * x + y * y);
     // NOTE we assume hUT = min (height(a), height(b)) and
     // hBS = max (height (a), height (b))
-    double hUt = std::min(sMob->GetPosition().z, uMob->GetPosition().z);
-    double hBs = std::max(sMob->GetPosition().z, uMob->GetPosition().z);
+    double hUt = std::min(sPos.z, uPos.z);
+    double hBs = std::max(sPos.z, uPos.z);
     // compute the 3D distance using eq. 7.4-1
     double distance3D = std::sqrt(distance2D * distance2D + (hBs - hUt) * (hBs - hUt));
 
-    Angles sAngle(uMob->GetPosition(), sMob->GetPosition());
-    Angles uAngle(sMob->GetPosition(), uMob->GetPosition());
-
-    Double2DVector sinCosA; // cached multiplications of sin and cos of the ZoA and AoA angles
-    Double2DVector sinSinA; // cached multiplications of sines of the ZoA and AoA angles
-    Double2DVector cosZoA;  // cached cos of the ZoA angle
-    Double2DVector sinCosD; // cached multiplications of sin and cos of the ZoD and AoD angles
-    Double2DVector sinSinD; // cached multiplications of the cosines of the ZoA and AoA angles
-    Double2DVector cosZoD;  // cached cos of the ZoD angle
+    Angles sAngle(uPos, sPos);
+    Angles uAngle(sPos, uPos);
+
+    // The terms that depend on the ray only are stored contiguously, in the
+    // order (cluster, ray), so that the inner loop over the rays reads them
+    // sequentially
+    const uint8_t numRays = table3gpp.m_raysPerCluster;
+    const size_t numRayTerms = channelParams.m_reducedClusterNumber * numRays;
+    DoubleVector sinCosA(numRayTerms); // cached multiplications of sin and cos of ZoA and AoA
+    DoubleVector sinSinA(numRayTerms); // cached multiplications of sines of ZoA and AoA
+    DoubleVector cosZoA(numRayTerms);  // cached cos of the ZoA angle
+    DoubleVector sinCosD(numRayTerms); // cached multiplications of sin and cos of ZoD and AoD
+    DoubleVector sinSinD(numRayTerms); // cached multiplications of sines of ZoD and AoD
+    DoubleVector cosZoD(numRayTerms);  // cached cos of the ZoD angle
 
     // contains part of the ray expression, cached as independent from the u- and s-indexes,
-    // but calculate it for different polarization angles of s and u
-    std::map<std::pair<uint8_t, uint8_t>, Complex2DVector> raysPreComp;
-    for (size_t polSa = 0; polSa < sAntenna->GetNumPols(); ++polSa)
-    {
-        for (size_t polUa = 0; polUa < uAntenna->GetNumPols(); ++polUa)
-        {
-            raysPreComp[std::make_pair(polSa, polUa)] =
-                Complex2DVector(channelParams->m_reducedClusterNumber, table3gpp->m_raysPerCluster);
-        }
-    }
+    // but calculate it for different polarization angles of s and u, with index
+    // polSa * uAntenna.GetNumPols () + polUa
+    const uint8_t numPolsS = sAntenna.GetNumPols();
+    const uint8_t numPolsU = uAntenna.GetNumPols();
+    std::vector<std::vector<std::complex<double>>> raysPreComp(
+        numPolsS * numPolsU,
+        std::vector<std::complex<double>>(numRayTerms));
 
-    // resize to appropriate dimensions
-    sinCosA.resize(channelParams->m_reducedClusterNumber);
-    sinSinA.resize(channelParams->m_reducedClusterNumber);
-    cosZoA.resize(channelParams->m_reducedClusterNumber);
-    sinCosD.resize(channelParams->m_reducedClusterNumber);
-    sinSinD.resize(channelParams->m_reducedClusterNumber);
-    cosZoD.resize(channelParams->m_reducedClusterNumber);
-    for (uint8_t nIndex = 0; nIndex < channelParams->m_reducedClusterNumber; nIndex++)
-    {
-        sinCosA[nIndex].resize(table3gpp->m_raysPerCluster);
-        sinSinA[nIndex].resize(table3gpp->m_raysPerCluster);
-        cosZoA[nIndex].resize(table3gpp->m_raysPerCluster);
-        sinCosD[nIndex].resize(table3gpp->m_raysPerCluster);
-        sinSinD[nIndex].resize(table3gpp->m_raysPerCluster);
-        cosZoD[nIndex].resize(table3gpp->m_raysPerCluster);
-    }
     // pre-compute the terms which are independent from uIndex and sIndex
-    for (uint8_t nIndex = 0; nIndex < channelParams->m_reducedClusterNumber; nIndex++)
+    for (uint8_t nIndex = 0; nIndex < channelParams.m_reducedClusterNumber; nIndex++)
     {
-        for (uint8_t mIndex = 0; mIndex < table3gpp->m_raysPerCluster; mIndex++)
+        for (uint8_t mIndex = 0; mIndex < numRays; mIndex++)
         {
-            DoubleVector initialPhase = channelParams->m_clusterPhase[nIndex][mIndex];
+            const size_t rayIndex = nIndex * numRays + mIndex;
+            const DoubleVector& initialPhase = channelParams.m_clusterPhase[nIndex][mIndex];
             NS_ASSERT(4 <= initialPhase.size());
-            double k = channelParams->m_crossPolarizationPowerRatios[nIndex][mIndex];
+            double k = channelParams.m_crossPolarizationPowerRatios[nIndex][mIndex];
 
             // cache the component of the "rays" terms which depend on the random angle of arrivals
             // and departures and initial phases only
-            for (uint8_t polUa = 0; polUa < uAntenna->GetNumPols(); ++polUa)
+            for (uint8_t polUa = 0; polUa < numPolsU; ++polUa)
             {
-                auto [rxFieldPatternPhi, rxFieldPatternTheta] = uAntenna->GetElementFieldPattern(
-                    Angles(channelParams->m_rayAoaRadian[nIndex][mIndex],
-                           channelParams->m_rayZoaRadian[nIndex][mIndex]),
+                auto [rxFieldPatternPhi, rxFieldPatternTheta] = uAntenna.GetElementFieldPattern(
+                    Angles(channelParams.m_rayAoaRadian[nIndex][mIndex],
+                           channelParams.m_rayZoaRadian[nIndex][mIndex]),
                     polUa);
-                for (uint8_t polSa = 0; polSa < sAntenna->GetNumPols(); ++polSa)
+                for (uint8_t polSa = 0; polSa < numPolsS; ++polSa)
                 {
-                    auto [txFieldPatternPhi, txFieldPatternTheta] =
-                        sAntenna->GetElementFieldPattern(
-                            Angles(channelParams->m_rayAodRadian[nIndex][mIndex],
-                                   channelParams->m_rayZodRadian[nIndex][mIndex]),
-                            polSa);
-                    raysPreComp[std::make_pair(polSa, polUa)](nIndex, mIndex) =
+                    auto [txFieldPatternPhi, txFieldPatternTheta] = sAntenna.GetElementFieldPattern(
+                        Angles(channelParams.m_rayAodRadian[nIndex][mIndex],
+                               channelParams.m_rayZodRadian[nIndex][mIndex]),
+                        polSa);
+                    raysPreComp[polSa * numPolsU + polUa][rayIndex] =
                         std::complex<double>(cos(initialPhase[0]), sin(initialPhase[0])) *
                             rxFieldPatternTheta * txFieldPatternTheta +
                         std::complex<double>(cos(initialPhase[1]), sin(initialPhase[1])) *
@@ -2020,60 +2258,75 @@ ThreeGppChannelModel::GetNewChannel(Ptr<const ThreeGppChannelParams> channelPara
             double sinRayZoa = sin(rayZoaRadian[nIndex][mIndex]);
             double sinRayAoa = sin(rayAoaRadian[nIndex][mIndex]);
             double cosRayAoa = cos(rayAoaRadian[nIndex][mIndex]);
-            sinCosA[nIndex][mIndex] = sinRayZoa * cosRayAoa;
-            sinSinA[nIndex][mIndex] = sinRayZoa * sinRayAoa;
-            cosZoA[nIndex][mIndex] = cos(rayZoaRadian[nIndex][mIndex]);
+            sinCosA[rayIndex] = sinRayZoa * cosRayAoa;
+            sinSinA[rayIndex] = sinRayZoa * sinRayAoa;
+            cosZoA[rayIndex] = cos(rayZoaRadian[nIndex][mIndex]);
 
             // cache the component of the "txPhaseDiff" terms which depend on the random angle of
             // departure only
             double sinRayZod = sin(rayZodRadian[nIndex][mIndex]);
             double sinRayAod = sin(rayAodRadian[nIndex][mIndex]);
             double cosRayAod = cos(rayAodRadian[nIndex][mIndex]);
-            sinCosD[nIndex][mIndex] = sinRayZod * cosRayAod;
-            sinSinD[nIndex][mIndex] = sinRayZod * sinRayAod;
-            cosZoD[nIndex][mIndex] = cos(rayZodRadian[nIndex][mIndex]);
+            sinCosD[rayIndex] = sinRayZod * cosRayAod;
+            sinSinD[rayIndex] = sinRayZod * sinRayAod;
+            cosZoD[rayIndex] = cos(rayZodRadian[nIndex][mIndex]);
         }
     }
 
+    // cache the location and the polarization of the antenna elements
+    std::vector<Vector> uLocs(uSize);
+    std::vector<uint8_t> uPols(uSize);
+    for (size_t uIndex = 0; uIndex < uSize; uIndex++)
+    {
+        uLocs[uIndex] = uAntenna.GetElementLocation(uIndex);
+        uPols[uIndex] = uAntenna.GetElemPol(uIndex);
+    }
+    std::vector<Vector> sLocs(sSize);
+    std::vector<uint8_t> sPols(sSize);
+    for (size_t sIndex = 0; sIndex < sSize; sIndex++)
+    {
+        sLocs[sIndex] = sAntenna.GetElementLocation(sIndex);
+        sPols[sIndex] = sAntenna.GetElemPol(sIndex);
+    }
+
     // The following for loops computes the channel coefficients
     // Keeps track of how many sub-clusters have been added up to now
     uint8_t numSubClustersAdded = 0;
-    for (uint8_t nIndex = 0; nIndex < channelParams->m_reducedClusterNumber; nIndex++)
+    for (uint8_t nIndex = 0; nIndex < channelParams.m_reducedClusterNumber; nIndex++)
     {
+        const size_t firstRay = nIndex * numRays;
         for (size_t uIndex = 0; uIndex < uSize; uIndex++)
         {
-            Vector uLoc = uAntenna->GetElementLocation(uIndex);
+            const Vector& uLoc = uLocs[uIndex];
 
             for (size_t sIndex = 0; sIndex < sSize; sIndex++)
             {
-                Vector sLoc = sAntenna->GetElementLocation(sIndex);
+                const Vector& sLoc = sLocs[sIndex];
+                const auto& raysPol = raysPreComp[sPols[sIndex] * numPolsU + uPols[uIndex]];
                 // Compute the N-2 weakest cluster, assuming 0 slant angle and a
                 // polarization slant angle configured in the array (7.5-22)
-                if (nIndex != channelParams->m_cluster1st && nIndex != channelParams->m_cluster2nd)
+                if (nIndex != channelParams.m_cluster1st && nIndex != channelParams.m_cluster2nd)
                 {
                     std::complex<double> rays(0, 0);
-                    for (uint8_t mIndex = 0; mIndex < table3gpp->m_raysPerCluster; mIndex++)
+                    for (size_t rayIndex = firstRay; rayIndex < firstRay + numRays; rayIndex++)
                     {
                         // lambda_0 is accounted in the antenna spacing uLoc and sLoc.
                         double rxPhaseDiff =
                             2 * M_PI *
-                            (sinCosA[nIndex][mIndex] * uLoc.x + sinSinA[nIndex][mIndex] * uLoc.y +
-                             cosZoA[nIndex][mIndex] * uLoc.z);
+                            (sinCosA[rayIndex] * uLoc.x + sinSinA[rayIndex] * uLoc.y +
+                             cosZoA[rayIndex] * uLoc.z);
 
                         double txPhaseDiff =
                             2 * M_PI *
-                            (sinCosD[nIndex][mIndex] * sLoc.x + sinSinD[nIndex][mIndex] * sLoc.y +
-                             cosZoD[nIndex][mIndex] * sLoc.z);
+                            (sinCosD[rayIndex] * sLoc.x + sinSinD[rayIndex] * sLoc.y +
+                             cosZoD[rayIndex] * sLoc.z);
                         // NOTE Doppler is computed in the CalcBeamformingGain function and is
                         // simplified to only account for the center angle of each cluster.
-                        rays += raysPreComp[std::make_pair(sAntenna->GetElemPol(sIndex),
-                                                           uAntenna->GetElemPol(uIndex))](nIndex,
-                                                                                          mIndex) *
+                        rays += raysPol[rayIndex] *
                                 std::complex<double>(cos(rxPhaseDiff), sin(rxPhaseDiff)) *
                                 std::complex<double>(cos(txPhaseDiff), sin(txPhaseDiff));
                     }
-                    rays *=
-                        sqrt(channelParams->m_clusterPower[nIndex] / table3gpp->m_raysPerCluster);
+                    rays *= sqrt(channelParams.m_clusterPower[nIndex] / numRays);
                     hUsn(uIndex, sIndex, nIndex) = rays;
                 }
                 else //(7.5-28)
@@ -2082,24 +2335,23 @@ ThreeGppChannelModel::GetNewChannel(Ptr<const ThreeGppChannelParams> channelPara
                     std::complex<double> raysSub2(0, 0);
                     std::complex<double> raysSub3(0, 0);
 
-                    for (uint8_t mIndex = 0; mIndex < table3gpp->m_raysPerCluster; mIndex++)
+                    for (uint8_t mIndex = 0; mIndex < numRays; mIndex++)
                     {
+                        const size_t rayIndex = firstRay + mIndex;
                         // ZML:Just remind me that the angle offsets for the 3 subclusters were not
                         // generated correctly.
                         double rxPhaseDiff =
                             2 * M_PI *
-                            (sinCosA[nIndex][mIndex] * uLoc.x + sinSinA[nIndex][mIndex] * uLoc.y +
-                             cosZoA[nIndex][mIndex] * uLoc.z);
+                            (sinCosA[rayIndex] * uLoc.x + sinSinA[rayIndex] * uLoc.y +
+                             cosZoA[rayIndex] * uLoc.z);
 
                         double txPhaseDiff =
                             2 * M_PI *
-                            (sinCosD[nIndex][mIndex] * sLoc.x + sinSinD[nIndex][mIndex] * sLoc.y +
-                             cosZoD[nIndex][mIndex] * sLoc.z);
+                            (sinCosD[rayIndex] * sLoc.x + sinSinD[rayIndex] * sLoc.y +
+                             cosZoD[rayIndex] * sLoc.z);
 
                         std::complex<double> raySub =
-                            raysPreComp[std::make_pair(sAntenna->GetElemPol(sIndex),
-                                                       uAntenna->GetElemPol(uIndex))](nIndex,
-                                                                                      mIndex) *
+                            raysPol[rayIndex] *
                             std::complex<double>(cos(rxPhaseDiff), sin(rxPhaseDiff)) *
                             std::complex<double>(cos(txPhaseDiff), sin(txPhaseDiff));
 
@@ -2124,30 +2376,25 @@ ThreeGppChannelModel::GetNewChannel(Ptr<const ThreeGppChannelParams> channelPara
                             break;
                         }
                     }
-                    raysSub1 *=
-                        sqrt(channelParams->m_clusterPower[nIndex] / table3gpp->m_raysPerCluster);
-                    raysSub2 *=
-                        sqrt(channelParams->m_clusterPower[nIndex] / table3gpp->m_raysPerCluster);
-                    raysSub3 *=
-                        sqrt(channelParams->m_clusterPower[nIndex] / table3gpp->m_raysPerCluster);
+                    raysSub1 *= sqrt(channelParams.m_clusterPower[nIndex] / numRays);
+                    raysSub2 *= sqrt(channelParams.m_clusterPower[nIndex] / numRays);
+                    raysSub3 *= sqrt(channelParams.m_clusterPower[nIndex] / numRays);
                     hUsn(uIndex, sIndex, nIndex) = raysSub1;
+                    hUsn(uIndex, sIndex, channelParams.m_reducedClusterNumber + numSubClustersAdded) =
+                        raysSub2;
                     hUsn(uIndex,
                          sIndex,
-                         channelParams->m_reducedClusterNumber + numSubClustersAdded) = raysSub2;
-                    hUsn(uIndex,
-                         sIndex,
-                         channelParams->m_reducedClusterNumber + numSubClustersAdded + 1) =
-                        raysSub3;
+                         channelParams.m_reducedClusterNumber + numSubClustersAdded + 1) = raysSub3;
                 }
             }
         }
-        if (nIndex == channelParams->m_cluster1st || nIndex == channelParams->m_cluster2nd)
+        if (nIndex == channelParams.m_cluster1st || nIndex == channelParams.m_cluster2nd)
         {
             numSubClustersAdded += 2;
         }
     }
 
-    if (channelParams->m_losCondition == ChannelCondition::LOS) //(7.5-29) && (7.5-30)
+    if (channelParams.m_losCondition == ChannelCondition::LOS) //(7.5-29) && (7.5-30)
     {
         double lambda = 3.0e8 / m_frequency; // the wavelength of the carrier frequency
         std::complex<double> phaseDiffDueToDistance(cos(-2 * M_PI * distance3D / lambda),
@@ -2161,29 +2408,30 @@ ThreeGppChannelModel::GetNewChannel(Ptr<const ThreeGppChannelParams> channelPara
         const double cosSAngleIncl = cos(sAngle.GetInclination());
         const double sinSAngleAz = sin(sAngle.GetAzimuth());
         const double cosSAngleAz = cos(sAngle.GetAzimuth());
+        const double kLinear = pow(10, channelParams.m_K_factor / 10.0);
 
         for (size_t uIndex = 0; uIndex < uSize; uIndex++)
         {
-            Vector uLoc = uAntenna->GetElementLocation(uIndex);
+            const Vector& uLoc = uLocs[uIndex];
             double rxPhaseDiff = 2 * M_PI *
                                  (sinUAngleIncl * cosUAngleAz * uLoc.x +
                                   sinUAngleIncl * sinUAngleAz * uLoc.y + cosUAngleIncl * uLoc.z);
+            auto [rxFieldPatternPhi, rxFieldPatternTheta] = uAntenna.GetElementFieldPattern(
+                Angles(uAngle.GetAzimuth(), uAngle.GetInclination()),
+                uPols[uIndex]);
 
             for (size_t sIndex = 0; sIndex < sSize; sIndex++)
             {
-                Vector sLoc = sAntenna->GetElementLocation(sIndex);
+                const Vector& sLoc = sLocs[sIndex];
                 std::complex<double> ray(0, 0);
                 double txPhaseDiff =
                     2 * M_PI *
                     (sinSAngleIncl * cosSAngleAz * sLoc.x + sinSAngleIncl * sinSAngleAz * sLoc.y +
                      cosSAngleIncl * sLoc.z);
 
-                auto [rxFieldPatternPhi, rxFieldPatternTheta] = uAntenna->GetElementFieldPattern(
-                    Angles(uAngle.GetAzimuth(), uAngle.GetInclination()),
-                    uAntenna->GetElemPol(uIndex));
-                auto [txFieldPatternPhi, txFieldPatternTheta] = sAntenna->GetElementFieldPattern(
+                auto [txFieldPatternPhi, txFieldPatternTheta] = sAntenna.GetElementFieldPattern(
                     Angles(sAngle.GetAzimuth(), sAngle.GetInclination()),
-                    sAntenna->GetElemPol(sIndex));
+                    sPols[sIndex]);
 
                 ray = (rxFieldPatternTheta * txFieldPatternTheta -
                        rxFieldPatternPhi * txFieldPatternPhi) *
@@ -2191,13 +2439,12 @@ ThreeGppChannelModel::GetNewChannel(Ptr<const ThreeGppChannelParams> channelPara
                       std::complex<double>(cos(rxPhaseDiff), sin(rxPhaseDiff)) *
                       std::complex<double>(cos(txPhaseDiff), sin(txPhaseDiff));
 
-                double kLinear = pow(10, channelParams->m_K_factor / 10.0);
                 // the LOS path should be attenuated if blockage is enabled.
                 hUsn(uIndex, sIndex, 0) =
                     sqrt(1.0 / (kLinear + 1)) * hUsn(uIndex, sIndex, 0) +
                     sqrt(kLinear / (1 + kLinear)) * ray /
                         pow(10,
-                            channelParams->m_attenuation_dB[0] / 10.0); //(7.5-30) for tau = tau1
+                            channelParams.m_attenuation_dB[0] / 10.0); //(7.5-30) for tau = tau1
                 for (size_t nIndex = 1; nIndex < hUsn.GetNumPages(); nIndex++)
                 {
                     hUsn(uIndex, sIndex, nIndex) *=
@@ -2207,7 +2454,7 @@ ThreeGppChannelModel::GetNewChannel(Ptr<const ThreeGppChannelParams> channelPara
         }
     }
 
-    NS_LOG_DEBUG("Husn (sAntenna, uAntenna):" << sAntenna->GetId() << ", " << uAntenna->GetId());
+    NS_LOG_DEBUG("Husn (sAntenna, uAntenna):" << sAntenna.GetId() << ", " << uAntenna.GetId());
     for (size_t cIndex = 0; cIndex < hUsn.GetNumPages(); cIndex++)
     {
         for (size_t rowIdx = 0; rowIdx < hUsn.GetNumRows(); rowIdx++)
@@ -2226,6 +2473,412 @@ ThreeGppChannelModel::GetNewChannel(Ptr<const ThreeGppChannelParams> channelPara
     return channelMatrix;
 }
 
+/**
+ * Append the bytes of a value to a key or record of the channel cache file
+ * \param buffer the key or record
+ * \param value the value
+ */
+template <class T>
+static void
+CacheAppend(std::string& buffer, const T& value)
+{
+    static_assert(std::is_trivially_copyable_v<T>, "The value must be trivially copyable");
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+/**
+ * Append a pair of values to a key or record of the channel cache file
+ * \param buffer the key or record
+ * \param values the values
+ */
+template <class T, class U>
+static void
+CacheAppend(std::string& buffer, const std::pair<T, U>& values)
+{
+    CacheAppend(buffer, values.first);
+    CacheAppend(buffer, values.second);
+}
+
+/**
+ * Append a vector of values, and its size, to a record of the channel cache file
+ * \param buffer the record
+ * \param values the values
+ */
+template <class T>
+static void
+CacheAppend(std::string& buffer, const std::vector<T>& values)
+{
+    CacheAppend(buffer, static_cast<uint64_t>(values.size()));
+    for (const auto& value : values)
+    {
+        CacheAppend(buffer, value);
+    }
+}
+
+/**
+ * Append a matrix array, and its dimensions, to a record of the channel cache file
+ * \param buffer the record
+ * \param values the matrix array
+ */
+static void
+CacheAppend(std::string& buffer, const ComplexMatrixArray& values)
+{
+    CacheAppend(buffer, static_cast<uint64_t>(values.GetNumRows()));
+    CacheAppend(buffer, static_cast<uint64_t>(values.GetNumCols()));
+    CacheAppend(buffer, static_cast<uint64_t>(values.GetNumPages()));
+    if (values.GetSize() > 0)
+    {
+        buffer.append(reinterpret_cast<const char*>(values.GetPagePtr(0)),
+                      values.GetSize() * sizeof(std::complex<double>));
+    }
+}
+
+/**
+ * Extract a value from the front of a record of the channel cache file
+ * \param record the rest of the record
+ * \param value the value
+ */
+template <class T>
+static void
+CacheExtract(std::string_view& record, T& value)
+{
+    static_assert(std::is_trivially_copyable_v<T>, "The value must be trivially copyable");
+    NS_ABORT_MSG_IF(record.size() < sizeof(T), "Corrupted record in the channel cache file");
+    std::memcpy(&value, record.data(), sizeof(T));
+    record.remove_prefix(sizeof(T));
+}
+
+/**
+ * Extract a pair of values from the front of a record of the channel cache file
+ * \param record the rest of the record
+ * \param values the values
+ */
+template <class T, class U>
+static void
+CacheExtract(std::string_view& record, std::pair<T, U>& values)
+{
+    CacheExtract(record, values.first);
+    CacheExtract(record, values.second);
+}
+
+/**
+ * Extract a vector of values from the front of a record of the channel cache file
+ * \param record the rest of the record
+ * \param values the values
+ */
+template <class T>
+static void
+CacheExtract(std::string_view& record, std::vector<T>& values)
+{
+    uint64_t size;
+    CacheExtract(record, size);
+    NS_ABORT_MSG_IF(size > record.size(), "Corrupted record in the channel cache file");
+    values.resize(size);
+    for (auto& value : values)
+    {
+        CacheExtract(record, value);
+    }
+}
+
+/**
+ * Extract a matrix array from the front of a record of the channel cache file
+ * \param record the rest of the record
+ * \param values the matrix array
+ */
+static void
+CacheExtract(std::string_view& record, ComplexMatrixArray& values)
+{
+    uint64_t numRows;
+    uint64_t numCols;
+    uint64_t numPages;
+    CacheExtract(record, numRows);
+    CacheExtract(record, numCols);
+    CacheExtract(record, numPages);
+    size_t size = numRows * numCols * numPages;
+    NS_ABORT_MSG_IF(record.size() / sizeof(std::complex<double>) < size,
+                    "Corrupted record in the channel cache file");
+    std::valarray<std::complex<double>> elements(size);
+    std::memcpy(&elements[0], record.data(), size * sizeof(std::complex<double>));
+    record.remove_prefix(size * sizeof(std::complex<double>));
+    values = ComplexMatrixArray(numRows, numCols, numPages, std::move(elements));
+}
+
+/**
+ * Apply a function to the fields of the channel parameters that are saved in the
+ * channel cache file
+ * \param params the channel parameters
+ * \param f the function
+ */
+template <class Params, class F>
+static void
+ForEachCachedParam(Params& params, F&& f)
+{
+    f(params.m_nodeIds);
+    f(params.m_losCondition);
+    f(params.m_o2iCondition);
+    f(params.m_delay);
+    f(params.m_angle);
+    f(params.m_cachedAngleSincos);
+    f(params.m_alpha);
+    f(params.m_D);
+    f(params.m_nonSelfBlocking);
+    f(params.m_preLocUT);
+    f(params.m_locUT);
+    f(params.m_norRvAngles);
+    f(params.m_DS);
+    f(params.m_K_factor);
+    f(params.m_reducedClusterNumber);
+    f(params.m_rayAodRadian);
+    f(params.m_rayAoaRadian);
+    f(params.m_rayZodRadian);
+    f(params.m_rayZoaRadian);
+    f(params.m_clusterPhase);
+    f(params.m_crossPolarizationPowerRatios);
+    f(params.m_speed);
+    f(params.m_dis2D);
+    f(params.m_dis3D);
+    f(params.m_clusterPower);
+    f(params.m_attenuation_dB);
+    f(params.m_cluster1st);
+    f(params.m_cluster2nd);
+}
+
+/**
+ * Get the hash of the properties of an antenna array that determine the channel
+ * matrix: the elements, their locations, polarizations and field patterns, and the
+ * ports
+ * \param antenna the antenna array
+ * \return the hash
+ */
+static uint64_t
+GetAntennaHash(const PhasedArrayModel& antenna)
+{
+    std::string buffer = antenna.GetInstanceTypeId().GetName();
+    CacheAppend(buffer, antenna.GetNumElems());
+    CacheAppend(buffer, antenna.GetNumRows());
+    CacheAppend(buffer, antenna.GetNumColumns());
+    CacheAppend(buffer, antenna.GetNumVerticalPorts());
+    CacheAppend(buffer, antenna.GetNumHorizontalPorts());
+    CacheAppend(buffer, antenna.GetNumPols());
+    CacheAppend(buffer, antenna.GetPolSlant());
+    for (size_t i = 0; i < antenna.GetNumElems(); i++)
+    {
+        CacheAppend(buffer, antenna.GetElementLocation(i));
+        CacheAppend(buffer, antenna.GetElemPol(i));
+    }
+    // sample the field pattern, which includes the orientation of the array
+    for (double azimuth = -M_PI + M_PI / 6; azimuth < M_PI; azimuth += M_PI / 3)
+    {
+        for (double inclination = M_PI / 6; inclination < M_PI; inclination += M_PI / 3)
+        {
+            for (uint8_t pol = 0; pol < antenna.GetNumPols(); pol++)
+            {
+                CacheAppend(buffer,
+                            antenna.GetElementFieldPattern(Angles(azimuth, inclination), pol));
+            }
+        }
+    }
+    return Hash64(buffer);
+}
+
+uint64_t
+ThreeGppChannelModel::GetConfigurationHash() const
+{
+    NS_LOG_FUNCTION(this);
+
+    std::string buffer = GetInstanceTypeId().GetName();
+    TypeId tid = GetInstanceTypeId();
+    do
+    {
+        for (uint32_t i = 0; i < tid.GetAttributeN(); i++)
+        {
+            const auto& info = tid.GetAttribute(i);
+            if (info.name == "CacheFile" || !(info.flags & TypeId::ATTR_GET) ||
+                !info.accessor->HasGetter())
+            {
+                continue;
+            }
+            // the objects pointed to are not part of the configuration; the channel
+            // condition is part of the keys of the realizations
+            Ptr<AttributeValue> value = info.checker->Create();
+            if (DynamicCast<PointerValue>(value))
+            {
+                continue;
+            }
+            info.accessor->Get(this, *value);
+            buffer += info.name + "=" + value->SerializeToString(info.checker) + ";";
+        }
+        tid = tid.GetParent();
+    } while (tid != ObjectBase::GetTypeId());
+
+    // the attributes of type double are serialized with a limited precision
+    CacheAppend(buffer, m_frequency);
+    CacheAppend(buffer, m_blockerSpeed);
+    CacheAppend(buffer, m_vScatt);
+    CacheAppend(buffer, RngSeedManager::GetSeed());
+    CacheAppend(buffer, RngSeedManager::GetRun());
+    CacheAppend(buffer, m_normalRv->GetStream());
+    CacheAppend(buffer, m_uniformRv->GetStream());
+    CacheAppend(buffer, m_uniformRvShuffle->GetStream());
+    CacheAppend(buffer, m_uniformRvDoppler->GetStream());
+    return Hash64(buffer);
+}
+
+Ptr<ThreeGppChannelModel::ThreeGppChannelParams>
+ThreeGppChannelModel::LoadOrGenerateChannelParameters(
+    const Ptr<const ChannelCondition> channelCondition,
+    const Ptr<const ParamsTable> table3gpp,
+    const Ptr<const MobilityModel> aMob,
+    const Ptr<const MobilityModel> bMob,
+    const Ptr<const ThreeGppChannelParams> previous) const
+{
+    NS_LOG_FUNCTION(this);
+
+    uint32_t generation = previous ? previous->m_generation + 1 : 0;
+    if (!m_cache)
+    {
+        Ptr<ThreeGppChannelParams> channelParams =
+            GenerateChannelParameters(channelCondition, table3gpp, aMob, bMob);
+        channelParams->m_generation = generation;
+        return channelParams;
+    }
+
+    if (!m_configurationHash)
+    {
+        m_configurationHash = GetConfigurationHash();
+    }
+    std::string key("P");
+    CacheAppend(key, *m_configurationHash);
+    CacheAppend(key, aMob->GetObject<Node>()->GetId());
+    CacheAppend(key, bMob->GetObject<Node>()->GetId());
+    CacheAppend(key, aMob->GetPosition());
+    CacheAppend(key, bMob->GetPosition());
+    CacheAppend(key, channelCondition->GetLosCondition());
+    CacheAppend(key, channelCondition->GetO2iCondition());
+    CacheAppend(key, generation);
+
+    Ptr<ThreeGppChannelParams> channelParams;
+    std::string_view record;
+    if (m_cache->Find(key, record))
+    {
+        NS_LOG_DEBUG("channel params read from the cache file");
+        channelParams = Create<ThreeGppChannelParams>();
+        ForEachCachedParam(*channelParams, [&record](auto& field) {
+            CacheExtract(record, field);
+        });
+        DrawCounts draws;
+        CacheExtract(record, draws.m_normal);
+        CacheExtract(record, draws.m_uniform);
+        CacheExtract(record, draws.m_shuffle);
+        CacheExtract(record, draws.m_doppler);
+        NS_ABORT_MSG_IF(!record.empty(), "Corrupted record in the channel cache file");
+        channelParams->m_generatedTime = Simulator::Now();
+
+        // draw the values drawn by the generation of the parameters, so that the
+        // next realizations are those of a run without the cache file
+        for (uint64_t i = 0; i < draws.m_normal; i++)
+        {
+            m_normalRv->GetValue();
+        }
+        for (uint64_t i = 0; i < draws.m_uniform; i++)
+        {
+            m_uniformRv->GetValue();
+        }
+        for (uint64_t i = 0; i < draws.m_shuffle; i++)
+        {
+            m_uniformRvShuffle->GetValue();
+        }
+        for (uint64_t i = 0; i < draws.m_doppler; i++)
+        {
+            m_uniformRvDoppler->GetValue();
+        }
+    }
+    else
+    {
+        m_draws = DrawCounts();
+        channelParams = GenerateChannelParameters(channelCondition, table3gpp, aMob, bMob);
+        std::string data;
+        ForEachCachedParam(std::as_const(*channelParams), [&data](const auto& field) {
+            CacheAppend(data, field);
+        });
+        CacheAppend(data, m_draws.m_normal);
+        CacheAppend(data, m_draws.m_uniform);
+        CacheAppend(data, m_draws.m_shuffle);
+        CacheAppend(data, m_draws.m_doppler);
+        m_cache->Add(key, data);
+    }
+    channelParams->m_generation = generation;
+    channelParams->m_cacheKey = key;
+    return channelParams;
+}
+
+std::string
+ThreeGppChannelModel::GetChannelMatrixCacheKey(const ThreeGppChannelParams& channelParams,
+                                               const Vector& sPos,
+                                               const Vector& uPos,
+                                               std::pair<uint32_t, uint32_t> nodeIds,
+                                               const PhasedArrayModel& sAntenna,
+                                               const PhasedArrayModel& uAntenna) const
+{
+    std::string key("M");
+    CacheAppend(key, static_cast<uint64_t>(channelParams.m_cacheKey.size()));
+    key += channelParams.m_cacheKey;
+    CacheAppend(key, nodeIds);
+    CacheAppend(key, sPos);
+    CacheAppend(key, uPos);
+    CacheAppend(key, GetAntennaHash(sAntenna));
+    CacheAppend(key, GetAntennaHash(uAntenna));
+    return key;
+}
+
+Ptr<MatrixBasedChannelModel::ChannelMatrix>
+ThreeGppChannelModel::LoadChannelMatrix(const ThreeGppChannelParams& channelParams,
+                                        const Vector& sPos,
+                                        const Vector& uPos,
+                                        std::pair<uint32_t, uint32_t> nodeIds,
+                                        const PhasedArrayModel& sAntenna,
+                                        const PhasedArrayModel& uAntenna) const
+{
+    NS_LOG_FUNCTION(this);
+
+    std::string_view record;
+    if (!m_cache || channelParams.m_cacheKey.empty() ||
+        !m_cache->Find(
+            GetChannelMatrixCacheKey(channelParams, sPos, uPos, nodeIds, sAntenna, uAntenna),
+            record))
+    {
+        return nullptr;
+    }
+    NS_LOG_DEBUG("channel matrix read from the cache file");
+    Ptr<ChannelMatrix> channelMatrix = Create<ChannelMatrix>();
+    CacheExtract(record, channelMatrix->m_channel);
+    NS_ABORT_MSG_IF(!record.empty(), "Corrupted record in the channel cache file");
+    channelMatrix->m_generatedTime = Simulator::Now();
+    channelMatrix->m_nodeIds = nodeIds;
+    return channelMatrix;
+}
+
+void
+ThreeGppChannelModel::SaveChannelMatrix(const ThreeGppChannelParams& channelParams,
+                                        const Vector& sPos,
+                                        const Vector& uPos,
+                                        std::pair<uint32_t, uint32_t> nodeIds,
+                                        const PhasedArrayModel& sAntenna,
+                                        const PhasedArrayModel& uAntenna,
+                                        const ChannelMatrix& channelMatrix) const
+{
+    NS_LOG_FUNCTION(this);
+
+    if (!m_cache || channelParams.m_cacheKey.empty())
+    {
+        return;
+    }
+    std::string data;
+    CacheAppend(data, channelMatrix.m_channel);
+    m_cache->Add(GetChannelMatrixCacheKey(channelParams, sPos, uPos, nodeIds, sAntenna, uAntenna),
+                 data);
+}
+
 std::pair<double, double>
 ThreeGppChannelModel::WrapAngles(double azimuthRad, double inclinationRad)
 {
@@ -2285,18 +2938,18 @@ ThreeGppChannelModel::CalcAttenuationOfBlockage(
         {
             // draw value from table 7.6.4.1-2 Blocking region parameters
             DoubleVector table;
-            table.push_back(m_normalRv->GetValue()); // phi_k: store the normal RV that will be
+            table.push_back(DrawNormal()); // phi_k: store the normal RV that will be
                                                      // mapped to uniform (0,360) later.
             if (m_scenario == "InH-OfficeMixed" || m_scenario == "InH-OfficeOpen")
             {
-                table.push_back(m_uniformRv->GetValue(15, 45)); // x_k
+                table.push_back(DrawUniform(15, 45)); // x_k
                 table.push_back(90);                            // Theta_k
-                table.push_back(m_uniformRv->GetValue(5, 15));  // y_k
+                table.push_back(DrawUniform(5, 15));  // y_k
                 table.push_back(2);                             // r
             }
             else
             {
-                table.push_back(m_uniformRv->GetValue(5, 15)); // x_k
+                table.push_back(DrawUniform(5, 15)); // x_k
                 table.push_back(90);                           // Theta_k
                 table.push_back(5);                            // y_k
                 table.push_back(10);                           // r
@@ -2366,7 +3019,7 @@ ThreeGppChannelModel::CalcAttenuationOfBlockage(
                 // Generate a new correlated normal RV with the following formula
                 channelParams->m_nonSelfBlocking[blockInd][PHI_INDEX] =
                     R * channelParams->m_nonSelfBlocking[blockInd][PHI_INDEX] +
-                    sqrt(1 - R * R) * m_normalRv->GetValue();
+                    sqrt(1 - R * R) * DrawNormal();
             }
         }
     }
@@ -2503,6 +3156,7 @@ ThreeGppChannelModel::Shuffle(double* first, double* last) const
 {
     for (auto i = (last - first) - 1; i > 0; --i)
     {
+        m_draws.m_shuffle++;
         std::swap(first[i], first[m_uniformRvShuffle->GetInteger(0, i)]);
     }
 }
@@ -2515,7 +3169,29 @@ ThreeGppChannelModel::AssignStreams(int64_t stream)
     m_uniformRv->SetStream(stream + 1);
     m_uniformRvShuffle->SetStream(stream + 2);
     m_uniformRvDoppler->SetStream(stream + 3);
+    m_configurationHash.reset();
     return 4;
 }
 
+double
+ThreeGppChannelModel::DrawNormal() const
+{
+    m_draws.m_normal++;
+    return m_normalRv->GetValue();
+}
+
+double
+ThreeGppChannelModel::DrawUniform(double min, double max) const
+{
+    m_draws.m_uniform++;
+    return m_uniformRv->GetValue(min, max);
+}
+
+double
+ThreeGppChannelModel::DrawDoppler(double min, double max) const
+{
+    m_draws.m_doppler++;
+    return m_uniformRvDoppler->GetValue(min, max);
+}
+
 } // namespace ns3
@@ -22,12 +22,16 @@
 #define THREE_GPP_CHANNEL_H
 
 #include "matrix-based-channel-model.h"
+#include "three-gpp-channel-cache.h"
 
 #include "ns3/angles.h"
 #include <ns3/boolean.h>
 #include <ns3/channel-condition-model.h>
+#include <ns3/event-id.h>
 
 #include <complex.h>
+#include <map>
+#include <optional>
 #include <unordered_map>
 
 namespace ns3
@@ -42,6 +46,29 @@ class MobilityModel;
  * The class implements the channel matrix generation procedure
  * described in 3GPP TR 38.901.
  *
+ * By default, a channel is generated when it is first requested with
+ * GetChannel, and regenerated when it is requested after UpdatePeriod. With
+ * the attribute BulkUpdate, the channels requested so far are all regenerated
+ * at the multiples of UpdatePeriod instead. The new parameters are drawn on
+ * the simulator thread, in the order of the antenna pair keys, and then the
+ * channel matrices are computed on BulkUpdateThreads threads, so the result
+ * does not depend on the number of threads. Subclasses that override
+ * GetNewChannel must leave BulkUpdate disabled.
+ *
+ * With the attribute CacheFile, the channel parameters and matrices are also
+ * saved in a ThreeGppChannelCache file, and later runs read them from the file
+ * instead of generating them again. A realization is keyed by the nodes, their
+ * positions and channel condition, the number of realizations generated
+ * before it for the same nodes, the antenna arrays, the attributes of the
+ * model, and the seed, run and streams of its random variables. The runs that
+ * repeat a static scenario with the same configuration thus get the same
+ * channels without generating them. The configuration is read when the first
+ * realization is looked up in the file. The record of the parameters also
+ * holds the number of values drawn from each random variable to generate
+ * them, and the same number of values is drawn again when the record is
+ * read, so a run gets the realizations of the same run without the file,
+ * whichever of them are found in the file.
+ *
  * \see GetChannel
  */
 class ThreeGppChannelModel : public MatrixBasedChannelModel
@@ -137,6 +164,18 @@ class ThreeGppChannelModel : public MatrixBasedChannelModel
      */
     int64_t AssignStreams(int64_t stream);
 
+    /**
+     * Set the file that caches the channel realizations
+     * \param fileName the name of the file, empty to disable the cache
+     */
+    void SetCacheFile(const std::string& fileName);
+
+    /**
+     * Get the file that caches the channel realizations
+     * \return the name of the file, empty if the cache is disabled
+     */
+    std::string GetCacheFile() const;
+
   protected:
     /**
      * Wrap an (azimuth, inclination) angle pair in a valid range.
@@ -202,6 +241,8 @@ class ThreeGppChannelModel : public MatrixBasedChannelModel
         DoubleVector m_attenuation_dB;      //!< vector that stores the attenuation of the blockage
         uint8_t m_cluster1st;               //!< index of the first strongest cluster
         uint8_t m_cluster2nd;               //!< index of the second strongest cluster
+        uint32_t m_generation{0};           //!< parameters generated before for the same nodes
+        std::string m_cacheKey;             //!< key of the parameters in the channel cache file
     };
 
     /**
@@ -304,6 +345,142 @@ class ThreeGppChannelModel : public MatrixBasedChannelModel
                                              const Ptr<const MobilityModel> uMob,
                                              Ptr<const PhasedArrayModel> sAntenna,
                                              Ptr<const PhasedArrayModel> uAntenna) const;
+
+    /**
+     * Compute the channel matrix between two antenna arrays s and u, as
+     * GetNewChannel does. It does not touch the mobility models, the reference
+     * counts or the state of the model, so it can be called concurrently.
+     * \param channelParams the channel parameters previously generated for the pair of
+     * nodes s and u
+     * \param table3gpp the 3gpp parameters table
+     * \param sPos the position of node s
+     * \param uPos the position of node u
+     * \param nodeIds the ids of the nodes s and u
+     * \param sAntenna the antenna array of node s
+     * \param uAntenna the antenna array of node u
+     * \param generatedTime the generation time of the channel
+     * \return the channel realization
+     */
+    Ptr<ChannelMatrix> GenerateChannelMatrix(const ThreeGppChannelParams& channelParams,
+                                             const ParamsTable& table3gpp,
+                                             const Vector& sPos,
+                                             const Vector& uPos,
+                                             std::pair<uint32_t, uint32_t> nodeIds,
+                                             const PhasedArrayModel& sAntenna,
+                                             const PhasedArrayModel& uAntenna,
+                                             Time generatedTime) const;
+
+    /**
+     * Read the channel parameters among the nodes a and b from the channel cache
+     * file or, if they are not there, generate them with GenerateChannelParameters
+     * and add them to the file
+     * \param channelCondition the channel condition
+     * \param table3gpp the 3gpp parameters from the table
+     * \param aMob the a node mobility model
+     * \param bMob the b node mobility model
+     * \param previous the parameters previously generated for the nodes, if any
+     * \return the channel parameters
+     */
+    Ptr<ThreeGppChannelParams> LoadOrGenerateChannelParameters(
+        const Ptr<const ChannelCondition> channelCondition,
+        const Ptr<const ParamsTable> table3gpp,
+        const Ptr<const MobilityModel> aMob,
+        const Ptr<const MobilityModel> bMob,
+        const Ptr<const ThreeGppChannelParams> previous) const;
+
+    /**
+     * Read a channel matrix from the channel cache file
+     * \param channelParams the channel parameters of the nodes s and u
+     * \param sPos the position of node s
+     * \param uPos the position of node u
+     * \param nodeIds the ids of the nodes s and u
+     * \param sAntenna the antenna array of node s
+     * \param uAntenna the antenna array of node u
+     * \return the channel realization, or nullptr if it is not in the file
+     */
+    Ptr<ChannelMatrix> LoadChannelMatrix(const ThreeGppChannelParams& channelParams,
+                                         const Vector& sPos,
+                                         const Vector& uPos,
+                                         std::pair<uint32_t, uint32_t> nodeIds,
+                                         const PhasedArrayModel& sAntenna,
+                                         const PhasedArrayModel& uAntenna) const;
+
+    /**
+     * Add a channel matrix to the channel cache file, if there is one
+     * \param channelParams the channel parameters of the nodes s and u
+     * \param sPos the position of node s
+     * \param uPos the position of node u
+     * \param nodeIds the ids of the nodes s and u
+     * \param sAntenna the antenna array of node s
+     * \param uAntenna the antenna array of node u
+     * \param channelMatrix the channel realization
+     */
+    void SaveChannelMatrix(const ThreeGppChannelParams& channelParams,
+                           const Vector& sPos,
+                           const Vector& uPos,
+                           std::pair<uint32_t, uint32_t> nodeIds,
+                           const PhasedArrayModel& sAntenna,
+                           const PhasedArrayModel& uAntenna,
+                           const ChannelMatrix& channelMatrix) const;
+
+    /**
+     * Get the key of a channel matrix in the channel cache file
+     * \param channelParams the channel parameters of the nodes s and u
+     * \param sPos the position of node s
+     * \param uPos the position of node u
+     * \param nodeIds the ids of the nodes s and u
+     * \param sAntenna the antenna array of node s
+     * \param uAntenna the antenna array of node u
+     * \return the key
+     */
+    std::string GetChannelMatrixCacheKey(const ThreeGppChannelParams& channelParams,
+                                         const Vector& sPos,
+                                         const Vector& uPos,
+                                         std::pair<uint32_t, uint32_t> nodeIds,
+                                         const PhasedArrayModel& sAntenna,
+                                         const PhasedArrayModel& uAntenna) const;
+
+    /**
+     * Get the hash of the configuration of the model that determines its
+     * realizations: the attributes, and the seed, run and streams of the
+     * random variables
+     * \return the hash
+     */
+    uint64_t GetConfigurationHash() const;
+
+    /**
+     * Draw a value from m_normalRv, counting it in m_draws
+     * \return the value
+     */
+    double DrawNormal() const;
+
+    /**
+     * Draw a value from m_uniformRv, counting it in m_draws
+     * \param min the lower bound of the value
+     * \param max the upper bound of the value
+     * \return the value
+     */
+    double DrawUniform(double min, double max) const;
+
+    /**
+     * Draw a value from m_uniformRvDoppler, counting it in m_draws
+     * \param min the lower bound of the value
+     * \param max the upper bound of the value
+     * \return the value
+     */
+    double DrawDoppler(double min, double max) const;
+
+    /**
+     * Schedule UpdateAllChannels at the next multiple of the update period
+     */
+    void ScheduleBulkUpdate();
+
+    /**
+     * Regenerate the channel parameters that need an update and the channel
+     * matrices of all the antenna pairs in m_channelPairs, computing the
+     * matrices on m_bulkUpdateThreads threads
+     */
+    void UpdateAllChannels();
     /**
      * Applies the blockage model A described in 3GPP TR 38.901
      * \param channelParams the channel parameters structure
@@ -377,6 +554,44 @@ class ThreeGppChannelModel : public MatrixBasedChannelModel
     bool m_portraitMode;           //!< true if portrait mode, false if landscape
     double m_blockerSpeed;         //!< the blocker speed
 
+    // parameters for the bulk update of the channels
+    /**
+     * The nodes and the antenna arrays of a channel regenerated by UpdateAllChannels
+     */
+    struct ChannelPair
+    {
+        Ptr<const MobilityModel> m_aMob;        //!< mobility model of the a device
+        Ptr<const MobilityModel> m_bMob;        //!< mobility model of the b device
+        Ptr<const PhasedArrayModel> m_aAntenna; //!< antenna of the a device
+        Ptr<const PhasedArrayModel> m_bAntenna; //!< antenna of the b device
+    };
+
+    std::map<uint64_t, ChannelPair>
+        m_channelPairs;             //!< the channels requested with BulkUpdate, with the keys of
+                                    //!< m_channelMatrixMap, in a deterministic order
+    bool m_bulkUpdate;              //!< regenerate all the channels at the multiples of the period
+    uint32_t m_bulkUpdateThreads;   //!< number of threads computing the matrices, 0 for one per
+                                    //!< hardware thread
+    EventId m_bulkUpdateEvent;      //!< the next call to UpdateAllChannels
+    bool m_channelRequested{false}; //!< GetChannel was called since the last UpdateAllChannels
+
+    Ptr<ThreeGppChannelCache> m_cache; //!< the file that caches the realizations, if any
+    mutable std::optional<uint64_t>
+        m_configurationHash; //!< the result of GetConfigurationHash, once it is computed
+
+    /**
+     * The number of values drawn from each random variable
+     */
+    struct DrawCounts
+    {
+        uint64_t m_normal{0};  //!< the values drawn from m_normalRv
+        uint64_t m_uniform{0}; //!< the values drawn from m_uniformRv
+        uint64_t m_shuffle{0}; //!< the values drawn from m_uniformRvShuffle
+        uint64_t m_doppler{0}; //!< the values drawn from m_uniformRvDoppler
+    };
+
+    mutable DrawCounts m_draws; //!< the values drawn by the generation of the channel parameters
+
     static const uint8_t PHI_INDEX = 0; //!< index of the PHI value in the m_nonSelfBlocking array
     static const uint8_t X_INDEX = 1;   //!< index of the X value in the m_nonSelfBlocking array
     static const uint8_t THETA_INDEX =
@@ -111,6 +111,41 @@ ThreeGppSpectrumPropagationLossModel::GetChannelModelAttribute(const std::string
     m_channelModel->GetAttribute(name, value);
 }
 
+/**
+ * \brief Builds the matrix that applies the beamforming weights of each port
+ *
+ * The elements of a port are traversed as in
+ * ThreeGppSpectrumPropagationLossModel::CalculateLongTermComponent, so that the product of
+ * the channel matrix by this matrix gives the same long term component.
+ *
+ * \param ant the antenna array
+ * \return matrix with dimensions #elements, #ports, with the weight of each element of a
+ * port in its column, and zeros for the elements of the other ports
+ */
+static ComplexMatrixArray
+GetPortWeights(const PhasedArrayModel& ant)
+{
+    const PhasedArrayModel::ComplexVector& w = ant.GetBeamformingVectorRef();
+    const auto portElems = ant.GetNumElemsPerPort();
+    const auto hElemsPerPort = ant.GetHElemsPerPort();
+    ComplexMatrixArray weights(ant.GetNumElems(), ant.GetNumPorts());
+    for (uint16_t portIdx = 0; portIdx < ant.GetNumPorts(); portIdx++)
+    {
+        const size_t start = ant.ArrayIndexFromPortIndex(portIdx, 0);
+        auto index = start;
+        for (size_t elemIdx = 0; elemIdx < portElems; elemIdx++, index++)
+        {
+            weights(index, portIdx) = w[index - start];
+            if (elemIdx % hElemsPerPort == hElemsPerPort - 1)
+            {
+                // Increment by a factor to reach next column in a port
+                index += ant.GetNumColumns() - hElemsPerPort;
+            }
+        }
+    }
+    return weights;
+}
+
 Ptr<const MatrixBasedChannelModel::Complex3DVector>
 ThreeGppSpectrumPropagationLossModel::CalcLongTerm(
     Ptr<const MatrixBasedChannelModel::ChannelMatrix> params,
@@ -119,37 +154,27 @@ ThreeGppSpectrumPropagationLossModel::CalcLongTerm(
 {
     NS_LOG_FUNCTION(this);
 
-    const PhasedArrayModel::ComplexVector& sW = sAnt->GetBeamformingVectorRef();
-    const PhasedArrayModel::ComplexVector& uW = uAnt->GetBeamformingVectorRef();
-    size_t sAntNumElems = sW.GetSize();
-    size_t uAntNumElems = uW.GetSize();
+    NS_ASSERT_MSG((sAnt != nullptr) && (uAnt != nullptr), "Improper call to the method");
+    size_t sAntNumElems = sAnt->GetBeamformingVectorRef().GetSize();
+    size_t uAntNumElems = uAnt->GetBeamformingVectorRef().GetSize();
     NS_ASSERT(uAntNumElems == params->m_channel.GetNumRows());
     NS_ASSERT(sAntNumElems == params->m_channel.GetNumCols());
-    NS_LOG_DEBUG("CalcLongTerm with " << uW.GetSize() << " u antenna elements and " << sW.GetSize()
-                                      << " s antenna elements, and with "
+    NS_LOG_DEBUG("CalcLongTerm with " << uAntNumElems << " u antenna elements and "
+                                      << sAntNumElems << " s antenna elements, and with "
                                       << " s ports: " << sAnt->GetNumPorts()
                                       << " u ports: " << uAnt->GetNumPorts());
-    NS_ASSERT_MSG((sAnt != nullptr) && (uAnt != nullptr), "Improper call to the method");
     size_t numClusters = params->m_channel.GetNumPages();
-    // create and initialize the size of the longTerm 3D matrix
-    Ptr<MatrixBasedChannelModel::Complex3DVector> longTerm =
-        Create<MatrixBasedChannelModel::Complex3DVector>(uAnt->GetNumPorts(),
-                                                         sAnt->GetNumPorts(),
-                                                         numClusters);
-    // Calculate long term uW * Husn * sW, the result is a matrix
-    // with the dimensions #uPorts, #sPorts, #cluster
-    for (auto sPortIdx = 0; sPortIdx < sAnt->GetNumPorts(); sPortIdx++)
-    {
-        for (auto uPortIdx = 0; uPortIdx < uAnt->GetNumPorts(); uPortIdx++)
-        {
-            for (size_t cIndex = 0; cIndex < numClusters; cIndex++)
-            {
-                longTerm->Elem(uPortIdx, sPortIdx, cIndex) =
-                    CalculateLongTermComponent(params, sAnt, uAnt, sPortIdx, uPortIdx, cIndex);
-            }
-        }
-    }
-    return longTerm;
+    // Calculate long term uW * Husn * sW for all the clusters at once, as the product of
+    // the channel matrix by the port weights of each side; the result is a matrix with the
+    // dimensions #uPorts, #sPorts, #cluster.
+    // The sub-array partition model is adopted for TXRU virtualization,
+    // as described in Section 5.2.2 of 3GPP TR 36.897,
+    // and so equal beam weights are used for all the ports.
+    // Support of the full-connection model for TXRU virtualization would need extensions.
+    ComplexMatrixArray uWeights = GetPortWeights(*uAnt).Transpose().MakeNCopies(numClusters);
+    ComplexMatrixArray sWeights = GetPortWeights(*sAnt).MakeNCopies(numClusters);
+    return Create<MatrixBasedChannelModel::Complex3DVector>(
+        uWeights * params->m_channel * sWeights);
 }
 
 std::complex<double>
@@ -362,12 +387,12 @@ ThreeGppSpectrumPropagationLossModel::GenSpectrumChannelMatrix(
     // and RB width (12*SCS) are reset, ensuring these values are updated too
     double rbWidth = inPsd->ConstBandsBegin()->fh - inPsd->ConstBandsBegin()->fl;
 
-    if (channelParams->m_cachedDelaySincos.GetNumRows() != numRb ||
-        channelParams->m_cachedDelaySincos.GetNumCols() != numCluster ||
+    if (channelParams->m_cachedDelaySincos.GetNumRows() != numCluster ||
+        channelParams->m_cachedDelaySincos.GetNumCols() != numRb ||
         channelParams->m_cachedRbWidth != rbWidth)
     {
         channelParams->m_cachedRbWidth = rbWidth;
-        channelParams->m_cachedDelaySincos = ComplexMatrixArray(numRb, numCluster);
+        channelParams->m_cachedDelaySincos = ComplexMatrixArray(numCluster, numRb);
         auto sbit = inPsd->ConstBandsBegin(); // band iterator
         for (unsigned i = 0; i < numRb; i++)
         {
@@ -375,7 +400,7 @@ ThreeGppSpectrumPropagationLossModel::GenSpectrumChannelMatrix(
             for (std::size_t cIndex = 0; cIndex < numCluster; cIndex++)
             {
                 double delay = -2 * M_PI * fsb * (channelParams->m_delay[cIndex]);
-                channelParams->m_cachedDelaySincos(i, cIndex) =
+                channelParams->m_cachedDelaySincos(cIndex, i) =
                     std::complex<double>(cos(delay), sin(delay));
             }
             sbit++;
@@ -384,17 +409,33 @@ ThreeGppSpectrumPropagationLossModel::GenSpectrumChannelMatrix(
 
     // Compute the product between the doppler and the delay sincos
     auto delaySincosCopy = channelParams->m_cachedDelaySincos;
-    for (size_t iRb = 0; iRb < inPsd->GetValuesN(); iRb++)
+    for (size_t iRb = 0; iRb < numRb; iRb++)
     {
+        std::complex<double>* delaySincosRb = delaySincosCopy.GetPagePtr(0) + iRb * numCluster;
         for (std::size_t cIndex = 0; cIndex < numCluster; cIndex++)
         {
-            delaySincosCopy(iRb, cIndex) *= doppler[cIndex];
+            delaySincosRb[cIndex] *= doppler[cIndex];
         }
     }
 
     // If "params" (ChannelMatrix) and longTerm were computed for the reverse direction (e.g. this
     // is a DL transmission but params and longTerm were last updated during UL), then the elements
     // in longTerm start from different offsets.
+    NS_ASSERT_MSG(directionalLongTerm.GetNumRows() == numRxPorts &&
+                      directionalLongTerm.GetNumCols() == numTxPorts,
+                  "The long term component does not match the number of ports");
+
+    // The pages of the long term component are the columns of a (numRxPorts * numTxPorts,
+    // numCluster) matrix, and the pages of the channel matrix the columns of a
+    // (numRxPorts * numTxPorts, numRb) matrix, so all the sub-band gains are a single
+    // matrix product
+    const size_t numPortPairs = numRxPorts * numTxPorts;
+    ComplexMatrixArray longTermPerCluster(
+        numPortPairs,
+        numCluster,
+        std::valarray<std::complex<double>>(directionalLongTerm.GetPagePtr(0),
+                                            numPortPairs * numCluster));
+    ComplexMatrixArray subbandGain = longTermPerCluster * delaySincosCopy;
 
     auto vit = inPsd->ValuesBegin(); // psd iterator
     size_t iRb = 0;
@@ -403,21 +444,14 @@ ThreeGppSpectrumPropagationLossModel::GenSpectrumChannelMatrix(
     {
         if ((*vit) != 0.00)
         {
+            // Multiply with the square root of the input PSD so that the norm (absolute
+            // value squared) of chanSpct will be the output PSD
             auto sqrtVit = sqrt(*vit);
-            for (auto rxPortIdx = 0; rxPortIdx < numRxPorts; rxPortIdx++)
+            const std::complex<double>* gainRb = subbandGain.GetPagePtr(0) + iRb * numPortPairs;
+            std::complex<double>* chanSpctRb = chanSpct->GetPagePtr(iRb);
+            for (size_t portPairIdx = 0; portPairIdx < numPortPairs; portPairIdx++)
             {
-                for (auto txPortIdx = 0; txPortIdx < numTxPorts; txPortIdx++)
-                {
-                    std::complex<double> subsbandGain(0.0, 0.0);
-                    for (size_t cIndex = 0; cIndex < numCluster; cIndex++)
-                    {
-                        subsbandGain += directionalLongTerm(rxPortIdx, txPortIdx, cIndex) *
-                                        delaySincosCopy(iRb, cIndex);
-                    }
-                    // Multiply with the square root of the input PSD so that the norm (absolute
-                    // value squared) of chanSpct will be the output PSD
-                    chanSpct->Elem(rxPortIdx, txPortIdx, iRb) = sqrtVit * subsbandGain;
-                }
+                chanSpctRb[portPairIdx] = sqrtVit * gainRb[portPairIdx];
             }
         }
         vit++;
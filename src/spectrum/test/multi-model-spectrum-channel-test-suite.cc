@@ -0,0 +1,305 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <ns3/constant-position-mobility-model.h>
+#include <ns3/constant-velocity-mobility-model.h>
+#include <ns3/double.h>
+#include <ns3/log.h>
+#include <ns3/multi-model-spectrum-channel.h>
+#include <ns3/net-device.h>
+#include <ns3/propagation-loss-model.h>
+#include <ns3/random-variable-stream.h>
+#include <ns3/rng-seed-manager.h>
+#include <ns3/simulator.h>
+#include <ns3/spectrum-phy.h>
+#include <ns3/spectrum-signal-parameters.h>
+#include <ns3/test.h>
+
+NS_LOG_COMPONENT_DEFINE("MultiModelSpectrumChannelTest");
+
+using namespace ns3;
+
+/**
+ * \ingroup spectrum-tests
+ *
+ * \brief A reception seen by a RangeTestSpectrumPhy
+ */
+struct RangeTestReception
+{
+    uint32_t m_rxId;   //!< Identifier of the receiver
+    Time m_time;       //!< Time of the reception
+    double m_power;    //!< Received power
+    double m_distance; //!< Distance from the transmitter, or -1 if unknown
+};
+
+/**
+ * \ingroup spectrum-tests
+ *
+ * \brief SpectrumPhy that records its receptions
+ */
+class RangeTestSpectrumPhy : public SpectrumPhy
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param id the identifier of the phy
+     * \param rxSpectrumModel the RX spectrum model of the phy
+     * \param receptions the receptions of all the phys
+     */
+    RangeTestSpectrumPhy(uint32_t id,
+                         Ptr<const SpectrumModel> rxSpectrumModel,
+                         std::vector<RangeTestReception>* receptions)
+        : m_id(id),
+          m_rxSpectrumModel(rxSpectrumModel),
+          m_receptions(receptions)
+    {
+    }
+
+    void SetDevice(Ptr<NetDevice> d) override
+    {
+    }
+
+    Ptr<NetDevice> GetDevice() const override
+    {
+        return nullptr;
+    }
+
+    void SetMobility(Ptr<MobilityModel> m) override
+    {
+        m_mobility = m;
+    }
+
+    Ptr<MobilityModel> GetMobility() const override
+    {
+        return m_mobility;
+    }
+
+    void SetChannel(Ptr<SpectrumChannel> c) override
+    {
+    }
+
+    Ptr<const SpectrumModel> GetRxSpectrumModel() const override
+    {
+        return m_rxSpectrumModel;
+    }
+
+    Ptr<Object> GetAntenna() const override
+    {
+        return nullptr;
+    }
+
+    void StartRx(Ptr<SpectrumSignalParameters> params) override
+    {
+        auto txMobility = params->txPhy->GetMobility();
+        double distance = -1;
+        if (m_mobility && txMobility)
+        {
+            distance = CalculateDistance(m_mobility->GetPosition(), txMobility->GetPosition());
+        }
+        m_receptions->push_back({m_id, Simulator::Now(), Integral(*params->psd), distance});
+    }
+
+  private:
+    uint32_t m_id;                             //!< Identifier of the phy
+    Ptr<const SpectrumModel> m_rxSpectrumModel; //!< RX spectrum model
+    Ptr<MobilityModel> m_mobility;             //!< Mobility model
+    std::vector<RangeTestReception>* m_receptions; //!< Receptions of all the phys
+};
+
+/**
+ * \ingroup spectrum-tests
+ *
+ * \brief Check that the MaxRange attribute of MultiModelSpectrumChannel only
+ * drops the receptions of the receivers out of range, without changing the
+ * order of the other ones
+ */
+class MultiModelSpectrumChannelMaxRangeTestCase : public TestCase
+{
+  public:
+    MultiModelSpectrumChannelMaxRangeTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Run a scenario with static, moving and added/removed receivers
+     *
+     * \param maxRange the MaxRange attribute of the channel
+     * \return the receptions
+     */
+    std::vector<RangeTestReception> RunScenario(double maxRange);
+};
+
+MultiModelSpectrumChannelMaxRangeTestCase::MultiModelSpectrumChannelMaxRangeTestCase()
+    : TestCase("Check the receivers culled by the MaxRange of MultiModelSpectrumChannel")
+{
+}
+
+std::vector<RangeTestReception>
+MultiModelSpectrumChannelMaxRangeTestCase::RunScenario(double maxRange)
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+
+    std::vector<RangeTestReception> receptions;
+
+    // two spectrum models with the same band, to check the order of the receivers
+    // of different spectrum models
+    Ptr<const SpectrumModel> models[2] = {
+        Create<SpectrumModel>(std::vector<double>{2.400e9, 2.410e9}),
+        Create<SpectrumModel>(std::vector<double>{2.400e9, 2.410e9})};
+
+    auto channel = CreateObject<MultiModelSpectrumChannel>();
+    channel->SetAttribute("MaxRange", DoubleValue(maxRange));
+    channel->AddPropagationLossModel(CreateObject<FriisPropagationLossModel>());
+
+    auto position = CreateObject<UniformRandomVariable>();
+    position->SetAttribute("Max", DoubleValue(1000));
+    position->SetStream(1);
+    std::vector<Ptr<RangeTestSpectrumPhy>> phys;
+    for (uint32_t i = 0; i < 300; ++i)
+    {
+        auto phy = CreateObject<RangeTestSpectrumPhy>(i, models[i % 2], &receptions);
+        Vector pos(position->GetValue(), position->GetValue(), (i % 3) * 10.0);
+        if (i % 50 == 0)
+        {
+            // a few receivers without mobility model, which always receive
+        }
+        else if (i % 10 == 0)
+        {
+            auto mobility = CreateObject<ConstantVelocityMobilityModel>();
+            mobility->SetPosition(pos);
+            mobility->SetVelocity(Vector(100, 0, 0));
+            phy->SetMobility(mobility);
+        }
+        else
+        {
+            auto mobility = CreateObject<ConstantPositionMobilityModel>();
+            mobility->SetPosition(pos);
+            phy->SetMobility(mobility);
+        }
+        channel->AddRx(phy);
+        phys.push_back(phy);
+    }
+
+    auto txPhy = CreateObject<RangeTestSpectrumPhy>(1000, models[0], &receptions);
+    auto txMobility = CreateObject<ConstantPositionMobilityModel>();
+    txPhy->SetMobility(txMobility);
+
+    for (uint32_t t = 1; t <= 40; ++t)
+    {
+        Simulator::Schedule(Seconds(t * 0.1), [&, t]() {
+            txMobility->SetPosition(Vector(position->GetValue(), position->GetValue(), 0));
+            auto params = Create<SpectrumSignalParameters>();
+            params->psd = Create<SpectrumValue>(models[t % 2]);
+            (*params->psd)[0] = 1e-3;
+            params->txPhy = txPhy;
+            params->duration = MilliSeconds(1);
+            channel->StartTx(params);
+        });
+    }
+
+    // a static receiver that moves, a moving receiver that stops, and one that starts
+    Simulator::Schedule(Seconds(1.05), [&]() {
+        phys[1]->GetMobility()->SetPosition(Vector(500, 500, 0));
+    });
+    Simulator::Schedule(Seconds(1.55), [&]() {
+        DynamicCast<ConstantVelocityMobilityModel>(phys[10]->GetMobility())
+            ->SetVelocity(Vector(0, 0, 0));
+    });
+    Simulator::Schedule(Seconds(2.05), [&]() {
+        auto mobility = CreateObject<ConstantVelocityMobilityModel>();
+        mobility->SetPosition(phys[2]->GetMobility()->GetPosition());
+        mobility->SetVelocity(Vector(0, 200, 0));
+        phys[2]->SetMobility(mobility);
+        channel->AddRx(phys[2]);
+    });
+    // receivers added and removed after the grid is built
+    Simulator::Schedule(Seconds(2.55), [&]() {
+        auto phy = CreateObject<RangeTestSpectrumPhy>(300, models[1], &receptions);
+        auto mobility = CreateObject<ConstantPositionMobilityModel>();
+        mobility->SetPosition(Vector(500, 500, 10));
+        phy->SetMobility(mobility);
+        channel->AddRx(phy);
+        phys.push_back(phy);
+        channel->RemoveRx(phys[3]);
+    });
+    // a new range, with a new grid
+    Simulator::Schedule(Seconds(3.05), [&]() {
+        if (maxRange > 0)
+        {
+            channel->SetAttribute("MaxRange", DoubleValue(maxRange * 2));
+        }
+    });
+
+    Simulator::Run();
+    Simulator::Destroy();
+    return receptions;
+}
+
+void
+MultiModelSpectrumChannelMaxRangeTestCase::DoRun()
+{
+    const double maxRange = 200;
+    auto all = RunScenario(0);
+    auto inRange = RunScenario(maxRange);
+
+    std::vector<RangeTestReception> expected;
+    for (const auto& reception : all)
+    {
+        double range = reception.m_time > Seconds(3.05) ? maxRange * 2 : maxRange;
+        if (reception.m_distance <= range)
+        {
+            expected.push_back(reception);
+        }
+    }
+    NS_TEST_ASSERT_MSG_LT(expected.size(), all.size() / 2, "Too few receivers out of range");
+    NS_TEST_ASSERT_MSG_GT(expected.size(), 40, "Too few receivers in range");
+
+    NS_TEST_ASSERT_MSG_EQ(inRange.size(), expected.size(), "Unexpected number of receptions");
+    for (std::size_t i = 0; i < std::min(inRange.size(), expected.size()); ++i)
+    {
+        NS_TEST_ASSERT_MSG_EQ(inRange[i].m_rxId,
+                              expected[i].m_rxId,
+                              "Unexpected receiver at reception " << i);
+        NS_TEST_ASSERT_MSG_EQ(inRange[i].m_time,
+                              expected[i].m_time,
+                              "Unexpected time of reception " << i);
+        NS_TEST_ASSERT_MSG_EQ(inRange[i].m_power,
+                              expected[i].m_power,
+                              "Unexpected power of reception " << i);
+    }
+}
+
+/**
+ * \ingroup spectrum-tests
+ *
+ * \brief MultiModelSpectrumChannel TestSuite
+ */
+class MultiModelSpectrumChannelTestSuite : public TestSuite
+{
+  public:
+    MultiModelSpectrumChannelTestSuite();
+};
+
+MultiModelSpectrumChannelTestSuite::MultiModelSpectrumChannelTestSuite()
+    : TestSuite("multi-model-spectrum-channel", Type::UNIT)
+{
+    AddTestCase(new MultiModelSpectrumChannelMaxRangeTestCase, TestCase::Duration::QUICK);
+}
+
+/// Static variable for test initialization
+static MultiModelSpectrumChannelTestSuite g_multiModelSpectrumChannelTestSuite;
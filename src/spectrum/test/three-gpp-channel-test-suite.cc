@@ -38,6 +38,7 @@
 #include "ns3/uinteger.h"
 #include "ns3/uniform-planar-array.h"
 
+#include <filesystem>
 #include <valarray>
 
 using namespace ns3;
@@ -1441,6 +1442,423 @@ ThreeGppMimoPolarizationTest::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup spectrum-tests
+ *
+ * Test case for the BulkUpdate attribute of the ThreeGppChannelModel class.
+ * It checks that all the channels are regenerated at the multiples of the
+ * update period, and that the channel realizations do not depend on the
+ * number of threads that compute them.
+ */
+class ThreeGppChannelBulkUpdateTest : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     */
+    ThreeGppChannelBulkUpdateTest();
+
+    /**
+     * Destructor
+     */
+    ~ThreeGppChannelBulkUpdateTest() override;
+
+  private:
+    /**
+     * Build the test scenario
+     */
+    void DoRun() override;
+
+    /**
+     * Run the scenario and collect the channel matrices
+     * \param numThreads the number of threads that compute the channel matrices
+     * \return the channel matrices, in the order of the requests
+     */
+    std::vector<Ptr<const ThreeGppChannelModel::ChannelMatrix>> RunScenario(uint32_t numThreads);
+
+    /**
+     * Request the channel matrices between the first node and all the others
+     * \param channelModel the ThreeGppChannelModel object used to generate the channel matrix
+     * \param mobs the mobility models of the nodes
+     * \param antennas the antennas of the nodes
+     * \param expectedGenerationTime the expected generation time of the matrices
+     */
+    void DoGetChannels(Ptr<ThreeGppChannelModel> channelModel,
+                       std::vector<Ptr<MobilityModel>> mobs,
+                       std::vector<Ptr<PhasedArrayModel>> antennas,
+                       Time expectedGenerationTime);
+
+    std::vector<Ptr<const ThreeGppChannelModel::ChannelMatrix>>
+        m_channels; //!< the channel matrices, in the order of the requests
+};
+
+ThreeGppChannelBulkUpdateTest::ThreeGppChannelBulkUpdateTest()
+    : TestCase("Check the bulk update of the channel realizations")
+{
+}
+
+ThreeGppChannelBulkUpdateTest::~ThreeGppChannelBulkUpdateTest()
+{
+}
+
+void
+ThreeGppChannelBulkUpdateTest::DoGetChannels(Ptr<ThreeGppChannelModel> channelModel,
+                                             std::vector<Ptr<MobilityModel>> mobs,
+                                             std::vector<Ptr<PhasedArrayModel>> antennas,
+                                             Time expectedGenerationTime)
+{
+    for (size_t i = 1; i < mobs.size(); i++)
+    {
+        Ptr<const ThreeGppChannelModel::ChannelMatrix> channelMatrix =
+            channelModel->GetChannel(mobs[0], mobs[i], antennas[0], antennas[i]);
+        NS_TEST_ASSERT_MSG_EQ(channelMatrix->m_generatedTime,
+                              expectedGenerationTime,
+                              Simulator::Now().GetMilliSeconds()
+                                  << " The channel matrix is not correctly updated");
+        m_channels.push_back(channelMatrix);
+    }
+}
+
+std::vector<Ptr<const ThreeGppChannelModel::ChannelMatrix>>
+ThreeGppChannelBulkUpdateTest::RunScenario(uint32_t numThreads)
+{
+    uint32_t numNodes = 5;
+    Time updatePeriod = MilliSeconds(100);
+
+    Ptr<ThreeGppChannelModel> channelModel = CreateObject<ThreeGppChannelModel>();
+    channelModel->SetAttribute("Frequency", DoubleValue(28.0e9));
+    channelModel->SetAttribute("Scenario", StringValue("UMa"));
+    channelModel->SetAttribute("ChannelConditionModel",
+                               PointerValue(CreateObject<AlwaysLosChannelConditionModel>()));
+    channelModel->SetAttribute("UpdatePeriod", TimeValue(updatePeriod));
+    channelModel->SetAttribute("BulkUpdate", BooleanValue(true));
+    channelModel->SetAttribute("BulkUpdateThreads", UintegerValue(numThreads));
+    channelModel->AssignStreams(1);
+
+    NodeContainer nodes;
+    nodes.Create(numNodes);
+    std::vector<Ptr<MobilityModel>> mobs;
+    std::vector<Ptr<PhasedArrayModel>> antennas;
+    for (uint32_t i = 0; i < numNodes; i++)
+    {
+        Ptr<MobilityModel> mob = CreateObject<ConstantPositionMobilityModel>();
+        mob->SetPosition(i == 0 ? Vector(0.0, 0.0, 25.0) : Vector(20.0 * i, 10.0 * i, 1.5));
+        nodes.Get(i)->AggregateObject(mob);
+        mobs.push_back(mob);
+
+        antennas.push_back(CreateObjectWithAttributes<UniformPlanarArray>(
+            "NumColumns",
+            UintegerValue(i == 0 ? 4 : 2),
+            "NumRows",
+            UintegerValue(2),
+            "AntennaElement",
+            PointerValue(CreateObject<IsotropicAntennaModel>()),
+            "IsDualPolarized",
+            BooleanValue(i == 0)));
+    }
+
+    // the channels are generated at the first request, then they are all
+    // regenerated at the multiples of the update period
+    m_channels.clear();
+    Simulator::Schedule(MilliSeconds(30),
+                        &ThreeGppChannelBulkUpdateTest::DoGetChannels,
+                        this,
+                        channelModel,
+                        mobs,
+                        antennas,
+                        MilliSeconds(30));
+    Simulator::Schedule(MilliSeconds(110),
+                        &ThreeGppChannelBulkUpdateTest::DoGetChannels,
+                        this,
+                        channelModel,
+                        mobs,
+                        antennas,
+                        updatePeriod);
+    Simulator::Schedule(MilliSeconds(250),
+                        &ThreeGppChannelBulkUpdateTest::DoGetChannels,
+                        this,
+                        channelModel,
+                        mobs,
+                        antennas,
+                        updatePeriod * 2);
+
+    Simulator::Run();
+    // the bulk updates stop one period after the last one with requests
+    NS_TEST_EXPECT_MSG_EQ(Simulator::Now(), updatePeriod * 4, "Unexpected end of the simulation");
+    Simulator::Destroy();
+
+    return m_channels;
+}
+
+void
+ThreeGppChannelBulkUpdateTest::DoRun()
+{
+    auto channels = RunScenario(1);
+    auto channelsMultiThread = RunScenario(3);
+
+    uint32_t numPairs = channels.size() / 3;
+    for (uint32_t i = 0; i < numPairs; i++)
+    {
+        NS_TEST_ASSERT_MSG_EQ((channels[i]->m_channel != channels[numPairs + i]->m_channel),
+                              true,
+                              "The channel matrix is not regenerated");
+        NS_TEST_ASSERT_MSG_EQ(
+            (channels[numPairs + i]->m_channel != channels[2 * numPairs + i]->m_channel),
+            true,
+            "The channel matrix is not regenerated");
+    }
+
+    NS_TEST_ASSERT_MSG_EQ(channelsMultiThread.size(), channels.size(), "Wrong number of channels");
+    for (size_t i = 0; i < channels.size(); i++)
+    {
+        NS_TEST_ASSERT_MSG_EQ((channels[i]->m_channel == channelsMultiThread[i]->m_channel),
+                              true,
+                              "The channel matrix depends on the number of threads");
+    }
+}
+
+/**
+ * \ingroup spectrum-tests
+ *
+ * Test case for the channel cache file of the ThreeGppChannelModel class.
+ * It runs a scenario in which the channels are requested twice, with a
+ * channel update in between, and checks that the realizations written to the
+ * cache file by a run are read back by the runs with the same configuration,
+ * without adding records to the file, and that they are the realizations of a
+ * run without the cache file, also when only part of them are in the file.
+ * A run with different random variable streams does not find its
+ * realizations in the file.
+ */
+class ThreeGppChannelCacheTest : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     */
+    ThreeGppChannelCacheTest();
+
+    /**
+     * Destructor
+     */
+    ~ThreeGppChannelCacheTest() override;
+
+  private:
+    /**
+     * Build the test scenario
+     */
+    void DoRun() override;
+
+    /**
+     * Run the scenario and collect the channel matrices
+     * \param cacheFile the channel cache file, empty for none
+     * \param stream the first stream of the random variables of the channel model
+     * \param bulkUpdate whether to enable the bulk update of the channels
+     * \param numNodes the number of nodes
+     * \param update whether to request the channels again after the channel update
+     * \return the channel matrices, in the order of the requests
+     */
+    std::vector<Ptr<const ThreeGppChannelModel::ChannelMatrix>> RunScenario(
+        const std::string& cacheFile,
+        int64_t stream,
+        bool bulkUpdate,
+        uint32_t numNodes,
+        bool update);
+
+    /**
+     * Request the channel matrices between the first node and all the others
+     * \param channelModel the ThreeGppChannelModel object used to generate the channel matrix
+     * \param mobs the mobility models of the nodes
+     * \param antennas the antennas of the nodes
+     */
+    void DoGetChannels(Ptr<ThreeGppChannelModel> channelModel,
+                       std::vector<Ptr<MobilityModel>> mobs,
+                       std::vector<Ptr<PhasedArrayModel>> antennas);
+
+    /**
+     * Check whether two runs returned the same channel matrices
+     * \param a the channel matrices of the first run
+     * \param b the channel matrices of the second run
+     * \return true if the channel matrices are the same
+     */
+    static bool SameChannels(const std::vector<Ptr<const ThreeGppChannelModel::ChannelMatrix>>& a,
+                             const std::vector<Ptr<const ThreeGppChannelModel::ChannelMatrix>>& b);
+
+    std::vector<Ptr<const ThreeGppChannelModel::ChannelMatrix>>
+        m_channels; //!< the channel matrices, in the order of the requests
+};
+
+ThreeGppChannelCacheTest::ThreeGppChannelCacheTest()
+    : TestCase("Check the channel cache file")
+{
+}
+
+ThreeGppChannelCacheTest::~ThreeGppChannelCacheTest()
+{
+}
+
+void
+ThreeGppChannelCacheTest::DoGetChannels(Ptr<ThreeGppChannelModel> channelModel,
+                                        std::vector<Ptr<MobilityModel>> mobs,
+                                        std::vector<Ptr<PhasedArrayModel>> antennas)
+{
+    for (size_t i = 1; i < mobs.size(); i++)
+    {
+        m_channels.push_back(channelModel->GetChannel(mobs[0], mobs[i], antennas[0], antennas[i]));
+    }
+}
+
+std::vector<Ptr<const ThreeGppChannelModel::ChannelMatrix>>
+ThreeGppChannelCacheTest::RunScenario(const std::string& cacheFile,
+                                      int64_t stream,
+                                      bool bulkUpdate,
+                                      uint32_t numNodes,
+                                      bool update)
+{
+    Ptr<ThreeGppChannelModel> channelModel = CreateObject<ThreeGppChannelModel>();
+    channelModel->SetAttribute("Frequency", DoubleValue(28.0e9));
+    channelModel->SetAttribute("Scenario", StringValue("UMa"));
+    channelModel->SetAttribute("ChannelConditionModel",
+                               PointerValue(CreateObject<AlwaysLosChannelConditionModel>()));
+    channelModel->SetAttribute("UpdatePeriod", TimeValue(MilliSeconds(100)));
+    channelModel->SetAttribute("BulkUpdate", BooleanValue(bulkUpdate));
+    channelModel->SetAttribute("CacheFile", StringValue(cacheFile));
+    channelModel->AssignStreams(stream);
+
+    NodeContainer nodes;
+    nodes.Create(numNodes);
+    std::vector<Ptr<MobilityModel>> mobs;
+    std::vector<Ptr<PhasedArrayModel>> antennas;
+    for (uint32_t i = 0; i < numNodes; i++)
+    {
+        Ptr<MobilityModel> mob = CreateObject<ConstantPositionMobilityModel>();
+        mob->SetPosition(i == 0 ? Vector(0.0, 0.0, 25.0) : Vector(30.0 * i, -15.0 * i, 1.5));
+        nodes.Get(i)->AggregateObject(mob);
+        mobs.push_back(mob);
+
+        antennas.push_back(CreateObjectWithAttributes<UniformPlanarArray>(
+            "NumColumns",
+            UintegerValue(i == 0 ? 4 : 2),
+            "NumRows",
+            UintegerValue(2),
+            "AntennaElement",
+            PointerValue(CreateObject<IsotropicAntennaModel>()),
+            "IsDualPolarized",
+            BooleanValue(i == 0)));
+    }
+
+    m_channels.clear();
+    std::vector<Time> times{MilliSeconds(30)};
+    if (update)
+    {
+        times.push_back(MilliSeconds(250));
+    }
+    for (auto time : times)
+    {
+        Simulator::Schedule(time,
+                            &ThreeGppChannelCacheTest::DoGetChannels,
+                            this,
+                            channelModel,
+                            mobs,
+                            antennas);
+    }
+    Simulator::Run();
+    Simulator::Destroy();
+
+    return m_channels;
+}
+
+bool
+ThreeGppChannelCacheTest::SameChannels(
+    const std::vector<Ptr<const ThreeGppChannelModel::ChannelMatrix>>& a,
+    const std::vector<Ptr<const ThreeGppChannelModel::ChannelMatrix>>& b)
+{
+    if (a.size() != b.size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); i++)
+    {
+        if (a[i]->m_channel != b[i]->m_channel)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void
+ThreeGppChannelCacheTest::DoRun()
+{
+    std::string cacheFile = CreateTempDirFilename("three-gpp-channel-cache.bin");
+    std::filesystem::remove(cacheFile);
+
+    auto channels = RunScenario("", 1, false, 4, true);
+    NS_TEST_ASSERT_MSG_EQ((channels[0]->m_channel != channels[3]->m_channel),
+                          true,
+                          "The channel matrix is not regenerated");
+
+    // the first run writes the realizations, without changing them
+    auto firstRun = RunScenario(cacheFile, 1, false, 4, true);
+    NS_TEST_ASSERT_MSG_EQ(SameChannels(channels, firstRun),
+                          true,
+                          "The cache file changed the realizations");
+    {
+        Ptr<ThreeGppChannelCache> cache = ThreeGppChannelCache::Open(cacheFile);
+        // parameters and matrix of 3 pairs of nodes, generated twice
+        NS_TEST_ASSERT_MSG_EQ(cache->GetNumRecords(), 12, "Unexpected number of records");
+    }
+    auto fileSize = std::filesystem::file_size(cacheFile);
+
+    // the second run reads them
+    auto secondRun = RunScenario(cacheFile, 1, false, 4, true);
+    NS_TEST_ASSERT_MSG_EQ(SameChannels(channels, secondRun),
+                          true,
+                          "The realizations read from the cache file differ");
+    NS_TEST_ASSERT_MSG_EQ(std::filesystem::file_size(cacheFile),
+                          fileSize,
+                          "The realizations were not found in the cache file");
+
+    // a run with other streams does not find them
+    auto otherStreams = RunScenario(cacheFile, 100, false, 4, true);
+    NS_TEST_ASSERT_MSG_EQ(SameChannels(channels, otherStreams),
+                          false,
+                          "The realizations of other streams were read from the cache file");
+    NS_TEST_ASSERT_MSG_GT(std::filesystem::file_size(cacheFile),
+                          fileSize,
+                          "The realizations of other streams were not added to the cache file");
+
+    // the bulk updates read the cache file too
+    auto firstBulk = RunScenario(cacheFile, 1, true, 4, true);
+    fileSize = std::filesystem::file_size(cacheFile);
+    auto secondBulk = RunScenario(cacheFile, 1, true, 4, true);
+    NS_TEST_ASSERT_MSG_EQ(SameChannels(firstBulk, secondBulk),
+                          true,
+                          "The realizations read from the cache file differ");
+    NS_TEST_ASSERT_MSG_EQ(std::filesystem::file_size(cacheFile),
+                          fileSize,
+                          "The realizations were not found in the cache file");
+
+    std::filesystem::remove(cacheFile);
+
+    // a run that finds only the first realizations of two pairs of nodes in the
+    // file draws the random values of the others as a run without the file
+    RunScenario(cacheFile, 1, false, 3, false);
+    {
+        Ptr<ThreeGppChannelCache> cache = ThreeGppChannelCache::Open(cacheFile);
+        NS_TEST_ASSERT_MSG_EQ(cache->GetNumRecords(), 4, "Unexpected number of records");
+    }
+    auto partialRun = RunScenario(cacheFile, 1, false, 4, true);
+    NS_TEST_ASSERT_MSG_EQ(SameChannels(channels, partialRun),
+                          true,
+                          "The realizations not found in the cache file differ");
+    {
+        Ptr<ThreeGppChannelCache> cache = ThreeGppChannelCache::Open(cacheFile);
+        NS_TEST_ASSERT_MSG_EQ(cache->GetNumRecords(), 12, "Unexpected number of records");
+    }
+
+    std::filesystem::remove(cacheFile);
+}
+
 /**
  * \ingroup spectrum-tests
  *
@@ -1468,6 +1886,8 @@ ThreeGppChannelTestSuite::ThreeGppChannelTestSuite()
     AddTestCase(new ThreeGppChannelMatrixUpdateTest(2, 4, 2, 2), TestCase::Duration::QUICK);
     AddTestCase(new ThreeGppChannelMatrixUpdateTest(2, 2, 2, 2), TestCase::Duration::QUICK);
     AddTestCase(new ThreeGppAntennaSetupChangedTest(), TestCase::Duration::QUICK);
+    AddTestCase(new ThreeGppChannelBulkUpdateTest(), TestCase::Duration::QUICK);
+    AddTestCase(new ThreeGppChannelCacheTest(), TestCase::Duration::QUICK);
     AddTestCase(new ThreeGppSpectrumPropagationLossModelTest(4, 4, 1, 1),
                 TestCase::Duration::QUICK);
     AddTestCase(new ThreeGppSpectrumPropagationLossModelTest(4, 4, 2, 2),
@@ -0,0 +1,173 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+//
+// This program measures the wall clock time spent by the InterferenceHelper of a
+// PHY to track the received signals and to calculate the SNR and PER of the
+// receptions, as the PHY receives a sequence of A-MPDUs in a dense deployment.
+//
+// The PHY receives back-to-back HE SU PPDUs (--nReceptions option), each carrying
+// an A-MPDU of a number of MPDUs (--nMpdus option). Every reception overlaps with
+// a number of interfering signals (--nInterferers option) coming from other BSSs.
+// The PHY never leaves the receiving state, as in a dense deployment where the
+// medium is never idle, hence the InterferenceHelper keeps tracking the changes of
+// noise and interference power for the whole simulation. At the end of every MPDU,
+// the SNR and PER of the MPDU are calculated, and at the end of the PPDU the PER of
+// the PHY header and the SNR of the PPDU are calculated, as done by the PHY.
+//
+// The program prints the time spent per reception over the first and the last tenth
+// of the receptions: these are expected to be the same, i.e., the cost of a reception
+// should not depend on the number of signals received before.
+//
+
+#include "ns3/command-line.h"
+#include "ns3/he-phy.h"
+#include "ns3/interference-helper.h"
+#include "ns3/nist-error-rate-model.h"
+#include "ns3/simulator.h"
+#include "ns3/wifi-phy-operating-channel.h"
+#include "ns3/wifi-phy.h"
+#include "ns3/wifi-ppdu.h"
+#include "ns3/wifi-psdu.h"
+#include "ns3/wifi-spectrum-value-helper.h"
+#include "ns3/wifi-utils.h"
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("WifiInterferenceHelperBenchmark");
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t nReceptions = 20000;
+    uint32_t nMpdus = 32;
+    uint32_t nInterferers = 4;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("nReceptions", "Number of PPDUs received by the PHY", nReceptions);
+    cmd.AddValue("nMpdus", "Number of MPDUs in the A-MPDU carried by each PPDU", nMpdus);
+    cmd.AddValue("nInterferers", "Number of interfering signals per reception", nInterferers);
+    cmd.Parse(argc, argv);
+
+    NS_ABORT_MSG_IF(nReceptions < 10, "At least 10 receptions are needed");
+    NS_ABORT_MSG_IF(nMpdus == 0, "At least one MPDU per A-MPDU is needed");
+
+    auto interference = CreateObject<InterferenceHelper>();
+    interference->SetNoiseFigure(DbToRatio(7));
+    interference->SetErrorRateModel(CreateObject<NistErrorRateModel>());
+    interference->SetNumberOfReceiveAntennas(1);
+    const WifiSpectrumBandInfo band{{0, 0}, {5170000000, 5190000000}};
+    interference->AddBand(band);
+    interference->NotifyRxStart(WHOLE_WIFI_SPECTRUM);
+
+    const WifiTxVector
+        txVector(HePhy::GetHeMcs7(), 0, WIFI_PREAMBLE_HE_SU, 800, 1, 1, 0, 20, false);
+    WifiMacHeader hdr(WIFI_MAC_QOSDATA);
+    auto ppdu = Create<WifiPpdu>(Create<WifiPsdu>(Create<Packet>(1000), hdr),
+                                 txVector,
+                                 WifiPhyOperatingChannel());
+    const auto mpduDuration = MicroSeconds(20);
+    const auto preambleDuration = WifiPhy::CalculatePhyPreambleAndHeaderDuration(txVector);
+    const auto ppduDuration = preambleDuration + mpduDuration * nMpdus;
+
+    uint32_t nReceived = 0;
+    double psr = 0;
+    std::vector<std::chrono::duration<double>> receptionTimes;
+    receptionTimes.reserve(nReceptions);
+
+    // each reception is a separate event, scheduled at the end of the previous one
+    std::function<void()> receive = [&]() {
+        auto start = std::chrono::steady_clock::now();
+        RxPowerWattPerChannelBand rxPower{{band, DbmToW(-60)}};
+        auto event = interference->Add(ppdu, ppduDuration, rxPower, WHOLE_WIFI_SPECTRUM);
+        receptionTimes.push_back(std::chrono::steady_clock::now() - start);
+
+        // interfering signals starting during the reception, with a power in the range
+        // [-95, -85] dBm and lasting from 1/4 to 3/2 of the PPDU duration
+        for (uint32_t i = 0; i < nInterferers; ++i)
+        {
+            const auto n = nReceived * nInterferers + i;
+            Simulator::Schedule(ppduDuration * (i + 1) / (nInterferers + 1), [&, n]() {
+                auto calcStart = std::chrono::steady_clock::now();
+                RxPowerWattPerChannelBand rxPower{{band, DbmToW(-95.0 + (n % 11))}};
+                interference->AddForeignSignal(ppduDuration * (1 + (n % 6)) / 4,
+                                               rxPower,
+                                               WHOLE_WIFI_SPECTRUM);
+                receptionTimes.back() += std::chrono::steady_clock::now() - calcStart;
+            });
+        }
+
+        // end of every MPDU
+        for (uint32_t i = 0; i < nMpdus; ++i)
+        {
+            Simulator::Schedule(preambleDuration + mpduDuration * (i + 1), [&, event, i]() {
+                auto calcStart = std::chrono::steady_clock::now();
+                psr += 1 - interference
+                               ->CalculatePayloadSnrPer(event,
+                                                        20,
+                                                        band,
+                                                        SU_STA_ID,
+                                                        {mpduDuration * i, mpduDuration * (i + 1)})
+                               .per;
+                if (i + 1 == nMpdus)
+                {
+                    // end of the PPDU
+                    auto snrPer = interference->CalculatePhyHeaderSnrPer(event,
+                                                                         20,
+                                                                         band,
+                                                                         WIFI_PPDU_FIELD_SIG_A);
+                    psr += 1 - snrPer.per;
+                    interference->CalculateSnr(event, 20, 1, band);
+                }
+                receptionTimes.back() += std::chrono::steady_clock::now() - calcStart;
+            });
+        }
+
+        if (++nReceived < nReceptions)
+        {
+            Simulator::Schedule(ppduDuration, receive);
+        }
+    };
+
+    Simulator::ScheduleNow(receive);
+    auto start = std::chrono::steady_clock::now();
+    Simulator::Run();
+    std::chrono::duration<double> totalTime = std::chrono::steady_clock::now() - start;
+    Simulator::Destroy();
+
+    const auto tenth = nReceptions / 10;
+    std::chrono::duration<double> firstTime{0};
+    std::chrono::duration<double> lastTime{0};
+    for (uint32_t i = 0; i < tenth; ++i)
+    {
+        firstTime += receptionTimes[i];
+        lastTime += receptionTimes[nReceptions - tenth + i];
+    }
+
+    std::cout << "Receptions:                 " << nReceptions << " (" << nMpdus
+              << " MPDUs, " << nInterferers << " interferers each)" << std::endl
+              << "Average PSR:                " << psr / (nReceptions * (nMpdus + 1)) << std::endl
+              << "Time per reception (first): " << firstTime.count() / tenth * 1e6 << " us"
+              << std::endl
+              << "Time per reception (last):  " << lastTime.count() / tenth * 1e6 << " us"
+              << std::endl
+              << "Total time:                 " << totalTime.count() << " s" << std::endl;
+
+    return 0;
+}
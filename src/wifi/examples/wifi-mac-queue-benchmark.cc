@@ -0,0 +1,166 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+//
+// This program measures the wall clock time spent to queue MPDUs in the MAC queue
+// of an access point and to retrieve them in the way A-MPDUs are built.
+//
+// The MAC queue of the AC_BE of an 802.11ax AP holds QoS data frames addressed to
+// a number of stations (--nStations option), on a number of TIDs (--nTids option).
+// In each round, the program enqueues a burst of MPDUs (--burst option) for every
+// station and TID, then, for every station and TID, it walks the container queue
+// as the MPDU aggregator does (by peeking the MPDU following the last one added to
+// the A-MPDU) to collect an A-MPDU of up to --ampduSize MPDUs, and finally
+// dequeues all the MPDUs of the A-MPDU at once, as done when they are acknowledged.
+// Rounds are repeated until --nMpdus MPDUs have been enqueued. The program prints
+// the time spent to enqueue and to aggregate MPDUs and the total time, which also
+// includes the events scheduled by the MAC queue.
+//
+// No PHY and channel access operations are involved, hence the wall clock time
+// only accounts for the MAC queue, its container and its scheduler.
+//
+
+#include "ns3/boolean.h"
+#include "ns3/command-line.h"
+#include "ns3/mac48-address.h"
+#include "ns3/node-container.h"
+#include "ns3/simulator.h"
+#include "ns3/wifi-mac-queue.h"
+#include "ns3/wifi-mac.h"
+#include "ns3/wifi-net-device.h"
+#include "ns3/yans-wifi-helper.h"
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("WifiMacQueueBenchmark");
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t nStations = 128;
+    uint32_t nTids = 2;
+    uint32_t burst = 256;
+    uint32_t ampduSize = 256;
+    uint64_t nMpdus = 4000000;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("nStations", "Number of stations the MPDUs are addressed to", nStations);
+    cmd.AddValue("nTids", "Number of TIDs used for each station", nTids);
+    cmd.AddValue("burst", "Number of MPDUs enqueued for each station and TID per round", burst);
+    cmd.AddValue("ampduSize", "Maximum number of MPDUs in an A-MPDU", ampduSize);
+    cmd.AddValue("nMpdus", "Total number of MPDUs to enqueue", nMpdus);
+    cmd.Parse(argc, argv);
+
+    NS_ABORT_MSG_IF(nTids == 0 || nTids > 8, "The number of TIDs must be between 1 and 8");
+
+    // install an AP to get a fully configured MAC queue and scheduler
+    NodeContainer apNode(1);
+    YansWifiPhyHelper phy;
+    phy.SetChannel(YansWifiChannelHelper::Default().Create());
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211ax);
+    WifiMacHelper mac;
+    mac.SetType("ns3::ApWifiMac", "BeaconGeneration", BooleanValue(false));
+    auto apDevice = DynamicCast<WifiNetDevice>(wifi.Install(phy, mac, apNode).Get(0));
+    auto queue = apDevice->GetMac()->GetTxopQueue(AC_BE);
+    queue->SetMaxSize(QueueSize(QueueSizeUnit::PACKETS, nStations * nTids * burst * 2));
+
+    std::vector<Mac48Address> stations;
+    for (uint32_t i = 0; i < nStations; ++i)
+    {
+        stations.push_back(Mac48Address::Allocate());
+    }
+    auto apAddress = apDevice->GetMac()->GetAddress();
+    auto packet = Create<Packet>(1000);
+
+    uint64_t nEnqueued = 0;
+    uint64_t nAmpdus = 0;
+    uint64_t nAggregated = 0;
+    std::vector<uint16_t> seqNumbers(nStations * nTids, 0);
+    std::chrono::duration<double> enqueueTime{0};
+    std::chrono::duration<double> aggregateTime{0};
+
+    // each round is a separate event, so that the events scheduled by the MAC queue
+    // (e.g., to notify the netdevice queue of the dequeued packets) are processed
+    // before the next round, as in a regular simulation
+    std::function<void()> round = [&]() {
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < nStations; ++i)
+        {
+            for (uint8_t tid = 0; tid < nTids; ++tid)
+            {
+                for (uint32_t n = 0; n < burst; ++n)
+                {
+                    WifiMacHeader hdr(WIFI_MAC_QOSDATA);
+                    hdr.SetAddr1(stations[i]);
+                    hdr.SetAddr2(apAddress);
+                    hdr.SetAddr3(apAddress);
+                    hdr.SetQosTid(tid);
+                    hdr.SetSequenceNumber(seqNumbers[i * nTids + tid]++ % 4096);
+                    NS_ABORT_IF(!queue->Enqueue(Create<WifiMpdu>(packet, hdr)));
+                    ++nEnqueued;
+                }
+            }
+        }
+        auto middle = std::chrono::steady_clock::now();
+        enqueueTime += middle - start;
+
+        for (uint32_t i = 0; i < nStations; ++i)
+        {
+            for (uint8_t tid = 0; tid < nTids; ++tid)
+            {
+                std::list<Ptr<const WifiMpdu>> ampdu;
+                for (auto mpdu = queue->PeekByTidAndAddress(tid, stations[i]);
+                     mpdu && ampdu.size() < ampduSize;
+                     mpdu = queue->PeekByTidAndAddress(tid, stations[i], mpdu))
+                {
+                    ampdu.push_back(mpdu);
+                }
+                if (!ampdu.empty())
+                {
+                    ++nAmpdus;
+                    nAggregated += ampdu.size();
+                    queue->DequeueIfQueued(ampdu);
+                }
+            }
+        }
+        aggregateTime += std::chrono::steady_clock::now() - middle;
+
+        if (nEnqueued < nMpdus)
+        {
+            Simulator::Schedule(MicroSeconds(1), round);
+        }
+    };
+
+    Simulator::ScheduleNow(round);
+    auto start = std::chrono::steady_clock::now();
+    Simulator::Run();
+    std::chrono::duration<double> totalTime = std::chrono::steady_clock::now() - start;
+    Simulator::Destroy();
+
+    std::cout << "Stations x TIDs:   " << nStations << " x " << nTids << std::endl
+              << "MPDUs enqueued:    " << nEnqueued << " in " << enqueueTime.count() << " s ("
+              << nEnqueued / enqueueTime.count() << " MPDU/s)" << std::endl
+              << "MPDUs aggregated:  " << nAggregated << " in " << nAmpdus << " A-MPDUs, "
+              << aggregateTime.count() << " s (" << nAggregated / aggregateTime.count()
+              << " MPDU/s)" << std::endl
+              << "Total time:        " << totalTime.count() << " s" << std::endl;
+
+    return 0;
+}
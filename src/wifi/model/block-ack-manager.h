@@ -25,6 +25,7 @@
 #include "recipient-block-ack-agreement.h"
 #include "wifi-mac-header.h"
 #include "wifi-mpdu.h"
+#include "wifi-slab-allocator.h"
 #include "wifi-tx-vector.h"
 
 #include "ns3/nstime.h"
@@ -456,13 +457,13 @@ class BlockAckManager : public Object
     void InactivityTimeout(const Mac48Address& recipient, uint8_t tid);
 
     /**
-     * typedef for a list of WifiMpdu.
+     * typedef for a list of WifiMpdu (elements are allocated from a slab pool).
      */
-    typedef std::list<Ptr<WifiMpdu>> PacketQueue;
+    typedef std::list<Ptr<WifiMpdu>, WifiSlabAllocator<Ptr<WifiMpdu>>> PacketQueue;
     /**
      * typedef for an iterator for PacketQueue.
      */
-    typedef std::list<Ptr<WifiMpdu>>::iterator PacketQueueI;
+    typedef PacketQueue::iterator PacketQueueI;
 
     /// AgreementKey-indexed map of originator block ack agreements
     using OriginatorAgreements =
@@ -20,8 +20,14 @@
 #include "error-rate-model.h"
 
 #include "wifi-tx-vector.h"
+#include "wifi-utils.h"
 
+#include "ns3/double.h"
 #include "ns3/dsss-error-rate-model.h"
+#include "ns3/uinteger.h"
+
+#include <bit>
+#include <cmath>
 
 namespace ns3
 {
@@ -31,7 +37,24 @@ NS_OBJECT_ENSURE_REGISTERED(ErrorRateModel);
 TypeId
 ErrorRateModel::GetTypeId()
 {
-    static TypeId tid = TypeId("ns3::ErrorRateModel").SetParent<Object>().SetGroupName("Wifi");
+    static TypeId tid =
+        TypeId("ns3::ErrorRateModel")
+            .SetParent<Object>()
+            .SetGroupName("Wifi")
+            .AddAttribute("CacheSize",
+                          "The number of entries (rounded up to a power of two) of the cache "
+                          "of chunk success rates, 0 to disable the cache.",
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&ErrorRateModel::SetCacheSize),
+                          MakeUintegerChecker<uint32_t>())
+            .AddAttribute("CacheSnrResolution",
+                          "The resolution (in dB) of the SNR values used to index the cache of "
+                          "chunk success rates. If not null, the success rate of a chunk is "
+                          "computed for its SNR rounded to this resolution; otherwise, only "
+                          "the chunks with exactly the same SNR share an entry of the cache.",
+                          DoubleValue(0),
+                          MakeDoubleAccessor(&ErrorRateModel::SetCacheSnrResolution),
+                          MakeDoubleChecker<double>(0));
     return tid;
 }
 
@@ -49,7 +72,14 @@ ErrorRateModel::CalculateSnr(const WifiTxVector& txVector, double ber) const
     {
         NS_ASSERT(high >= low);
         double middle = low + (high - low) / 2;
-        if ((1 - GetChunkSuccessRate(txVector.GetMode(), txVector, middle, 1)) > ber)
+        // do not fill the cache with the SNR values of the search
+        if ((1 - ComputeChunkSuccessRate(txVector.GetMode(),
+                                         txVector,
+                                         middle,
+                                         1,
+                                         1,
+                                         WIFI_PPDU_FIELD_DATA,
+                                         SU_STA_ID)) > ber)
         {
             low = middle;
         }
@@ -61,6 +91,42 @@ ErrorRateModel::CalculateSnr(const WifiTxVector& txVector, double ber) const
     return low;
 }
 
+void
+ErrorRateModel::SetCacheSize(uint32_t size)
+{
+    std::size_t entries = (size > 0 ? 1 : 0);
+    while (entries < size)
+    {
+        entries <<= 1;
+    }
+    m_cache.assign(entries, CacheEntry{});
+}
+
+void
+ErrorRateModel::SetCacheSnrResolution(double resolution)
+{
+    m_cacheSnrResolution = resolution;
+    ClearCache();
+}
+
+void
+ErrorRateModel::ClearCache()
+{
+    std::fill(m_cache.begin(), m_cache.end(), CacheEntry{});
+}
+
+uint64_t
+ErrorRateModel::GetCacheHits() const
+{
+    return m_cacheHits;
+}
+
+uint64_t
+ErrorRateModel::GetCacheMisses() const
+{
+    return m_cacheMisses;
+}
+
 double
 ErrorRateModel::GetChunkSuccessRate(WifiMode mode,
                                     const WifiTxVector& txVector,
@@ -69,6 +135,103 @@ ErrorRateModel::GetChunkSuccessRate(WifiMode mode,
                                     uint8_t numRxAntennas,
                                     WifiPpduField field,
                                     uint16_t staId) const
+{
+    if (m_cache.empty() || !(snr > 0))
+    {
+        return ComputeChunkSuccessRate(mode, txVector, snr, nbits, numRxAntennas, field, staId);
+    }
+    auto snrKey = std::bit_cast<uint64_t>(snr);
+    if (m_cacheSnrResolution > 0)
+    {
+        const auto step = std::llround(RatioToDb(snr) / m_cacheSnrResolution);
+        snrKey = static_cast<uint64_t>(step);
+        snr = DbToRatio(step * m_cacheSnrResolution);
+    }
+    CacheEntry key;
+    key.snr = snrKey;
+    key.nbits = nbits;
+    key.modeUid = mode.GetUid();
+    key.channelWidth = txVector.GetChannelWidth();
+    key.guardInterval = txVector.GetGuardInterval();
+    key.field = static_cast<uint8_t>(field);
+    key.rxAntennas = numRxAntennas;
+    key.ldpc = txVector.IsLdpc();
+    key.mu = txVector.IsMu();
+    key.staId = key.mu ? staId : SU_STA_ID;
+    if (!key.mu)
+    {
+        key.nss = txVector.GetNss();
+    }
+    else if (const auto userInfoIt = txVector.GetHeMuUserInfoMap().find(staId);
+             userInfoIt != txVector.GetHeMuUserInfoMap().cend())
+    {
+        key.nss = userInfoIt->second.nss;
+        key.ruType = static_cast<uint8_t>(userInfoIt->second.ru.GetRuType()) + 1;
+    }
+    auto hash = (snrKey * 0x9e3779b97f4a7c15) ^ (nbits * 0xc2b2ae3d27d4eb4f) ^
+                (static_cast<uint64_t>(key.modeUid) << 40) ^
+                (static_cast<uint64_t>(key.channelWidth) << 28) ^
+                (static_cast<uint64_t>(key.guardInterval) << 16) ^
+                (static_cast<uint64_t>(key.staId) * 0x165667b19e3779f9) ^
+                (static_cast<uint64_t>(key.nss) << 12) ^ (static_cast<uint64_t>(key.ruType) << 8) ^
+                (static_cast<uint64_t>(key.field) << 4) ^
+                (static_cast<uint64_t>(key.rxAntennas) << 2) ^
+                (static_cast<uint64_t>(key.mu) << 1) ^ static_cast<uint64_t>(key.ldpc);
+    hash ^= hash >> 32;
+    auto& entry = m_cache[hash & (m_cache.size() - 1)];
+    if (entry.valid && entry.snr == key.snr && entry.nbits == key.nbits &&
+        entry.modeUid == key.modeUid && entry.channelWidth == key.channelWidth &&
+        entry.guardInterval == key.guardInterval && entry.staId == key.staId &&
+        entry.nss == key.nss && entry.ruType == key.ruType && entry.field == key.field &&
+        entry.rxAntennas == key.rxAntennas && entry.ldpc == key.ldpc && entry.mu == key.mu)
+    {
+        ++m_cacheHits;
+        return entry.successRate;
+    }
+    ++m_cacheMisses;
+    const auto successRate =
+        ComputeChunkSuccessRate(mode, txVector, snr, nbits, numRxAntennas, field, staId);
+    entry = key;
+    entry.valid = true;
+    entry.successRate = successRate;
+    return successRate;
+}
+
+double
+ErrorRateModel::GetChunksSuccessRate(WifiMode mode,
+                                     const WifiTxVector& txVector,
+                                     const std::vector<Chunk>& chunks,
+                                     uint8_t numRxAntennas,
+                                     WifiPpduField field,
+                                     uint16_t staId) const
+{
+    double successRate = 1.0;
+    for (const auto& chunk : chunks)
+    {
+        successRate *= GetChunkSuccessRate(mode,
+                                           txVector,
+                                           chunk.snr,
+                                           chunk.nbits,
+                                           numRxAntennas,
+                                           field,
+                                           staId);
+        if (successRate == 0.0)
+        {
+            // the remaining chunks cannot change the result
+            break;
+        }
+    }
+    return successRate;
+}
+
+double
+ErrorRateModel::ComputeChunkSuccessRate(WifiMode mode,
+                                        const WifiTxVector& txVector,
+                                        double snr,
+                                        uint64_t nbits,
+                                        uint8_t numRxAntennas,
+                                        WifiPpduField field,
+                                        uint16_t staId) const
 {
     if (mode.GetModulationClass() == WIFI_MOD_CLASS_DSSS ||
         mode.GetModulationClass() == WIFI_MOD_CLASS_HR_DSSS)
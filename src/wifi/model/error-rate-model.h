@@ -24,6 +24,8 @@
 
 #include "ns3/object.h"
 
+#include <vector>
+
 namespace ns3
 {
 
@@ -31,6 +33,15 @@ namespace ns3
  * \ingroup wifi
  * \brief the interface for Wifi's error models
  *
+ * The chunk success rates returned by the error model are memoized in a cache
+ * (see the CacheSize attribute) indexed by the mode, the SNR, the number of bits,
+ * the number of RX antennas and the PPDU field of the chunk, and by the parameters
+ * of the TXVECTOR that determine the PHY rate of the chunk: the channel width, the
+ * guard interval, the coding (LDPC or BCC), whether the PPDU is MU and, for MU
+ * PPDUs, the STA-ID of the user together with its number of spatial streams and
+ * RU size (the number of spatial streams is used for SU PPDUs as well). Error
+ * models whose chunk success rate depends on other parameters of the TXVECTOR
+ * must be used with the cache disabled.
  */
 class ErrorRateModel : public Object
 {
@@ -41,6 +52,15 @@ class ErrorRateModel : public Object
      */
     static TypeId GetTypeId();
 
+    /**
+     * A chunk of a PPDU field with constant SNR
+     */
+    struct Chunk
+    {
+        double snr;     //!< the SNR of the chunk (linear scale)
+        uint64_t nbits; //!< the number of bits in the chunk
+    };
+
     /**
      * \param txVector a specific transmission vector including WifiMode
      * \param ber a target BER
@@ -92,6 +112,44 @@ class ErrorRateModel : public Object
                                WifiPpduField field = WIFI_PPDU_FIELD_DATA,
                                uint16_t staId = SU_STA_ID) const;
 
+    /**
+     * This method returns the probability that all the given chunks of a PPDU field,
+     * which are transmitted with the same mode, will be successfully received by the PHY,
+     * i.e. the product of their success rates (multiplied in the order of the chunks).
+     *
+     * \param mode the Wi-Fi mode applicable to the chunks
+     * \param txVector TXVECTOR of the overall transmission
+     * \param chunks the chunks
+     * \param numRxAntennas the number of active RX antennas (1 if not provided)
+     * \param field the PPDU field to which the chunks belong to (assumes this is for the payload
+     * part if not provided)
+     * \param staId the station ID for MU
+     *
+     * \return probability of successfully receiving all the chunks
+     */
+    double GetChunksSuccessRate(WifiMode mode,
+                                const WifiTxVector& txVector,
+                                const std::vector<Chunk>& chunks,
+                                uint8_t numRxAntennas = 1,
+                                WifiPpduField field = WIFI_PPDU_FIELD_DATA,
+                                uint16_t staId = SU_STA_ID) const;
+
+    /**
+     * \return the number of chunk success rates found in the cache
+     */
+    uint64_t GetCacheHits() const;
+
+    /**
+     * \return the number of chunk success rates that were not found in the cache
+     */
+    uint64_t GetCacheMisses() const;
+
+    /**
+     * Remove all the entries of the cache of chunk success rates. This must be called
+     * when changing a parameter the chunk success rates depend on.
+     */
+    void ClearCache();
+
     /**
      * Assign a fixed random variable stream number to the random variables
      * used by this model. Return the number of streams (possibly zero) that
@@ -103,6 +161,41 @@ class ErrorRateModel : public Object
     virtual int64_t AssignStreams(int64_t stream);
 
   private:
+    /**
+     * Set the number of entries of the cache of chunk success rates.
+     *
+     * \param size the number of entries (rounded up to a power of two), 0 to disable the cache
+     */
+    void SetCacheSize(uint32_t size);
+
+    /**
+     * Set the resolution of the SNR values used to index the cache.
+     *
+     * \param resolution the resolution in dB, 0 to use the exact SNR values
+     */
+    void SetCacheSnrResolution(double resolution);
+
+    /**
+     * Compute the success rate of a chunk, without looking up the cache.
+     *
+     * \param mode the Wi-Fi mode applicable to this chunk
+     * \param txVector TXVECTOR of the overall transmission
+     * \param snr the SNR of the chunk
+     * \param nbits the number of bits in this chunk
+     * \param numRxAntennas the number of active RX antennas
+     * \param field the PPDU field to which the chunk belongs to
+     * \param staId the station ID for MU
+     *
+     * \return probability of successfully receiving the chunk
+     */
+    double ComputeChunkSuccessRate(WifiMode mode,
+                                   const WifiTxVector& txVector,
+                                   double snr,
+                                   uint64_t nbits,
+                                   uint8_t numRxAntennas,
+                                   WifiPpduField field,
+                                   uint16_t staId) const;
+
     /**
      * A pure virtual method that must be implemented in the subclass.
      *
@@ -123,6 +216,30 @@ class ErrorRateModel : public Object
                                          uint8_t numRxAntennas,
                                          WifiPpduField field,
                                          uint16_t staId) const = 0;
+
+    /// An entry of the cache of chunk success rates
+    struct CacheEntry
+    {
+        uint64_t snr{0};           //!< the SNR (bits of the value or quantized value in dB)
+        uint64_t nbits{0};         //!< the number of bits
+        uint32_t modeUid{0};       //!< the UID of the mode
+        uint16_t channelWidth{0};  //!< the channel width (MHz)
+        uint16_t guardInterval{0}; //!< the guard interval (ns)
+        uint16_t staId{0};         //!< the STA-ID of the user (SU_STA_ID for SU PPDUs)
+        uint8_t nss{0};            //!< the number of spatial streams of the user
+        uint8_t ruType{0};         //!< the RU type of the user plus one (0 if no RU)
+        uint8_t field{0};          //!< the PPDU field
+        uint8_t rxAntennas{0};     //!< the number of RX antennas
+        bool ldpc{false};          //!< whether LDPC is used
+        bool mu{false};            //!< whether the PPDU is MU
+        bool valid{false};         //!< whether the entry holds a success rate
+        double successRate{0};     //!< the success rate
+    };
+
+    mutable std::vector<CacheEntry> m_cache; //!< direct-mapped cache of chunk success rates
+    double m_cacheSnrResolution{0};          //!< resolution (dB) of the SNR values in the cache
+    mutable uint64_t m_cacheHits{0};         //!< number of chunk success rates found in the cache
+    mutable uint64_t m_cacheMisses{0}; //!< number of chunk success rates not found in the cache
 };
 
 } // namespace ns3
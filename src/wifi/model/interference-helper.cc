@@ -145,11 +145,6 @@ InterferenceHelper::NiChange::NiChange(double power, Ptr<Event> event)
 {
 }
 
-InterferenceHelper::NiChange::~NiChange()
-{
-    m_event = nullptr;
-}
-
 double
 InterferenceHelper::NiChange::GetPower() const
 {
@@ -198,10 +193,6 @@ void
 InterferenceHelper::DoDispose()
 {
     NS_LOG_FUNCTION(this);
-    for (auto it : m_niChanges)
-    {
-        it.second.clear();
-    }
     m_niChanges.clear();
     m_firstPowers.clear();
     m_errorRateModel = nullptr;
@@ -366,23 +357,70 @@ InterferenceHelper::AppendEvent(Ptr<Event> event,
             // Always leave the first zero power noise event in the list
             niIt->second.erase(++(niIt->second.begin()), ++previousPowerPosition);
         }
-        else if (isStartHePortionRxing)
+        else
         {
-            // When the first HE portion is received, we need to set m_firstPowerPerBand
-            // so that it takes into account interferences that arrived between the start of the
-            // HE TB PPDU transmission and the start of HE TB payload.
-            m_firstPowers.find(band)->second = previousPowerStart;
+            if (isStartHePortionRxing)
+            {
+                // When the first HE portion is received, we need to set m_firstPowerPerBand
+                // so that it takes into account interferences that arrived between the start of
+                // the HE TB PPDU transmission and the start of HE TB payload.
+                m_firstPowers.find(band)->second = previousPowerStart;
+            }
+            // The NiChanges keep accumulating as long as we are receiving: get rid of the
+            // expired ones when the array is full, so that the cost is amortized over the
+            // insertions (the array grows if few of them can be removed)
+            if (niIt->second.size() + 2 > niIt->second.capacity())
+            {
+                RemoveExpiredNiChanges(niIt->second);
+            }
         }
         auto first =
             AddNiChangeEvent(event->GetStartTime(), NiChange(previousPowerStart, event), niIt);
+        // the NiChange at the end of the event is inserted after the one at the start of
+        // the event, hence the position of the latter does not change
+        const auto firstPos = first - niIt->second.begin();
         auto last = AddNiChangeEvent(event->GetEndTime(), NiChange(previousPowerEnd, event), niIt);
-        for (auto i = first; i != last; ++i)
+        for (auto i = niIt->second.begin() + firstPos; i != last; ++i)
         {
             i->second.AddPower(power);
         }
     }
 }
 
+void
+InterferenceHelper::RemoveExpiredNiChanges(NiChanges& niChanges) const
+{
+    NS_LOG_FUNCTION(this << niChanges.size());
+    // The NiChanges at or after the current time belong to the events that have not ended yet,
+    // which are the only ones whose SNR and PER may still be calculated
+    const auto now = Simulator::Now();
+    auto horizon = now;
+    // skip the first zero power noise event, which has no associated event
+    for (auto it = std::partition_point(niChanges.begin() + 1,
+                                        niChanges.end(),
+                                        [now](const auto& niChange) {
+                                            return niChange.first < now;
+                                        });
+         it != niChanges.end();
+         ++it)
+    {
+        horizon = Min(horizon, it->second.GetEvent()->GetStartTime());
+    }
+    // Always leave the first zero power noise event and the last NiChange preceding the horizon
+    auto last = std::partition_point(niChanges.begin() + 1,
+                                     niChanges.end(),
+                                     [horizon](const auto& niChange) {
+                                         return niChange.first < horizon;
+                                     });
+    if (last - niChanges.begin() > 2)
+    {
+        niChanges.erase(niChanges.begin() + 1, last - 1);
+    }
+    // leave room for at least as many NiChanges as those left, so that the next removal does
+    // not occur before as many insertions
+    niChanges.reserve(2 * niChanges.size());
+}
+
 void
 InterferenceHelper::UpdateEvent(Ptr<Event> event, const RxPowerWattPerChannelBand& rxPower)
 {
@@ -436,7 +474,6 @@ InterferenceHelper::CalculateSnr(double signal,
 
 double
 InterferenceHelper::CalculateNoiseInterferenceW(Ptr<Event> event,
-                                                NiChangesPerBand& nis,
                                                 const WifiSpectrumBandInfo& band) const
 {
     NS_LOG_FUNCTION(this << band);
@@ -446,7 +483,7 @@ InterferenceHelper::CalculateNoiseInterferenceW(Ptr<Event> event,
     auto niIt = m_niChanges.find(band);
     NS_ABORT_IF(niIt == m_niChanges.end());
     const auto now = Simulator::Now();
-    auto it = niIt->second.find(event->GetStartTime());
+    auto it = FindNiChange(event->GetStartTime(), niIt->second);
     double muMimoPowerW = (event->GetPpdu()->GetType() == WIFI_PPDU_TYPE_UL_MU)
                               ? CalculateMuMimoPowerW(event, band)
                               : 0.0;
@@ -466,23 +503,36 @@ InterferenceHelper::CalculateNoiseInterferenceW(Ptr<Event> event,
             noiseInterferenceW = 0.0;
         }
     }
-    it = niIt->second.find(event->GetStartTime());
-    NS_ABORT_IF(it == niIt->second.end());
-    for (; it != niIt->second.end() && it->second.GetEvent() != event; ++it)
+    NS_ASSERT_MSG(noiseInterferenceW >= 0.0,
+                  "CalculateNoiseInterferenceW returns negative value " << noiseInterferenceW);
+    return noiseInterferenceW;
+}
+
+InterferenceHelper::EventNiChanges
+InterferenceHelper::GetEventNiChanges(Ptr<const Event> event,
+                                      const WifiSpectrumBandInfo& band) const
+{
+    NS_LOG_FUNCTION(this << band);
+    auto niIt = m_niChanges.find(band);
+    NS_ABORT_IF(niIt == m_niChanges.end());
+    const auto& niChanges = niIt->second;
+    auto it = FindNiChange(event->GetStartTime(), niChanges);
+    NS_ABORT_IF(it == niChanges.cend());
+    for (; it != niChanges.cend() && it->second.GetEvent() != event; ++it)
     {
         ;
     }
-    NiChanges ni;
-    ni.emplace(event->GetStartTime(), NiChange(0, event));
-    while (++it != niIt->second.end() && it->second.GetEvent() != event)
+    NS_ABORT_IF(it == niChanges.cend());
+    EventNiChanges eventNiChanges{it, it};
+    // stop at the NiChange added at the end of the event or, should it be missing, at the first
+    // NiChange following the end of the event
+    while (++eventNiChanges.last != niChanges.cend() &&
+           eventNiChanges.last->second.GetEvent() != event &&
+           eventNiChanges.last->first <= event->GetEndTime())
     {
-        ni.insert(*it);
+        ;
     }
-    ni.emplace(event->GetEndTime(), NiChange(0, event));
-    nis.insert({band, ni});
-    NS_ASSERT_MSG(noiseInterferenceW >= 0.0,
-                  "CalculateNoiseInterferenceW returns negative value " << noiseInterferenceW);
-    return noiseInterferenceW;
+    return eventNiChanges;
 }
 
 double
@@ -551,10 +601,7 @@ InterferenceHelper::CalculatePayloadChunkSuccessRate(double snir,
         return 1.0;
     }
     WifiMode mode = txVector.GetMode(staId);
-    uint64_t rate = mode.GetDataRate(txVector, staId);
-    auto nbits = static_cast<uint64_t>(rate * duration.GetSeconds());
-    nbits /= txVector.GetNss(staId); // divide effective number of bits by NSS to achieve same chunk
-                                     // error rate as SISO for AWGN
+    uint64_t nbits = GetPayloadChunkBits(duration, txVector, staId);
     double csr = m_errorRateModel->GetChunkSuccessRate(mode,
                                                        txVector,
                                                        snir,
@@ -565,21 +612,32 @@ InterferenceHelper::CalculatePayloadChunkSuccessRate(double snir,
     return csr;
 }
 
+uint64_t
+InterferenceHelper::GetPayloadChunkBits(Time duration,
+                                        const WifiTxVector& txVector,
+                                        uint16_t staId) const
+{
+    uint64_t rate = txVector.GetMode(staId).GetDataRate(txVector, staId);
+    auto nbits = static_cast<uint64_t>(rate * duration.GetSeconds());
+    nbits /= txVector.GetNss(staId); // divide effective number of bits by NSS to achieve same chunk
+                                     // error rate as SISO for AWGN
+    return nbits;
+}
+
 double
 InterferenceHelper::CalculatePayloadPer(Ptr<const Event> event,
                                         uint16_t channelWidth,
-                                        NiChangesPerBand* nis,
+                                        const EventNiChanges& niChanges,
                                         const WifiSpectrumBandInfo& band,
                                         uint16_t staId,
                                         std::pair<Time, Time> window) const
 {
     NS_LOG_FUNCTION(this << channelWidth << band << staId << window.first << window.second);
-    double psr = 1.0; /* Packet Success Rate */
-    const auto& niIt = nis->find(band)->second;
-    auto j = niIt.cbegin();
+    const auto& txVector = event->GetPpdu()->GetTxVector();
+    auto j = niChanges.first;
     Time previous = j->first;
     double muMimoPowerW = 0.0;
-    WifiMode payloadMode = event->GetPpdu()->GetTxVector().GetMode(staId);
+    WifiMode payloadMode = txVector.GetMode(staId);
     Time phyPayloadStart = j->first;
     if (event->GetPpdu()->GetType() != WIFI_PPDU_TYPE_UL_MU &&
         event->GetPpdu()->GetType() !=
@@ -597,35 +655,39 @@ InterferenceHelper::CalculatePayloadPer(Ptr<const Event> event,
     NS_ABORT_IF(!m_firstPowers.contains(band));
     double noiseInterferenceW = m_firstPowers.at(band);
     double powerW = event->GetRxPowerW(band);
-    while (++j != niIt.cend())
+    // collect the chunks of the windowed payload, whose success rates are then obtained at once
+    m_chunks.clear();
+    while (true)
     {
-        Time current = j->first;
+        // the last chunk ends at the end of the event
+        const auto isLast = (++j == niChanges.last);
+        Time current = isLast ? event->GetEndTime() : j->first;
         NS_LOG_DEBUG("previous= " << previous << ", current=" << current);
         NS_ASSERT(current >= previous);
-        double snr = CalculateSnr(powerW,
-                                  noiseInterferenceW,
-                                  channelWidth,
-                                  event->GetPpdu()->GetTxVector().GetNss(staId));
+        double snr = CalculateSnr(powerW, noiseInterferenceW, channelWidth, txVector.GetNss(staId));
+        Time duration;
         // Case 1: Both previous and current point to the windowed payload
         if (previous >= windowStart)
         {
-            psr *= CalculatePayloadChunkSuccessRate(snr,
-                                                    Min(windowEnd, current) - previous,
-                                                    event->GetPpdu()->GetTxVector(),
-                                                    staId);
+            duration = Min(windowEnd, current) - previous;
             NS_LOG_DEBUG("Both previous and current point to the windowed payload: mode="
-                         << payloadMode << ", psr=" << psr);
+                         << payloadMode << ", duration=" << duration);
         }
         // Case 2: previous is before windowed payload and current is in the windowed payload
         else if (current >= windowStart)
         {
-            psr *= CalculatePayloadChunkSuccessRate(snr,
-                                                    Min(windowEnd, current) - windowStart,
-                                                    event->GetPpdu()->GetTxVector(),
-                                                    staId);
+            duration = Min(windowEnd, current) - windowStart;
             NS_LOG_DEBUG(
                 "previous is before windowed payload and current is in the windowed payload: mode="
-                << payloadMode << ", psr=" << psr);
+                << payloadMode << ", duration=" << duration);
+        }
+        if (!duration.IsZero())
+        {
+            m_chunks.push_back({snr, GetPayloadChunkBits(duration, txVector, staId)});
+        }
+        if (isLast)
+        {
+            break;
         }
         noiseInterferenceW = j->second.GetPower() - powerW;
         if (IsSameMuMimoTransmission(event, j->second.GetEvent()))
@@ -643,6 +705,13 @@ InterferenceHelper::CalculatePayloadPer(Ptr<const Event> event,
             break;
         }
     }
+    double psr = m_errorRateModel->GetChunksSuccessRate(payloadMode,
+                                                        txVector,
+                                                        m_chunks,
+                                                        m_numRxAntennas,
+                                                        WIFI_PPDU_FIELD_DATA,
+                                                        staId);
+    NS_LOG_DEBUG("mode=" << payloadMode << ", psr=" << psr);
     double per = 1 - psr;
     return per;
 }
@@ -650,15 +719,14 @@ InterferenceHelper::CalculatePayloadPer(Ptr<const Event> event,
 double
 InterferenceHelper::CalculatePhyHeaderSectionPsr(
     Ptr<const Event> event,
-    NiChangesPerBand* nis,
+    const EventNiChanges& niChanges,
     uint16_t channelWidth,
     const WifiSpectrumBandInfo& band,
     PhyEntity::PhyHeaderSections phyHeaderSections) const
 {
     NS_LOG_FUNCTION(this << band);
     double psr = 1.0; /* Packet Success Rate */
-    auto niIt = nis->find(band)->second;
-    auto j = niIt.begin();
+    auto j = niChanges.first;
 
     NS_ASSERT(!phyHeaderSections.empty());
     Time stopLastSection = Seconds(0);
@@ -671,9 +739,11 @@ InterferenceHelper::CalculatePhyHeaderSectionPsr(
     NS_ABORT_IF(!m_firstPowers.contains(band));
     double noiseInterferenceW = m_firstPowers.at(band);
     double powerW = event->GetRxPowerW(band);
-    while (++j != niIt.end())
+    while (true)
     {
-        Time current = j->first;
+        // the last chunk ends at the end of the event
+        const auto isLast = (++j == niChanges.last);
+        Time current = isLast ? event->GetEndTime() : j->first;
         NS_LOG_DEBUG("previous= " << previous << ", current=" << current);
         NS_ASSERT(current >= previous);
         double snr = CalculateSnr(powerW, noiseInterferenceW, channelWidth, 1);
@@ -699,6 +769,10 @@ InterferenceHelper::CalculatePhyHeaderSectionPsr(
                 }
             }
         }
+        if (isLast)
+        {
+            break;
+        }
         noiseInterferenceW = j->second.GetPower() - powerW;
         previous = j->first;
         if (previous > stopLastSection)
@@ -713,19 +787,18 @@ InterferenceHelper::CalculatePhyHeaderSectionPsr(
 
 double
 InterferenceHelper::CalculatePhyHeaderPer(Ptr<const Event> event,
-                                          NiChangesPerBand* nis,
+                                          const EventNiChanges& niChanges,
                                           uint16_t channelWidth,
                                           const WifiSpectrumBandInfo& band,
                                           WifiPpduField header) const
 {
     NS_LOG_FUNCTION(this << band << header);
-    auto niIt = nis->find(band)->second;
     auto phyEntity =
         WifiPhy::GetStaticPhyEntity(event->GetPpdu()->GetTxVector().GetModulationClass());
 
     PhyEntity::PhyHeaderSections sections;
     for (const auto& section :
-         phyEntity->GetPhyHeaderSections(event->GetPpdu()->GetTxVector(), niIt.begin()->first))
+         phyEntity->GetPhyHeaderSections(event->GetPpdu()->GetTxVector(), niChanges.first->first))
     {
         if (section.first == header)
         {
@@ -736,7 +809,7 @@ InterferenceHelper::CalculatePhyHeaderPer(Ptr<const Event> event,
     double psr = 1.0;
     if (!sections.empty())
     {
-        psr = CalculatePhyHeaderSectionPsr(event, nis, channelWidth, band, sections);
+        psr = CalculatePhyHeaderSectionPsr(event, niChanges, channelWidth, band, sections);
     }
     return 1 - psr;
 }
@@ -750,8 +823,7 @@ InterferenceHelper::CalculatePayloadSnrPer(Ptr<Event> event,
 {
     NS_LOG_FUNCTION(this << channelWidth << band << staId << relativeMpduStartStop.first
                          << relativeMpduStartStop.second);
-    NiChangesPerBand ni;
-    double noiseInterferenceW = CalculateNoiseInterferenceW(event, ni, band);
+    double noiseInterferenceW = CalculateNoiseInterferenceW(event, band);
     double snr = CalculateSnr(event->GetRxPowerW(band),
                               noiseInterferenceW,
                               channelWidth,
@@ -760,7 +832,12 @@ InterferenceHelper::CalculatePayloadSnrPer(Ptr<Event> event,
     /* calculate the SNIR at the start of the MPDU (located through windowing) and accumulate
      * all SNIR changes in the SNIR vector.
      */
-    double per = CalculatePayloadPer(event, channelWidth, &ni, band, staId, relativeMpduStartStop);
+    double per = CalculatePayloadPer(event,
+                                     channelWidth,
+                                     GetEventNiChanges(event, band),
+                                     band,
+                                     staId,
+                                     relativeMpduStartStop);
 
     return PhyEntity::SnrPer(snr, per);
 }
@@ -771,8 +848,7 @@ InterferenceHelper::CalculateSnr(Ptr<Event> event,
                                  uint8_t nss,
                                  const WifiSpectrumBandInfo& band) const
 {
-    NiChangesPerBand ni;
-    double noiseInterferenceW = CalculateNoiseInterferenceW(event, ni, band);
+    double noiseInterferenceW = CalculateNoiseInterferenceW(event, band);
     double snr = CalculateSnr(event->GetRxPowerW(band), noiseInterferenceW, channelWidth, nss);
     return snr;
 }
@@ -784,14 +860,14 @@ InterferenceHelper::CalculatePhyHeaderSnrPer(Ptr<Event> event,
                                              WifiPpduField header) const
 {
     NS_LOG_FUNCTION(this << band << header);
-    NiChangesPerBand ni;
-    double noiseInterferenceW = CalculateNoiseInterferenceW(event, ni, band);
+    double noiseInterferenceW = CalculateNoiseInterferenceW(event, band);
     double snr = CalculateSnr(event->GetRxPowerW(band), noiseInterferenceW, channelWidth, 1);
 
     /* calculate the SNIR at the start of the PHY header and accumulate
      * all SNIR changes in the SNIR vector.
      */
-    double per = CalculatePhyHeaderPer(event, &ni, channelWidth, band, header);
+    double per =
+        CalculatePhyHeaderPer(event, GetEventNiChanges(event, band), channelWidth, band, header);
 
     return PhyEntity::SnrPer(snr, per);
 }
@@ -799,7 +875,22 @@ InterferenceHelper::CalculatePhyHeaderSnrPer(Ptr<Event> event,
 InterferenceHelper::NiChanges::iterator
 InterferenceHelper::GetNextPosition(Time moment, NiChangesPerBand::iterator niIt)
 {
-    return niIt->second.upper_bound(moment);
+    return std::partition_point(niIt->second.begin(),
+                                niIt->second.end(),
+                                [moment](const auto& niChange) {
+                                    return niChange.first <= moment;
+                                });
+}
+
+InterferenceHelper::NiChanges::const_iterator
+InterferenceHelper::FindNiChange(Time moment, const NiChanges& niChanges) const
+{
+    auto it = std::partition_point(niChanges.cbegin(),
+                                   niChanges.cend(),
+                                   [moment](const auto& niChange) {
+                                       return niChange.first < moment;
+                                   });
+    return (it != niChanges.cend() && it->first == moment) ? it : niChanges.cend();
 }
 
 InterferenceHelper::NiChanges::iterator
@@ -815,7 +906,7 @@ InterferenceHelper::GetPreviousPosition(Time moment, NiChangesPerBand::iterator
 InterferenceHelper::NiChanges::iterator
 InterferenceHelper::AddNiChangeEvent(Time moment, NiChange change, NiChangesPerBand::iterator niIt)
 {
-    return niIt->second.insert(GetNextPosition(moment, niIt), {moment, change});
+    return niIt->second.emplace(GetNextPosition(moment, niIt), moment, change);
 }
 
 void
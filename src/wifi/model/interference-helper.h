@@ -20,16 +20,18 @@
 #ifndef INTERFERENCE_HELPER_H
 #define INTERFERENCE_HELPER_H
 
+#include "error-rate-model.h"
 #include "phy-entity.h"
 
 #include "ns3/object.h"
 
+#include <vector>
+
 namespace ns3
 {
 
 class WifiPpdu;
 class WifiPsdu;
-class ErrorRateModel;
 
 /**
  * \ingroup wifi
@@ -351,6 +353,18 @@ class InterferenceHelper : public Object
                                             Time duration,
                                             const WifiTxVector& txVector,
                                             uint16_t staId = SU_STA_ID) const;
+    /**
+     * Calculate the number of bits of a payload chunk given its duration and the TXVECTOR.
+     *
+     * \param duration the duration of the chunk
+     * \param txVector the TXVECTOR
+     * \param staId the station ID of the PSDU (only used for MU)
+     *
+     * \return the number of bits of the chunk
+     */
+    uint64_t GetPayloadChunkBits(Time duration,
+                                 const WifiTxVector& txVector,
+                                 uint16_t staId = SU_STA_ID) const;
 
   protected:
     std::map<FrequencyRange, bool>
@@ -370,7 +384,6 @@ class InterferenceHelper : public Object
          * \param event causes this NI change
          */
         NiChange(double power, Ptr<Event> event);
-        ~NiChange();
         /**
          * Return the power
          *
@@ -396,9 +409,22 @@ class InterferenceHelper : public Object
     };
 
     /**
-     * typedef for a multimap of NiChange
+     * Time-ordered array of NiChange. NiChanges occurring at the same time are kept
+     * in the order they have been added, and each NiChange holds the total power
+     * received from its time until the time of the next NiChange.
      */
-    using NiChanges = std::multimap<Time, NiChange>;
+    using NiChanges = std::vector<std::pair<Time, NiChange>>;
+
+    /**
+     * The NiChanges of a band that span an event: the NiChange added at the start of
+     * the event and the NiChanges that follow it, up to (excluded) the NiChange added
+     * at the end of the event.
+     */
+    struct EventNiChanges
+    {
+        NiChanges::const_iterator first; //!< the NiChange added at the start of the event
+        NiChanges::const_iterator last;  //!< the NiChange added at the end of the event
+    };
 
     /**
      * Map of NiChanges per band
@@ -438,18 +464,35 @@ class InterferenceHelper : public Object
      */
     void AppendEvent(Ptr<Event> event, const FrequencyRange& freqRange, bool isStartHePortionRxing);
 
+    /**
+     * Remove the NiChanges of a band that are no longer needed, i.e. those preceding the
+     * start of the events that have not ended yet (but the last one of them, which holds
+     * the power at the start of the earliest of these events).
+     *
+     * \param niChanges the NiChanges of the band
+     */
+    void RemoveExpiredNiChanges(NiChanges& niChanges) const;
+
     /**
      * Calculate noise and interference power in W.
      *
      * \param event the event
-     * \param nis the NiChanges
      * \param band the band
      *
      * \return noise and interference power
      */
-    double CalculateNoiseInterferenceW(Ptr<Event> event,
-                                       NiChangesPerBand& nis,
-                                       const WifiSpectrumBandInfo& band) const;
+    double CalculateNoiseInterferenceW(Ptr<Event> event, const WifiSpectrumBandInfo& band) const;
+
+    /**
+     * Get the NiChanges of a given band that span a given event.
+     *
+     * \param event the event
+     * \param band the band
+     *
+     * \return the NiChanges of the band that span the event
+     */
+    EventNiChanges GetEventNiChanges(Ptr<const Event> event,
+                                     const WifiSpectrumBandInfo& band) const;
 
     /**
      * Calculate power of all other events preceding a given event that belong to the same MU-MIMO
@@ -470,7 +513,7 @@ class InterferenceHelper : public Object
      *
      * \param event the event
      * \param channelWidth the channel width used to transmit the PSDU (in MHz)
-     * \param nis the NiChanges
+     * \param niChanges the NiChanges spanning the event
      * \param band identify the band used by the PSDU
      * \param staId the station ID of the PSDU (only used for MU)
      * \param window time window (pair of start and end times) of PHY payload to focus on
@@ -479,7 +522,7 @@ class InterferenceHelper : public Object
      */
     double CalculatePayloadPer(Ptr<const Event> event,
                                uint16_t channelWidth,
-                               NiChangesPerBand* nis,
+                               const EventNiChanges& niChanges,
                                const WifiSpectrumBandInfo& band,
                                uint16_t staId,
                                std::pair<Time, Time> window) const;
@@ -488,7 +531,7 @@ class InterferenceHelper : public Object
      * can be divided into multiple chunks (e.g. due to interference from other transmissions).
      *
      * \param event the event
-     * \param nis the NiChanges
+     * \param niChanges the NiChanges spanning the event
      * \param channelWidth the channel width (in MHz) for header measurement
      * \param band the band
      * \param header the PHY header to consider
@@ -496,7 +539,7 @@ class InterferenceHelper : public Object
      * \return the error rate of the HT PHY header
      */
     double CalculatePhyHeaderPer(Ptr<const Event> event,
-                                 NiChangesPerBand* nis,
+                                 const EventNiChanges& niChanges,
                                  uint16_t channelWidth,
                                  const WifiSpectrumBandInfo& band,
                                  WifiPpduField header) const;
@@ -504,7 +547,7 @@ class InterferenceHelper : public Object
      * Calculate the success rate of the PHY header sections for the provided event.
      *
      * \param event the event
-     * \param nis the NiChanges
+     * \param niChanges the NiChanges spanning the event
      * \param channelWidth the channel width (in MHz) for header measurement
      * \param band the band
      * \param phyHeaderSections the map of PHY header sections (\see PhyEntity::PhyHeaderSections)
@@ -512,7 +555,7 @@ class InterferenceHelper : public Object
      * \return the success rate of the PHY header sections
      */
     double CalculatePhyHeaderSectionPsr(Ptr<const Event> event,
-                                        NiChangesPerBand* nis,
+                                        const EventNiChanges& niChanges,
                                         uint16_t channelWidth,
                                         const WifiSpectrumBandInfo& band,
                                         PhyEntity::PhyHeaderSections phyHeaderSections) const;
@@ -522,6 +565,8 @@ class InterferenceHelper : public Object
     uint8_t m_numRxAntennas;         //!< the number of RX antennas in the corresponding receiver
     NiChangesPerBand m_niChanges;    //!< NI Changes for each band
     FirstPowerPerBand m_firstPowers; //!< first power of each band in watts
+    mutable std::vector<ErrorRateModel::Chunk>
+        m_chunks; //!< the payload chunks whose success rate is being calculated
 
     /**
      * Returns an iterator to the first NiChange that is later than moment
@@ -539,6 +584,14 @@ class InterferenceHelper : public Object
      * \returns an iterator to the list of NiChanges
      */
     NiChanges::iterator GetPreviousPosition(Time moment, NiChangesPerBand::iterator niIt);
+    /**
+     * Returns an iterator to the first NiChange that occurs at moment
+     *
+     * \param moment time to check from
+     * \param niChanges the NiChanges of the band to check
+     * \returns an iterator to the NiChanges, or the end of the NiChanges if none occurs at moment
+     */
+    NiChanges::const_iterator FindNiChange(Time moment, const NiChanges& niChanges) const;
 
     /**
      * Add NiChange to the list at the appropriate position and
@@ -55,12 +55,14 @@ TableBasedErrorRateModel::GetTypeId()
                           "Ptr to the fallback error rate model to be used when no matching value "
                           "is found in a table",
                           PointerValue(CreateObject<YansErrorRateModel>()),
-                          MakePointerAccessor(&TableBasedErrorRateModel::m_fallbackErrorModel),
+                          MakePointerAccessor(&TableBasedErrorRateModel::SetFallbackErrorRateModel,
+                                              &TableBasedErrorRateModel::GetFallbackErrorRateModel),
                           MakePointerChecker<ErrorRateModel>())
             .AddAttribute("SizeThreshold",
                           "Threshold in bytes over which the table for large size frames is used",
                           UintegerValue(400),
-                          MakeUintegerAccessor(&TableBasedErrorRateModel::m_threshold),
+                          MakeUintegerAccessor(&TableBasedErrorRateModel::SetSizeThreshold,
+                                               &TableBasedErrorRateModel::GetSizeThreshold),
                           MakeUintegerChecker<uint64_t>());
     return tid;
 }
@@ -76,6 +78,34 @@ TableBasedErrorRateModel::~TableBasedErrorRateModel()
     m_fallbackErrorModel = nullptr;
 }
 
+void
+TableBasedErrorRateModel::SetFallbackErrorRateModel(Ptr<ErrorRateModel> model)
+{
+    NS_LOG_FUNCTION(this << model);
+    m_fallbackErrorModel = model;
+    ClearCache();
+}
+
+Ptr<ErrorRateModel>
+TableBasedErrorRateModel::GetFallbackErrorRateModel() const
+{
+    return m_fallbackErrorModel;
+}
+
+void
+TableBasedErrorRateModel::SetSizeThreshold(uint64_t threshold)
+{
+    NS_LOG_FUNCTION(this << threshold);
+    m_threshold = threshold;
+    ClearCache();
+}
+
+uint64_t
+TableBasedErrorRateModel::GetSizeThreshold() const
+{
+    return m_threshold;
+}
+
 double
 TableBasedErrorRateModel::RoundSnr(double snr, double precision) const
 {
@@ -66,6 +66,31 @@ class TableBasedErrorRateModel : public ErrorRateModel
                                  WifiPpduField field,
                                  uint16_t staId) const override;
 
+    /**
+     * Set the error rate model to fallback to and clear the cache of chunk success rates.
+     *
+     * \param model the fallback error rate model
+     */
+    void SetFallbackErrorRateModel(Ptr<ErrorRateModel> model);
+
+    /**
+     * \return the error rate model to fallback to
+     */
+    Ptr<ErrorRateModel> GetFallbackErrorRateModel() const;
+
+    /**
+     * Set the threshold over which the table for large size frames is used and clear the
+     * cache of chunk success rates.
+     *
+     * \param threshold the threshold in bytes
+     */
+    void SetSizeThreshold(uint64_t threshold);
+
+    /**
+     * \return the threshold in bytes over which the table for large size frames is used
+     */
+    uint64_t GetSizeThreshold() const;
+
     /**
      * Round SNR (in dB) to the specified precision
      *
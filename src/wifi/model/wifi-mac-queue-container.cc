@@ -25,8 +25,6 @@
 #include "ns3/mac48-address.h"
 #include "ns3/simulator.h"
 
-#include <vector>
-
 namespace ns3
 {
 
@@ -43,14 +41,16 @@ WifiMacQueueContainer::insert(const_iterator pos, Ptr<WifiMpdu> item)
 {
     WifiContainerQueueId queueId = GetQueueId(item);
 
-    NS_ABORT_MSG_UNLESS(pos == m_queues[queueId].cend() || GetQueueId(pos->mpdu) == queueId,
+    auto& queue = m_queues[queueId];
+
+    NS_ABORT_MSG_UNLESS(pos == queue.cend() || GetQueueId(pos->mpdu) == queueId,
                         "pos iterator does not point to the correct container queue");
     NS_ABORT_MSG_IF(!item->IsOriginal(), "Only the original copy of an MPDU can be inserted");
 
     auto [it, ret] = m_nBytesPerQueue.insert({queueId, 0});
     it->second += item->GetSize();
 
-    return m_queues[queueId].emplace(pos, item);
+    return queue.emplace(pos, item);
 }
 
 WifiMacQueueContainer::iterator
@@ -209,16 +209,21 @@ std::size_t
 std::hash<ns3::WifiContainerQueueId>::operator()(ns3::WifiContainerQueueId queueId) const
 {
     auto [type, addrType, address, tid] = queueId;
-    const std::size_t size = tid.has_value() ? 8 : 7;
 
-    std::vector<uint8_t> buffer(size);
-    buffer[0] = type;
-    address.CopyTo(&buffer[1]);
-    if (tid.has_value())
+    // pack the queue ID in a 64-bit word (48 bits for the address, 8 bits for the TID,
+    // 1 bit for the presence of the TID, 2 bits for the queue type and 1 bit for the
+    // receiver address type), which avoids allocating a buffer on every lookup
+    uint8_t buffer[6];
+    address.CopyTo(buffer);
+    uint64_t key = 0;
+    for (auto byte : buffer)
     {
-        buffer[7] = *tid;
+        key = (key << 8) | byte;
     }
+    key |= static_cast<uint64_t>(tid.value_or(0)) << 48;
+    key |= static_cast<uint64_t>(tid.has_value()) << 56;
+    key |= static_cast<uint64_t>(type) << 57;
+    key |= static_cast<uint64_t>(addrType) << 59;
 
-    std::string s(buffer.begin(), buffer.end());
-    return std::hash<std::string>{}(s);
+    return std::hash<uint64_t>{}(key);
 }
@@ -21,6 +21,7 @@
 #define WIFI_MAC_QUEUE_CONTAINER_H
 
 #include "wifi-mac-queue-elem.h"
+#include "wifi-slab-allocator.h"
 
 #include "ns3/mac48-address.h"
 
@@ -113,8 +114,8 @@ namespace ns3
 class WifiMacQueueContainer
 {
   public:
-    /// Type of a queue held by the container
-    using ContainerQueue = std::list<WifiMacQueueElem>;
+    /// Type of a queue held by the container (elements are allocated from a slab pool)
+    using ContainerQueue = std::list<WifiMacQueueElem, WifiSlabAllocator<WifiMacQueueElem>>;
     /// iterator over elements in a container queue
     using iterator = ContainerQueue::iterator;
     /// const iterator over elements in a container queue
@@ -285,7 +285,8 @@ WifiMacQueue::DequeueIfQueued(const std::list<Ptr<const WifiMpdu>>& mpdus)
 {
     NS_LOG_FUNCTION(this);
 
-    std::list<ConstIterator> iterators;
+    std::vector<ConstIterator> iterators;
+    iterators.reserve(mpdus.size());
 
     for (const auto& mpdu : mpdus)
     {
@@ -503,7 +504,7 @@ WifiMacQueue::DoEnqueue(ConstIterator pos, Ptr<WifiMpdu> item)
 }
 
 void
-WifiMacQueue::DoDequeue(const std::list<ConstIterator>& iterators)
+WifiMacQueue::DoDequeue(const std::vector<ConstIterator>& iterators)
 {
     NS_LOG_FUNCTION(this);
 
@@ -32,6 +32,7 @@
 #include <functional>
 #include <optional>
 #include <unordered_map>
+#include <vector>
 
 namespace ns3
 {
@@ -336,7 +337,7 @@ class WifiMacQueue : public Queue<WifiMpdu, ns3::WifiMacQueueContainer>
      *
      * \param iterators the list of iterators pointing to the items to dequeue
      */
-    void DoDequeue(const std::list<ConstIterator>& iterators);
+    void DoDequeue(const std::vector<ConstIterator>& iterators);
     /**
      * Wrapper for the DoRemove method provided by the base class that additionally
      * resets the iterator field of the item and notifies the scheduleer, if an
@@ -26,6 +26,7 @@
 #include "amsdu-subframe-header.h"
 #include "wifi-mac-header.h"
 #include "wifi-mac-queue-elem.h"
+#include "wifi-slab-allocator.h"
 
 #include "ns3/packet.h"
 #include "ns3/simulator.h"
@@ -158,7 +159,7 @@ class WifiMpdu : public SimpleRefCount<WifiMpdu>
     DeaggregatedMsdusCI end() const;
 
     /// Const iterator typedef
-    typedef std::list<WifiMacQueueElem>::iterator Iterator;
+    typedef std::list<WifiMacQueueElem, WifiSlabAllocator<WifiMacQueueElem>>::iterator Iterator;
 
     /**
      * Set the queue iterator stored by this object.
@@ -0,0 +1,188 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef WIFI_SLAB_ALLOCATOR_H
+#define WIFI_SLAB_ALLOCATOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup wifi
+ * Pool of fixed-size blocks carved out of large contiguous slabs.
+ *
+ * Released blocks are kept in a free list and handed out again (most recently
+ * released first), so that the blocks used by a queue that is repeatedly filled
+ * and drained stay in the same few slabs. Slabs are never returned to the system.
+ *
+ * \tparam Size the size of the blocks
+ * \tparam Align the alignment of the blocks
+ */
+template <std::size_t Size, std::size_t Align>
+class WifiSlabPool
+{
+  public:
+    WifiSlabPool() = default;
+    WifiSlabPool(const WifiSlabPool&) = delete;
+    WifiSlabPool& operator=(const WifiSlabPool&) = delete;
+
+    /**
+     * \return a block of Size bytes aligned to Align
+     */
+    void* Allocate()
+    {
+        if (m_freeList == nullptr)
+        {
+            AddSlab();
+        }
+        auto block = m_freeList;
+        m_freeList = block->next;
+        return block;
+    }
+
+    /**
+     * Release a block previously returned by Allocate().
+     *
+     * \param p the block to release
+     */
+    void Deallocate(void* p)
+    {
+        auto block = static_cast<FreeBlock*>(p);
+        block->next = m_freeList;
+        m_freeList = block;
+    }
+
+  private:
+    /// A block that is not in use
+    struct FreeBlock
+    {
+        FreeBlock* next; //!< the next block in the free list
+    };
+
+    /// size of the blocks, large enough to link them in the free list
+    static constexpr std::size_t BLOCK_SIZE =
+        (std::max(Size, sizeof(FreeBlock)) + Align - 1) / Align * Align;
+    /// number of blocks in a slab
+    static constexpr std::size_t BLOCKS_PER_SLAB = std::max<std::size_t>(64, 16384 / BLOCK_SIZE);
+
+    /**
+     * Allocate a new slab and add its blocks to the free list, in increasing order of address.
+     */
+    void AddSlab()
+    {
+        auto slab = static_cast<std::byte*>(
+            ::operator new(BLOCK_SIZE * BLOCKS_PER_SLAB, std::align_val_t{Align}));
+        m_slabs.push_back(slab);
+        for (std::size_t i = BLOCKS_PER_SLAB; i > 0; --i)
+        {
+            auto block = reinterpret_cast<FreeBlock*>(slab + (i - 1) * BLOCK_SIZE);
+            block->next = m_freeList;
+            m_freeList = block;
+        }
+    }
+
+    std::vector<std::byte*> m_slabs; //!< the allocated slabs
+    FreeBlock* m_freeList{nullptr};  //!< the blocks that are not in use
+};
+
+/**
+ * \ingroup wifi
+ * Stateless allocator serving single objects from a WifiSlabPool.
+ *
+ * It is meant for node-based containers (such as std::list) that hold many
+ * small elements and are frequently updated, e.g., the container queues of the
+ * WifiMacQueue: it keeps the nodes of such containers close in memory and
+ * avoids a call to the global allocator for each insertion and removal, while
+ * preserving the stability of the iterators. All the instances of this allocator
+ * compare equal, hence elements can be spliced between containers using it.
+ * Each thread has its own pool, hence a container using this allocator must only
+ * be accessed by the thread that created it.
+ *
+ * \tparam T the type of the allocated objects
+ */
+template <class T>
+class WifiSlabAllocator
+{
+  public:
+    using value_type = T; //!< the type of the allocated objects
+
+    WifiSlabAllocator() noexcept = default;
+
+    /**
+     * Converting constructor, needed to rebind the allocator to the node type
+     * of a container.
+     */
+    template <class U>
+    WifiSlabAllocator(const WifiSlabAllocator<U>& /* other */) noexcept
+    {
+    }
+
+    /**
+     * \param n the number of objects to allocate
+     * \return a pointer to the storage for the given number of objects
+     */
+    T* allocate(std::size_t n)
+    {
+        if (n != 1)
+        {
+            return std::allocator<T>{}.allocate(n);
+        }
+        return static_cast<T*>(GetPool().Allocate());
+    }
+
+    /**
+     * \param p a pointer returned by allocate()
+     * \param n the number of objects passed to allocate()
+     */
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+        if (n != 1)
+        {
+            std::allocator<T>{}.deallocate(p, n);
+            return;
+        }
+        GetPool().Deallocate(p);
+    }
+
+  private:
+    /// \return the pool of the calling thread
+    static WifiSlabPool<sizeof(T), alignof(T)>& GetPool()
+    {
+        // the pool is never destroyed, because containers with static storage duration
+        // may release their elements after the thread-local objects are destroyed
+        thread_local auto pool = new WifiSlabPool<sizeof(T), alignof(T)>;
+        return *pool;
+    }
+};
+
+/**
+ * \return true, as all the slab allocators can release each other's objects
+ */
+template <class T, class U>
+bool
+operator==(const WifiSlabAllocator<T>&, const WifiSlabAllocator<U>&) noexcept
+{
+    return true;
+}
+
+} // namespace ns3
+
+#endif /* WIFI_SLAB_ALLOCATOR_H */
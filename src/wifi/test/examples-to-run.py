@@ -2183,6 +2183,8 @@ cpp_examples = [
         "False",
         "False",
     ),  # TODO: run from N=5 to N=50 for 600s (TAKES_FOREVER) when issue #170 is fixed
+    ("wifi-mac-queue-benchmark --nStations=10 --nMpdus=10000", "True", "False"),
+    ("wifi-interference-helper-benchmark --nReceptions=100", "True", "False"),
 ]
 
 # A list of Python examples to run in order to ensure that they remain
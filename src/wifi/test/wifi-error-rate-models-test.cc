@@ -25,13 +25,17 @@
 #include <gsl/gsl_sf_bessel.h>
 #endif
 
+#include "ns3/double.h"
 #include "ns3/dsss-error-rate-model.h"
+#include "ns3/dsss-phy.h"
 #include "ns3/he-phy.h" //includes HT and VHT
 #include "ns3/interference-helper.h"
 #include "ns3/log.h"
 #include "ns3/nist-error-rate-model.h"
+#include "ns3/object-factory.h"
 #include "ns3/table-based-error-rate-model.h"
 #include "ns3/test.h"
+#include "ns3/uinteger.h"
 #include "ns3/wifi-phy.h"
 #include "ns3/wifi-utils.h"
 #include "ns3/yans-error-rate-model.h"
@@ -1038,6 +1042,194 @@ TableBasedErrorRateTestCase::DoRun()
     }
 }
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Wifi Error Rate Models Test Case for the cache of chunk success rates
+ */
+class WifiErrorRateModelsCacheTestCase : public TestCase
+{
+  public:
+    WifiErrorRateModelsCacheTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Check the chunk success rates returned by an error rate model using the cache
+     * against those returned by the same model not using the cache.
+     *
+     * \param cached the error rate model using the cache
+     * \param uncached the error rate model not using the cache
+     */
+    void CheckModel(Ptr<ErrorRateModel> cached, Ptr<ErrorRateModel> uncached);
+};
+
+WifiErrorRateModelsCacheTestCase::WifiErrorRateModelsCacheTestCase()
+    : TestCase("WifiErrorRateModel test case for the cache of chunk success rates")
+{
+}
+
+void
+WifiErrorRateModelsCacheTestCase::CheckModel(Ptr<ErrorRateModel> cached,
+                                             Ptr<ErrorRateModel> uncached)
+{
+    const std::vector<WifiMode> modes{DsssPhy::GetDsssRate11Mbps(),
+                                      OfdmPhy::GetOfdmRate6Mbps(),
+                                      HtPhy::GetHtMcs3(),
+                                      VhtPhy::GetVhtMcs8(),
+                                      HePhy::GetHeMcs11()};
+    const std::vector<uint64_t> sizes{8, 1000 * 8, 1500 * 8};
+    uint64_t lookups = 0;
+    for (uint8_t pass = 0; pass < 2; ++pass)
+    {
+        for (const auto& mode : modes)
+        {
+            // the chunks sent over different channel widths are looked up one after the
+            // other, hence they would share the cache entries if the width were not in the key
+            std::vector<WifiTxVector> txVectors;
+            for (uint16_t width : {20, 40, 80, 160})
+            {
+                if ((mode.GetModulationClass() < WIFI_MOD_CLASS_HT && width > 20) ||
+                    (mode.GetModulationClass() == WIFI_MOD_CLASS_HT && width > 40))
+                {
+                    continue;
+                }
+                for (bool ldpc : {false, true})
+                {
+                    WifiTxVector txVector;
+                    txVector.SetMode(mode);
+                    txVector.SetChannelWidth(width);
+                    txVector.SetLdpc(ldpc);
+                    txVectors.push_back(txVector);
+                }
+            }
+            for (const auto& txVector : txVectors)
+            {
+                for (double snrDb = -2; snrDb <= 30; snrDb += 0.5)
+                {
+                    const auto snr = DbToRatio(snrDb);
+                    for (auto nbits : sizes)
+                    {
+                        NS_TEST_EXPECT_MSG_EQ(
+                            cached->GetChunkSuccessRate(mode, txVector, snr, nbits),
+                            uncached->GetChunkSuccessRate(mode, txVector, snr, nbits),
+                            "Unexpected success rate for mode "
+                                << mode << ", " << txVector.GetChannelWidth() << " MHz, SNR "
+                                << snrDb << " dB, " << nbits << " bits");
+                        ++lookups;
+                    }
+                    // a batch of chunks is successful if all the chunks are successful
+                    std::vector<ErrorRateModel::Chunk> chunks{{snr, 8},
+                                                              {snr * 2, 1000 * 8},
+                                                              {snr, 1500 * 8}};
+                    double expected = 1.0;
+                    for (const auto& chunk : chunks)
+                    {
+                        expected *=
+                            uncached->GetChunkSuccessRate(mode, txVector, chunk.snr, chunk.nbits);
+                    }
+                    const auto batchLookups = cached->GetCacheHits() + cached->GetCacheMisses();
+                    NS_TEST_EXPECT_MSG_EQ(cached->GetChunksSuccessRate(mode, txVector, chunks),
+                                          expected,
+                                          "Unexpected success rate for a batch of chunks");
+                    lookups += cached->GetCacheHits() + cached->GetCacheMisses() - batchLookups;
+                }
+            }
+        }
+
+        // the users of a MU PPDU are assigned RUs of different sizes, hence their chunks
+        // have different PHY rates
+        WifiTxVector txVector;
+        txVector.SetPreambleType(WIFI_PREAMBLE_HE_MU);
+        txVector.SetChannelWidth(80);
+        txVector.SetHeMuUserInfo(1, {{HeRu::RU_26_TONE, 1, true}, 5, 1});
+        txVector.SetHeMuUserInfo(2, {{HeRu::RU_242_TONE, 2, true}, 5, 1});
+        txVector.SetHeMuUserInfo(3, {{HeRu::RU_484_TONE, 2, true}, 5, 2});
+        const auto sigBMode = VhtPhy::GetVhtMcs0();
+        for (double snrDb = 0; snrDb <= 30; snrDb += 0.5)
+        {
+            const auto snr = DbToRatio(snrDb);
+            for (uint16_t staId : {1, 2, 3})
+            {
+                const auto mode = txVector.GetMode(staId);
+                NS_TEST_EXPECT_MSG_EQ(
+                    cached->GetChunkSuccessRate(mode, txVector, snr, 8000, 1,
+                                                WIFI_PPDU_FIELD_DATA, staId),
+                    uncached->GetChunkSuccessRate(mode, txVector, snr, 8000, 1,
+                                                  WIFI_PPDU_FIELD_DATA, staId),
+                    "Unexpected success rate for STA " << staId << ", SNR " << snrDb << " dB");
+                ++lookups;
+            }
+            // the HE-SIG-B field is not addressed to a given user
+            NS_TEST_EXPECT_MSG_EQ(
+                cached->GetChunkSuccessRate(sigBMode, txVector, snr, 8000, 1,
+                                            WIFI_PPDU_FIELD_SIG_B),
+                uncached->GetChunkSuccessRate(sigBMode, txVector, snr, 8000, 1,
+                                              WIFI_PPDU_FIELD_SIG_B),
+                "Unexpected success rate for HE-SIG-B, SNR " << snrDb << " dB");
+            ++lookups;
+        }
+    }
+    NS_TEST_EXPECT_MSG_EQ(cached->GetCacheHits() + cached->GetCacheMisses(),
+                          lookups,
+                          "Unexpected number of cache lookups");
+    // the second pass looks up the chunks of the first pass, most of which are still cached
+    NS_TEST_EXPECT_MSG_GT(cached->GetCacheHits(), lookups / 4, "Too few cache hits");
+    NS_TEST_EXPECT_MSG_EQ(uncached->GetCacheHits() + uncached->GetCacheMisses(),
+                          0,
+                          "The cache should be disabled");
+}
+
+void
+WifiErrorRateModelsCacheTestCase::DoRun()
+{
+    CheckModel(CreateObjectWithAttributes<NistErrorRateModel>("CacheSize", UintegerValue(16384)),
+               CreateObjectWithAttributes<NistErrorRateModel>("CacheSize", UintegerValue(0)));
+    CheckModel(CreateObjectWithAttributes<YansErrorRateModel>("CacheSize", UintegerValue(16384)),
+               CreateObjectWithAttributes<YansErrorRateModel>("CacheSize", UintegerValue(0)));
+    CheckModel(
+        CreateObjectWithAttributes<TableBasedErrorRateModel>("CacheSize", UintegerValue(16384)),
+        CreateObjectWithAttributes<TableBasedErrorRateModel>("CacheSize", UintegerValue(0)));
+
+    // with a SNR resolution, the success rate is computed for the rounded SNR
+    auto quantized = CreateObjectWithAttributes<NistErrorRateModel>("CacheSize",
+                                                                    UintegerValue(256),
+                                                                    "CacheSnrResolution",
+                                                                    DoubleValue(0.5));
+    auto nist = CreateObjectWithAttributes<NistErrorRateModel>("CacheSize", UintegerValue(0));
+    WifiTxVector txVector;
+    txVector.SetMode(OfdmPhy::GetOfdmRate24Mbps());
+    for (double snrDb = 0; snrDb <= 20; snrDb += 0.1)
+    {
+        const auto roundedSnrDb = std::round(snrDb * 2) / 2;
+        NS_TEST_EXPECT_MSG_EQ(
+            quantized->GetChunkSuccessRate(txVector.GetMode(), txVector, DbToRatio(snrDb), 8000),
+            nist->GetChunkSuccessRate(txVector.GetMode(),
+                                      txVector,
+                                      DbToRatio(roundedSnrDb),
+                                      8000),
+            "Unexpected success rate for SNR " << snrDb << " dB");
+    }
+    NS_TEST_EXPECT_MSG_EQ(quantized->GetCacheMisses(), 41, "Unexpected number of cache misses");
+
+    // changing an attribute of the model must not return the cached success rates
+    auto table =
+        CreateObjectWithAttributes<TableBasedErrorRateModel>("CacheSize", UintegerValue(256));
+    auto smallFrames =
+        CreateObjectWithAttributes<TableBasedErrorRateModel>("SizeThreshold", UintegerValue(2000));
+    const auto snr = DbToRatio(9.0);
+    const auto largeFrameSr = table->GetChunkSuccessRate(txVector.GetMode(), txVector, snr, 8000);
+    table->SetAttribute("SizeThreshold", UintegerValue(2000));
+    const auto smallFrameSr = table->GetChunkSuccessRate(txVector.GetMode(), txVector, snr, 8000);
+    NS_TEST_EXPECT_MSG_EQ(
+        smallFrameSr,
+        smallFrames->GetChunkSuccessRate(txVector.GetMode(), txVector, snr, 8000),
+        "Success rate not recomputed after changing the size threshold");
+    NS_TEST_EXPECT_MSG_NE(largeFrameSr, smallFrameSr, "The size threshold should matter");
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -1056,6 +1248,7 @@ WifiErrorRateModelsTestSuite::WifiErrorRateModelsTestSuite()
     AddTestCase(new WifiErrorRateModelsTestCaseDsss, TestCase::Duration::QUICK);
     AddTestCase(new WifiErrorRateModelsTestCaseNist, TestCase::Duration::QUICK);
     AddTestCase(new WifiErrorRateModelsTestCaseMimo, TestCase::Duration::QUICK);
+    AddTestCase(new WifiErrorRateModelsCacheTestCase, TestCase::Duration::QUICK);
     AddTestCase(new TableBasedErrorRateTestCase("DefaultTableBasedHtMcs0-1458bytes",
                                                 HtPhy::GetHtMcs0(),
                                                 1458),
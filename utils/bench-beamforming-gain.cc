@@ -0,0 +1,188 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/antenna-module.h"
+#include "ns3/core-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/network-module.h"
+#include "ns3/propagation-module.h"
+#include "ns3/spectrum-module.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+using namespace ns3;
+
+/**
+ * Benchmark instance for one size of the antenna array of the transmitter.
+ *
+ * The transmitter and the receiver are two nodes with a UniformPlanarArray, whose
+ * 3GPP channel is generated once. Each evaluation computes the received PSD of a
+ * transmission with ThreeGppSpectrumPropagationLossModel, i.e. the beamforming gain
+ * of every RB. If the beams change at every evaluation, the long term component of
+ * the channel is recomputed too.
+ */
+class Bench
+{
+  public:
+    /**
+     * Constructor
+     * \param txRows the number of rows of the transmitter array
+     * \param txCols the number of columns of the transmitter array
+     * \param rxRows the number of rows of the receiver array
+     * \param rxCols the number of columns of the receiver array
+     * \param numRb the number of RBs of the transmitted PSD
+     */
+    Bench(uint32_t txRows, uint32_t txCols, uint32_t rxRows, uint32_t rxCols, uint32_t numRb);
+
+    /**
+     * Run the evaluations.
+     * \param evaluations the number of evaluations
+     * \param changeBeams whether to switch the beams of both arrays before each evaluation
+     * \returns the number of evaluations per second
+     */
+    double Run(uint32_t evaluations, bool changeBeams);
+
+  private:
+    Ptr<ThreeGppSpectrumPropagationLossModel> m_lossModel; //!< The model under test
+    Ptr<MobilityModel> m_txMob;                            //!< Transmitter mobility
+    Ptr<MobilityModel> m_rxMob;                            //!< Receiver mobility
+    Ptr<PhasedArrayModel> m_txAntenna;                     //!< Transmitter array
+    Ptr<PhasedArrayModel> m_rxAntenna;                     //!< Receiver array
+    PhasedArrayModel::ComplexVector m_txBeams[2];          //!< Alternative transmitter beams
+    PhasedArrayModel::ComplexVector m_rxBeams[2];          //!< Alternative receiver beams
+    Ptr<SpectrumSignalParameters> m_txParams;              //!< The transmission
+};
+
+Bench::Bench(uint32_t txRows, uint32_t txCols, uint32_t rxRows, uint32_t rxCols, uint32_t numRb)
+{
+    m_lossModel = CreateObject<ThreeGppSpectrumPropagationLossModel>();
+    m_lossModel->SetChannelModelAttribute("Frequency", DoubleValue(28e9));
+    m_lossModel->SetChannelModelAttribute("Scenario", StringValue("UMa"));
+    m_lossModel->SetChannelModelAttribute(
+        "ChannelConditionModel",
+        PointerValue(CreateObject<NeverLosChannelConditionModel>()));
+
+    NodeContainer nodes;
+    nodes.Create(2);
+    m_txMob = CreateObject<ConstantPositionMobilityModel>();
+    m_txMob->SetPosition(Vector(0.0, 0.0, 25.0));
+    nodes.Get(0)->AggregateObject(m_txMob);
+    m_rxMob = CreateObject<ConstantPositionMobilityModel>();
+    m_rxMob->SetPosition(Vector(100.0, 50.0, 1.5));
+    nodes.Get(1)->AggregateObject(m_rxMob);
+
+    m_txAntenna = CreateObjectWithAttributes<UniformPlanarArray>("NumRows",
+                                                                 UintegerValue(txRows),
+                                                                 "NumColumns",
+                                                                 UintegerValue(txCols));
+    m_rxAntenna = CreateObjectWithAttributes<UniformPlanarArray>("NumRows",
+                                                                 UintegerValue(rxRows),
+                                                                 "NumColumns",
+                                                                 UintegerValue(rxCols));
+
+    // One beam towards the other node, and one slightly off
+    Angles txAngles(m_rxMob->GetPosition(), m_txMob->GetPosition());
+    Angles rxAngles(m_txMob->GetPosition(), m_rxMob->GetPosition());
+    for (uint32_t i = 0; i < 2; ++i)
+    {
+        m_txBeams[i] = m_txAntenna->GetBeamformingVector(
+            Angles(txAngles.GetAzimuth() + 0.1 * i, txAngles.GetInclination()));
+        m_rxBeams[i] = m_rxAntenna->GetBeamformingVector(
+            Angles(rxAngles.GetAzimuth() + 0.1 * i, rxAngles.GetInclination()));
+    }
+    m_txAntenna->SetBeamformingVector(m_txBeams[0]);
+    m_rxAntenna->SetBeamformingVector(m_rxBeams[0]);
+
+    // 30 kHz subcarrier spacing, 12 subcarriers per RB
+    const double rbWidth = 12 * 30e3;
+    const double firstRb = 28e9 - numRb * rbWidth / 2;
+    Bands bands;
+    for (uint32_t rb = 0; rb < numRb; ++rb)
+    {
+        BandInfo band;
+        band.fl = firstRb + rb * rbWidth;
+        band.fc = band.fl + rbWidth / 2;
+        band.fh = band.fl + rbWidth;
+        bands.push_back(band);
+    }
+    m_txParams = Create<SpectrumSignalParameters>();
+    m_txParams->psd = Create<SpectrumValue>(Create<SpectrumModel>(bands));
+    *m_txParams->psd = 1e-9;
+}
+
+double
+Bench::Run(uint32_t evaluations, bool changeBeams)
+{
+    double sum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < evaluations; ++i)
+    {
+        if (changeBeams)
+        {
+            m_txAntenna->SetBeamformingVector(m_txBeams[i % 2]);
+            m_rxAntenna->SetBeamformingVector(m_rxBeams[i % 2]);
+        }
+        Ptr<SpectrumSignalParameters> rxParams =
+            m_lossModel->CalcRxPowerSpectralDensity(m_txParams,
+                                                    m_txMob,
+                                                    m_rxMob,
+                                                    m_txAntenna,
+                                                    m_rxAntenna);
+        sum += Sum(*rxParams->psd);
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    // Keep the compiler from optimizing the evaluations away
+    NS_ABORT_MSG_IF(sum < 0, "Negative received power");
+    return evaluations / elapsed.count();
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t evaluations = 1000;
+    uint32_t numRb = 273;
+    uint32_t rxRows = 2;
+    uint32_t rxCols = 2;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark the beamforming gain of ThreeGppSpectrumPropagationLossModel.\n"
+              "\n"
+              "Prints the gain evaluations per second for a transmitter with\n"
+              "64 and 256 antenna elements, with fixed beams and with beams\n"
+              "that change at every evaluation.");
+    cmd.AddValue("evaluations", "number of evaluations per run", evaluations);
+    cmd.AddValue("rb", "number of RBs of the transmitted PSD", numRb);
+    cmd.AddValue("rxRows", "number of rows of the receiver array", rxRows);
+    cmd.AddValue("rxCols", "number of columns of the receiver array", rxCols);
+    cmd.Parse(argc, argv);
+
+    std::cout << std::left << std::setw(10) << "elements" << std::setw(16) << "fixed beams/s"
+              << "changing beams/s" << std::endl;
+    for (uint32_t side : {8, 16})
+    {
+        Bench bench(side, side, rxRows, rxCols, numRb);
+        // Generate the channel and the long term component before measuring
+        bench.Run(1, false);
+        double fixed = bench.Run(evaluations, false);
+        double changing = bench.Run(evaluations, true);
+        std::cout << std::left << std::setw(10) << side * side << std::setw(16) << fixed
+                  << changing << std::endl;
+    }
+
+    Simulator::Destroy();
+    return 0;
+}
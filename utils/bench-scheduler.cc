@@ -387,24 +387,87 @@ BenchSuite::Log() const
 
 } // BenchSuite::Log()
 
+/**
+ *  Create a delay trace resembling a slotted PHY/MAC simulation.
+ *
+ *  Most events land on the next few slot boundaries of 125 us,
+ *  so many events share the same time stamp; the others are
+ *  short processing delays within the slot.
+ *
+ *  \returns The RandomVariableStream.
+ */
+Ptr<RandomVariableStream>
+GetSlottedStream()
+{
+    const double slot = 125000;
+    auto slots = CreateObject<UniformRandomVariable>();
+    auto offset = CreateObject<ExponentialRandomVariable>();
+    offset->SetAttribute("Mean", DoubleValue(2000));
+
+    std::vector<double> nsValues(1 << 20);
+    for (auto& value : nsValues)
+    {
+        if (slots->GetValue() < 0.8)
+        {
+            value = slot * slots->GetInteger(1, 4);
+        }
+        else
+        {
+            value = std::round(offset->GetValue());
+        }
+    }
+    auto drv = CreateObject<DeterministicRandomVariable>();
+    drv->SetValueArray(nsValues);
+    return drv;
+}
+
 /**
  *  Create a RandomVariableStream to generate next event delays.
  *
- *  If the \p filename parameter is empty a default exponential time
- *  distribution will be used, with mean delay of 100 ns.
+ *  If the \p filename parameter is empty the \p dist distribution
+ *  will be used:
+ *  - `exp`: exponential, with mean delay of 100 ns (default),
+ *  - `slotted`: slot boundaries and short delays, see GetSlottedStream(),
+ *  - `bimodal`: 90% exponential with mean 100 ns, 10% with mean 10 ms,
+ *    mixing per-packet events with long timers.
  *
  *  If the \p filename is `-` standard input will be used.
  *
  *  \param [in] filename The delay interval source file name.
+ *  \param [in] dist The delay distribution, if no file is given.
  *  \returns The RandomVariableStream.
  */
 Ptr<RandomVariableStream>
-GetRandomStream(std::string filename)
+GetRandomStream(std::string filename, std::string dist)
 {
     Ptr<RandomVariableStream> stream = nullptr;
 
-    if (filename.empty())
+    if (filename.empty() && dist == "slotted")
+    {
+        LOG("  Event time distribution:      slotted");
+        stream = GetSlottedStream();
+    }
+    else if (filename.empty() && dist == "bimodal")
+    {
+        LOG("  Event time distribution:      bimodal exponential");
+        auto choice = CreateObject<UniformRandomVariable>();
+        auto shortDelay = CreateObject<ExponentialRandomVariable>();
+        shortDelay->SetAttribute("Mean", DoubleValue(100));
+        auto longDelay = CreateObject<ExponentialRandomVariable>();
+        longDelay->SetAttribute("Mean", DoubleValue(10000000));
+
+        std::vector<double> nsValues(1 << 20);
+        for (auto& value : nsValues)
+        {
+            value = choice->GetValue() < 0.9 ? shortDelay->GetValue() : longDelay->GetValue();
+        }
+        auto drv = CreateObject<DeterministicRandomVariable>();
+        drv->SetValueArray(nsValues);
+        stream = drv;
+    }
+    else if (filename.empty())
     {
+        NS_ABORT_MSG_UNLESS(dist == "exp", "Unknown event time distribution " << dist);
         LOG("  Event time distribution:      default exponential");
         auto erv = CreateObject<ExponentialRandomVariable>();
         erv->SetAttribute("Mean", DoubleValue(100));
@@ -457,6 +520,7 @@ main(int argc, char* argv[])
     bool allSched = false;
     bool schedCal = false;
     bool schedHeap = false;
+    bool schedLadder = false;
     bool schedList = false;
     bool schedMap = false; // default scheduler
     bool schedPQ = false;
@@ -465,6 +529,7 @@ main(int argc, char* argv[])
     uint64_t total = 1000000;
     uint64_t runs = 1;
     std::string filename = "";
+    std::string dist = "exp";
     bool calRev = false;
 
     CommandLine cmd(__FILE__);
@@ -472,6 +537,7 @@ main(int argc, char* argv[])
               "\n"
               "Event intervals are taken from one of:\n"
               "  an exponential distribution, with mean 100 ns,\n"
+              "  a slotted or bimodal distribution, given by --dist,\n"
               "  an ascii file, given by the --file=\"<filename>\" argument,\n"
               "  or standard input, by the argument --file=\"-\"\n"
               "In the case of either --file form, the input is expected\n"
@@ -482,6 +548,7 @@ main(int argc, char* argv[])
     cmd.AddValue("cal", "use CalendarScheduler", schedCal);
     cmd.AddValue("calrev", "reverse ordering in the CalendarScheduler", calRev);
     cmd.AddValue("heap", "use HeapScheduler", schedHeap);
+    cmd.AddValue("ladder", "use LadderScheduler", schedLadder);
     cmd.AddValue("list", "use ListScheduler", schedList);
     cmd.AddValue("map", "use MapScheduler (default)", schedMap);
     cmd.AddValue("pri", "use PriorityQueue", schedPQ);
@@ -490,6 +557,7 @@ main(int argc, char* argv[])
     cmd.AddValue("total", "total number of events to run", total);
     cmd.AddValue("runs", "number of runs", runs);
     cmd.AddValue("file", "file of relative event times", filename);
+    cmd.AddValue("dist", "event time distribution: exp, slotted or bimodal", dist);
     cmd.AddValue("prec", "printed output precision", g_fwidth);
     cmd.Parse(argc, argv);
 
@@ -505,15 +573,15 @@ main(int argc, char* argv[])
 
     if (allSched)
     {
-        schedCal = schedHeap = schedList = schedMap = schedPQ = true;
+        schedCal = schedHeap = schedLadder = schedList = schedMap = schedPQ = true;
     }
     // Set the default case if nothing else is set
-    if (!(schedCal || schedHeap || schedList || schedMap || schedPQ))
+    if (!(schedCal || schedHeap || schedLadder || schedList || schedMap || schedPQ))
     {
         schedMap = true;
     }
 
-    auto eventStream = GetRandomStream(filename);
+    auto eventStream = GetRandomStream(filename, dist);
 
     ObjectFactory factory("ns3::MapScheduler");
     if (schedCal)
@@ -532,6 +600,11 @@ main(int argc, char* argv[])
         factory.SetTypeId("ns3::HeapScheduler");
         BenchSuite(factory, pop, total, runs, eventStream, calRev).Log();
     }
+    if (schedLadder)
+    {
+        factory.SetTypeId("ns3::LadderScheduler");
+        BenchSuite(factory, pop, total, runs, eventStream, calRev).Log();
+    }
     if (schedList)
     {
         factory.SetTypeId("ns3::ListScheduler");